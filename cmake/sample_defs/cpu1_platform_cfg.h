@@ -144,6 +144,58 @@
 #define CFE_PLATFORM_SB_MAX_PIPE_DEPTH           256
 
 
+/**
+**  \cfesbcfg Quiet period before an elastic pipe shrinks
+**
+**  \par Description:
+**       The value of this constant dictates the number of consecutive SB
+**       housekeeping requests during which an elastic pipe (see
+**       #CFE_SB_CreatePipeElastic) must not have held more than its base depth
+**       before it is shrunk back to that depth.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1.  There are no restrictions on the
+**       upper limit; the period in seconds depends on the rate at which the SB
+**       housekeeping packet is requested.
+*/
+#define CFE_PLATFORM_SB_ELASTIC_QUIET_CYCLES     4
+
+
+/**
+**  \cfesbcfg Maximum number of messages returned by one batch receive
+**
+**  \par Description:
+**       The value of this constant dictates the maximum number of messages
+**       that one call to #CFE_SB_RcvMsgBatch drains from a pipe.  Each pipe
+**       keeps a pointer to every message of its last batch until the next
+**       receive, so this value also sizes the pipe table.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1.  There are no restrictions on the
+**       upper limit however, each increment adds one pointer to every entry
+**       of the pipe table.
+*/
+#define CFE_PLATFORM_SB_MAX_RCV_BATCH            16
+
+
+/**
+**  \cfesbcfg Maximum number of broadcast topics
+**
+**  \par Description:
+**       The value of this constant dictates the maximum number of message
+**       IDs that can be made broadcast topics with #CFE_SB_SetBroadcastTopic
+**       at one time.  A message sent on a broadcast topic is stored once in
+**       a ring shared by every subscribing pipe instead of being written to
+**       the queue of each pipe.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 32.  Each
+**       increment adds one topic to the SB global data and one read cursor to
+**       every entry of the pipe table.
+*/
+#define CFE_PLATFORM_SB_MAX_BCAST_TOPICS         4
+
+
 /**
 **  \cfesbcfg Highest Valid Message Id
 **
@@ -163,7 +215,8 @@
 **       The recommended case to to have this value the same across all mission platforms
 **
 **  \par Limits
-**       This parameter has a lower limit of 1 and an upper limit of 0xFFFF. Note
+**       This parameter has a lower limit of 1 and an upper limit of 0xFFFF, or
+**       0xFFFFFFFE when #CFE_PLATFORM_SB_MSGMAP_HASH is defined. Note
 **       for current implementations, V2/Extended headers assign 0xFFFFFFFF as the invalid
 **       message ID value, and default headers assigns 0xFFFF as the invalid value.  This
 **       means for default headers, 0xFFFF is invalid even if you set the value
@@ -172,6 +225,43 @@
 */
 #define CFE_PLATFORM_SB_HIGHEST_VALID_MSGID      0x1FFF
 
+
+/**
+**  \cfesbcfg Use a hashed SB message map
+**
+**  \par Description:
+**       By default the SB message map is a table indexed directly by message id,
+**       so its size follows #CFE_PLATFORM_SB_HIGHEST_VALID_MSGID.  Defining
+**       CFE_PLATFORM_SB_MSGMAP_HASH replaces it with an open addressing hash table
+**       sized from #CFE_PLATFORM_SB_MAX_MSG_IDS, so that its size follows the number
+**       of message ids that can be subscribed to instead of the message id range.
+**       This allows message ids wider than 16 bits, for example to use the subsystem
+**       and system fields of extended header message ids.
+**
+**       Lookups stay constant time but hash the message id first, so the direct
+**       table remains the better choice when the message id range is small.
+**
+**  \par Limits
+**       Not Applicable
+*/
+/* #define CFE_PLATFORM_SB_MSGMAP_HASH */
+
+/**
+**  \cfesbcfg Keep a latency histogram per message id
+**
+**  \par Description:
+**       SB always keeps a histogram of the time messages wait on each pipe,
+**       from send to receive.  Defining CFE_PLATFORM_SB_MSGID_LATENCY_HIST also
+**       keeps one per routing table entry, so that the latency of a single
+**       message id can be reported by #CFE_SB_SEND_LATENCY_STATS_CC.  This costs
+**       one #CFE_SB_LatencyHist_t per #CFE_PLATFORM_SB_MAX_MSG_IDS and a routing
+**       table lookup per message received.
+**
+**  \par Limits
+**       Not Applicable
+*/
+/* #define CFE_PLATFORM_SB_MSGID_LATENCY_HIST */
+
 /**
 **  \cfesbcfg Platform Endian Indicator
 **
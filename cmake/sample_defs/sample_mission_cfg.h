@@ -370,6 +370,7 @@
 #define CFE_MISSION_TBL_HK_TLM_MSG      4
 #define CFE_MISSION_TIME_HK_TLM_MSG     5
 #define CFE_MISSION_TIME_DIAG_TLM_MSG   6
+#define CFE_MISSION_SB_LATENCY_TLM_MSG  7
 
 #define CFE_MISSION_EVS_LONG_EVENT_MSG_MSG    8
 #define CFE_MISSION_EVS_SHORT_EVENT_MSG_MSG   9
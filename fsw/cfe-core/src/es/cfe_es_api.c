@@ -653,6 +653,7 @@ void CFE_ES_WaitForStartupSync(uint32 TimeOutMilliseconds)
 int32 CFE_ES_RegisterApp(void)
 {
    int32 Result;
+   CFE_ES_TaskContext_t Context;
 
    CFE_ES_LockSharedData(__func__,__LINE__);
 
@@ -664,6 +665,11 @@ int32 CFE_ES_RegisterApp(void)
    if (Result == OS_SUCCESS)
    {
        Result = CFE_SUCCESS;
+
+       /*
+       ** Prime the context cache for the main task
+       */
+       CFE_ES_GetTaskContextInternal(&Context);
    }
    else
    {
@@ -734,13 +740,19 @@ int32 CFE_ES_GetAppIDByName(CFE_ES_ResourceID_t *AppIdPtr, const char *AppName)
 */
 int32 CFE_ES_GetAppID(CFE_ES_ResourceID_t *AppIdPtr)
 {
+   CFE_ES_TaskContext_t Context;
    int32  Result;
 
-   CFE_ES_LockSharedData(__func__,__LINE__);
-
-   Result = CFE_ES_GetAppIDInternal(AppIdPtr);
-
-   CFE_ES_UnlockSharedData(__func__,__LINE__);
+   Result = CFE_ES_GetTaskContext(&Context);
+   if (Result == CFE_SUCCESS)
+   {
+      *AppIdPtr = Context.AppId;
+   }
+   else
+   {
+      *AppIdPtr = CFE_ES_RESOURCEID_UNDEFINED;
+      Result = CFE_ES_ERR_APPID;
+   }
 
    return(Result);
 
@@ -751,24 +763,43 @@ int32 CFE_ES_GetAppID(CFE_ES_ResourceID_t *AppIdPtr)
 */
 int32 CFE_ES_GetTaskID(CFE_ES_ResourceID_t *TaskIdPtr)
 {
+    CFE_ES_TaskContext_t Context;
     int32 Result;
-    CFE_ES_TaskRecord_t *TaskRecPtr;
 
-    CFE_ES_LockSharedData(__func__,__LINE__);
-    TaskRecPtr = CFE_ES_GetTaskRecordByContext();
-    if (TaskRecPtr == NULL)
+    /*
+     * The task ID is still valid if only the parent app lookup failed
+     */
+    Result = CFE_ES_GetTaskContext(&Context);
+    if (Result == CFE_ES_ERR_APPID)
     {
-        *TaskIdPtr = CFE_ES_RESOURCEID_UNDEFINED;
-        Result = CFE_ES_ERR_TASKID;
+        Result = CFE_SUCCESS;
     }
-    else
+
+    *TaskIdPtr = Context.TaskId;
+    return Result;
+}
+
+/*
+** Function: CFE_ES_GetTaskContext  - See API and header file for details
+*/
+int32 CFE_ES_GetTaskContext(CFE_ES_TaskContext_t *ContextPtr)
+{
+    int32 Result;
+
+#ifdef CFE_ES_LOCKFREE_CONTEXT
+    if (CFE_ES_ReadTaskContext(ContextPtr))
     {
-        *TaskIdPtr = CFE_ES_TaskRecordGetID(TaskRecPtr);
-        Result = CFE_SUCCESS;
+        return CFE_SUCCESS;
     }
+#endif
+
+    CFE_ES_LockSharedData(__func__,__LINE__);
+    Result = CFE_ES_GetTaskContextInternal(ContextPtr);
     CFE_ES_UnlockSharedData(__func__,__LINE__);
+
     return Result;
-}
+
+} /* End of CFE_ES_GetTaskContext() */
 
 /*
 ** Function: CFE_ES_GetAppName - See API and header file for details
@@ -1041,6 +1072,7 @@ int32 CFE_ES_RegisterChildTask(void)
 {
    int32 Result;
    int32 ReturnCode;
+   CFE_ES_TaskContext_t Context;
 
    CFE_ES_LockSharedData(__func__,__LINE__);
 
@@ -1060,6 +1092,11 @@ int32 CFE_ES_RegisterChildTask(void)
    else
    {
        ReturnCode = CFE_SUCCESS;
+
+       /*
+       ** Prime the context cache for the child task
+       */
+       CFE_ES_GetTaskContextInternal(&Context);
    }
 
    /*
@@ -1920,6 +1957,128 @@ CFE_ES_AppRecord_t *CFE_ES_GetAppRecordByContext(void)
 
 
 
+/*
+ * Copies the identity of the task and its parent app into the context
+ * cache entry that shares its index with the task record.
+ * Global data must be locked.
+ */
+void CFE_ES_SetTaskContext_Unsync(const CFE_ES_TaskRecord_t *TaskRecPtr, const CFE_ES_AppRecord_t *AppRecPtr)
+{
+    CFE_ES_TaskContextRecord_t *CtxPtr;
+
+    CtxPtr = &CFE_ES_Global.TaskContext[TaskRecPtr - CFE_ES_Global.TaskTable];
+
+    ++CtxPtr->Seq;
+    CFE_ES_MEMORY_BARRIER();
+    CtxPtr->TaskId  = CFE_ES_TaskRecordGetID(TaskRecPtr);
+    CtxPtr->AppId   = CFE_ES_AppRecordGetID(AppRecPtr);
+    CtxPtr->AppName = AppRecPtr->StartParams.Name;
+    CFE_ES_MEMORY_BARRIER();
+    ++CtxPtr->Seq;
+}
+
+/*
+ * Invalidates the context cache entry of a task record that is being freed.
+ * Global data must be locked.
+ */
+void CFE_ES_ClearTaskContext_Unsync(const CFE_ES_TaskRecord_t *TaskRecPtr)
+{
+    CFE_ES_TaskContextRecord_t *CtxPtr;
+
+    CtxPtr = &CFE_ES_Global.TaskContext[TaskRecPtr - CFE_ES_Global.TaskTable];
+
+    ++CtxPtr->Seq;
+    CFE_ES_MEMORY_BARRIER();
+    CtxPtr->TaskId  = CFE_ES_RESOURCEID_UNDEFINED;
+    CtxPtr->AppId   = CFE_ES_RESOURCEID_UNDEFINED;
+    CtxPtr->AppName = NULL;
+    CFE_ES_MEMORY_BARRIER();
+    ++CtxPtr->Seq;
+}
+
+#ifdef CFE_ES_LOCKFREE_CONTEXT
+/*
+ * Reads the context cache entry of the calling task without taking the
+ * shared data lock.  Returns false if the entry is not valid for the
+ * caller or was modified while being read, in which case the caller
+ * must take the lock and use CFE_ES_GetTaskContextInternal().
+ *
+ * The task and app table entries are re-checked as well, so the result
+ * is the same as the locked lookup would give.
+ */
+bool CFE_ES_ReadTaskContext(CFE_ES_TaskContext_t *ContextPtr)
+{
+    const CFE_ES_TaskContextRecord_t *CtxPtr;
+    CFE_ES_ResourceID_t TaskID;
+    uint32 Idx;
+    uint32 Seq;
+
+    TaskID = CFE_ES_ResourceID_FromOSAL(OS_TaskGetId());
+    if (CFE_ES_TaskID_ToIndex(TaskID, &Idx) != CFE_SUCCESS)
+    {
+        return false;
+    }
+
+    CtxPtr = &CFE_ES_Global.TaskContext[Idx];
+
+    Seq = CtxPtr->Seq;
+    CFE_ES_MEMORY_BARRIER();
+    ContextPtr->TaskId  = CtxPtr->TaskId;
+    ContextPtr->AppId   = CtxPtr->AppId;
+    ContextPtr->AppName = CtxPtr->AppName;
+    CFE_ES_MEMORY_BARRIER();
+
+    return ((Seq & 1) == 0 && Seq == CtxPtr->Seq &&
+            CFE_ES_ResourceID_Equal(ContextPtr->TaskId, TaskID) &&
+            CFE_ES_TaskRecordIsMatch(&CFE_ES_Global.TaskTable[Idx], TaskID) &&
+            CFE_ES_AppRecordIsMatch(CFE_ES_LocateAppRecordByID(ContextPtr->AppId), ContextPtr->AppId));
+}
+#endif
+
+/*
+** Function: CFE_ES_GetTaskContextInternal
+**
+** Purpose:  Look up the identity of the calling task in the ES tables and
+**           refresh its context cache entry.  Global data must be locked.
+**
+*/
+int32 CFE_ES_GetTaskContextInternal(CFE_ES_TaskContext_t *ContextPtr)
+{
+    CFE_ES_TaskRecord_t *TaskRecPtr;
+    CFE_ES_AppRecord_t  *AppRecPtr;
+    int32 Result;
+
+    ContextPtr->TaskId  = CFE_ES_RESOURCEID_UNDEFINED;
+    ContextPtr->AppId   = CFE_ES_RESOURCEID_UNDEFINED;
+    ContextPtr->AppName = NULL;
+
+    TaskRecPtr = CFE_ES_GetTaskRecordByContext();
+    if (TaskRecPtr == NULL)
+    {
+        Result = CFE_ES_ERR_TASKID;
+    }
+    else
+    {
+        ContextPtr->TaskId = CFE_ES_TaskRecordGetID(TaskRecPtr);
+
+        AppRecPtr = CFE_ES_LocateAppRecordByID(TaskRecPtr->AppId);
+        if (!CFE_ES_AppRecordIsMatch(AppRecPtr, TaskRecPtr->AppId))
+        {
+            Result = CFE_ES_ERR_APPID;
+        }
+        else
+        {
+            ContextPtr->AppId   = CFE_ES_AppRecordGetID(AppRecPtr);
+            ContextPtr->AppName = AppRecPtr->StartParams.Name;
+            CFE_ES_SetTaskContext_Unsync(TaskRecPtr, AppRecPtr);
+            Result = CFE_SUCCESS;
+        }
+    }
+
+    return Result;
+
+} /* End of CFE_ES_GetTaskContextInternal() */
+
 /*
 ** Function: CFE_ES_GetAppIDInternal
 **
@@ -74,6 +74,18 @@
 #define CFE_ES_COUNTID_BASE     (CFE_ES_RESOURCEID_MARK | ((OS_OBJECT_TYPE_USER+3) << CFE_ES_RESOURCEID_SHIFT))
 #define CFE_ES_POOLID_BASE      (CFE_ES_RESOURCEID_MARK | ((OS_OBJECT_TYPE_USER+4) << CFE_ES_RESOURCEID_SHIFT))
 
+/*
+ * The per-task context cache is read without the shared data lock where
+ * the compiler provides a full memory barrier.  Other targets always
+ * take the lock.
+ */
+#ifdef __GNUC__
+#define CFE_ES_LOCKFREE_CONTEXT
+#define CFE_ES_MEMORY_BARRIER()  __sync_synchronize()
+#else
+#define CFE_ES_MEMORY_BARRIER()
+#endif
+
 /*
 ** Typedefs
 */
@@ -89,6 +101,19 @@ typedef struct
    char           CounterName[OS_MAX_API_NAME];   /* Counter Name */
 } CFE_ES_GenCounterRecord_t;
 
+/*
+** CFE_ES_TaskContextRecord_t caches the identity of the task that owns the
+** task table entry with the same index.  Seq is odd while the entry is
+** being written, readers fall back to the lock if Seq changes.
+*/
+typedef struct
+{
+   volatile uint32     Seq;
+   CFE_ES_ResourceID_t TaskId;      /**< Task ID of the cached entry, or undefined */
+   CFE_ES_ResourceID_t AppId;       /**< Parent App ID */
+   const char          *AppName;    /**< Points at the name in the parent App Table entry */
+} CFE_ES_TaskContextRecord_t;
+
 /*
  * Encapsulates the state of the ES background task
  */
@@ -132,6 +157,7 @@ typedef struct
    */
    uint32              RegisteredTasks;
    CFE_ES_TaskRecord_t TaskTable[OS_MAX_TASKS];
+   CFE_ES_TaskContextRecord_t TaskContext[OS_MAX_TASKS];
 
    /*
    ** ES App Table
@@ -377,6 +403,29 @@ static inline bool CFE_ES_LibRecordIsMatch(const CFE_ES_LibRecord_t *LibRecPtr,
     return (LibRecPtr != NULL && CFE_ES_ResourceID_Equal(LibRecPtr->LibId, LibID));
 }
 
+/**
+ * @brief Update the cached context of a Task table entry
+ *
+ * Copies the task ID, app ID and app name into the context cache entry
+ * for this task, so that CFE_ES_GetTaskContext() can find them without
+ * searching the tables.
+ *
+ * Global data must be locked prior to invoking this function.
+ *
+ * @param[in]   TaskRecPtr   pointer to Task table entry
+ * @param[in]   AppRecPtr    pointer to the parent App table entry
+ */
+extern void CFE_ES_SetTaskContext_Unsync(const CFE_ES_TaskRecord_t *TaskRecPtr, const CFE_ES_AppRecord_t *AppRecPtr);
+
+/**
+ * @brief Invalidate the cached context of a Task table entry
+ *
+ * Global data must be locked prior to invoking this function.
+ *
+ * @param[in]   TaskRecPtr   pointer to Task table entry
+ */
+extern void CFE_ES_ClearTaskContext_Unsync(const CFE_ES_TaskRecord_t *TaskRecPtr);
+
 /**
  * @brief Get the ID value from an Task table entry
  *
@@ -440,6 +489,7 @@ static inline void CFE_ES_TaskRecordSetUsed(CFE_ES_TaskRecord_t *TaskRecPtr, CFE
 static inline void CFE_ES_TaskRecordSetFree(CFE_ES_TaskRecord_t *TaskRecPtr)
 {
     TaskRecPtr->TaskId = CFE_ES_RESOURCEID_UNDEFINED;
+    CFE_ES_ClearTaskContext_Unsync(TaskRecPtr);
 }
 
 /**
@@ -618,6 +668,10 @@ int32 CFE_ES_ResourceID_ToIndex_Internal(uint32 Serial, uint32 TableSize, uint32
 ** Functions used to lock/unlock shared data
 */
 extern int32 CFE_ES_GetAppIDInternal(CFE_ES_ResourceID_t *AppIdPtr);
+extern int32 CFE_ES_GetTaskContextInternal(CFE_ES_TaskContext_t *ContextPtr);
+#ifdef CFE_ES_LOCKFREE_CONTEXT
+extern bool  CFE_ES_ReadTaskContext(CFE_ES_TaskContext_t *ContextPtr);
+#endif
 extern void  CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber);
 extern void  CFE_ES_UnlockSharedData(const char *FunctionName, int32 LineNumber);
 
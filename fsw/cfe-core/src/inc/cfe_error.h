@@ -717,6 +717,8 @@
  *
  *  In #CFE_SB_RcvMsg, this return value indicates that a packet has not 
  *  been received in the time given in the "timeout" parameter.
+ *  In #CFE_SB_SendMsgTimeout, it indicates that a lossless pipe had no
+ *  room for the message within the time given.
  *
  */
 #define CFE_SB_TIME_OUT         ((int32)0xca000001)
@@ -362,6 +362,19 @@ typedef struct CFE_ES_TaskInfo
 
 } CFE_ES_TaskInfo_t;
 
+/**
+ * \brief Calling Task Context
+ *
+ * Identity of the calling task as cached by ES, see #CFE_ES_GetTaskContext
+ */
+typedef struct CFE_ES_TaskContext
+{
+   CFE_ES_ResourceID_t   TaskId;       /**< \brief Task Id of the calling task */
+   CFE_ES_ResourceID_t   AppId;        /**< \brief Parent Application ID */
+   const char           *AppName;      /**< \brief Parent Application Name, valid while the application exists */
+
+} CFE_ES_TaskContext_t;
+
 /**
  * \brief Block statistics
  */
@@ -802,6 +815,35 @@ int32 CFE_ES_GetAppID(CFE_ES_ResourceID_t *AppIdPtr);
 ******************************************************************************/
 int32 CFE_ES_GetTaskID(CFE_ES_ResourceID_t *TaskIdPtr);
 
+/*****************************************************************************/
+/**
+** \brief Get the task ID, Application ID and Application name of the calling context
+**
+** \par Description
+**        This retrieves the identity of the calling task in a single call.  ES
+**        keeps a cached copy of this information for each registered task, so
+**        on most targets this does not need to take the ES shared data lock.
+**
+** \par Assumptions, External Events, and Notes:
+**        Intended for services that need the caller's identity on every
+**        call (for example, when sending or receiving messages).
+**        The AppName pointer refers to ES internal storage and must not be
+**        used after the application has been deleted.
+**        If the task is known but its application is not, the TaskId field
+**        is still set and #CFE_ES_ERR_APPID is returned.
+**
+** \param[out]   ContextPtr     Pointer to structure that is to receive the context.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_TASKID    \copybrief CFE_ES_ERR_TASKID
+** \retval #CFE_ES_ERR_APPID     \copybrief CFE_ES_ERR_APPID
+**
+** \sa #CFE_ES_GetAppID, #CFE_ES_GetTaskID
+**
+******************************************************************************/
+int32 CFE_ES_GetTaskContext(CFE_ES_TaskContext_t *ContextPtr);
+
 /*****************************************************************************/
 /**
 ** \brief Get an Application ID associated with a specified Application name
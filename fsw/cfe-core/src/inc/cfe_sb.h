@@ -42,6 +42,7 @@
 #include "cfe_mission_cfg.h"
 #include "ccsds.h"
 #include "cfe_time.h"
+#include "cfe_es.h"
 
 
 /*
@@ -141,6 +142,10 @@
 ** Pipe option bit fields.
 */
 #define CFE_SB_PIPEOPTS_IGNOREMINE 0x00000001 /**< \brief Messages sent by the app that owns this pipe will not be sent to this pipe. */
+#define CFE_SB_PIPEOPTS_RING       0x00000002 /**< \brief The pipe queue is an in-process ring instead of an OS queue; can only be selected by #CFE_SB_CreatePipeEx. */
+#define CFE_SB_PIPEOPTS_LATEST     0x00000004 /**< \brief Only the newest message of each MsgId is kept on the pipe; a new message replaces the one still pending. */
+#define CFE_SB_PIPEOPTS_LOSSLESS   0x00000008 /**< \brief Senders using #CFE_SB_SendMsgTimeout wait for space on this pipe instead of dropping; the pipe depth is its only message limit. */
+#define CFE_SB_PIPEOPTS_ELASTIC    0x00000010 /**< \brief The ring of the pipe grows under burst up to a maximum depth and shrinks back when quiet; can only be selected by #CFE_SB_CreatePipeElastic. */
 
 /*
 ** Type Definitions
@@ -192,16 +197,47 @@ typedef cpuaddr CFE_SB_ZeroCopyHandle_t;
 
 /** \brief Quality Of Service Type Definition
 **
-** Currently an unused parameter in #CFE_SB_SubscribeEx
-** Intended to be used for interprocessor communication only
+** Used by #CFE_SB_SubscribeEx.  Priority selects the lane of the pipe a
+** subscription delivers through; Reliability is intended to be used for
+** interprocessor communication only
 **/
 typedef  struct {
-    uint8 Priority;/**< \brief  Specify high(1) or low(0) message priority for off-board routing, currently unused */
+    uint8 Priority;/**< \brief  Specify high(1) or low(0) message priority; high priority messages are received ahead of all low priority messages on the pipe */
     uint8 Reliability;/**< \brief  Specify high(1) or low(0) message transfer reliability for off-board routing, currently unused */
 }CFE_SB_Qos_t;
 
 extern CFE_SB_Qos_t CFE_SB_Default_Qos;/**< \brief  Defines a default priority and reliabilty for off-board routing */
 
+/*
+** Delivery policy modes, see #CFE_SB_DeliveryPolicy_t
+*/
+#define CFE_SB_DELIVER_ALL         0 /**< \brief Every message is delivered (default) */
+#define CFE_SB_DELIVER_EVERY_NTH   1 /**< \brief The first and then every Param'th message is delivered */
+#define CFE_SB_DELIVER_INTERVAL    2 /**< \brief At most one message per Param milliseconds is delivered */
+#define CFE_SB_DELIVER_ON_CHANGE   3 /**< \brief A message is delivered only when the selected field differs from the last one delivered */
+
+/** \brief Delivery Policy Type Definition
+**
+** Selects which of the messages sent with a MsgId are delivered to a pipe,
+** see #CFE_SB_SetDeliveryPolicy.  Messages that are not delivered never take
+** pipe depth or SB buffers.
+**/
+typedef struct {
+    uint8  Mode;        /**< \brief  One of the CFE_SB_DELIVER_xxx modes */
+    uint8  FieldSize;   /**< \brief  #CFE_SB_DELIVER_ON_CHANGE: size of the field in bytes, 1 to 4 */
+    uint16 FieldOffset; /**< \brief  #CFE_SB_DELIVER_ON_CHANGE: offset of the field in bytes from the start of the message */
+    uint32 Param;       /**< \brief  #CFE_SB_DELIVER_EVERY_NTH: N, #CFE_SB_DELIVER_INTERVAL: milliseconds */
+}CFE_SB_DeliveryPolicy_t;
+
+/** \brief Message Fragment Type Definition
+**
+** One piece of a message sent with #CFE_SB_SendMsgV
+**/
+typedef struct {
+    const void *Base;   /**< \brief  Start of the fragment, may be NULL only if Length is 0 */
+    size_t      Length; /**< \brief  Length of the fragment in bytes */
+}CFE_SB_IoVec_t;
+
 
 /****************** Function Prototypes **********************/
 
@@ -247,6 +283,106 @@ int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr,
                          uint16  Depth,
                          const char *PipeName);
 
+/*****************************************************************************/
+/**
+** \brief Creates a new software bus pipe with options.
+**
+** \par Description
+**          This routine is the same as #CFE_SB_CreatePipe except that the pipe
+**          options are given at creation.  With #CFE_SB_PIPEOPTS_RING the pipe
+**          carries its messages in an in-process ring instead of an OS queue,
+**          so a send to the pipe and a receive from it do not enter the OS
+**          unless the receiver is blocked waiting for a message.
+**
+** \par Assumptions, External Events, and Notes:
+**          - The ring is allocated from the SB memory pool.
+**          - #CFE_SB_PIPEOPTS_RING cannot be set or cleared afterwards by
+**            #CFE_SB_SetPipeOpts.
+**
+** \param[in, out]  PipeIdPtr    A pointer to a variable of type #CFE_SB_PipeId_t,
+**                          which will be filled in with the pipe ID information
+**                          by the #CFE_SB_CreatePipeEx routine. *PipeIdPtr is the identifier for the created pipe.
+**
+** \param[in]  Depth        The maximum number of messages that will be allowed on
+**                          this pipe at one time.
+**
+** \param[in]  PipeName     A string to be used to identify this pipe in error messages
+**                          and routing information telemetry.  The string must be no
+**                          longer than #OS_MAX_API_NAME (including terminator).
+**                          Longer strings will be truncated.
+**
+** \param[in]  Opts         A bit field of options, see #CFE_SB_SetPipeOpts.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MAX_PIPES_MET \copybrief CFE_SB_MAX_PIPES_MET
+** \retval #CFE_SB_PIPE_CR_ERR   \copybrief CFE_SB_PIPE_CR_ERR
+**
+** \sa #CFE_SB_CreatePipe #CFE_SB_DeletePipe #CFE_SB_GetPipeOpts #CFE_SB_SetPipeOpts #CFE_SB_PIPEOPTS_RING
+**/
+int32  CFE_SB_CreatePipeEx(CFE_SB_PipeId_t *PipeIdPtr,
+                           uint16  Depth,
+                           const char *PipeName,
+                           uint8 Opts);
+
+/*****************************************************************************/
+/**
+** \brief Creates a new software bus pipe whose depth follows its load.
+**
+** \par Description
+**          This routine is the same as #CFE_SB_CreatePipeEx except that the pipe
+**          starts with a base depth and grows, when a message finds it full, up
+**          to a maximum depth.  Once the pipe has not held more than its base
+**          depth for #CFE_PLATFORM_SB_ELASTIC_QUIET_CYCLES SB housekeeping
+**          requests in a row it shrinks back to the base depth.  The depth,
+**          the largest depth reached and the number of times the pipe has grown
+**          and shrunk are reported in the pipe depth statistics.
+**
+** \par Assumptions, External Events, and Notes:
+**          - An elastic pipe always uses the ring backend (#CFE_SB_PIPEOPTS_RING),
+**            which is allocated from the SB memory pool.  A pipe that cannot get
+**            memory to grow drops messages as a full pipe does.
+**          - The SB task allocates the larger ring before it is needed, so
+**            reads and writes of an elastic pipe do not take the SB shared
+**            data lock.  The pipe grows one step, to twice its depth, when a
+**            message finds it full; the next step is ready once the reader has
+**            emptied the smaller ring and the SB task has released it.
+**          - The high priority lane of the pipe, if any, keeps the base depth.
+**          - A MaxDepth equal to Depth creates a fixed depth pipe, the same as
+**            #CFE_SB_CreatePipeEx.
+**
+** \param[in, out]  PipeIdPtr    A pointer to a variable of type #CFE_SB_PipeId_t,
+**                          which will be filled in with the pipe ID information
+**                          by the #CFE_SB_CreatePipeElastic routine. *PipeIdPtr is the identifier for the created pipe.
+**
+** \param[in]  Depth        The base number of messages that will be allowed on
+**                          this pipe at one time.
+**
+** \param[in]  MaxDepth     The number of messages the pipe can grow to, from
+**                          Depth up to #CFE_PLATFORM_SB_MAX_PIPE_DEPTH.
+**
+** \param[in]  PipeName     A string to be used to identify this pipe in error messages
+**                          and routing information telemetry.  The string must be no
+**                          longer than #OS_MAX_API_NAME (including terminator).
+**                          Longer strings will be truncated.
+**
+** \param[in]  Opts         A bit field of options, see #CFE_SB_SetPipeOpts.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MAX_PIPES_MET \copybrief CFE_SB_MAX_PIPES_MET
+** \retval #CFE_SB_PIPE_CR_ERR   \copybrief CFE_SB_PIPE_CR_ERR
+**
+** \sa #CFE_SB_CreatePipeEx #CFE_SB_DeletePipe #CFE_SB_PIPEOPTS_ELASTIC
+**/
+int32  CFE_SB_CreatePipeElastic(CFE_SB_PipeId_t *PipeIdPtr,
+                                uint16  Depth,
+                                uint16  MaxDepth,
+                                const char *PipeName,
+                                uint8 Opts);
+
 /*****************************************************************************/
 /**
 ** \brief Delete a software bus pipe.
@@ -282,7 +418,22 @@ int32  CFE_SB_DeletePipe(CFE_SB_PipeId_t PipeId);
 **
 ** \par Description
 **          This routine sets (or clears) options to alter the pipe's behavior.
-**          Options are (re)set every call to this routine.
+**          Options are (re)set every call to this routine, except for
+**          #CFE_SB_PIPEOPTS_RING and #CFE_SB_PIPEOPTS_ELASTIC which are kept
+**          as chosen at creation.
+**
+** \par Assumptions, External Events, and Notes:
+**          - With #CFE_SB_PIPEOPTS_LATEST each subscribed MsgId takes at most
+**            one slot of the pipe depth.  A message sent while the previous
+**            one of the same MsgId is still on the pipe replaces it and the
+**            older buffer is released at once, so the pipe does not overflow
+**            or report a message limit error as long as its depth is at least
+**            the number of MsgIds subscribed to it.  The reader gets the
+**            newest message in the place of the one it replaced.
+**          - With #CFE_SB_PIPEOPTS_LOSSLESS the MsgLim of the subscriptions
+**            is not applied and a sender using #CFE_SB_SendMsgTimeout waits
+**            for space when the pipe is full.  Other senders still drop the
+**            message on a full pipe.
 **
 ** \param[in]  PipeId       The pipe ID of the pipe to set options on.
 **
@@ -292,7 +443,7 @@ int32  CFE_SB_DeletePipe(CFE_SB_PipeId_t PipeId);
 ** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
 ** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
 **
-** \sa #CFE_SB_CreatePipe #CFE_SB_DeletePipe #CFE_SB_GetPipeOpts #CFE_SB_GetPipeIdByName #CFE_SB_PIPEOPTS_IGNOREMINE
+** \sa #CFE_SB_CreatePipe #CFE_SB_DeletePipe #CFE_SB_GetPipeOpts #CFE_SB_GetPipeIdByName #CFE_SB_PIPEOPTS_IGNOREMINE #CFE_SB_PIPEOPTS_LATEST #CFE_SB_PIPEOPTS_LOSSLESS
 **/
 int32  CFE_SB_SetPipeOpts(CFE_SB_PipeId_t     PipeId,
                           uint8               Opts);
@@ -386,7 +537,10 @@ int32  CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName);
 **
 ** \param[in]  Quality      The requested Quality of Service (QoS) required of
 **                          the messages. Most callers will use #CFE_SB_Default_Qos
-**                          for this parameter.
+**                          for this parameter.  A non zero Priority delivers the
+**                          message through the high priority lane of the pipe,
+**                          which #CFE_SB_RcvMsg empties before the normal lane;
+**                          the lane holds up to the pipe depth of messages.
 **
 ** \param[in]  MsgLim       The maximum number of messages with this Message ID to
 **                          allow in this pipe at the same time.
@@ -476,6 +630,139 @@ int32 CFE_SB_SubscribeLocal(CFE_SB_MsgId_t MsgId,
                             CFE_SB_PipeId_t PipeId,
                             uint16 MsgLim);
 
+/*****************************************************************************/
+/**
+** \brief Subscribe to a range of messages on the software bus
+**
+** \par Description
+**          This routine adds the specified pipe to the destination list of
+**          every message ID from FirstMsgId to LastMsgId, inclusive.  This is
+**          the same as calling #CFE_SB_Subscribe for each message ID of the
+**          range, but is done in one call with one event.
+**
+** \par Assumptions, External Events, and Notes:
+**          - Each message ID of the range takes its own routing table entry, so
+**            the range counts against #CFE_PLATFORM_SB_MAX_MSG_IDS. If there is
+**            not enough room for the whole range nothing is subscribed.
+**          - Message IDs the pipe is already subscribed to are skipped.
+**          - With subscription reporting enabled, the range is reported as
+**            by #CFE_SB_SubscribeMany.
+**          - The subscriptions are removed one message ID at a time with
+**            #CFE_SB_Unsubscribe, or all at once by deleting the pipe.
+**
+** \param[in]  FirstMsgId   The first message ID of the range.
+**
+** \param[in]  LastMsgId    The last message ID of the range.
+**
+** \param[in]  PipeId       The pipe ID of the pipe the subscribed messages
+**                          should be sent to.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_MAX_MSGS_MET  \copybrief CFE_SB_MAX_MSGS_MET
+** \retval #CFE_SB_MAX_DESTS_MET \copybrief CFE_SB_MAX_DESTS_MET
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_BUF_ALOC_ERR  \copybrief CFE_SB_BUF_ALOC_ERR
+**
+** \sa #CFE_SB_Subscribe, #CFE_SB_SubscribeMask, #CFE_SB_Unsubscribe
+**/
+int32 CFE_SB_SubscribeRange(CFE_SB_MsgId_t FirstMsgId,
+                            CFE_SB_MsgId_t LastMsgId,
+                            CFE_SB_PipeId_t PipeId);
+
+/*****************************************************************************/
+/**
+** \brief Subscribe to all messages matching a masked message ID
+**
+** \par Description
+**          This routine adds the specified pipe to the destination list of
+**          every valid message ID whose bits selected by Mask are equal to
+**          those of MsgId.  Bits not in Mask are wildcards.  This is the same
+**          as calling #CFE_SB_Subscribe for each matching message ID, but is
+**          done in one call with one event.
+**
+** \par Assumptions, External Events, and Notes:
+**          - Each matching message ID takes its own routing table entry, so
+**            the match counts against #CFE_PLATFORM_SB_MAX_MSG_IDS. If there is
+**            not enough room for all of them nothing is subscribed.
+**          - Message IDs the pipe is already subscribed to are skipped.
+**          - With subscription reporting enabled, the matching message IDs
+**            are reported as by #CFE_SB_SubscribeMany.
+**
+** \param[in]  MsgId        A message ID with the bits to be matched.
+**
+** \param[in]  Mask         The bits of MsgId that must match.
+**
+** \param[in]  PipeId       The pipe ID of the pipe the subscribed messages
+**                          should be sent to.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_MAX_MSGS_MET  \copybrief CFE_SB_MAX_MSGS_MET
+** \retval #CFE_SB_MAX_DESTS_MET \copybrief CFE_SB_MAX_DESTS_MET
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_BUF_ALOC_ERR  \copybrief CFE_SB_BUF_ALOC_ERR
+**
+** \sa #CFE_SB_Subscribe, #CFE_SB_SubscribeRange, #CFE_SB_Unsubscribe
+**/
+int32 CFE_SB_SubscribeMask(CFE_SB_MsgId_t MsgId,
+                           CFE_SB_MsgId_Atom_t Mask,
+                           CFE_SB_PipeId_t PipeId);
+
+/*****************************************************************************/
+/**
+** \brief Subscribe to a list of messages on the software bus
+**
+** \par Description
+**          This routine adds the specified pipe to the destination list of
+**          every message ID in MsgIdList.  This is the same as calling
+**          #CFE_SB_SubscribeEx for each message ID of the list, but the whole
+**          list is applied under one lock, with one event and one subscription
+**          report.
+**
+** \par Assumptions, External Events, and Notes:
+**          - Each message ID takes its own routing table entry.  The list is
+**            checked before anything is changed: an invalid message ID, or not
+**            enough room in the routing table or destination lists for the
+**            whole list, subscribes nothing.  A message ID listed more than
+**            once needs a single routing table entry.
+**          - If a destination cannot be allocated partway through the list,
+**            the message IDs subscribed before it are unsubscribed again.
+**          - Count may not exceed #CFE_PLATFORM_SB_MAX_MSG_IDS.
+**          - Message IDs the pipe is already subscribed to are skipped.
+**          - With subscription reporting enabled, the list is reported in
+**            #CFE_SB_AllSubscriptionsTlm_t packets of up to
+**            #CFE_SB_SUB_ENTRIES_PER_PKT entries instead of one
+**            #CFE_SB_SingleSubscriptionTlm_t packet per message ID.
+**
+** \param[in]  MsgIdList    A pointer to the message IDs to subscribe to.
+**
+** \param[in]  Count        The number of message IDs in MsgIdList.
+**
+** \param[in]  PipeId       The pipe ID of the pipe the subscribed messages
+**                          should be sent to.
+**
+** \param[in]  Quality      The requested Quality of Service (QoS) required of
+**                          the messages.
+**
+** \param[in]  MsgLim       The maximum number of messages with each message ID
+**                          to allow in this pipe at the same time.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_MAX_MSGS_MET  \copybrief CFE_SB_MAX_MSGS_MET
+** \retval #CFE_SB_MAX_DESTS_MET \copybrief CFE_SB_MAX_DESTS_MET
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_BUF_ALOC_ERR  \copybrief CFE_SB_BUF_ALOC_ERR
+**
+** \sa #CFE_SB_SubscribeEx, #CFE_SB_SubscribeRange, #CFE_SB_UnsubscribeMany
+**/
+int32 CFE_SB_SubscribeMany(const CFE_SB_MsgId_t *MsgIdList,
+                           uint32 Count,
+                           CFE_SB_PipeId_t PipeId,
+                           CFE_SB_Qos_t Quality,
+                           uint16 MsgLim);
+
 /*****************************************************************************/
 /**
 ** \brief Remove a subscription to a message on the software bus
@@ -525,6 +812,160 @@ int32  CFE_SB_Unsubscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId);
 ** \sa #CFE_SB_Subscribe, #CFE_SB_SubscribeEx, #CFE_SB_SubscribeLocal, #CFE_SB_Unsubscribe
 **/
 int32 CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId);
+
+/*****************************************************************************/
+/**
+** \brief Remove the subscriptions to a list of messages on the software bus
+**
+** \par Description
+**          This routine removes the specified pipe from the destination list
+**          of every message ID in MsgIdList.  This is the same as calling
+**          #CFE_SB_Unsubscribe for each message ID of the list, but the whole
+**          list is applied under one lock with one event.
+**
+** \par Assumptions, External Events, and Notes:
+**          - An invalid message ID in the list unsubscribes nothing.
+**          - Message IDs the pipe is not subscribed to are skipped.
+**
+** \param[in]  MsgIdList    A pointer to the message IDs to unsubscribe.
+**
+** \param[in]  Count        The number of message IDs in MsgIdList.
+**
+** \param[in]  PipeId       The pipe ID of the pipe the subscribed messages
+**                          should no longer be sent to.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_Unsubscribe, #CFE_SB_SubscribeMany
+**/
+int32 CFE_SB_UnsubscribeMany(const CFE_SB_MsgId_t *MsgIdList,
+                             uint32 Count,
+                             CFE_SB_PipeId_t PipeId);
+
+/*****************************************************************************/
+/**
+** \brief Set which messages of a subscription are delivered to a pipe
+**
+** \par Description
+**          This routine sets the delivery policy of the subscription of a pipe
+**          to a message ID, as made by #CFE_SB_Subscribe, #CFE_SB_SubscribeEx
+**          or any of the other subscribe APIs.  The policy is applied when the
+**          message is sent, so a message that is not delivered never takes a
+**          slot of the pipe depth or an SB buffer.  Messages that are not
+**          delivered are counted per subscription and reported in the routing
+**          information file (#CFE_SB_SEND_ROUTING_INFO_CC).
+**
+** \par Assumptions, External Events, and Notes:
+**          - Only the owner of the pipe may set the policy.
+**          - The policy starts over when it is set: the next message is
+**            always delivered.
+**          - Unsubscribing removes the policy.  A policy of
+**            #CFE_SB_DELIVER_ALL restores the default behavior.
+**          - A message too short to hold the #CFE_SB_DELIVER_ON_CHANGE field
+**            is always delivered.
+**
+** \param[in]  MsgId        The message ID of the subscription.
+**
+** \param[in]  PipeId       The pipe ID of the subscription.
+**
+** \param[in]  PolicyPtr    A pointer to the delivery policy.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_Subscribe, #CFE_SB_SubscribeEx, #CFE_SB_Unsubscribe
+**/
+int32 CFE_SB_SetDeliveryPolicy(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
+                               const CFE_SB_DeliveryPolicy_t *PolicyPtr);
+
+/*****************************************************************************/
+/**
+** \brief Keep only the newest pending message of a subscription on a pipe
+**
+** \par Description
+**          This routine turns coalescing on or off for the subscription of a
+**          pipe to a message ID.  While a message of a coalescing subscription
+**          is pending on the pipe, a new message with the same message ID
+**          replaces it in place: it keeps the position of the pending one in
+**          the pipe and takes no further slot of the pipe depth, and the
+**          replaced message is released.  This is meant for housekeeping and
+**          other messages of which only the latest matters, so the pipe depth
+**          they need grows with the number of message IDs rather than with
+**          the length of a burst.  It is the per subscription form of
+**          #CFE_SB_PIPEOPTS_LATEST.
+**
+** \par Assumptions, External Events, and Notes:
+**          - Only the owner of the pipe may change the subscription.
+**          - Turning coalescing off does not drop a replacing message that
+**            is already pending; it is still the one received.
+**          - Unsubscribing removes the setting.
+**          - Coalescing does not apply to broadcast topics, see
+**            #CFE_SB_SetBroadcastTopic.
+**
+** \param[in]  MsgId        The message ID of the subscription.
+**
+** \param[in]  PipeId       The pipe ID of the subscription.
+**
+** \param[in]  Enable       true to coalesce the messages, false to queue
+**                          each of them (the default).
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_Subscribe, #CFE_SB_SetDeliveryPolicy, #CFE_SB_SetPipeOpts
+**/
+int32 CFE_SB_SetCoalescing(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, bool Enable);
+
+/*****************************************************************************/
+/**
+** \brief Make a message ID a broadcast topic
+**
+** \par Description
+**          This routine makes a message ID a broadcast topic, or removes the
+**          topic when Depth is zero.  A message sent on a broadcast topic is
+**          stored once in a ring of Depth messages shared by every pipe
+**          subscribed to the message ID, instead of being written to the
+**          queue of each pipe, so the cost of a send does not grow with the
+**          number of subscribers.  Each pipe reads the ring from its own
+**          position through #CFE_SB_RcvMsg and #CFE_SB_RcvMsgBatch as usual;
+**          only a pipe whose reader is blocked is sent a wakeup.
+**
+** \par Assumptions, External Events, and Notes:
+**          - Meant for message IDs with many subscribers, such as schedule
+**            wakeups or mode broadcasts.
+**          - The topic may be set before or after the subscriptions are
+**            made.  A pipe receives the messages sent after it subscribed,
+**            or after the topic was set.
+**          - A pipe that falls more than Depth messages behind loses the
+**            oldest ones; they are counted as pipe overflows.  Messages of a
+**            topic take neither pipe depth nor message limits.
+**          - Topic messages are read after the high priority lane and before
+**            the normal queue of a pipe, so they are not ordered with the
+**            other messages on the pipe.
+**          - Delivery policies, latest value pipes, #CFE_SB_PIPEOPTS_IGNOREMINE
+**            and disabled routes do not apply to topic messages.
+**          - Up to #CFE_PLATFORM_SB_MAX_BCAST_TOPICS message IDs can be
+**            topics at one time.
+**
+** \param[in]  MsgId        The message ID of the topic.
+**
+** \param[in]  Depth        The number of messages the topic holds, up to
+**                          #CFE_PLATFORM_SB_MAX_PIPE_DEPTH, or 0 to remove
+**                          the topic.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MAX_MSGS_MET  \copybrief CFE_SB_MAX_MSGS_MET
+** \retval #CFE_SB_BUF_ALOC_ERR  \copybrief CFE_SB_BUF_ALOC_ERR
+**
+** \sa #CFE_SB_Subscribe, #CFE_SB_SetDeliveryPolicy, #CFE_SB_RcvMsg
+**/
+int32 CFE_SB_SetBroadcastTopic(CFE_SB_MsgId_t MsgId, uint16 Depth);
 /**@}*/
 
 /** @defgroup CFEAPISBMessage cFE Send/Receive Message APIs
@@ -563,6 +1004,48 @@ int32 CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId);
 **/
 int32  CFE_SB_SendMsg(CFE_SB_Msg_t   *MsgPtr);
 
+/*****************************************************************************/
+/**
+** \brief Send a software bus message, waiting for space on lossless pipes
+**
+** \par Description
+**          This routine sends the specified message to all subscribers, as
+**          #CFE_SB_SendMsg does.  When a pipe with #CFE_SB_PIPEOPTS_LOSSLESS
+**          is full, the caller is delayed until the receiver makes room or
+**          the timeout expires, instead of the message being dropped for that
+**          pipe.  This lets a producer run at full rate without losing
+**          messages or over sizing the pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**          - The SB shared data is not locked while the caller waits; other
+**            senders and receivers proceed normally.
+**          - The timeout is shared by all of the destinations of the message.
+**            Pipes without #CFE_SB_PIPEOPTS_LOSSLESS are never waited on.
+**          - A message still not written when the timeout expires is dropped
+**            for that pipe and counted as a pipe overflow, as in
+**            #CFE_SB_SendMsg.
+**          - This function tracks and increments the source sequence counter
+**            of a telemetry message.
+**
+** \param[in]  MsgPtr       A pointer to the message to be sent.  This must point
+**                          to the first byte of the software bus message header
+**                          (#CFE_SB_Msg_t).
+**
+** \param[in]  TimeOut      The number of milliseconds to wait for pipe space,
+**                          #CFE_SB_POLL not to wait or #CFE_SB_PEND_FOREVER
+**                          to wait until there is space.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MSG_TOO_BIG  \copybrief CFE_SB_MSG_TOO_BIG
+** \retval #CFE_SB_BUF_ALOC_ERR \copybrief CFE_SB_BUF_ALOC_ERR
+** \retval #CFE_SB_TIME_OUT     \copybrief CFE_SB_TIME_OUT
+**
+** \sa #CFE_SB_SendMsg, #CFE_SB_SetPipeOpts, #CFE_SB_PIPEOPTS_LOSSLESS
+**/
+int32  CFE_SB_SendMsgTimeout(CFE_SB_Msg_t *MsgPtr, int32 TimeOut);
+
 /*****************************************************************************/
 /**
 ** \brief Passes a software bus message
@@ -596,6 +1079,79 @@ int32  CFE_SB_SendMsg(CFE_SB_Msg_t   *MsgPtr);
 **/
 int32  CFE_SB_PassMsg(CFE_SB_Msg_t   *MsgPtr);
 
+/*****************************************************************************/
+/**
+** \brief Send a batch of software bus messages
+**
+** \par Description
+**          This routine sends each of the specified messages to all of its
+**          subscribers, exactly as #CFE_SB_SendMsg would.  Routing the whole
+**          batch in one call saves the per-message locking and lookup overhead
+**          for applications that publish many packets back to back.
+**
+** \par Assumptions, External Events, and Notes:
+**          - Messages are sent in array order.
+**          - A message that cannot be sent does not stop the rest of the batch.
+**          - Send errors are counted per message, but at most one event of
+**            each kind is issued per batch.
+**          - This function tracks and increments the source sequence counter
+**            of each telemetry message.
+**
+** \param[in]  MsgArray     An array of pointers to the messages to be sent.
+**
+** \param[in]  Count        The number of messages in \c MsgArray.
+**
+** \param[out] StatusArray  An optional array of \c Count entries that receives
+**                          the status of each message (see #CFE_SB_SendMsg).
+**                          May be NULL.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MSG_TOO_BIG  \copybrief CFE_SB_MSG_TOO_BIG
+** \retval #CFE_SB_BUF_ALOC_ERR \copybrief CFE_SB_BUF_ALOC_ERR
+**
+** \sa #CFE_SB_SendMsg, #CFE_SB_ZeroCopySendBatch
+**/
+int32  CFE_SB_SendMsgBatch(CFE_SB_Msg_t **MsgArray, uint32 Count, int32 *StatusArray);
+
+/*****************************************************************************/
+/**
+** \brief Send a software bus message assembled from fragments
+**
+** \par Description
+**          This routine sends a message made up of the concatenation of the
+**          given fragments, typically a header and one or more payload
+**          pieces, to all subscribers of its MsgId.  The fragments are copied
+**          once, straight into the software bus buffer, so an application
+**          forwarding a payload does not need to assemble the packet first.
+**
+** \par Assumptions, External Events, and Notes:
+**          - The first fragment must hold at least the primary header, as
+**            the MsgId is read from it, and the fragments together must
+**            hold the whole header that primary header declares.
+**          - The length in the header is set to the total length of the
+**            fragments and, for a command packet, the checksum is generated.
+**            The header fragment itself is not modified.  If either fails
+**            the message is not sent and the MSG module status is returned.
+**          - This function tracks and increments the source sequence counter
+**            of a telemetry message.
+**
+** \param[in]  IoVec        An array of fragments, in message order.
+**
+** \param[in]  Count        The number of fragments in \c IoVec.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MSG_TOO_BIG  \copybrief CFE_SB_MSG_TOO_BIG
+** \retval #CFE_SB_BUF_ALOC_ERR \copybrief CFE_SB_BUF_ALOC_ERR
+** \retval #CFE_MSG_BAD_ARGUMENT \copybrief CFE_MSG_BAD_ARGUMENT
+**
+** \sa #CFE_SB_SendMsg, #CFE_SB_ZeroCopySend
+**/
+int32  CFE_SB_SendMsgV(const CFE_SB_IoVec_t *IoVec, uint32 Count);
+
 /*****************************************************************************/
 /**
 ** \brief Receive a message from a software bus pipe
@@ -641,6 +1197,55 @@ int32  CFE_SB_PassMsg(CFE_SB_Msg_t   *MsgPtr);
 int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t  *BufPtr,
                      CFE_SB_PipeId_t  PipeId,
                      int32            TimeOut);
+
+/*****************************************************************************/
+/**
+** \brief Receive a batch of messages from a software bus pipe
+**
+** \par Description
+**          This routine waits for a message on the specified pipe like
+**          #CFE_SB_RcvMsg, then also takes every further message already
+**          waiting on the pipe, up to \c MaxCount, without waiting again.
+**          The messages of the previous receive on the pipe are released and
+**          the new ones accounted for in a single pass, which makes draining
+**          a busy pipe much cheaper than one #CFE_SB_RcvMsg call per message.
+**
+** \par Assumptions, External Events, and Notes:
+**          - Messages are returned in the order they were written to the pipe.
+**          - At most #CFE_PLATFORM_SB_MAX_RCV_BATCH messages are returned per
+**            call; a larger \c MaxCount is reduced to that limit.
+**          - The returned pointers are read-only and remain valid only until
+**            the next call to #CFE_SB_RcvMsgBatch or #CFE_SB_RcvMsg for the
+**            same pipe.
+**
+** \param[out] BufPtrArray  An array of at least \c MaxCount entries that
+**                          receives a pointer to each message obtained.
+**
+** \param[in]  MaxCount     The maximum number of messages to obtain.
+**
+** \param[out] CountPtr     The number of messages stored in \c BufPtrArray.
+**
+** \param[in]  PipeId       The pipe ID of the pipe containing the messages.
+**
+** \param[in]  TimeOut      The number of milliseconds to wait for a new message if the
+**                          pipe is empty at the time of the call.  This can also be set
+**                          to #CFE_SB_POLL for a non-blocking receive or
+**                          #CFE_SB_PEND_FOREVER to wait forever for a message to arrive.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_TIME_OUT     \copybrief CFE_SB_TIME_OUT
+** \retval #CFE_SB_PIPE_RD_ERR  \copybrief CFE_SB_PIPE_RD_ERR
+** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
+**
+** \sa #CFE_SB_RcvMsg, #CFE_SB_SendMsgBatch
+**/
+int32  CFE_SB_RcvMsgBatch(CFE_SB_MsgPtr_t  *BufPtrArray,
+                          uint32           MaxCount,
+                          uint32           *CountPtr,
+                          CFE_SB_PipeId_t  PipeId,
+                          int32            TimeOut);
 /**@}*/
 
 /** @defgroup CFEAPISBZeroCopy cFE Zero Copy Message APIs
@@ -797,6 +1402,155 @@ int32 CFE_SB_ZeroCopySend(CFE_SB_Msg_t   *MsgPtr,
 **/
 int32 CFE_SB_ZeroCopyPass(CFE_SB_Msg_t   *MsgPtr,
                           CFE_SB_ZeroCopyHandle_t          BufferHandle);
+
+/*****************************************************************************/
+/**
+** \brief Send a batch of SB messages in "zero copy" mode.
+**
+** \par Description
+**          This routine sends each of the specified messages, created by the
+**          application in buffers obtained with #CFE_SB_ZeroCopyGetPtr,
+**          exactly as #CFE_SB_ZeroCopySend would.  Routing the whole batch in
+**          one call saves the per-message locking and lookup overhead.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Each message pointer must be paired with the handle supplied
+**             with the #CFE_SB_ZeroCopyGetPtr call for that buffer.
+**          -# Applications must not de-reference any message pointer of the
+**             batch after the call, except one whose status is
+**             #CFE_SB_BUFFER_INVALID.
+**          -# Send errors are counted per message, but at most one event of
+**             each kind is issued per batch.
+**          -# This function tracks and increments the source sequence counter
+**             of each telemetry message.
+**
+** \param[in]  MsgArray     An array of pointers to the SB messages to be sent.
+**
+** \param[in]  HandleArray  An array of the matching buffer handles.
+**
+** \param[in]  Count        The number of entries in \c MsgArray and \c HandleArray.
+**
+** \param[out] StatusArray  An optional array of \c Count entries that receives
+**                          the status of each message (see #CFE_SB_ZeroCopySend).
+**                          May be NULL.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT   \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MSG_TOO_BIG    \copybrief CFE_SB_MSG_TOO_BIG
+** \retval #CFE_SB_BUF_ALOC_ERR   \copybrief CFE_SB_BUF_ALOC_ERR
+** \retval #CFE_SB_BUFFER_INVALID \copybrief CFE_SB_BUFFER_INVALID
+**
+** \sa #CFE_SB_ZeroCopySend, #CFE_SB_SendMsgBatch, #CFE_SB_ZeroCopyGetPtr
+**/
+int32 CFE_SB_ZeroCopySendBatch(CFE_SB_Msg_t **MsgArray, CFE_SB_ZeroCopyHandle_t *HandleArray,
+                               uint32 Count, int32 *StatusArray);
+
+/*****************************************************************************/
+/**
+** \brief Retain a received SB message beyond the next receive on its pipe.
+**
+** \par Description
+**          A message returned by #CFE_SB_RcvMsg or #CFE_SB_RcvMsgBatch is
+**          normally released on the next receive from the same pipe.  This
+**          routine detaches the buffer holding the message from the pipe and
+**          hands the pipe's reference to the buffer to a "zero copy" handle,
+**          so the message stays valid until the handle is given up.  The
+**          handle may be used exactly like one obtained from
+**          #CFE_SB_ZeroCopyGetPtr: the message can be forwarded without a copy
+**          with #CFE_SB_ZeroCopyPass (or #CFE_SB_ZeroCopySend), or released
+**          with #CFE_SB_ReleaseRetained.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Only the task that received the message from the pipe may
+**             retain it, before its next receive on that pipe.
+**          -# The buffer may also have been delivered to other pipes.  Retained
+**             messages must be treated as read-only; use #CFE_SB_ZeroCopyPass
+**             rather than #CFE_SB_ZeroCopySend to forward them, as the latter
+**             updates the sequence counter in the shared buffer.
+**          -# Retained messages that are never released are released when the
+**             application is cleaned up, like any other "zero copy" buffer.
+**          -# The same message delivered to several pipes may be retained
+**             through each of them.  The handles share the one buffer, which
+**             is returned to the memory pool when the last of them is given up.
+**             When an application is cleaned up, only the handles it holds
+**             are released; the message stays valid for other holders.
+**
+** \param[in]  MsgPtr        A pointer to the message, as returned by the last
+**                           receive on \c PipeId.
+**
+** \param[in]  PipeId        The pipe the message was received from.
+**
+** \param[out] BufferHandle  The handle to use with #CFE_SB_ZeroCopyPass,
+**                           #CFE_SB_ZeroCopySend or #CFE_SB_ReleaseRetained.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT   \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_BUFFER_INVALID \copybrief CFE_SB_BUFFER_INVALID
+**
+** \sa #CFE_SB_ReleaseRetained, #CFE_SB_ZeroCopyPass, #CFE_SB_RcvMsg
+**/
+int32 CFE_SB_RetainMsg(CFE_SB_Msg_t *MsgPtr, CFE_SB_PipeId_t PipeId,
+                       CFE_SB_ZeroCopyHandle_t *BufferHandle);
+
+/*****************************************************************************/
+/**
+** \brief Release a message retained with #CFE_SB_RetainMsg.
+**
+** \par Description
+**          This routine gives up the reference to a message obtained with
+**          #CFE_SB_RetainMsg.  The buffer is returned to the memory pool once
+**          no pipe or other handle refers to it any more.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Applications must not de-reference the message pointer (for reading
+**             or writing) after the call to #CFE_SB_ReleaseRetained.
+**
+** \param[in]  MsgPtr        A pointer to the retained message.
+**
+** \param[in]  BufferHandle  The handle returned by #CFE_SB_RetainMsg.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BUFFER_INVALID \copybrief CFE_SB_BUFFER_INVALID
+**
+** \sa #CFE_SB_RetainMsg
+**/
+int32 CFE_SB_ReleaseRetained(CFE_SB_Msg_t *MsgPtr, CFE_SB_ZeroCopyHandle_t BufferHandle);
+
+/*****************************************************************************/
+/**
+** \brief Get the application that sent a received SB message.
+**
+** \par Description
+**          Returns the ID of the application that sent or passed a message
+**          returned by #CFE_SB_RcvMsg or #CFE_SB_RcvMsgBatch.  The sender
+**          is recorded with the buffer by SB itself, not in the message, so
+**          it is known even for a message passed on unchanged with
+**          #CFE_SB_PassMsg or #CFE_SB_ZeroCopyPass.  A bridge can use it to
+**          recognize the traffic it injected itself.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Only the task that received the message from the pipe may ask
+**             for its sender, before its next receive on that pipe.
+**
+** \param[in]  MsgPtr       A pointer to the message, as returned by the last
+**                          receive on \c PipeId.
+**
+** \param[in]  PipeId       The pipe the message was received from.
+**
+** \param[out] SenderIdPtr  The application ID of the sender.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT   \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_BUFFER_INVALID \copybrief CFE_SB_BUFFER_INVALID
+**
+** \sa #CFE_SB_RcvMsg, #CFE_SB_RetainMsg
+**/
+int32 CFE_SB_GetMsgSender(const CFE_SB_Msg_t *MsgPtr, CFE_SB_PipeId_t PipeId,
+                          CFE_ES_ResourceID_t *SenderIdPtr);
 /**@}*/
 
 /** @defgroup CFEAPISBSetMessage cFE Setting Message Characteristics APIs
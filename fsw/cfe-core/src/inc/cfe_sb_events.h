@@ -40,7 +40,7 @@
 ** and when you're done adding, set this to the highest EID you used. It may
 ** be worthwhile to, on occasion, re-number the EID's to put them back in order.
 */
-#define CFE_SB_MAX_EID                  67
+#define CFE_SB_MAX_EID                  79
 
 /*
 ** SB task event message ID's.
@@ -251,6 +251,163 @@
 **/
 #define CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID         67
 
+/** \brief <tt> 'Subscription Rcvd:MsgId 0x\%x-0x\%x,Mask 0x\%x on \%s(\%d),\%d of \%d new,app \%s' </tt>
+**  \event <tt> 'Subscription Rcvd:MsgId 0x\%x-0x\%x,Mask 0x\%x on \%s(\%d),\%d of \%d new,app \%s' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This debug event message is issued when #CFE_SB_SubscribeRange or
+**  #CFE_SB_SubscribeMask completes successfully.  One event is issued for the
+**  whole set of message ids, giving the number of message ids that were newly
+**  subscribed and the number of message ids in the set.
+**/
+#define CFE_SB_SUBSCRIPTION_SET_RCVD_EID            68
+
+/** \brief <tt> 'Delivery policy set:MsgId 0x\%x on \%s(\%d),mode \%d,param \%d,app \%s' </tt>
+**  \event <tt> 'Delivery policy set:MsgId 0x\%x on \%s(\%d),mode \%d,param \%d,app \%s' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This debug event message is issued when #CFE_SB_SetDeliveryPolicy completes
+**  successfully.
+**/
+#define CFE_SB_SET_POLICY_EID                       69
+
+/** \brief <tt> 'Delivery policy Err:Bad Arg,MsgId 0x\%x,PipeId \%d,mode \%d,app \%s' </tt>
+**  \event <tt> 'Delivery policy Err:Bad Arg,MsgId 0x\%x,PipeId \%d,mode \%d,app \%s' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This error event message is issued when #CFE_SB_SetDeliveryPolicy is called
+**  with a NULL or invalid policy, an invalid MsgId or PipeId, by an app that
+**  does not own the pipe, or for a MsgId the pipe is not subscribed to.
+**/
+#define CFE_SB_SET_POLICY_ERR_EID                   70
+
+/** \brief <tt> 'Latency statistics packet sent,Msg 0x\%x,Pipe \%d' </tt>
+**  \event <tt> 'Latency statistics packet sent,Msg 0x\%x,Pipe \%d' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This debug event message is issued when SB receives a cmd to send the
+**  latency statistics pkt of a pipe.
+**/
+#define CFE_SB_SND_LATENCY_EID                      71
+
+/** \brief <tt> 'Send Latency Stats Cmd:Invalid Param,Pipe \%d' </tt>
+**  \event <tt> 'Send Latency Stats Cmd:Invalid Param,Pipe \%d' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This error event message is issued when SB receives a cmd to send the
+**  latency statistics pkt for a pipe that does not exist.
+**/
+#define CFE_SB_SND_LATENCY_ERR_EID                  72
+
+/** \brief <tt> '\%s not written, \%s is still being written' </tt>
+**  \event <tt> '\%s not written, \%s is still being written' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This error event message is issued when the SB 'Send Routing Info' cmd,
+**  the SB 'Send Pipe Info' cmd or the SB 'Send Map Info' cmd is received
+**  while the file requested by an earlier one of these cmds is still being
+**  written.
+**/
+#define CFE_SB_SND_RTG_BUSY_EID                     73
+
+/** \brief <tt> 'Broadcast topic set:MsgId 0x\%x,depth \%d,app \%s' </tt>
+**  \event <tt> 'Broadcast topic set:MsgId 0x\%x,depth \%d,app \%s' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This debug event message is issued when #CFE_SB_SetBroadcastTopic makes a
+**  MsgId a broadcast topic, or removes the topic when the depth is zero.
+**/
+#define CFE_SB_BCAST_TOPIC_EID                      74
+
+/** \brief <tt> 'Broadcast topic Err:MsgId 0x\%x,depth \%d,stat 0x\%x,app \%s' </tt>
+**  \event <tt> 'Broadcast topic Err:MsgId 0x\%x,depth \%d,stat 0x\%x,app \%s' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This error event message is issued when #CFE_SB_SetBroadcastTopic is called
+**  with an invalid MsgId or depth, for a MsgId that already is a broadcast
+**  topic (or is not one, when removing it), when every broadcast topic is in
+**  use or when the topic ring cannot be allocated.  The stat field is the
+**  status returned to the caller.
+**/
+#define CFE_SB_BCAST_TOPIC_ERR_EID                  75
+
+/** \brief <tt> 'Subscription Rcvd:\%d MsgIds on \%s(\%d),\%d new,app \%s' </tt>
+**  \event <tt> 'Subscription Rcvd:\%d MsgIds on \%s(\%d),\%d new,app \%s' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This debug event message is issued when #CFE_SB_SubscribeMany completes
+**  successfully.  One event is issued for the whole list, giving the number of
+**  message ids in the list and the number that were newly subscribed.
+**/
+#define CFE_SB_SUBSCRIPTION_LIST_RCVD_EID           76
+
+/** \brief <tt> 'Subscriptions Removed:\%d of \%d MsgIds on pipe \%d,app \%s' </tt>
+**  \event <tt> 'Subscriptions Removed:\%d of \%d MsgIds on pipe \%d,app \%s' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This debug event message is issued when #CFE_SB_UnsubscribeMany completes
+**  successfully.  One event is issued for the whole list, giving the number of
+**  subscriptions that were removed and the number of message ids in the list.
+**  It is also issued when a pipe that has subscriptions is deleted, giving the
+**  number of subscriptions removed with the pipe.
+**/
+#define CFE_SB_SUBSCRIPTION_LIST_REMOVED_EID        77
+
+/** \brief <tt> 'Coalescing set:MsgId 0x\%x on \%s(\%d),enable \%d,app \%s' </tt>
+**  \event <tt> 'Coalescing set:MsgId 0x\%x on \%s(\%d),enable \%d,app \%s' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This debug event message is issued when #CFE_SB_SetCoalescing completes
+**  successfully.
+**/
+#define CFE_SB_SET_COALESCE_EID                     78
+
+/** \brief <tt> 'Coalescing Err:Bad Arg,MsgId 0x\%x,PipeId \%d,app \%s' </tt>
+**  \event <tt> 'Coalescing Err:Bad Arg,MsgId 0x\%x,PipeId \%d,app \%s' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This error event message is issued when #CFE_SB_SetCoalescing is called
+**  with an invalid MsgId or PipeId, by an app that does not own the pipe, or
+**  for a MsgId the pipe is not subscribed to.
+**/
+#define CFE_SB_SET_COALESCE_ERR_EID                 79
+
 /** \brief <tt> 'Subscribe Err:Bad Arg,MsgId 0x\%x,PipeId \%d,app \%s,scope \%d' </tt>
 **  \event <tt> 'Subscribe Err:Bad Arg,MsgId 0x\%x,PipeId \%d,app \%s,scope \%d' </tt>
 **
@@ -412,8 +569,8 @@
 **/
 #define CFE_SB_GET_BUF_ERR_EID          16
 
-/** \brief <tt> 'Send Err:Msg Limit Err MsgId 0x\%x,pipe \%s,sender \%s' </tt>
-**  \event <tt> 'Send Err:Msg Limit Err MsgId 0x\%x,pipe \%s,sender \%s' </tt>
+/** \brief <tt> 'Msg Limit Err,MsgId 0x\%x,pipe \%s,sender \%s,count \%u' </tt>
+**  \event <tt> 'Msg Limit Err,MsgId 0x\%x,pipe \%s,sender \%s,count \%u' </tt>
 **
 **  \par Type: ERROR
 **
@@ -428,6 +585,9 @@
 **  subscriber of the message dictates this limit count in the 'MsgLim' parameter of
 **  the #CFE_SB_SubscribeEx API or uses the default value of 4 if using the
 **  #CFE_SB_Subscribe API.
+**
+**  The error is reported by the SB task on its next housekeeping request, with
+**  the number of times it occurred since the last report and the first sender.
 **/
 #define CFE_SB_MSGID_LIM_ERR_EID        17
 
@@ -497,8 +657,8 @@
 **/
 #define CFE_SB_SUBSCRIPTION_RPT_EID     22
 
-/** \brief <tt> 'Pipe Overflow,MsgId 0x\%x,pipe \%s,stat 0x\%x,app \%s' </tt>
-**  \event <tt> 'Pipe Overflow,MsgId 0x\%x,pipe \%s,stat 0x\%x,app \%s' </tt>
+/** \brief <tt> 'Pipe Overflow,MsgId 0x\%x,pipe \%s,sender \%s,count \%u' </tt>
+**  \event <tt> 'Pipe Overflow,MsgId 0x\%x,pipe \%s,sender \%s,count \%u' </tt>
 **
 **  \par Type: ERROR
 **
@@ -510,11 +670,14 @@
 **  not readings its messages fast enough or at all. It may also mean that the
 **  pipe depth is not deep enough. The pipe depth is an input parameter to the
 **  #CFE_SB_CreatePipe API.
+**
+**  The error is reported by the SB task on its next housekeeping request, with
+**  the number of times it occurred since the last report and the first sender.
 **/
 #define CFE_SB_Q_FULL_ERR_EID           25
 
-/** \brief <tt> 'Pipe Write Err,MsgId 0x\%x,pipe \%s,stat 0x\%x,app \%s' </tt>
-**  \event <tt> 'Pipe Write Err,MsgId 0x\%x,pipe \%s,stat 0x\%x,app \%s' </tt>
+/** \brief <tt> 'Pipe Write Err,MsgId 0x\%x,pipe \%s,sender \%s,stat 0x\%x,count \%u' </tt>
+**  \event <tt> 'Pipe Write Err,MsgId 0x\%x,pipe \%s,sender \%s,stat 0x\%x,count \%u' </tt>
 **
 **  \par Type: ERROR
 **
@@ -526,6 +689,10 @@
 **  returned an unexpected error. The return code is displayed in the event. For
 **  more information, the user may look up the return code in the OSAL documention or
 **  source code.
+**
+**  The error is reported by the SB task on its next housekeeping request, with
+**  the number of times it occurred since the last report, the first sender and
+**  the status of the first failed write.
 **/
 #define CFE_SB_Q_WR_ERR_EID             26
 
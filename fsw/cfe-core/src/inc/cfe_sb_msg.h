@@ -174,15 +174,22 @@
 **       - The #CFE_SB_SND_RTG_EID debug event message will be generated. All
 **         debug events are filtered by default.
 **
+**       The file entries are written by the SB task in the background, after
+**       the command has been counted.  The #CFE_SB_SND_RTG_EID event marks
+**       the completion of the file.
+**
 **  \par Error Conditions
 **       - Errors may occur during write operations to the file. Possible
 **         causes might be insufficient space in the file system or the
 **         filename or file path is improperly specified.
+**       - Another routing, pipe or map info file is still being written.
 **
 **       Evidence of failure may be found in the following telemetry:
-**       - \b \c \SB_CMDEC - command error counter will increment
+**       - \b \c \SB_CMDEC - command error counter will increment, except for
+**         errors writing the file entries
 **       - A command specific error event message is issued for all error
-**         cases. See #CFE_SB_SND_RTG_ERR1_EID and #CFE_SB_FILEWRITE_ERR_EID
+**         cases. See #CFE_SB_SND_RTG_ERR1_EID, #CFE_SB_SND_RTG_BUSY_EID and
+**         #CFE_SB_FILEWRITE_ERR_EID
 **
 **  \par Criticality
 **       This command is not inherently dangerous.  It will create a new
@@ -301,15 +308,22 @@
 **       - The #CFE_SB_SND_RTG_EID debug event message will be generated. All
 **         debug events are filtered by default.
 **
+**       The file entries are written by the SB task in the background, after
+**       the command has been counted.  The #CFE_SB_SND_RTG_EID event marks
+**       the completion of the file.
+**
 **  \par Error Conditions
 **       - Errors may occur during write operations to the file. Possible
 **         causes might be insufficient space in the file system or the
 **         filename or file path is improperly specified.
+**       - Another routing, pipe or map info file is still being written.
 **
 **       Evidence of failure may be found in the following telemetry:
-**       - \b \c \SB_CMDEC - command error counter will increment
+**       - \b \c \SB_CMDEC - command error counter will increment, except for
+**         errors writing the file entries
 **       - A command specific error event message is issued for all error
-**         cases. See #CFE_SB_SND_RTG_ERR1_EID and #CFE_SB_FILEWRITE_ERR_EID
+**         cases. See #CFE_SB_SND_RTG_ERR1_EID, #CFE_SB_SND_RTG_BUSY_EID and
+**         #CFE_SB_FILEWRITE_ERR_EID
 **
 **  \par Criticality
 **       This command is not inherently dangerous.  It will create a new
@@ -346,15 +360,22 @@
 **       - The #CFE_SB_SND_RTG_EID debug event message will be generated. All
 **         debug events are filtered by default.
 **
+**       The file entries are written by the SB task in the background, after
+**       the command has been counted.  The #CFE_SB_SND_RTG_EID event marks
+**       the completion of the file.
+**
 **  \par Error Conditions
 **       - Errors may occur during write operations to the file. Possible
 **         causes might be insufficient space in the file system or the
 **         filename or file path is improperly specified.
+**       - Another routing, pipe or map info file is still being written.
 **
 **       Evidence of failure may be found in the following telemetry:
-**       - \b \c \SB_CMDEC - command error counter will increment
+**       - \b \c \SB_CMDEC - command error counter will increment, except for
+**         errors writing the file entries
 **       - A command specific error event message is issued for all error
-**         cases. See #CFE_SB_SND_RTG_ERR1_EID and #CFE_SB_FILEWRITE_ERR_EID
+**         cases. See #CFE_SB_SND_RTG_ERR1_EID, #CFE_SB_SND_RTG_BUSY_EID and
+**         #CFE_SB_FILEWRITE_ERR_EID
 **
 **  \par Criticality
 **       This command is not inherently dangerous.  It will create a new
@@ -463,6 +484,45 @@
 */
 #define CFE_SB_SEND_PREV_SUBS_CC        11
 
+/** \cfesbcmd Send Latency Statistics
+**
+**  \par Description
+**       This command will cause the SB task to send a packet containing the
+**       histogram of the time messages have waited on a pipe, from the send
+**       to the receive of each message, and optionally the histogram of one
+**       message id.  This may be used to find receivers that do not keep up
+**       with their pipes.
+**
+**  \cfecmdmnemonic \SB_SENDLATENCY
+**
+**  \par Command Structure
+**       #CFE_SB_SendLatencyStats_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with the
+**       following telemetry:
+**       - \b \c \SB_CMDPC - command execution counter will increment
+**       - Receipt of latency packet with MsgId #CFE_SB_LATENCY_TLM_MID
+**       - The #CFE_SB_SND_LATENCY_EID debug event message will be generated.
+**         All debug events are filtered by default.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason:
+**       - The pipe does not exist
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \SB_CMDEC - command error counter will increment
+**       - The #CFE_SB_SND_LATENCY_ERR_EID error event message will be generated.
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create and send
+**       a message on the software bus. If performed repeatedly, it is
+**       possible that receiver pipes may overflow.
+**
+**  \sa #CFE_SB_LatencyTlm_t, #CFE_SB_SEND_SB_STATS_CC
+*/
+#define CFE_SB_SEND_LATENCY_STATS_CC    12
+
 
 /****************************
 **  SB Command Formats     **
@@ -514,6 +574,9 @@ typedef CFE_SB_WriteFileInfoCmd_t CFE_SB_SendMapInfo_t;
 **  'Enable Route' #CFE_SB_ENABLE_ROUTE_CC and 'Disable Route' #CFE_SB_DISABLE_ROUTE_CC.
 **  A route is the destination pipe for a  particular message and is therefore defined
 **  as a MsgId and PipeId combination.
+**
+**  'Send Latency Statistics' #CFE_SB_SEND_LATENCY_STATS_CC uses the same format
+**  to select the pipe and the message id to report on.
 */
 typedef struct CFE_SB_RouteCmd_Payload {
 
@@ -532,6 +595,7 @@ typedef struct CFE_SB_RouteCmd {
  */
 typedef CFE_SB_RouteCmd_t CFE_SB_EnableRoute_t;
 typedef CFE_SB_RouteCmd_t CFE_SB_DisableRoute_t;
+typedef CFE_SB_RouteCmd_t CFE_SB_SendLatencyStats_t;
 
 /****************************
 **  SB Telemetry Formats   **
@@ -606,6 +670,22 @@ typedef struct CFE_SB_PipeDepthStats {
                                    \brief Number of messages currently on the pipe */
     uint16              PeakInUse;/**< \cfetlmmnemonic \SB_PDPKINUSE
                                        \brief Peak number of messages that have been on the pipe */
+    uint16              HighInUse;/**< \cfetlmmnemonic \SB_PDHIINUSE
+                                       \brief Number of messages currently on the high priority lane of the pipe */
+    uint16              HighPeakInUse;/**< \cfetlmmnemonic \SB_PDHIPKINUSE
+                                           \brief Peak number of messages that have been on the high priority lane of the pipe */
+    uint16              Overflows;/**< \cfetlmmnemonic \SB_PDOVERFLOWS
+                                       \brief Number of messages dropped because the normal lane of the pipe was full */
+    uint16              HighOverflows;/**< \cfetlmmnemonic \SB_PDHIOVERFLOWS
+                                           \brief Number of messages dropped because the high priority lane of the pipe was full */
+    uint16              MaxDepth;/**< \cfetlmmnemonic \SB_PDMAXDEPTH
+                                      \brief Number of messages an elastic pipe can grow to, the depth for other pipes */
+    uint16              PeakDepth;/**< \cfetlmmnemonic \SB_PDPKDEPTH
+                                       \brief Largest depth the pipe has grown to */
+    uint16              Grows;/**< \cfetlmmnemonic \SB_PDGROWS
+                                   \brief Number of times an elastic pipe has grown */
+    uint16              Shrinks;/**< \cfetlmmnemonic \SB_PDSHRINKS
+                                     \brief Number of times an elastic pipe has shrunk back to its base depth */
 
 }CFE_SB_PipeDepthStats_t;
 
@@ -661,6 +741,54 @@ typedef struct CFE_SB_StatsTlm {
     CFE_SB_StatsTlm_Payload_t    Payload;
 } CFE_SB_StatsTlm_t;
 
+/**
+** \brief Number of buckets of a SB latency histogram
+*/
+#define CFE_SB_LATENCY_HIST_BUCKETS     24
+
+/**
+** \brief SB Latency Histogram
+**
+** Counts the time messages have waited from send to receive, in microseconds.
+** Bucket 0 counts waits under 1 microsecond, bucket N (N > 0) waits of at least
+** 2^(N-1) and under 2^N microseconds; the last bucket also counts all longer waits.
+*/
+typedef struct CFE_SB_LatencyHist {
+
+    uint32              Samples;/**< \brief Number of messages received */
+    uint32              MaxLatency;/**< \brief Longest wait in microseconds */
+    uint32              Bucket[CFE_SB_LATENCY_HIST_BUCKETS];/**< \brief Number of messages per log2 wait bucket */
+
+}CFE_SB_LatencyHist_t;
+
+/**
+** \cfesbtlm SB Latency Statistics Telemetry Packet
+**
+** SB Latency packet sent (via CFE_SB_SendMsg) in response to #CFE_SB_SEND_LATENCY_STATS_CC
+*/
+typedef struct CFE_SB_LatencyTlm_Payload {
+
+    CFE_SB_MsgId_t      MsgId;/**< \cfetlmmnemonic \SB_LTMSGID
+                               \brief Message Id of MsgIdHist, as commanded */
+    CFE_SB_PipeId_t     PipeId;/**< \cfetlmmnemonic \SB_LTPIPEID
+                                \brief Pipe Id of PipeHist, as commanded */
+    uint8               MsgIdValid;/**< \cfetlmmnemonic \SB_LTMIDVALID
+                                    \brief 1 if MsgIdHist holds the histogram of MsgId, 0 if the
+                                     MsgId is not routed or per MsgId histograms are not kept */
+    uint8               Spare[2];/**< \cfetlmmnemonic \SB_LTSPARE
+                                  \brief Spare bytes to ensure alignment */
+    CFE_SB_LatencyHist_t PipeHist;/**< \cfetlmmnemonic \SB_LTPIPEHIST
+                                   \brief Latency of all messages received from the pipe */
+    CFE_SB_LatencyHist_t MsgIdHist;/**< \cfetlmmnemonic \SB_LTMIDHIST
+                                    \brief Latency of the messages with MsgId received from any pipe */
+
+} CFE_SB_LatencyTlm_Payload_t;
+
+typedef struct CFE_SB_LatencyTlm {
+    CFE_SB_TlmHdr_t              Hdr;/**< \brief cFE Software Bus Telemetry Message Header */
+    CFE_SB_LatencyTlm_Payload_t  Payload;
+} CFE_SB_LatencyTlm_t;
+
 
 /**
 ** \brief SB Routing File Entry
@@ -672,6 +800,7 @@ typedef struct CFE_SB_RoutingFileEntry {
     CFE_SB_PipeId_t     PipeId;/**< \brief Pipe Id portion of the route */
     uint8               State;/**< \brief Route Enabled or Disabled */
     uint16              MsgCnt;/**< \brief Number of msgs with this MsgId sent to this PipeId */
+    uint16              SkipCnt;/**< \brief Number of msgs with this MsgId not delivered to this PipeId due to its delivery policy */
     char                AppName[CFE_MISSION_MAX_API_LEN];/**< \brief Pipe Depth Statistics */
     char                PipeName[CFE_MISSION_MAX_API_LEN];/**< \brief Pipe Depth Statistics */
  }CFE_SB_RoutingFileEntry_t;
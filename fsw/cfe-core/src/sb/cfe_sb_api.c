@@ -64,25 +64,68 @@
 #include "cfe_sb_priv.h"
 #include "cfe_sb.h"
 #include "osapi.h"
+#include "cfe_msgids.h"
 #include "cfe_es.h"
 #include "cfe_psp.h"
 #include "cfe_error.h"
 #include <string.h>
 
-/* 
- * Macro to reflect size of PipeDepthStats Telemetry array - 
- * this may or may not be the same as CFE_SB_MSG_MAX_PIPES
- */
-#define CFE_SB_TLM_PIPEDEPTHSTATS_SIZE     (sizeof(CFE_SB.StatTlmMsg.Payload.PipeDepthStats) / sizeof(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[0]))
-
 /*
  * Function: CFE_SB_CreatePipe - See API and header file for details
  */
 int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *PipeName)
+{
+
+    return CFE_SB_CreatePipeEx(PipeIdPtr, Depth, PipeName, 0);
+
+}/* end CFE_SB_CreatePipe */
+
+
+/*
+ * Function: CFE_SB_CreatePipeEx - See API and header file for details
+ */
+int32  CFE_SB_CreatePipeEx(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *PipeName, uint8 Opts)
+{
+
+    return CFE_SB_CreatePipeFull(PipeIdPtr, Depth, Depth, PipeName, Opts & ~CFE_SB_PIPEOPTS_ELASTIC);
+
+}/* end CFE_SB_CreatePipeEx */
+
+
+/*
+ * Function: CFE_SB_CreatePipeElastic - See API and header file for details
+ */
+int32  CFE_SB_CreatePipeElastic(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, uint16 MaxDepth,
+                                const char *PipeName, uint8 Opts)
+{
+
+    return CFE_SB_CreatePipeFull(PipeIdPtr, Depth, MaxDepth, PipeName, Opts);
+
+}/* end CFE_SB_CreatePipeElastic */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_CreatePipeFull()
+**
+**  Purpose:
+**    Creates a pipe.  A pipe with a MaxDepth above its Depth is an elastic
+**    pipe, which always uses the ring backend.
+**
+**  Arguments:
+**    PipeIdPtr - Set to the ID of the new pipe
+**    Depth     - Depth of the pipe
+**    MaxDepth  - Depth an elastic pipe may grow to, Depth otherwise
+**    PipeName  - Name of the pipe
+**    Opts      - Pipe options
+**
+**  Return:
+**    CFE_SUCCESS or cFE Error Code
+*/
+int32  CFE_SB_CreatePipeFull(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, uint16 MaxDepth,
+                             const char *PipeName, uint8 Opts)
 {
     CFE_ES_ResourceID_t  AppId;
     CFE_ES_ResourceID_t  TskId;
-    osal_id_t       SysQueueId;
     int32           Status;
     CFE_SB_PipeId_t OriginalPipeIdParamValue = (PipeIdPtr == NULL) ? 0 : (*PipeIdPtr);
     CFE_SB_PipeId_t PipeTblIdx;
@@ -110,7 +153,8 @@ int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *
     }/* end if */
 
     /* check input parameters */
-    if((PipeIdPtr == NULL)||(Depth > CFE_PLATFORM_SB_MAX_PIPE_DEPTH)||(Depth == 0)){
+    if((PipeIdPtr == NULL)||(Depth > CFE_PLATFORM_SB_MAX_PIPE_DEPTH)||(Depth == 0)||
+       (MaxDepth < Depth)||(MaxDepth > CFE_PLATFORM_SB_MAX_PIPE_DEPTH)){
         CFE_SB.HKTlmMsg.Payload.CreatePipeErrorCounter++;
         CFE_SB_UnlockSharedData(__func__,__LINE__);
         CFE_EVS_SendEventWithAppID(CFE_SB_CR_PIPE_BAD_ARG_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
@@ -119,6 +163,13 @@ int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *
         return CFE_SB_BAD_ARGUMENT;
     }/*end if*/
 
+    /* an elastic pipe needs the ring backend, the depth of an OSAL queue is fixed */
+    if(MaxDepth > Depth){
+        Opts |= CFE_SB_PIPEOPTS_RING | CFE_SB_PIPEOPTS_ELASTIC;
+    }else{
+        Opts &= ~CFE_SB_PIPEOPTS_ELASTIC;
+    }/* end if */
+
     /* get first available entry in pipe table */
     PipeTblIdx = CFE_SB_GetAvailPipeIdx();
 
@@ -132,7 +183,7 @@ int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *
     }/* end if */
 
     /* create the queue */
-    Status = OS_QueueCreate(&SysQueueId,PipeName,Depth,sizeof(CFE_SB_BufferD_t *),0);
+    Status = CFE_SB_QueueCreate_Unsync(&CFE_SB.PipeTbl[PipeTblIdx],PipeName,Depth,Opts);
     if (Status != OS_SUCCESS) {
         CFE_SB_UnlockSharedData(__func__,__LINE__);
 
@@ -164,15 +215,29 @@ int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *
 
     /* fill in the pipe table fields */
     CFE_SB.PipeTbl[PipeTblIdx].InUse       = CFE_SB_IN_USE;
-    CFE_SB.PipeTbl[PipeTblIdx].SysQueueId  = SysQueueId;
     CFE_SB.PipeTbl[PipeTblIdx].PipeId      = PipeTblIdx;
+    CFE_SB.PipeTbl[PipeTblIdx].Opts        = Opts;
     CFE_SB.PipeTbl[PipeTblIdx].QueueDepth  = Depth;
+    CFE_SB.PipeTbl[PipeTblIdx].BaseDepth   = Depth;
+    CFE_SB.PipeTbl[PipeTblIdx].MaxDepth    = MaxDepth;
+    CFE_SB.PipeTbl[PipeTblIdx].ElasticPeak = 0;
+    CFE_SB.PipeTbl[PipeTblIdx].QuietCycles = 0;
     CFE_SB.PipeTbl[PipeTblIdx].AppId       = AppId;
     CFE_SB.PipeTbl[PipeTblIdx].SendErrors  = 0;
     CFE_SB.PipeTbl[PipeTblIdx].CurrentBuff = NULL;
     CFE_SB.PipeTbl[PipeTblIdx].ToTrashBuff = NULL;
+    CFE_SB.PipeTbl[PipeTblIdx].PendingPuts = 0;
+    CFE_SB.PipeTbl[PipeTblIdx].BatchCount  = 0;
+    CFE_SB.PipeTbl[PipeTblIdx].BcastMask   = 0;
+    memset(CFE_SB.PipeTbl[PipeTblIdx].RouteMap, 0, sizeof(CFE_SB.PipeTbl[PipeTblIdx].RouteMap));
+    memset(&CFE_SB.PipeTbl[PipeTblIdx].Latency, 0, sizeof(CFE_SB.PipeTbl[PipeTblIdx].Latency));
     strcpy(&CFE_SB.PipeTbl[PipeTblIdx].AppName[0],&AppName[0]);
 
+    /* ready the first larger ring; if the pool is short, housekeeping tries again */
+    if(Opts & CFE_SB_PIPEOPTS_ELASTIC){
+        CFE_SB_ElasticPrepare_Unsync(&CFE_SB.PipeTbl[PipeTblIdx]);
+    }/* end if */
+
     /* Increment the Pipes in use ctr and if it's > the high water mark,*/
     /* adjust the high water mark */
     CFE_SB.StatTlmMsg.Payload.PipesInUse++;
@@ -187,6 +252,14 @@ int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *
     CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].Depth = Depth;
     CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].InUse = 0;
     CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].PeakInUse = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].HighInUse = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].HighPeakInUse = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].Overflows = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].HighOverflows = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].MaxDepth = MaxDepth;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].PeakDepth = Depth;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].Grows = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].Shrinks = 0;
     }
 
     /* give the pipe handle to the caller */
@@ -202,7 +275,7 @@ int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *
 
     return CFE_SUCCESS;
 
-}/* end CFE_SB_CreatePipe */
+}/* end CFE_SB_CreatePipeFull */
 
 
 /*
@@ -253,7 +326,8 @@ int32 CFE_SB_DeletePipeWithAppId(CFE_SB_PipeId_t PipeId, CFE_ES_ResourceID_t App
 **
 **  Purpose:
 **    Will unsubscribe to all routes associated with the given pipe id, then remove
-**    pipe from the pipe table.
+**    pipe from the pipe table.  The routes are found through the route map of
+**    the pipe and removed under one lock.
 **
 **  NOTE:This function cannot be called directly, it would not be semaphore protected
 **
@@ -266,12 +340,15 @@ int32 CFE_SB_DeletePipeWithAppId(CFE_SB_PipeId_t PipeId, CFE_ES_ResourceID_t App
 int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId,CFE_ES_ResourceID_t AppId)
 {
     uint8         PipeTblIdx;
-    int32         RtnFromVal,Stat;
+    int32         RtnFromVal;
     CFE_ES_ResourceID_t Owner;
     uint32        i;
+    uint32        Bit;
+    CFE_SB_RouteEntry_t *RoutePtr;
     CFE_ES_ResourceID_t TskId;
-    CFE_SB_Msg_t  *PipeMsgPtr;
-    CFE_SB_DestinationD_t *DestPtr = NULL;
+    uint16        DestIdx;
+    uint32        NumRoutes = 0;
+    uint32        NumRemoved = 0;
     char          FullName[(OS_MAX_API_NAME * 2)];
 
     /* get TaskId of caller for events */
@@ -306,56 +383,144 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId,CFE_ES_ResourceID_t AppId)
         return CFE_SB_BAD_ARGUMENT;
     }/* end if */
 
-    /* check destination list of every in-use MsgId, for the given pipeid. */
-    /* when found, remove the pipe ID from the destination list via 'unsubscribe' */
-    for(i=0;i<CFE_PLATFORM_SB_MAX_MSG_IDS;i++)
+    /* remove the pipe from the destination list of each route in its route map */
+    for(i=0;i<CFE_SB_ROUTE_MAP_WORDS;i++)
     {
-        if(CFE_SB_IsValidMsgId(CFE_SB.RoutingTbl[i].MsgId))
+        Bit = 0;
+        while(CFE_SB.PipeTbl[PipeTblIdx].RouteMap[i] != 0)
         {
-            DestPtr = CFE_SB.RoutingTbl[i].ListHeadPtr;
+            if(CFE_SB.PipeTbl[PipeTblIdx].RouteMap[i] & (1UL << Bit))
+            {
+                RoutePtr = &CFE_SB.RoutingTbl[(i * 32) + Bit];
+                NumRoutes++;
+
+                for(DestIdx = 0; (DestIdx < RoutePtr->Destinations) &&
+                                 (RoutePtr->DestArray[DestIdx].PipeId != PipeId); DestIdx++)
+                    ;
 
-            while(DestPtr != NULL){
+                if(DestIdx < RoutePtr->Destinations)
+                {
+                    CFE_SB_RemoveDest(RoutePtr,&RoutePtr->DestArray[DestIdx]);
 
-                if(DestPtr -> PipeId == PipeId){
-                    /* release the semaphore, unsubscribe will need to take it */
-                    CFE_SB_UnlockSharedData(__func__,__LINE__);
-                    CFE_SB_UnsubscribeWithAppId(CFE_SB.RoutingTbl[i].MsgId,
-                                       PipeId,AppId);
-                    CFE_SB_LockSharedData(__func__,__LINE__);
+                    CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse--;
+                    NumRemoved++;
                 }/* end if */
 
-                DestPtr = DestPtr -> Next;
+                /* RemoveDest clears the bit, this only guards against a stale one */
+                CFE_SB.PipeTbl[PipeTblIdx].RouteMap[i] &= ~(1UL << Bit);
+            }/* end if */
+            Bit++;
+        }/* end while */
+    }/* end for */
+
+    /*
+    ** Senders write pipe queues outside of the shared data lock.  A sender
+    ** that reserved a slot on this pipe before it was unsubscribed may still
+    ** be writing the queue, the queue is kept until the last one is done.
+    ** Whichever of this task and that sender finishes last releases the pipe.
+    */
+    CFE_SB.PipeTbl[PipeTblIdx].InUse = CFE_SB_PIPE_DELETING;
+    CFE_SB_MEMORY_BARRIER();
 
-            }/* end while */
+    /* a sender waiting for room on a lossless pipe gives up */
+    CFE_SB_QueueWakeWriters(&CFE_SB.PipeTbl[PipeTblIdx]);
 
-        }/* end if */
-    }/* end for */
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    CFE_SB_FinishPipeDelete(&CFE_SB.PipeTbl[PipeTblIdx]);
+
+    /* one event for the subscriptions removed with the pipe, sent outside the lock */
+    if(NumRoutes > 0)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_SB_SUBSCRIPTION_LIST_REMOVED_EID,CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
+            "Subscriptions Removed:%d of %d MsgIds on pipe %d,app %s",
+            (int)NumRemoved,(int)NumRoutes,(int)PipeId,CFE_SB_GetAppTskName(TskId,FullName));
+    }/* end if */
+
+    /*
+     * Get the app name of the actual pipe owner for the event string
+     * as this may be different than the task doing the deletion.
+     *
+     * Note: If this fails (e.g. bad AppID, it returns an empty string
+     */
+    CFE_ES_GetAppName(FullName, Owner, sizeof(FullName));
+
+    CFE_EVS_SendEventWithAppID(CFE_SB_PIPE_DELETED_EID,CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
+          "Pipe Deleted:id %d,owner %s",(int)PipeId, FullName);
 
-    if (CFE_SB.PipeTbl[PipeTblIdx].ToTrashBuff != NULL) {
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_DeletePipeFull */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_FinishPipeDelete()
+**
+**  Purpose:
+**    Releases the queue, the buffers and the table entry of a deleted pipe
+**    once no sender has a queue write pending on it.  Called by
+**    CFE_SB_DeletePipeFull and by the last CFE_SB_PendingPutEnd on the pipe,
+**    only one of them releases the pipe.
+**
+**  NOTE:Called without the shared data lock.
+**
+**  Arguments:
+**    PipeDscPtr - Pointer to the pipe descriptor
+**
+**  Return:
+**    None
+*/
+void CFE_SB_FinishPipeDelete(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    CFE_SB_QueueEntry_t  QueueEntry;
+    CFE_SB_PipeId_t      PipeTblIdx;
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    if((PipeDscPtr->InUse != CFE_SB_PIPE_DELETING)||(PipeDscPtr->PendingPuts != 0)){
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        return;
+    }/* end if */
+
+    PipeDscPtr->InUse = CFE_SB_PIPE_CLOSING;
+    PipeTblIdx = PipeDscPtr->PipeId;
+
+    if (PipeDscPtr->ToTrashBuff != NULL) {
 
         /* Decrement the Buffer Use Count and Free buffer if cnt=0) */
-        CFE_SB_DecrBufUseCnt(CFE_SB.PipeTbl[PipeTblIdx].ToTrashBuff);
-        CFE_SB.PipeTbl[PipeTblIdx].ToTrashBuff = NULL;
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->ToTrashBuff);
+        PipeDscPtr->ToTrashBuff = NULL;
+
+    }/* end if */
+
+    if (PipeDscPtr->CurrentBuff != NULL) {
+
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->CurrentBuff);
+        PipeDscPtr->CurrentBuff = NULL;
 
     }/* end if */
 
+    CFE_SB_ReleaseBatchBuffs_Unsync(PipeDscPtr);
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
 
     /* remove any messages that might be on the pipe */
     /* this step will free the memory used to store the message */
-    do{
-      CFE_SB_UnlockSharedData(__func__,__LINE__);
-      Stat = CFE_SB_RcvMsg(&PipeMsgPtr,PipeId,CFE_SB_POLL);
-      CFE_SB_LockSharedData(__func__,__LINE__);
-    }while(Stat == CFE_SUCCESS);
+    while(CFE_SB_QueueTryGet(PipeDscPtr, &QueueEntry) == OS_SUCCESS)
+    {
+        CFE_SB_LockSharedData(__func__,__LINE__);
+        CFE_SB_DecrBufUseCnt(QueueEntry.BufDscPtr);
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+    }/* end while */
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
 
-    /* Delete the underlying OS queue */
-    OS_QueueDelete(CFE_SB.PipeTbl[PipeTblIdx].SysQueueId);
+    /* Delete the underlying OS queue (and ring) */
+    CFE_SB_QueueDelete_Unsync(PipeDscPtr);
 
     /* remove the pipe from the pipe table */
-    CFE_SB.PipeTbl[PipeTblIdx].InUse         = CFE_SB_NOT_IN_USE;
-    CFE_SB.PipeTbl[PipeTblIdx].SysQueueId    = CFE_SB_UNUSED_QUEUE;
-    CFE_SB.PipeTbl[PipeTblIdx].PipeId        = CFE_SB_INVALID_PIPE;
-    CFE_SB.PipeTbl[PipeTblIdx].CurrentBuff   = NULL;
+    PipeDscPtr->SysQueueId    = CFE_SB_UNUSED_QUEUE;
+    PipeDscPtr->PipeId        = CFE_SB_INVALID_PIPE;
 
     /* zero out the pipe depth stats */
     if (PipeTblIdx < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE)
@@ -364,26 +529,24 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId,CFE_ES_ResourceID_t AppId)
     CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].Depth = 0;
     CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].InUse = 0;
     CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].PeakInUse = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].HighInUse = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].HighPeakInUse = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].Overflows = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].HighOverflows = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].MaxDepth = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].PeakDepth = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].Grows = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].Shrinks = 0;
     }
 
     CFE_SB.StatTlmMsg.Payload.PipesInUse--;
 
-    CFE_SB_UnlockSharedData(__func__,__LINE__);
-
-    /*
-     * Get the app name of the actual pipe owner for the event string
-     * as this may be different than the task doing the deletion.
-     *
-     * Note: If this fails (e.g. bad AppID, it returns an empty string
-     */
-    CFE_ES_GetAppName(FullName, Owner, sizeof(FullName));
-
-    CFE_EVS_SendEventWithAppID(CFE_SB_PIPE_DELETED_EID,CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
-          "Pipe Deleted:id %d,owner %s",(int)PipeId, FullName);
+    /* the entry may be reused from here on */
+    PipeDscPtr->InUse         = CFE_SB_NOT_IN_USE;
 
-    return CFE_SUCCESS;
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
 
-}/* end CFE_SB_DeletePipeFull */
+}/* end CFE_SB_FinishPipeDelete */
 
 
 /*
@@ -443,7 +606,24 @@ int32 CFE_SB_SetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 Opts)
         return CFE_SB_BAD_ARGUMENT;
     }/* end if */
 
-    CFE_SB.PipeTbl[PipeTblIdx].Opts = Opts;
+    /* senders wait for room on a lossless pipe on its space semaphore */
+    if(Opts & CFE_SB_PIPEOPTS_LOSSLESS)
+    {
+        Status = CFE_SB_QueueAddSpaceSignal_Unsync(&CFE_SB.PipeTbl[PipeTblIdx]);
+        if(Status != OS_SUCCESS)
+        {
+            CFE_SB.HKTlmMsg.Payload.PipeOptsErrorCounter++;
+            CFE_SB_UnlockSharedData(__func__,__LINE__);
+            CFE_ES_WriteToSysLog("SB SetPipeOpts:OS_CountSemCreate failed for pipe %d,Stat 0x%x\n",
+                                 (int)PipeId,(unsigned int)Status);
+            return CFE_SB_INTERNAL_ERR;
+        }/* end if */
+    }/* end if */
+
+    /* the queue backend is fixed when the pipe is created */
+    CFE_SB.PipeTbl[PipeTblIdx].Opts = (Opts & ~(CFE_SB_PIPEOPTS_RING | CFE_SB_PIPEOPTS_ELASTIC)) |
+                                      (CFE_SB.PipeTbl[PipeTblIdx].Opts &
+                                       (CFE_SB_PIPEOPTS_RING | CFE_SB_PIPEOPTS_ELASTIC));
 
     CFE_SB_UnlockSharedData(__func__,__LINE__);
 
@@ -728,14 +908,10 @@ int32  CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
                             uint16           MsgLim,
                             uint8            Scope)
 {
-    CFE_SB_MsgRouteIdx_t RouteIdx;
-    CFE_SB_RouteEntry_t* RoutePtr;
     int32  Stat;
-    CFE_SB_MsgKey_t   MsgKey;
     CFE_ES_ResourceID_t        TskId;
     CFE_ES_ResourceID_t  AppId;
     uint8  PipeIdx;
-    CFE_SB_DestinationD_t *DestBlkPtr = NULL;
     char   FullName[(OS_MAX_API_NAME * 2)];
     char   PipeName[OS_MAX_API_NAME] = {'\0'};
 
@@ -783,11 +959,10 @@ int32  CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
         return CFE_SB_BAD_ARGUMENT;
     }/* end if */
 
-    /* Convert the API MsgId into the SB internal representation MsgKey */
-    MsgKey = CFE_SB_ConvertMsgIdtoMsgKey(MsgId);
+    /* add the pipe to the destinations of this MsgId */
+    Stat = CFE_SB_AddSubscription_Unsync(MsgId, PipeId, Quality, MsgLim, Scope);
 
-    /* check for duplicate subscription */
-    if(CFE_SB_DuplicateSubscribeCheck(MsgKey,PipeId)==CFE_SB_DUPLICATE){
+    if(Stat == CFE_SB_DUPLICATE){
         CFE_SB.HKTlmMsg.Payload.DuplicateSubscriptionsCounter++;
         CFE_SB_UnlockSharedData(__func__,__LINE__);
         CFE_EVS_SendEventWithAppID(CFE_SB_DUP_SUBSCRIP_EID,CFE_EVS_EventType_INFORMATION,CFE_SB.AppId,
@@ -797,60 +972,18 @@ int32  CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
         return CFE_SUCCESS;
     }/* end if */
 
-    /*
-    ** If there has been a subscription for this message id earlier,
-    ** get the element number in the routing table.
-    */
-    RouteIdx = CFE_SB_GetRoutingTblIdx(MsgKey);
-
-    /* if not first subscription for this message KEY ... */
-    if(CFE_SB_IsValidRouteIdx(RouteIdx))
-    {
-        RoutePtr = CFE_SB_GetRoutePtrFromIdx(RouteIdx);
-
-        /*
-         * FIXME: If a hash or other conversion is used between MsgId and MsgKey,
-         * then it is possible that this existing route is for a different MsgId.
-         *
-         * The MsgId should be checked against the "MsgId" in the route here.
-         *
-         * However it is not possible to have a mismatch in the default case where
-         * MsgKey == MsgId
-         */
-    }
-    else
-    {
-        /* Get the index to the first available element in the routing table */
-        RouteIdx = CFE_SB_RouteIdxPop_Unsync();
-
-        /* if all routing table elements are used, send event */
-        if(!CFE_SB_IsValidRouteIdx(RouteIdx)){
-            CFE_SB_UnlockSharedData(__func__,__LINE__);
-            CFE_EVS_SendEventWithAppID(CFE_SB_MAX_MSGS_MET_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
-              "Subscribe Err:Max Msgs(%d)In Use,MsgId 0x%x,pipe %s,app %s",
-              CFE_PLATFORM_SB_MAX_MSG_IDS,
-              (unsigned int)CFE_SB_MsgIdToValue(MsgId),
-              PipeName,CFE_SB_GetAppTskName(TskId,FullName));
-            return CFE_SB_MAX_MSGS_MET;
-        }/* end if */
-
-        /* Increment the MsgIds in use ctr and if it's > the high water mark,*/
-        /* adjust the high water mark */
-        CFE_SB.StatTlmMsg.Payload.MsgIdsInUse++;
-        if(CFE_SB.StatTlmMsg.Payload.MsgIdsInUse > CFE_SB.StatTlmMsg.Payload.PeakMsgIdsInUse){
-           CFE_SB.StatTlmMsg.Payload.PeakMsgIdsInUse = CFE_SB.StatTlmMsg.Payload.MsgIdsInUse;
-        }/* end if */
-
-        /* populate the look up table with the routing table index */
-        CFE_SB_SetRoutingTblIdx(MsgKey,RouteIdx);
-
-        /* label the new routing block with the message identifier */
-        RoutePtr = CFE_SB_GetRoutePtrFromIdx(RouteIdx);
-        RoutePtr->MsgId = MsgId;
-
+    /* if all routing table elements are used, send event */
+    if(Stat == CFE_SB_MAX_MSGS_MET){
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_MAX_MSGS_MET_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+          "Subscribe Err:Max Msgs(%d)In Use,MsgId 0x%x,pipe %s,app %s",
+          CFE_PLATFORM_SB_MAX_MSG_IDS,
+          (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+          PipeName,CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_MAX_MSGS_MET;
     }/* end if */
 
-    if(RoutePtr->Destinations >= CFE_PLATFORM_SB_MAX_DEST_PER_PKT){
+    if(Stat == CFE_SB_MAX_DESTS_MET){
         CFE_SB_UnlockSharedData(__func__,__LINE__);
         CFE_EVS_SendEventWithAppID(CFE_SB_MAX_DESTS_MET_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
             "Subscribe Err:Max Dests(%d)In Use For Msg 0x%x,pipe %s,app %s",
@@ -861,8 +994,7 @@ int32  CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
         return CFE_SB_MAX_DESTS_MET;
     }/* end if */
 
-    DestBlkPtr = CFE_SB_GetDestinationBlk();
-    if(DestBlkPtr == NULL){
+    if(Stat != CFE_SUCCESS){
         CFE_SB_UnlockSharedData(__func__,__LINE__);
         CFE_EVS_SendEventWithAppID(CFE_SB_DEST_BLK_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
             "Subscribe Err:Request for Destination Blk failed for Msg 0x%x", 
@@ -870,27 +1002,6 @@ int32  CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
         return CFE_SB_BUF_ALOC_ERR;
     }/* end if */
 
-    /* initialize destination block */
-    DestBlkPtr -> PipeId = PipeId;
-    DestBlkPtr -> MsgId2PipeLim = (uint16)MsgLim;
-    DestBlkPtr -> Active = CFE_SB_ACTIVE;
-    DestBlkPtr -> BuffCount = 0;
-    DestBlkPtr -> DestCnt = 0;
-    DestBlkPtr -> Scope = Scope;
-    DestBlkPtr -> Prev = NULL;
-    DestBlkPtr -> Next = NULL;
-
-    /* add destination block to head of list */
-    CFE_SB_AddDest(RoutePtr, DestBlkPtr);
-
-    RoutePtr->Destinations++;
-
-    CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse++;
-    if(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse > CFE_SB.StatTlmMsg.Payload.PeakSubscriptionsInUse)
-    {
-       CFE_SB.StatTlmMsg.Payload.PeakSubscriptionsInUse = CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse;
-    }/* end if */
-
     if((CFE_SB.SubscriptionReporting == CFE_SB_ENABLE)&&(Scope==CFE_SB_GLOBAL)){
       CFE_SB.SubRprtMsg.Payload.MsgId = MsgId;
       CFE_SB.SubRprtMsg.Payload.Pipe = PipeId;
@@ -920,96 +1031,168 @@ int32  CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
 
 
 /*
- * Function: CFE_SB_Unsubscribe - See API and header file for details
+ * Function: CFE_SB_SubscribeRange - See API and header file for details
  */
-int32 CFE_SB_Unsubscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
+int32 CFE_SB_SubscribeRange(CFE_SB_MsgId_t   FirstMsgId,
+                            CFE_SB_MsgId_t   LastMsgId,
+                            CFE_SB_PipeId_t  PipeId)
 {
-    CFE_ES_ResourceID_t CallerId;
-    int32   Status = 0;
-
-    /* get the callers Application Id */
-    CFE_ES_GetAppID(&CallerId);
+    CFE_SB_MsgIdSet_t Set;
 
-    Status = CFE_SB_UnsubscribeFull(MsgId, PipeId, (uint8)CFE_SB_GLOBAL,CallerId);
+    Set.First = CFE_SB_MsgIdToValue(FirstMsgId);
+    Set.Last  = CFE_SB_MsgIdToValue(LastMsgId);
+    Set.Mask  = 0;
+    Set.Value = 0;
 
-    return Status;
+    return CFE_SB_SubscribeSetFull(&Set,PipeId,CFE_SB_Default_Qos,
+                                   (uint16)CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT,
+                                   (uint8)CFE_SB_GLOBAL);
 
-}/* end CFE_SB_Unsubscribe */
+}/* end CFE_SB_SubscribeRange */
 
 
 /*
- * Function: CFE_SB_UnsubscribeLocal - See API and header file for details
+ * Function: CFE_SB_SubscribeMask - See API and header file for details
  */
-int32 CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
+int32 CFE_SB_SubscribeMask(CFE_SB_MsgId_t       MsgId,
+                           CFE_SB_MsgId_Atom_t  Mask,
+                           CFE_SB_PipeId_t      PipeId)
 {
-    CFE_ES_ResourceID_t CallerId;
-    int32   Status = 0;
+    CFE_SB_MsgIdSet_t Set;
 
-    /* get the callers Application Id */
-    CFE_ES_GetAppID(&CallerId);
+    Set.First = 0;
+    Set.Last  = CFE_PLATFORM_SB_HIGHEST_VALID_MSGID;
+    Set.Mask  = Mask;
+    Set.Value = CFE_SB_MsgIdToValue(MsgId) & Mask;
 
-    Status = CFE_SB_UnsubscribeFull(MsgId, PipeId, (uint8)CFE_SB_LOCAL,CallerId);
+    return CFE_SB_SubscribeSetFull(&Set,PipeId,CFE_SB_Default_Qos,
+                                   (uint16)CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT,
+                                   (uint8)CFE_SB_GLOBAL);
 
-    return Status;
+}/* end CFE_SB_SubscribeMask */
 
-}/* end CFE_SB_UnsubscribeLocal */
+
+/******************************************************************************
+** Name:    CFE_SB_SubRprtInit
+**
+** Purpose: CFE Internal API used to start a report of the MsgIds of one
+**          subscription request, in the format of the previous subscriptions
+**          packet.  See CFE_SB_SubRprtAdd.
+**
+** Input Arguments:
+**          RptPtr     - Pointer to the report
+**          NumEntries - Number of subscriptions the report will hold
+**
+** Output Arguments:
+**          None
+**
+** Return Values:
+**          None
+**
+******************************************************************************/
+void CFE_SB_SubRprtInit(CFE_SB_AllSubscriptionsTlm_t *RptPtr, uint32 NumEntries)
+{
+    CFE_SB_InitMsg(RptPtr, CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID), sizeof(*RptPtr), true);
+    RptPtr->Payload.PktSegment = 1;
+    RptPtr->Payload.TotalSegments = (NumEntries + CFE_SB_SUB_ENTRIES_PER_PKT - 1) / CFE_SB_SUB_ENTRIES_PER_PKT;
+    RptPtr->Payload.Entries = 0;
+
+}/* end CFE_SB_SubRprtInit */
 
 
 /******************************************************************************
-** Name:    CFE_SB_UnsubscribeAppId
+** Name:    CFE_SB_SubRprtAdd
 **
-** Purpose: CFE Internal API intented to be called by CFE_ES when an applications
-**          SB resources need to be freed. The regular unsibscribe api won't work
-**          because it does a check to ensure the caller is the owner of the pipe.
+** Purpose: CFE Internal API used to add a subscription to a report started by
+**          CFE_SB_SubRprtInit.  The report is sent each time it holds
+**          CFE_SB_SUB_ENTRIES_PER_PKT entries, so a request is reported in as
+**          few packets as it fits in; CFE_SB_SubRprtFlush sends the rest.
 **
-** Date Written:
-**          03/15/2007
+** Assumptions, External Events, and Notes:
+**          Called without the shared data lock.
 **
 ** Input Arguments:
-**          MsgId
-**          PipeId
-**          AppId
+**          RptPtr  - Pointer to the report
+**          MsgId   - The subscribed MsgId
+**          PipeId  - The subscribed pipe
+**          Quality - Quality of Service of the subscription
 **
 ** Output Arguments:
 **          None
 **
 ** Return Values:
-**          Status
+**          None
 **
 ******************************************************************************/
-int32 CFE_SB_UnsubscribeWithAppId(CFE_SB_MsgId_t MsgId,
-                              CFE_SB_PipeId_t PipeId,
-                              CFE_ES_ResourceID_t AppId)
+void CFE_SB_SubRprtAdd(CFE_SB_AllSubscriptionsTlm_t *RptPtr, CFE_SB_MsgId_t MsgId,
+                       CFE_SB_PipeId_t PipeId, CFE_SB_Qos_t Quality)
 {
-    int32   Status = 0;
-
-    Status = CFE_SB_UnsubscribeFull(MsgId, PipeId, (uint8)CFE_SB_LOCAL, AppId);
+    RptPtr->Payload.Entry[RptPtr->Payload.Entries].MsgId = MsgId;
+    RptPtr->Payload.Entry[RptPtr->Payload.Entries].Qos = Quality;
+    RptPtr->Payload.Entry[RptPtr->Payload.Entries].Pipe = PipeId;
+    RptPtr->Payload.Entries++;
 
-    return Status;
+    if(RptPtr->Payload.Entries >= CFE_SB_SUB_ENTRIES_PER_PKT){
+        CFE_SB_SubRprtFlush(RptPtr);
+    }/* end if */
 
-}/* end CFE_SB_UnsubscribeWithAppId */
+}/* end CFE_SB_SubRprtAdd */
 
 
 /******************************************************************************
-** Name:    CFE_SB_UnsubscribeFull
+** Name:    CFE_SB_SubRprtFlush
 **
-** Purpose: CFE Internal API used to unsubscribe to a message.
+** Purpose: CFE Internal API used to send the entries of a report that have
+**          not been sent yet, see CFE_SB_SubRprtAdd.
 **
-** Assumptions, External Events, and Notes:
+** Input Arguments:
+**          RptPtr  - Pointer to the report
 **
+** Output Arguments:
+**          None
 **
-** Notes:This function cannot be called directly,it would not be semaphore protected.
-**       Also,if more than one subscription is found, this function will remove all
-**       entries that match.
+** Return Values:
+**          None
 **
-** Date Written:
-**          04/25/2005
+******************************************************************************/
+void CFE_SB_SubRprtFlush(CFE_SB_AllSubscriptionsTlm_t *RptPtr)
+{
+    if(RptPtr->Payload.Entries != 0){
+        CFE_SB_SendMsg((CFE_SB_Msg_t *)RptPtr);
+        RptPtr->Payload.PktSegment++;
+        RptPtr->Payload.Entries = 0;
+    }/* end if */
+
+}/* end CFE_SB_SubRprtFlush */
+
+
+/******************************************************************************
+** Name:    CFE_SB_SubscribeSetFull
+**
+** Purpose: CFE Internal API used to subscribe a pipe to a set of message ids
+**          in one call.  This function is called by CFE_SB_SubscribeRange and
+**          CFE_SB_SubscribeMask.
+**
+** Assumptions, External Events, and Notes:
+**          Each MsgId of the set gets its own routing table entry, the same as
+**          if it had been subscribed to by CFE_SB_SubscribeFull, so sending is
+**          not affected by how the subscription was made.  Everything is done
+**          under one lock with one event for the whole set, and the set is
+**          reported in as few subscription packets as it fits in.
+**
+**          The routing table space and destinations are checked for the whole
+**          set before anything is changed.  If a destination cannot be
+**          allocated partway, the MsgIds added before it are unsubscribed
+**          again, so the set is subscribed whole or not at all.  MsgIds the
+**          pipe is already subscribed to are skipped.
 **
 ** Input Arguments:
-**          MsgId
-**          PipeId
-**          Scope
-**          AppId
+**          SetPtr  - The set of message ids to subscribe to
+**          PipeId  - The Pipe ID to send the messages to
+**          Quality - Quality of Service (Qos) - priority and reliability
+**          MsgLim  - Max number of messages, with each MsgId, allowed on the
+**                    pipe at any time.
+**          Scope   - Local subscription or broadcasted to peers
 **
 ** Output Arguments:
 **          None
@@ -1018,21 +1201,698 @@ int32 CFE_SB_UnsubscribeWithAppId(CFE_SB_MsgId_t MsgId,
 **          Status
 **
 ******************************************************************************/
-int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId,CFE_SB_PipeId_t PipeId,
-                             uint8 Scope,CFE_ES_ResourceID_t AppId)
+int32 CFE_SB_SubscribeSetFull(const CFE_SB_MsgIdSet_t *SetPtr,
+                              CFE_SB_PipeId_t  PipeId,
+                              CFE_SB_Qos_t     Quality,
+                              uint16           MsgLim,
+                              uint8            Scope)
 {
-    CFE_SB_MsgKey_t MsgKey;
+    CFE_SB_AllSubscriptionsTlm_t Rpt;
     CFE_SB_MsgRouteIdx_t RouteIdx;
-    CFE_SB_RouteEntry_t* RoutePtr;
-    uint32  PipeIdx;
-    CFE_ES_ResourceID_t        TskId;
-    CFE_SB_DestinationD_t   *DestPtr = NULL;
+    CFE_SB_RouteEntry_t  *RoutePtr;
+    CFE_SB_MsgKey_t      MsgKey;
+    CFE_SB_MsgId_Atom_t  Value;
+    CFE_ES_ResourceID_t  TskId;
+    CFE_ES_ResourceID_t  AppId;
+    uint32  PrevRouteMap[CFE_SB_ROUTE_MAP_WORDS];
+    uint16  PrevRouteIdxTop;
+    uint8   PipeIdx;
+    bool    More;
+    uint32  NumMsgIds = 0;
+    uint32  NumNewRoutes = 0;
+    uint32  NumAdded = 0;
+    int32   Stat = CFE_SUCCESS;
     char    FullName[(OS_MAX_API_NAME * 2)];
+    char    PipeName[OS_MAX_API_NAME] = {'\0'};
+
+    CFE_SB_GetPipeName(PipeName, sizeof(PipeName), PipeId);
+
+    /* get the callers Application Id */
+    CFE_ES_GetAppID(&AppId);
 
     /* get TaskId of caller for events */
     CFE_ES_GetTaskID(&TskId);
 
-    /* take semaphore to prevent a task switch during this call */
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    /* check that the pipe has been created */
+    PipeIdx = CFE_SB_GetPipeIdx(PipeId);
+    if(PipeIdx==CFE_SB_INVALID_PIPE){
+      CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter++;
+      CFE_SB_UnlockSharedData(__func__,__LINE__);
+      CFE_EVS_SendEventWithAppID(CFE_SB_SUB_INV_PIPE_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+          "Subscribe Err:Invalid Pipe Id,Msg=0x%x-0x%x,Mask=0x%x,PipeId=%d,App %s",
+          (unsigned int)SetPtr->First,(unsigned int)SetPtr->Last,(unsigned int)SetPtr->Mask,
+          (int)PipeId, CFE_SB_GetAppTskName(TskId,FullName));
+      return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    /* check that the requestor is the owner of the pipe */
+    if( !CFE_ES_ResourceID_Equal(CFE_SB.PipeTbl[PipeIdx].AppId, AppId)){
+      CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter++;
+      CFE_SB_UnlockSharedData(__func__,__LINE__);
+      CFE_EVS_SendEventWithAppID(CFE_SB_SUB_INV_CALLER_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+          "Subscribe Err:Caller(%s) is not the owner of pipe %d,Msg=0x%x-0x%x,Mask=0x%x",
+          CFE_SB_GetAppTskName(TskId,FullName),(int)PipeId,
+          (unsigned int)SetPtr->First,(unsigned int)SetPtr->Last,(unsigned int)SetPtr->Mask);
+      return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    /*
+    ** Check every MsgId of the set and count the routing table entries that
+    ** will be needed.  This stops as soon as more are needed than are free,
+    ** so a set much larger than the routing table is rejected quickly.
+    */
+    More = (Scope <= 1) &&
+           CFE_SB_IsValidMsgId(CFE_SB_ValueToMsgId(SetPtr->First)) &&
+           CFE_SB_IsValidMsgId(CFE_SB_ValueToMsgId(SetPtr->Last)) &&
+           CFE_SB_MsgIdSetFirst(SetPtr, &Value);
+    while(More){
+        NumMsgIds++;
+        MsgKey = CFE_SB_ConvertMsgIdtoMsgKey(CFE_SB_ValueToMsgId(Value));
+        RouteIdx = CFE_SB_GetRoutingTblIdx(MsgKey);
+        if(!CFE_SB_IsValidRouteIdx(RouteIdx)){
+            NumNewRoutes++;
+            if(NumNewRoutes > (CFE_PLATFORM_SB_MAX_MSG_IDS - CFE_SB.RouteIdxTop)){
+                Stat = CFE_SB_MAX_MSGS_MET;
+                break;
+            }/* end if */
+        }else{
+            RoutePtr = CFE_SB_GetRoutePtrFromIdx(RouteIdx);
+            if((RoutePtr->Destinations >= CFE_PLATFORM_SB_MAX_DEST_PER_PKT) &&
+               (CFE_SB_DuplicateSubscribeCheck(MsgKey,PipeId) != CFE_SB_DUPLICATE)){
+                Stat = CFE_SB_MAX_DESTS_MET;
+                break;
+            }/* end if */
+        }/* end if */
+        More = CFE_SB_MsgIdSetNext(SetPtr, &Value);
+    }/* end while */
+
+    if(NumMsgIds == 0)
+    {
+        CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter++;
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_SUB_ARG_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+          "Subscribe Err:Bad Arg,MsgId 0x%x-0x%x,Mask 0x%x,PipeId %d,app %s,scope %d",
+          (unsigned int)SetPtr->First,(unsigned int)SetPtr->Last,(unsigned int)SetPtr->Mask,
+          (int)PipeId,CFE_SB_GetAppTskName(TskId,FullName),Scope);
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    if(Stat == CFE_SB_MAX_MSGS_MET){
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_MAX_MSGS_MET_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+          "Subscribe Err:Max Msgs(%d)In Use,MsgId 0x%x-0x%x,Mask 0x%x,pipe %s,app %s",
+          CFE_PLATFORM_SB_MAX_MSG_IDS,
+          (unsigned int)SetPtr->First,(unsigned int)SetPtr->Last,(unsigned int)SetPtr->Mask,
+          PipeName,CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_MAX_MSGS_MET;
+    }/* end if */
+
+    if(Stat == CFE_SB_MAX_DESTS_MET){
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_MAX_DESTS_MET_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Subscribe Err:Max Dests(%d)In Use For Msg 0x%x,pipe %s,app %s",
+             CFE_PLATFORM_SB_MAX_DEST_PER_PKT,(unsigned int)Value,
+             PipeName, CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_MAX_DESTS_MET;
+    }/* end if */
+
+    /* keep what is needed to back out of a failure partway */
+    memcpy(PrevRouteMap, CFE_SB.PipeTbl[PipeIdx].RouteMap, sizeof(PrevRouteMap));
+    PrevRouteIdxTop = CFE_SB.RouteIdxTop;
+
+    /* now add the pipe to each MsgId of the set */
+    More = CFE_SB_MsgIdSetFirst(SetPtr, &Value);
+    while(More){
+        Stat = CFE_SB_AddSubscription_Unsync(CFE_SB_ValueToMsgId(Value), PipeId,
+                                             Quality, MsgLim, Scope);
+        if(Stat == CFE_SUCCESS){
+            NumAdded++;
+        }else if(Stat == CFE_SB_DUPLICATE){
+            CFE_SB.HKTlmMsg.Payload.DuplicateSubscriptionsCounter++;
+            Stat = CFE_SUCCESS;
+        }else{
+            CFE_SB_UndoSubscriptions_Unsync(PipeId, PrevRouteMap, PrevRouteIdxTop);
+            break;
+        }/* end if */
+        More = CFE_SB_MsgIdSetNext(SetPtr, &Value);
+    }/* end while */
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    if(Stat != CFE_SUCCESS){
+        CFE_EVS_SendEventWithAppID(CFE_SB_DEST_BLK_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Subscribe Err:Request for Destination Blk failed for Msg 0x%x",
+            (unsigned int)Value);
+        return CFE_SB_BUF_ALOC_ERR;
+    }/* end if */
+
+    /* report the whole set in as few subscription packets as it fits in */
+    if((CFE_SB.SubscriptionReporting == CFE_SB_ENABLE)&&(Scope==CFE_SB_GLOBAL)){
+        CFE_SB_SubRprtInit(&Rpt, NumMsgIds);
+        More = CFE_SB_MsgIdSetFirst(SetPtr, &Value);
+        while(More){
+            CFE_SB_SubRprtAdd(&Rpt, CFE_SB_ValueToMsgId(Value), PipeId, Quality);
+            More = CFE_SB_MsgIdSetNext(SetPtr, &Value);
+        }/* end while */
+        CFE_SB_SubRprtFlush(&Rpt);
+    }/* end if */
+
+    CFE_EVS_SendEventWithAppID(CFE_SB_SUBSCRIPTION_SET_RCVD_EID,CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
+        "Subscription Rcvd:MsgId 0x%x-0x%x,Mask 0x%x on %s(%d),%d of %d new,app %s",
+         (unsigned int)SetPtr->First,(unsigned int)SetPtr->Last,(unsigned int)SetPtr->Mask,
+         PipeName,(int)PipeId,(int)NumAdded,(int)NumMsgIds,
+         CFE_SB_GetAppTskName(TskId,FullName));
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_SubscribeSetFull */
+
+
+/*
+ * Function: CFE_SB_SubscribeMany - See API and header file for details
+ */
+int32 CFE_SB_SubscribeMany(const CFE_SB_MsgId_t *MsgIdList,
+                           uint32           Count,
+                           CFE_SB_PipeId_t  PipeId,
+                           CFE_SB_Qos_t     Quality,
+                           uint16           MsgLim)
+{
+    CFE_SB_AllSubscriptionsTlm_t Rpt;
+    CFE_SB_MsgRouteIdx_t RouteIdx;
+    CFE_SB_RouteEntry_t  *RoutePtr;
+    CFE_SB_MsgKey_t      MsgKey;
+    CFE_SB_MsgId_Atom_t  Sorted[CFE_PLATFORM_SB_MAX_MSG_IDS];
+    CFE_ES_ResourceID_t  TskId;
+    CFE_ES_ResourceID_t  AppId;
+    uint32  PrevRouteMap[CFE_SB_ROUTE_MAP_WORDS];
+    uint16  PrevRouteIdxTop;
+    uint8   PipeIdx;
+    uint32  i;
+    uint32  j;
+    uint32  NumDistinct = 0;
+    uint32  NumNewRoutes = 0;
+    uint32  NumAdded = 0;
+    int32   Stat = CFE_SUCCESS;
+    char    FullName[(OS_MAX_API_NAME * 2)];
+    char    PipeName[OS_MAX_API_NAME] = {'\0'};
+
+    CFE_SB_GetPipeName(PipeName, sizeof(PipeName), PipeId);
+
+    /* get the callers Application Id */
+    CFE_ES_GetAppID(&AppId);
+
+    /* get TaskId of caller for events */
+    CFE_ES_GetTaskID(&TskId);
+
+    /*
+    ** Check every MsgId of the list and sort a copy of it without the lock.
+    ** A MsgId listed more than once appears once in the copy, so it needs
+    ** a single routing table entry.
+    */
+    if((MsgIdList == NULL)||(Count == 0)||(Count > CFE_PLATFORM_SB_MAX_MSG_IDS)){
+        Stat = CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    for(i = 0; (Stat == CFE_SUCCESS) && (i < Count); i++){
+        if(!CFE_SB_IsValidMsgId(MsgIdList[i])){
+            Stat = CFE_SB_BAD_ARGUMENT;
+            break;
+        }/* end if */
+        Sorted[i] = CFE_SB_MsgIdToValue(MsgIdList[i]);
+    }/* end for */
+
+    if(Stat == CFE_SUCCESS){
+        NumDistinct = CFE_SB_SortMsgIdValues(Sorted, Count);
+    }/* end if */
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    /* check that the pipe has been created */
+    PipeIdx = CFE_SB_GetPipeIdx(PipeId);
+    if(PipeIdx==CFE_SB_INVALID_PIPE){
+      CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter++;
+      CFE_SB_UnlockSharedData(__func__,__LINE__);
+      CFE_EVS_SendEventWithAppID(CFE_SB_SUB_INV_PIPE_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+          "Subscribe Err:Invalid Pipe Id,%d MsgIds,PipeId=%d,App %s",
+          (int)Count,(int)PipeId, CFE_SB_GetAppTskName(TskId,FullName));
+      return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    /* check that the requestor is the owner of the pipe */
+    if( !CFE_ES_ResourceID_Equal(CFE_SB.PipeTbl[PipeIdx].AppId, AppId)){
+      CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter++;
+      CFE_SB_UnlockSharedData(__func__,__LINE__);
+      CFE_EVS_SendEventWithAppID(CFE_SB_SUB_INV_CALLER_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+          "Subscribe Err:Caller(%s) is not the owner of pipe %d,%d MsgIds",
+          CFE_SB_GetAppTskName(TskId,FullName),(int)PipeId,(int)Count);
+      return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    /*
+    ** Count the routing table entries the distinct MsgIds will need and check
+    ** their destinations, so the list is either applied whole or not at all.
+    */
+    for(j = 0; (Stat == CFE_SUCCESS) && (j < NumDistinct); j++){
+        MsgKey = CFE_SB_ConvertMsgIdtoMsgKey(CFE_SB_ValueToMsgId(Sorted[j]));
+        RouteIdx = CFE_SB_GetRoutingTblIdx(MsgKey);
+        if(!CFE_SB_IsValidRouteIdx(RouteIdx)){
+            NumNewRoutes++;
+            if(NumNewRoutes > (CFE_PLATFORM_SB_MAX_MSG_IDS - CFE_SB.RouteIdxTop)){
+                Stat = CFE_SB_MAX_MSGS_MET;
+            }/* end if */
+        }else{
+            RoutePtr = CFE_SB_GetRoutePtrFromIdx(RouteIdx);
+            if((RoutePtr->Destinations >= CFE_PLATFORM_SB_MAX_DEST_PER_PKT) &&
+               (CFE_SB_DuplicateSubscribeCheck(MsgKey,PipeId) != CFE_SB_DUPLICATE)){
+                Stat = CFE_SB_MAX_DESTS_MET;
+            }/* end if */
+        }/* end if */
+    }/* end for */
+
+    if(Stat == CFE_SB_BAD_ARGUMENT)
+    {
+        CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter++;
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_SUB_ARG_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+          "Subscribe Err:Bad Arg,MsgId 0x%x,entry %d of %d,PipeId %d,app %s",
+          (unsigned int)((MsgIdList != NULL) && (i < Count) ? CFE_SB_MsgIdToValue(MsgIdList[i]) : 0),
+          (int)i,(int)Count,(int)PipeId,CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    if(Stat == CFE_SB_MAX_MSGS_MET){
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_MAX_MSGS_MET_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+          "Subscribe Err:Max Msgs(%d)In Use,%d MsgIds,pipe %s,app %s",
+          CFE_PLATFORM_SB_MAX_MSG_IDS,(int)Count,
+          PipeName,CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_MAX_MSGS_MET;
+    }/* end if */
+
+    if(Stat == CFE_SB_MAX_DESTS_MET){
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_MAX_DESTS_MET_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Subscribe Err:Max Dests(%d)In Use For Msg 0x%x,pipe %s,app %s",
+             CFE_PLATFORM_SB_MAX_DEST_PER_PKT,(unsigned int)Sorted[j - 1],
+             PipeName, CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_MAX_DESTS_MET;
+    }/* end if */
+
+    /* keep what is needed to back out of a failure partway */
+    memcpy(PrevRouteMap, CFE_SB.PipeTbl[PipeIdx].RouteMap, sizeof(PrevRouteMap));
+    PrevRouteIdxTop = CFE_SB.RouteIdxTop;
+
+    /* now add the pipe to each MsgId of the list */
+    for(i = 0; i < Count; i++){
+        Stat = CFE_SB_AddSubscription_Unsync(MsgIdList[i], PipeId, Quality, MsgLim,
+                                             (uint8)CFE_SB_GLOBAL);
+        if(Stat == CFE_SUCCESS){
+            NumAdded++;
+        }else if(Stat == CFE_SB_DUPLICATE){
+            CFE_SB.HKTlmMsg.Payload.DuplicateSubscriptionsCounter++;
+            Stat = CFE_SUCCESS;
+        }else{
+            CFE_SB_UndoSubscriptions_Unsync(PipeId, PrevRouteMap, PrevRouteIdxTop);
+            break;
+        }/* end if */
+    }/* end for */
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    if(Stat != CFE_SUCCESS){
+        CFE_EVS_SendEventWithAppID(CFE_SB_DEST_BLK_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Subscribe Err:Request for Destination Blk failed for Msg 0x%x",
+            (unsigned int)CFE_SB_MsgIdToValue(MsgIdList[i]));
+        return CFE_SB_BUF_ALOC_ERR;
+    }/* end if */
+
+    /* report the whole list in as few subscription packets as it fits in */
+    if(CFE_SB.SubscriptionReporting == CFE_SB_ENABLE){
+        CFE_SB_SubRprtInit(&Rpt, Count);
+        for(i = 0; i < Count; i++){
+            CFE_SB_SubRprtAdd(&Rpt, MsgIdList[i], PipeId, Quality);
+        }/* end for */
+        CFE_SB_SubRprtFlush(&Rpt);
+    }/* end if */
+
+    CFE_EVS_SendEventWithAppID(CFE_SB_SUBSCRIPTION_LIST_RCVD_EID,CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
+        "Subscription Rcvd:%d MsgIds on %s(%d),%d new,app %s",
+         (int)Count,PipeName,(int)PipeId,(int)NumAdded,
+         CFE_SB_GetAppTskName(TskId,FullName));
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_SubscribeMany */
+
+
+/*
+ * Function: CFE_SB_SetDeliveryPolicy - See API and header file for details
+ */
+int32 CFE_SB_SetDeliveryPolicy(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
+                               const CFE_SB_DeliveryPolicy_t *PolicyPtr)
+{
+    CFE_SB_DestinationD_t *DestPtr = NULL;
+    CFE_ES_ResourceID_t    TskId;
+    CFE_ES_ResourceID_t    AppId;
+    uint8   PipeIdx;
+    uint8   Mode = CFE_SB_DELIVER_ALL;
+    bool    Valid;
+    char    FullName[(OS_MAX_API_NAME * 2)];
+    char    PipeName[OS_MAX_API_NAME] = {'\0'};
+
+    /* get the callers Application Id */
+    CFE_ES_GetAppID(&AppId);
+
+    /* get TaskId of caller for events */
+    CFE_ES_GetTaskID(&TskId);
+
+    /* check the policy itself */
+    Valid = (PolicyPtr != NULL);
+    if(Valid){
+        Mode = PolicyPtr->Mode;
+        switch(Mode){
+          case CFE_SB_DELIVER_ALL:
+          case CFE_SB_DELIVER_INTERVAL:
+              break;
+          case CFE_SB_DELIVER_EVERY_NTH:
+              Valid = (PolicyPtr->Param > 0);
+              break;
+          case CFE_SB_DELIVER_ON_CHANGE:
+              Valid = (PolicyPtr->FieldSize > 0) && (PolicyPtr->FieldSize <= sizeof(uint32));
+              break;
+          default:
+              Valid = false;
+              break;
+        }/* end switch */
+    }/* end if */
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    /* check the subscription, and that the requestor is the owner of the pipe */
+    PipeIdx = CFE_SB_GetPipeIdx(PipeId);
+    if(Valid && CFE_SB_IsValidMsgId(MsgId) && (PipeIdx != CFE_SB_INVALID_PIPE) &&
+       CFE_ES_ResourceID_Equal(CFE_SB.PipeTbl[PipeIdx].AppId, AppId)){
+        DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId);
+    }/* end if */
+
+    if(DestPtr == NULL){
+        CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter++;
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_SET_POLICY_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Delivery policy Err:Bad Arg,MsgId 0x%x,PipeId %d,mode %d,app %s",
+            (unsigned int)CFE_SB_MsgIdToValue(MsgId),(int)PipeId,(int)Mode,
+            CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    /* the policy starts over, so the next message is delivered */
+    DestPtr->Policy      = *PolicyPtr;
+    DestPtr->PolicyCount = 0;
+    DestPtr->PolicyLast  = 0;
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    CFE_SB_GetPipeName(PipeName, sizeof(PipeName), PipeId);
+
+    CFE_EVS_SendEventWithAppID(CFE_SB_SET_POLICY_EID,CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
+        "Delivery policy set:MsgId 0x%x on %s(%d),mode %d,param %d,app %s",
+        (unsigned int)CFE_SB_MsgIdToValue(MsgId),PipeName,(int)PipeId,
+        (int)Mode,(int)PolicyPtr->Param,CFE_SB_GetAppTskName(TskId,FullName));
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_SetDeliveryPolicy */
+
+
+/*
+ * Function: CFE_SB_SetCoalescing - See API and header file for details
+ */
+int32 CFE_SB_SetCoalescing(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, bool Enable)
+{
+    CFE_SB_DestinationD_t *DestPtr = NULL;
+    CFE_ES_ResourceID_t    TskId;
+    CFE_ES_ResourceID_t    AppId;
+    uint8   PipeIdx;
+    char    FullName[(OS_MAX_API_NAME * 2)];
+    char    PipeName[OS_MAX_API_NAME] = {'\0'};
+
+    /* get the callers Application Id */
+    CFE_ES_GetAppID(&AppId);
+
+    /* get TaskId of caller for events */
+    CFE_ES_GetTaskID(&TskId);
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    /* check the subscription, and that the requestor is the owner of the pipe */
+    PipeIdx = CFE_SB_GetPipeIdx(PipeId);
+    if(CFE_SB_IsValidMsgId(MsgId) && (PipeIdx != CFE_SB_INVALID_PIPE) &&
+       CFE_ES_ResourceID_Equal(CFE_SB.PipeTbl[PipeIdx].AppId, AppId)){
+        DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId);
+    }/* end if */
+
+    if(DestPtr == NULL){
+        CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter++;
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_SET_COALESCE_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Coalescing Err:Bad Arg,MsgId 0x%x,PipeId %d,app %s",
+            (unsigned int)CFE_SB_MsgIdToValue(MsgId),(int)PipeId,
+            CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    /* a message that already replaced the pending one stays, see CFE_SB_TakeLatest_Unsync */
+    DestPtr->Coalesce = Enable ? 1 : 0;
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    CFE_SB_GetPipeName(PipeName, sizeof(PipeName), PipeId);
+
+    CFE_EVS_SendEventWithAppID(CFE_SB_SET_COALESCE_EID,CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
+        "Coalescing set:MsgId 0x%x on %s(%d),enable %d,app %s",
+        (unsigned int)CFE_SB_MsgIdToValue(MsgId),PipeName,(int)PipeId,
+        (int)Enable,CFE_SB_GetAppTskName(TskId,FullName));
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_SetCoalescing */
+
+
+/*
+ * Function: CFE_SB_SetBroadcastTopic - See API and header file for details
+ */
+int32 CFE_SB_SetBroadcastTopic(CFE_SB_MsgId_t MsgId, uint16 Depth)
+{
+    CFE_SB_BcastTopic_t   *TopicPtr;
+    CFE_SB_RouteEntry_t   *RoutePtr = NULL;
+    CFE_SB_MsgRouteIdx_t   RouteIdx;
+    CFE_SB_PipeD_t        *PipeDscPtr;
+    CFE_ES_ResourceID_t    TskId;
+    uint32  TopicIdx;
+    uint16  i;
+    int32   Status = CFE_SUCCESS;
+    char    FullName[(OS_MAX_API_NAME * 2)];
+
+    /* get TaskId of caller for events */
+    CFE_ES_GetTaskID(&TskId);
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    if(!CFE_SB_IsValidMsgId(MsgId) || (Depth > CFE_PLATFORM_SB_MAX_PIPE_DEPTH)){
+        Status = CFE_SB_BAD_ARGUMENT;
+    }else{
+        TopicPtr = CFE_SB_FindBcastTopic(MsgId);
+
+        RouteIdx = CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(MsgId));
+        if(CFE_SB_IsValidRouteIdx(RouteIdx)){
+            RoutePtr = CFE_SB_GetRoutePtrFromIdx(RouteIdx);
+        }/* end if */
+
+        if(Depth == 0){
+
+            /* remove the topic, the subscribers go back to their own queues */
+            if(TopicPtr == NULL){
+                Status = CFE_SB_BAD_ARGUMENT;
+            }else{
+                if(RoutePtr != NULL){
+                    TopicIdx = (uint32)(TopicPtr - CFE_SB.BcastTbl);
+                    for(i = 0; i < RoutePtr->Destinations; i++){
+                        PipeDscPtr = &CFE_SB.PipeTbl[RoutePtr->DestArray[i].PipeId];
+                        PipeDscPtr->BcastMask &= ~(1UL << TopicIdx);
+                    }/* end for */
+                    RoutePtr->Topic = NULL;
+                }/* end if */
+                CFE_SB_BcastDelete_Unsync(TopicPtr);
+            }/* end if */
+
+        }else if(TopicPtr != NULL){
+            Status = CFE_SB_BAD_ARGUMENT;
+        }else{
+
+            TopicPtr = CFE_SB_FindBcastTopic(CFE_SB_INVALID_MSG_ID);
+            if(TopicPtr == NULL){
+                Status = CFE_SB_MAX_MSGS_MET;
+            }else if(CFE_SB_BcastCreate_Unsync(TopicPtr, Depth) != OS_SUCCESS){
+                Status = CFE_SB_BUF_ALOC_ERR;
+            }else{
+                TopicPtr->MsgId = MsgId;
+
+                /* current subscribers read the topic from the next message sent */
+                if(RoutePtr != NULL){
+                    TopicIdx = (uint32)(TopicPtr - CFE_SB.BcastTbl);
+                    for(i = 0; i < RoutePtr->Destinations; i++){
+                        PipeDscPtr = &CFE_SB.PipeTbl[RoutePtr->DestArray[i].PipeId];
+                        PipeDscPtr->BcastNext[TopicIdx] = 0;
+                        CFE_SB_MEMORY_BARRIER();
+                        PipeDscPtr->BcastMask |= (1UL << TopicIdx);
+                    }/* end for */
+                    RoutePtr->Topic = TopicPtr;
+                }/* end if */
+            }/* end if */
+
+        }/* end if */
+    }/* end if */
+
+    if(Status != CFE_SUCCESS){
+        CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter++;
+    }/* end if */
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    if(Status != CFE_SUCCESS){
+        CFE_EVS_SendEventWithAppID(CFE_SB_BCAST_TOPIC_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Broadcast topic Err:MsgId 0x%x,depth %d,stat 0x%x,app %s",
+            (unsigned int)CFE_SB_MsgIdToValue(MsgId),(int)Depth,(unsigned int)Status,
+            CFE_SB_GetAppTskName(TskId,FullName));
+        return Status;
+    }/* end if */
+
+    CFE_EVS_SendEventWithAppID(CFE_SB_BCAST_TOPIC_EID,CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
+        "Broadcast topic set:MsgId 0x%x,depth %d,app %s",
+        (unsigned int)CFE_SB_MsgIdToValue(MsgId),(int)Depth,
+        CFE_SB_GetAppTskName(TskId,FullName));
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_SetBroadcastTopic */
+
+
+/*
+ * Function: CFE_SB_Unsubscribe - See API and header file for details
+ */
+int32 CFE_SB_Unsubscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
+{
+    CFE_ES_ResourceID_t CallerId;
+    int32   Status = 0;
+
+    /* get the callers Application Id */
+    CFE_ES_GetAppID(&CallerId);
+
+    Status = CFE_SB_UnsubscribeFull(MsgId, PipeId, (uint8)CFE_SB_GLOBAL,CallerId);
+
+    return Status;
+
+}/* end CFE_SB_Unsubscribe */
+
+
+/*
+ * Function: CFE_SB_UnsubscribeLocal - See API and header file for details
+ */
+int32 CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
+{
+    CFE_ES_ResourceID_t CallerId;
+    int32   Status = 0;
+
+    /* get the callers Application Id */
+    CFE_ES_GetAppID(&CallerId);
+
+    Status = CFE_SB_UnsubscribeFull(MsgId, PipeId, (uint8)CFE_SB_LOCAL,CallerId);
+
+    return Status;
+
+}/* end CFE_SB_UnsubscribeLocal */
+
+
+/******************************************************************************
+** Name:    CFE_SB_UnsubscribeAppId
+**
+** Purpose: CFE Internal API intented to be called by CFE_ES when an applications
+**          SB resources need to be freed. The regular unsibscribe api won't work
+**          because it does a check to ensure the caller is the owner of the pipe.
+**
+** Date Written:
+**          03/15/2007
+**
+** Input Arguments:
+**          MsgId
+**          PipeId
+**          AppId
+**
+** Output Arguments:
+**          None
+**
+** Return Values:
+**          Status
+**
+******************************************************************************/
+int32 CFE_SB_UnsubscribeWithAppId(CFE_SB_MsgId_t MsgId,
+                              CFE_SB_PipeId_t PipeId,
+                              CFE_ES_ResourceID_t AppId)
+{
+    int32   Status = 0;
+
+    Status = CFE_SB_UnsubscribeFull(MsgId, PipeId, (uint8)CFE_SB_LOCAL, AppId);
+
+    return Status;
+
+}/* end CFE_SB_UnsubscribeWithAppId */
+
+
+/******************************************************************************
+** Name:    CFE_SB_UnsubscribeFull
+**
+** Purpose: CFE Internal API used to unsubscribe to a message.
+**
+** Assumptions, External Events, and Notes:
+**
+**
+** Notes:This function cannot be called directly,it would not be semaphore protected.
+**       Also,if more than one subscription is found, this function will remove all
+**       entries that match.
+**
+** Date Written:
+**          04/25/2005
+**
+** Input Arguments:
+**          MsgId
+**          PipeId
+**          Scope
+**          AppId
+**
+** Output Arguments:
+**          None
+**
+** Return Values:
+**          Status
+**
+******************************************************************************/
+int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId,CFE_SB_PipeId_t PipeId,
+                             uint8 Scope,CFE_ES_ResourceID_t AppId)
+{
+    CFE_SB_MsgKey_t MsgKey;
+    CFE_SB_MsgRouteIdx_t RouteIdx;
+    CFE_SB_RouteEntry_t* RoutePtr;
+    uint32  PipeIdx;
+    CFE_ES_ResourceID_t        TskId;
+    uint16  DestIdx;
+    char    FullName[(OS_MAX_API_NAME * 2)];
+
+    /* get TaskId of caller for events */
+    CFE_ES_GetTaskID(&TskId);
+
+    /* take semaphore to prevent a task switch during this call */
     CFE_SB_LockSharedData(__func__,__LINE__);
 
     /* check that the pipe has been created */
@@ -1093,18 +1953,14 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId,CFE_SB_PipeId_t PipeId,
     RoutePtr = CFE_SB_GetRoutePtrFromIdx(RouteIdx);
 
     /* search the list for a matching pipe id */
-    for (DestPtr = RoutePtr->ListHeadPtr; DestPtr != NULL && DestPtr->PipeId != PipeId; DestPtr = DestPtr->Next)
+    for (DestIdx = 0; DestIdx < RoutePtr->Destinations && RoutePtr->DestArray[DestIdx].PipeId != PipeId; DestIdx++)
         ;
 
-    if(DestPtr)
+    if(DestIdx < RoutePtr->Destinations)
     {
-        /* match found, remove node from list */
-        CFE_SB_RemoveDest(RoutePtr,DestPtr);
+        /* match found, remove destination from the array */
+        CFE_SB_RemoveDest(RoutePtr,&RoutePtr->DestArray[DestIdx]);
 
-        /* return node to memory pool */
-        CFE_SB_PutDestinationBlk(DestPtr);
-
-        RoutePtr->Destinations--;
         CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse--;
 
         CFE_EVS_SendEventWithAppID(CFE_SB_SUBSCRIPTION_REMOVED_EID,CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
@@ -1127,7 +1983,97 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId,CFE_SB_PipeId_t PipeId,
     CFE_SB_UnlockSharedData(__func__,__LINE__);
 
     return CFE_SUCCESS;
-}/* end CFE_SB_UnsubscribeFull */
+}/* end CFE_SB_UnsubscribeFull */
+
+
+/*
+ * Function: CFE_SB_UnsubscribeMany - See API and header file for details
+ */
+int32 CFE_SB_UnsubscribeMany(const CFE_SB_MsgId_t *MsgIdList,
+                             uint32           Count,
+                             CFE_SB_PipeId_t  PipeId)
+{
+    CFE_SB_MsgRouteIdx_t RouteIdx;
+    CFE_SB_RouteEntry_t  *RoutePtr;
+    CFE_ES_ResourceID_t  TskId;
+    CFE_ES_ResourceID_t  AppId;
+    uint32  PipeIdx;
+    uint32  i;
+    uint32  NumRemoved = 0;
+    uint16  DestIdx;
+    char    FullName[(OS_MAX_API_NAME * 2)];
+
+    /* get the callers Application Id */
+    CFE_ES_GetAppID(&AppId);
+
+    /* get TaskId of caller for events */
+    CFE_ES_GetTaskID(&TskId);
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    /* check that the pipe has been created */
+    PipeIdx = CFE_SB_GetPipeIdx(PipeId);
+    if(PipeIdx==CFE_SB_INVALID_PIPE){
+      CFE_SB_UnlockSharedData(__func__,__LINE__);
+      CFE_EVS_SendEventWithAppID(CFE_SB_UNSUB_INV_PIPE_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Unsubscribe Err:Invalid Pipe Id,%d MsgIds,Pipe=%d,app=%s",
+            (int)Count,(int)PipeId,CFE_SB_GetAppTskName(TskId,FullName));
+      return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    /* if the caller is not the owner of the pipe, send error event and return */
+    if( !CFE_ES_ResourceID_Equal(CFE_SB.PipeTbl[PipeIdx].AppId, AppId) )
+    {
+      CFE_SB_UnlockSharedData(__func__,__LINE__);
+      CFE_EVS_SendEventWithAppID(CFE_SB_UNSUB_INV_CALLER_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Unsubscribe Err:Caller(%s) is not the owner of pipe %d,%d MsgIds",
+            CFE_SB_GetAppTskName(TskId,FullName),(int)PipeId,(int)Count);
+      return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    /* check the whole list before anything is removed */
+    for(i = 0; (MsgIdList != NULL) && (i < Count) && CFE_SB_IsValidMsgId(MsgIdList[i]); i++)
+        ;
+
+    if((MsgIdList == NULL)||(Count == 0)||(i < Count))
+    {
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_UNSUB_ARG_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "UnSubscribe Err:Bad Arg,MsgId 0x%x,entry %d of %d,PipeId %d,app %s",
+            (unsigned int)((MsgIdList != NULL) && (i < Count) ? CFE_SB_MsgIdToValue(MsgIdList[i]) : 0),
+            (int)i,(int)Count,(int)PipeId,CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    for(i = 0; i < Count; i++){
+
+        RouteIdx = CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(MsgIdList[i]));
+        if(!CFE_SB_IsValidRouteIdx(RouteIdx)){
+            continue;
+        }/* end if */
+
+        RoutePtr = CFE_SB_GetRoutePtrFromIdx(RouteIdx);
+
+        for (DestIdx = 0; DestIdx < RoutePtr->Destinations && RoutePtr->DestArray[DestIdx].PipeId != PipeId; DestIdx++)
+            ;
+
+        if(DestIdx < RoutePtr->Destinations){
+            CFE_SB_RemoveDest(RoutePtr,&RoutePtr->DestArray[DestIdx]);
+            CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse--;
+            NumRemoved++;
+        }/* end if */
+
+    }/* end for */
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    CFE_EVS_SendEventWithAppID(CFE_SB_SUBSCRIPTION_LIST_REMOVED_EID,CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
+        "Subscriptions Removed:%d of %d MsgIds on pipe %d,app %s",
+        (int)NumRemoved,(int)Count,(int)PipeId,CFE_SB_GetAppTskName(TskId,FullName));
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_UnsubscribeMany */
 
 /*
  * Function: CFE_SB_SendMsg - See API and header file for details
@@ -1136,7 +2082,7 @@ int32  CFE_SB_SendMsg(CFE_SB_Msg_t    *MsgPtr)
 {
     int32   Status = 0;
 
-    Status = CFE_SB_SendMsgFull(MsgPtr,CFE_SB_INCREMENT_TLM,CFE_SB_SEND_ONECOPY);
+    Status = CFE_SB_SendMsgFull(MsgPtr,CFE_SB_INCREMENT_TLM,CFE_SB_SEND_ONECOPY,CFE_SB_POLL);
 
     return Status;
 
@@ -1144,6 +2090,21 @@ int32  CFE_SB_SendMsg(CFE_SB_Msg_t    *MsgPtr)
 
 
 
+/*
+ * Function: CFE_SB_SendMsgTimeout - See API and header file for details
+ */
+int32  CFE_SB_SendMsgTimeout(CFE_SB_Msg_t    *MsgPtr, int32 TimeOut)
+{
+    int32   Status = 0;
+
+    Status = CFE_SB_SendMsgFull(MsgPtr,CFE_SB_INCREMENT_TLM,CFE_SB_SEND_ONECOPY,TimeOut);
+
+    return Status;
+
+}/* end CFE_SB_SendMsgTimeout */
+
+
+
 /*
  * Function: CFE_SB_PassMsg - See API and header file for details
  */
@@ -1151,7 +2112,7 @@ int32  CFE_SB_PassMsg(CFE_SB_Msg_t    *MsgPtr)
 {
     int32   Status = 0;
 
-    Status = CFE_SB_SendMsgFull(MsgPtr,CFE_SB_DO_NOT_INCREMENT,CFE_SB_SEND_ONECOPY);
+    Status = CFE_SB_SendMsgFull(MsgPtr,CFE_SB_DO_NOT_INCREMENT,CFE_SB_SEND_ONECOPY,CFE_SB_POLL);
 
     return Status;
 
@@ -1159,6 +2120,152 @@ int32  CFE_SB_PassMsg(CFE_SB_Msg_t    *MsgPtr)
 
 
 
+/*
+ * Function: CFE_SB_SendMsgBatch - See API and header file for details
+ */
+int32  CFE_SB_SendMsgBatch(CFE_SB_Msg_t **MsgArray, uint32 Count, int32 *StatusArray)
+{
+    int32   Status = 0;
+
+    Status = CFE_SB_SendMsgBatchFull(MsgArray,NULL,Count,StatusArray,
+                                     CFE_SB_INCREMENT_TLM,CFE_SB_SEND_ONECOPY);
+
+    return Status;
+
+}/* end CFE_SB_SendMsgBatch */
+
+
+
+/*
+ * Function: CFE_SB_SendMsgV - See API and header file for details
+ */
+int32  CFE_SB_SendMsgV(const CFE_SB_IoVec_t *IoVec, uint32 Count)
+{
+    CFE_SB_MsgId_t          MsgId = CFE_SB_INVALID_MSG_ID;
+    CFE_SB_BufferD_t        *BufDscPtr;
+    uint8                   *DestPtr;
+    size_t                  TotalMsgSize = 0;
+    bool                    BadArg = false;
+    int32                   Status;
+    CFE_ES_ResourceID_t     TskId;
+    uint32                  i;
+    char                    FullName[(OS_MAX_API_NAME * 2)];
+
+    CFE_ES_GetTaskID(&TskId);
+
+    /* the first fragment must hold at least the primary header */
+    if((IoVec == NULL)||(Count == 0)||(IoVec[0].Base == NULL)||
+       (IoVec[0].Length < sizeof(CFE_SB_Msg_t))){
+        BadArg = true;
+    }else{
+        for(i = 0; i < Count; i++){
+            if((IoVec[i].Base == NULL)&&(IoVec[i].Length > 0)){
+                BadArg = true;
+            }else if(TotalMsgSize <= CFE_MISSION_SB_MAX_SB_MSG_SIZE){
+                /* stop adding once too big, so the sum cannot wrap */
+                TotalMsgSize += IoVec[i].Length;
+            }/* end if */
+        }/* end for */
+
+        /* the gathered message must hold the whole header the first fragment declares */
+        if((!BadArg)&&(TotalMsgSize < CFE_SB_MsgHdrSize((const CFE_SB_Msg_t *)IoVec[0].Base))){
+            BadArg = true;
+        }/* end if */
+    }/* end if */
+
+    if(BadArg){
+        CFE_SB_LockSharedData(__func__,__LINE__);
+        CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter++;
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_SEND_BAD_ARG_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Send Err:Bad input argument,Arg 0x%lx,App %s",
+            (unsigned long)IoVec,CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    MsgId = CFE_SB_GetMsgId((CFE_SB_Msg_t *)IoVec[0].Base);
+
+    /* validated here as well, as the send below never sees an oversized length */
+    if(TotalMsgSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE){
+        CFE_SB_LockSharedData(__func__,__LINE__);
+        CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter++;
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_MSG_TOO_BIG_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Send Err:Msg Too Big MsgId=0x%x,app=%s,size=%d,MaxSz=%d",
+            (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+            CFE_SB_GetAppTskName(TskId,FullName),(int)TotalMsgSize,CFE_MISSION_SB_MAX_SB_MSG_SIZE);
+        return CFE_SB_MSG_TOO_BIG;
+    }/* end if */
+
+    /*
+    ** The fragments are gathered straight into the buffer that gets sent.
+    ** TotalMsgSize is bounded by the mission limit above, which cfe_sb_verify.h
+    ** holds to 16 bits, so the narrowing below cannot truncate.
+    */
+    CFE_SB_LockSharedData(__func__,__LINE__);
+    BufDscPtr = CFE_SB_GetBufferFromPool(MsgId, (uint16)TotalMsgSize);
+    if(BufDscPtr == NULL){
+        CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter++;
+    }/* end if */
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    if(BufDscPtr == NULL){
+
+        /* Determine if event can be sent without causing recursive event problem */
+        if(CFE_SB_RequestToSendEvent(TskId,CFE_SB_GET_BUF_ERR_EID_BIT) == CFE_SB_GRANTED){
+
+            CFE_EVS_SendEventWithAppID(CFE_SB_GET_BUF_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+              "Send Err:Request for Buffer Failed. MsgId 0x%x,app %s,size %d",
+              (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+              CFE_SB_GetAppTskName(TskId,FullName),(int)TotalMsgSize);
+
+            /* clear the bit so the task may send this event again */
+            CFE_SB_FinishSendEvent(TskId,CFE_SB_GET_BUF_ERR_EID_BIT);
+        }/* end if */
+
+        return CFE_SB_BUF_ALOC_ERR;
+    }/* end if */
+
+    DestPtr = (uint8 *)BufDscPtr->Buffer;
+    for(i = 0; i < Count; i++){
+        if(IoVec[i].Length > 0){
+            memcpy(DestPtr, IoVec[i].Base, IoVec[i].Length);
+            DestPtr += IoVec[i].Length;
+        }/* end if */
+    }/* end for */
+
+    /*
+    ** Fix up the header for the gathered message.  Only command packets
+    ** carry a checksum; for any other packet the MSG module reports
+    ** CFE_MSG_WRONG_MSG_TYPE and leaves the message alone.
+    */
+    Status = CFE_MSG_SetSize((CFE_SB_Msg_t *)BufDscPtr->Buffer, (CFE_MSG_Size_t)TotalMsgSize);
+    if(Status == CFE_SUCCESS){
+        Status = CFE_MSG_GenerateChecksum((CFE_SB_Msg_t *)BufDscPtr->Buffer);
+        if(Status == CFE_MSG_WRONG_MSG_TYPE){
+            Status = CFE_SUCCESS;
+        }/* end if */
+    }/* end if */
+
+    if(Status != CFE_SUCCESS){
+        CFE_SB_LockSharedData(__func__,__LINE__);
+        CFE_SB_DecrBufUseCnt(BufDscPtr);
+        CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter++;
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_SEND_BAD_ARG_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Send Err:Bad input argument,Arg 0x%lx,App %s",
+            (unsigned long)IoVec,CFE_SB_GetAppTskName(TskId,FullName));
+        return Status;
+    }/* end if */
+
+    /* the buffer is owned by SB from here on, so no zero copy handle is needed */
+    return CFE_SB_SendMsgFull((CFE_SB_Msg_t *)BufDscPtr->Buffer,CFE_SB_INCREMENT_TLM,
+                              CFE_SB_SEND_ZEROCOPY,CFE_SB_POLL);
+
+}/* end CFE_SB_SendMsgV */
+
+
+
 /******************************************************************************
 ** Name:    CFE_SB_SendMsgFull
 **
@@ -1169,6 +2276,21 @@ int32  CFE_SB_PassMsg(CFE_SB_Msg_t    *MsgPtr)
 **          Note: This function increments and tracks the source sequence
 **                counter for all telemetry messages.
 **
+**          Note: The shared data lock is held to look up the route,
+**                allocate the buffer and reserve the pipe counters; the
+**                queue writes themselves are done after the lock is
+**                released.
+**
+**          Note: Pipe errors (message limit, overflow, write error) are not
+**                reported here.  They are recorded under the lock and the
+**                SB task sends one summary event per MsgId, pipe and error
+**                each housekeeping cycle, see CFE_SB_SendErrReports.
+**
+**          Note: A write to a full CFE_SB_PIPEOPTS_LOSSLESS pipe waits for
+**                the reader to make room until TimeOut expires, see
+**                CFE_SB_WaitWriteQueue.  The caller does not hold the shared
+**                data lock while it waits.
+**
 ** Date Written:
 **          04/25/2005
 **
@@ -1176,6 +2298,7 @@ int32  CFE_SB_PassMsg(CFE_SB_Msg_t    *MsgPtr)
 **          MsgPtr
 **          TlmCntIncrements
 **          CopyMode
+**          TimeOut
 **
 ** Output Arguments:
 **          None
@@ -1186,27 +2309,26 @@ int32  CFE_SB_PassMsg(CFE_SB_Msg_t    *MsgPtr)
 ******************************************************************************/
 int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
                           uint32           TlmCntIncrements,
-                          uint32           CopyMode)
+                          uint32           CopyMode,
+                          int32            TimeOut)
 {
     CFE_SB_MsgKey_t         MsgKey;
     CFE_SB_MsgId_t          MsgId;
-    int32                   Status;
-    CFE_SB_DestinationD_t   *DestPtr = NULL;
-    CFE_SB_PipeD_t          *PipeDscPtr;
-    CFE_SB_RouteEntry_t     *RtgTblPtr;
+    CFE_SB_MsgRouteIdx_t    RtgTblIdx;
+    CFE_SB_RouteEntry_t     *RtgTblPtr = NULL;
     CFE_SB_BufferD_t        *BufDscPtr;
     uint16                  TotalMsgSize;
-    CFE_SB_MsgRouteIdx_t    RtgTblIdx;
+    CFE_SB_Delivery_t       Delivery;
+    uint16                  NumWake;
+    bool                    TimedOut;
+    CFE_ES_TaskContext_t    Context;
     CFE_ES_ResourceID_t     TskId;
     uint32                  i;
     char                    FullName[(OS_MAX_API_NAME * 2)];
-    CFE_SB_EventBuf_t       SBSndErr;
-    char                    PipeName[OS_MAX_API_NAME] = {'\0'};
 
-    SBSndErr.EvtsToSnd = 0;
-
-    /* get task id for events and Sender Info*/
-    CFE_ES_GetTaskID(&TskId);
+    /* get task id for events and Sender Info, app id for IGNOREMINE pipes */
+    CFE_ES_GetTaskContext(&Context);
+    TskId = Context.TaskId;
 
     /* check input parameter */
     if(MsgPtr == NULL){
@@ -1265,9 +2387,17 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
 
     RtgTblIdx = CFE_SB_GetRoutingTblIdx(MsgKey);
 
+    /* Obtain the actual routing table entry from the selected index */
+    if(CFE_SB_IsValidRouteIdx(RtgTblIdx)){
+        RtgTblPtr = CFE_SB_GetRoutePtrFromIdx(RtgTblIdx);
+        if(!CFE_SB_MsgId_Equal(RtgTblPtr->MsgId, MsgId)){
+            RtgTblPtr = NULL;
+        }/* end if */
+    }/* end if */
+
     /* if there have been no subscriptions for this pkt, */
     /* increment the dropped pkt cnt, send event and return success */
-    if(!CFE_SB_IsValidRouteIdx(RtgTblIdx)){
+    if(RtgTblPtr == NULL){
 
         CFE_SB.HKTlmMsg.Payload.NoSubscribersCounter++;
 
@@ -1319,190 +2449,405 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
         return CFE_SB_BUF_ALOC_ERR;
     }/* end if */
 
-    /* Copy the packet into the SB memory space */
-    if (CopyMode != CFE_SB_SEND_ZEROCOPY){
-        /* Copy the packet into the SB memory space */
-        memcpy( BufDscPtr->Buffer, MsgPtr, (uint16)TotalMsgSize );
-    }
+    /* stamp the buffer for the pipe latency histograms and with its sender */
+    BufDscPtr->SendTime = CFE_SB_LatencyNow();
+    BufDscPtr->SenderId = Context.AppId;
 
-    /* Obtain the actual routing table entry from the selected index */
-    RtgTblPtr = CFE_SB_GetRoutePtrFromIdx(RtgTblIdx);
+    CFE_SB_InitDelivery(&Delivery, MsgPtr, MsgId, TotalMsgSize, CopyMode);
+    Delivery.BufDscPtr = BufDscPtr;
 
     /* For Tlm packets, increment the seq count if requested */
-    if((CFE_SB_GetPktType(MsgId)==CFE_SB_PKTTYPE_TLM) &&
-       (TlmCntIncrements==CFE_SB_INCREMENT_TLM)){
+    Delivery.SetSeqCnt = ((CFE_SB_GetPktType(MsgId)==CFE_SB_PKTTYPE_TLM) &&
+                          (TlmCntIncrements==CFE_SB_INCREMENT_TLM));
+    if(Delivery.SetSeqCnt){
         RtgTblPtr->SeqCnt++;
-        CFE_SB_SetMsgSeqCnt((CFE_SB_Msg_t *)BufDscPtr->Buffer,
-                RtgTblPtr->SeqCnt);
+        Delivery.SeqCnt = RtgTblPtr->SeqCnt;
+    }/* end if */
+
+    /*
+    ** A broadcast topic stores the packet once for all of its subscribers
+    ** instead of writing the queue of each one.  The readers can take it as
+    ** soon as the lock is released, so it is copied now.
+    */
+    if((RtgTblPtr->Topic != NULL) && (RtgTblPtr->Destinations > 0)){
+
+        CFE_SB_CopyDelivery(&Delivery);
+
+        NumWake = CFE_SB_BcastPut_Unsync(RtgTblPtr, BufDscPtr, Delivery.PipeId);
+
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+        /* only the subscribers blocked on their pipe need a queue write */
+        CFE_SB_BcastWake(Delivery.PipeId, NumWake);
+
+        return CFE_SUCCESS;
+
     }/* end if */
 
     /* At this point there must be at least one destination for pkt */
 
-    /* Send the packet to all destinations  */
-    for (i=0, DestPtr = RtgTblPtr -> ListHeadPtr;
-            i < RtgTblPtr -> Destinations; i++, DestPtr = DestPtr -> Next)
+    /*
+    ** Reserve a slot on every destination that will receive the packet.  The
+    ** counters are charged now; the queue writes themselves are done after
+    ** the lock is released and any that fail are refunded below.
+    */
+    for (i=0; i < RtgTblPtr->Destinations; i++)
     {
-        /* The DestPtr should never be NULL in this loop, this is just extra
-           protection in case of the unforseen */
-        if(DestPtr == NULL)
-        {
-          break;
-        }
+        CFE_SB_ReserveDelivery_Unsync(&Delivery, &RtgTblPtr->DestArray[i], Context.AppId, TskId,
+                                      (TimeOut != CFE_SB_POLL));
+    } /* end loop over destinations */
 
-        if (DestPtr->Active == CFE_SB_INACTIVE)    /* destination is active */
-        {
-            continue;
-        }/*end if */
+    CFE_SB_HandOffDelivery_Unsync(&Delivery);
 
-        PipeDscPtr = &CFE_SB.PipeTbl[DestPtr->PipeId];
+    /* release the semaphore */
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
 
-        if(PipeDscPtr->Opts & CFE_SB_PIPEOPTS_IGNOREMINE)
-        {
-            CFE_ES_ResourceID_t  AppId;
+    /* Copy the packet into the SB memory space and write the pipe queues */
+    TimedOut = CFE_SB_WriteDelivery(&Delivery, TimeOut);
 
-            CFE_ES_GetAppID(&AppId);
+    /* refund the reservations of any queue write that failed */
+    if (Delivery.NumFailed > 0){
 
-            if( CFE_ES_ResourceID_Equal(PipeDscPtr->AppId, AppId) )
-            {
-                continue;
-            }
-        }/* end if */
+        CFE_SB_LockSharedData(__func__,__LINE__);
 
-        /* if Msg limit exceeded, log event, increment counter */
-        /* and go to next destination */
-        if(DestPtr->BuffCount >= DestPtr->MsgId2PipeLim){
+        CFE_SB_RefundDelivery_Unsync(&Delivery, TskId);
 
-            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_MSGID_LIM_ERR_EID;
-            SBSndErr.EvtsToSnd++;
-            CFE_SB.HKTlmMsg.Payload.MsgLimitErrorCounter++;
-            PipeDscPtr->SendErrors++;
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
 
-            continue;
+    }/* end if */
+
+    if (TimedOut){
+        return CFE_SB_TIME_OUT;
+    }/* end if */
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_SendMsgFull */
+
+
+
+/******************************************************************************
+** Name:    CFE_SB_SendMsgBatchFull
+**
+** Purpose: API used to send a batch of messages on the software bus.
+**
+** Assumptions, External Events, and Notes:
+**
+**          Note: Each message is routed as CFE_SB_SendMsgFull would route it,
+**                but the shared data lock is taken twice per
+**                CFE_SB_SEND_BATCH_CHUNK messages rather than once or twice
+**                per message: once to allocate the buffers, which are then
+**                filled without the lock, and once to reserve the
+**                destinations of the chunk.  The pipe queues are written
+**                after that lock is released, and the lock is only taken a
+**                third time if a queue write failed and must be refunded.
+**                A batch send never waits on a full lossless pipe.
+**
+**          Note: Errors are counted per message, but only one event of each
+**                kind is sent per batch.  Pipe errors are recorded for the SB
+**                task to report, as in CFE_SB_SendMsgFull.
+**
+** Input Arguments:
+**          MsgArray
+**          HandleArray (zero copy mode only)
+**          Count
+**          TlmCntIncrements
+**          CopyMode
+**
+** Output Arguments:
+**          StatusArray (optional)
+**
+** Return Values:
+**          CFE_SUCCESS if every message was sent, otherwise the status of
+**          the first message that was not
+**
+******************************************************************************/
+int32  CFE_SB_SendMsgBatchFull(CFE_SB_Msg_t            **MsgArray,
+                               CFE_SB_ZeroCopyHandle_t  *HandleArray,
+                               uint32                   Count,
+                               int32                    *StatusArray,
+                               uint32                   TlmCntIncrements,
+                               uint32                   CopyMode)
+{
+    CFE_SB_BatchEntry_t     Entry[CFE_SB_SEND_BATCH_CHUNK];
+    CFE_SB_BatchEntry_t     *EntryPtr;
+    CFE_SB_Delivery_t       *DelivPtr;
+    CFE_SB_BatchErr_t       NullErr, InvIdErr, TooBigErr, NoSubsErr;
+    CFE_SB_BatchErr_t       BufErr;
+    CFE_SB_Msg_t            *MsgPtr;
+    CFE_SB_MsgId_t          MsgId;
+    uint16                  TotalMsgSize;
+    CFE_SB_MsgRouteIdx_t    RouteIdx;
+    CFE_SB_RouteEntry_t     *RtgTblPtr;
+    CFE_SB_BufferD_t        *BufDscPtr;
+    uint16                  DestIdx;
+    bool                    HaveFailed;
+    CFE_ES_TaskContext_t    Context;
+    CFE_ES_ResourceID_t     TskId;
+    uint32                  Base;
+    uint32                  NumInChunk;
+    uint32                  SendTime;
+    uint32                  n;
+    int32                   Status = CFE_SUCCESS;
+    char                    FullName[(OS_MAX_API_NAME * 2)];
+
+    memset(&NullErr, 0, sizeof(NullErr));
+    memset(&InvIdErr, 0, sizeof(InvIdErr));
+    memset(&TooBigErr, 0, sizeof(TooBigErr));
+    memset(&NoSubsErr, 0, sizeof(NoSubsErr));
+    memset(&BufErr, 0, sizeof(BufErr));
+
+    /* get task and app id once for the whole batch */
+    CFE_ES_GetTaskContext(&Context);
+    TskId = Context.TaskId;
+
+    /* check input parameters */
+    if((MsgArray == NULL) || ((CopyMode == CFE_SB_SEND_ZEROCOPY) && (HandleArray == NULL))){
+        CFE_SB_LockSharedData(__func__,__LINE__);
+        CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter++;
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_SEND_BAD_ARG_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Send Err:Bad input argument,Arg 0x%lx,App %s",
+            (unsigned long)MsgArray,CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    for (Base = 0; Base < Count; Base += NumInChunk)
+    {
+        NumInChunk = Count - Base;
+        if (NumInChunk > CFE_SB_SEND_BATCH_CHUNK){
+            NumInChunk = CFE_SB_SEND_BATCH_CHUNK;
         }/* end if */
 
-        /*
-        ** Write the buffer descriptor to the queue of the pipe.  If the write
-        ** failed, log info and increment the pipe's error counter.
-        */
-                Status = OS_QueuePut(PipeDscPtr->SysQueueId,(void *)&BufDscPtr,
-                                     sizeof(CFE_SB_BufferD_t *),0);
-
-        if (Status == OS_SUCCESS) {
-            BufDscPtr->UseCount++;    /* used for releasing buffer  */
-            DestPtr->BuffCount++; /* used for checking MsgId2PipeLimit */
-            DestPtr->DestCnt++;   /* used for statistics */
-            if (DestPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE)
-            {
-                CFE_SB_PipeDepthStats_t *StatObj =
-                        &CFE_SB.StatTlmMsg.Payload.PipeDepthStats[DestPtr->PipeId];
-                StatObj->InUse++;
-                if(StatObj->InUse > StatObj->PeakInUse){
-                    StatObj->PeakInUse = StatObj->InUse;
+        /* one latency stamp serves the whole chunk */
+        SendTime = CFE_SB_LatencyNow();
+
+        /* validate the chunk and get a buffer for each message under one lock */
+        CFE_SB_LockSharedData(__func__,__LINE__);
+
+        for (n = 0; n < NumInChunk; n++)
+        {
+            EntryPtr = &Entry[n];
+            EntryPtr->BufDscPtr = NULL;
+            EntryPtr->Status    = CFE_SUCCESS;
+            EntryPtr->NumWake   = 0;
+
+            MsgPtr = MsgArray[Base + n];
+
+            if (CopyMode == CFE_SB_SEND_ZEROCOPY){
+                if (CFE_SB_ZeroCopyReleaseDesc_Unsync(MsgPtr, HandleArray[Base + n], Context.AppId) != CFE_SUCCESS){
+                    CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter++;
+                    EntryPtr->Status = CFE_SB_BUFFER_INVALID;
+                    continue;
                 }/* end if */
-            }
+            }/* end if */
 
-        }else if(Status == OS_QUEUE_FULL) {
+            if (MsgPtr == NULL){
+                CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter++;
+                EntryPtr->Status = CFE_SB_BAD_ARGUMENT;
+                CFE_SB_CountBatchErr(&NullErr, CFE_SB_INVALID_MSG_ID, 0, 0);
+                continue;
+            }/* end if */
 
-            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_Q_FULL_ERR_EID;
-            SBSndErr.EvtsToSnd++;
-            CFE_SB.HKTlmMsg.Payload.PipeOverflowErrorCounter++;
-            PipeDscPtr->SendErrors++;
+            MsgId        = CFE_SB_GetMsgId(MsgPtr);
+            TotalMsgSize = CFE_SB_GetTotalMsgLength(MsgPtr);
 
+            if (!CFE_SB_IsValidMsgId(MsgId)){
+                EntryPtr->Status = CFE_SB_BAD_ARGUMENT;
+                CFE_SB_CountBatchErr(&InvIdErr, MsgId, 0, 0);
+            }else if (TotalMsgSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE){
+                EntryPtr->Status = CFE_SB_MSG_TOO_BIG;
+                CFE_SB_CountBatchErr(&TooBigErr, MsgId, 0, TotalMsgSize);
+            }/* end if */
 
-        }else{ /* Unexpected error while writing to queue. */
+            if (EntryPtr->Status != CFE_SUCCESS){
+                CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter++;
+                if (CopyMode == CFE_SB_SEND_ZEROCOPY){
+                    CFE_SB_DecrBufUseCnt(CFE_SB_GetBufferFromCaller(MsgId, MsgPtr));
+                }/* end if */
+                continue;
+            }/* end if */
 
-            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_Q_WR_ERR_EID;
-            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].ErrStat = Status;
-            SBSndErr.EvtsToSnd++;
-            CFE_SB.HKTlmMsg.Payload.InternalErrorCounter++;
-            PipeDscPtr->SendErrors++;
+            /* no subscriptions for this pkt, count it and carry on */
+            if (!CFE_SB_IsValidRouteIdx(CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(MsgId)))){
+                CFE_SB.HKTlmMsg.Payload.NoSubscribersCounter++;
+                if (CopyMode == CFE_SB_SEND_ZEROCOPY){
+                    CFE_SB_DecrBufUseCnt(CFE_SB_GetBufferFromCaller(MsgId, MsgPtr));
+                }/* end if */
+                CFE_SB_CountBatchErr(&NoSubsErr, MsgId, 0, 0);
+                continue;
+            }/* end if */
 
-                }/*end if */
+            if (CopyMode == CFE_SB_SEND_ZEROCOPY){
+                EntryPtr->BufDscPtr = CFE_SB_GetBufferFromCaller(MsgId, MsgPtr);
+            }else{
+                EntryPtr->BufDscPtr = CFE_SB_GetBufferFromPool(MsgId, TotalMsgSize);
+            }/* end if */
 
-    } /* end loop over destinations */
-    
-    /*
-    ** Decrement the buffer UseCount and free buffer if cnt=0. This decrement is done
-    ** because the use cnt is initialized to 1 in CFE_SB_GetBufferFromPool.
-    ** Initializing the count to 1 (as opposed to zero) and decrementing it here are
-    ** done to ensure the buffer gets released when there are destinations that have
-    ** been disabled via ground command.
-    */
-    CFE_SB_DecrBufUseCnt(BufDscPtr);
+            if (EntryPtr->BufDscPtr == NULL){
+                CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter++;
+                EntryPtr->Status = CFE_SB_BUF_ALOC_ERR;
+                CFE_SB_CountBatchErr(&BufErr, MsgId, 0, TotalMsgSize);
+                continue;
+            }/* end if */
 
-    /* release the semaphore */
-    CFE_SB_UnlockSharedData(__func__,__LINE__);
+            EntryPtr->BufDscPtr->SendTime = SendTime;
+            EntryPtr->BufDscPtr->SenderId = Context.AppId;
+        }/* end for */
 
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
 
-    /* send an event for each pipe write error that may have occurred */
-    for(i=0;i < SBSndErr.EvtsToSnd; i++)
-    {
-        if(SBSndErr.EvtBuf[i].EventId == CFE_SB_MSGID_LIM_ERR_EID)
+        /* copy the packets into the SB memory space without the lock */
+        if (CopyMode != CFE_SB_SEND_ZEROCOPY){
+            for (n = 0; n < NumInChunk; n++)
+            {
+                if (Entry[n].BufDscPtr != NULL){
+                    memcpy(Entry[n].BufDscPtr->Buffer, MsgArray[Base + n], Entry[n].BufDscPtr->Size);
+                }/* end if */
+            }/* end for */
+        }/* end if */
+
+        /* reserve the destinations of the whole chunk under one lock */
+        CFE_SB_LockSharedData(__func__,__LINE__);
+
+        for (n = 0; n < NumInChunk; n++)
         {
+            EntryPtr  = &Entry[n];
+            DelivPtr  = &EntryPtr->Delivery;
+            BufDscPtr = EntryPtr->BufDscPtr;
+            if (BufDscPtr == NULL){
+                continue;
+            }/* end if */
+
+            MsgId = BufDscPtr->MsgId;
 
-            /* Determine if event can be sent without causing recursive event problem */
-            if(CFE_SB_RequestToSendEvent(TskId,CFE_SB_MSGID_LIM_ERR_EID_BIT) == CFE_SB_GRANTED){
+            CFE_SB_InitDelivery(DelivPtr, MsgArray[Base + n], MsgId, BufDscPtr->Size, CopyMode);
+            DelivPtr->BufDscPtr = BufDscPtr;
+            DelivPtr->Copied    = true;
 
-              CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
+            /* the route may have been removed since the buffer was allocated */
+            RouteIdx = CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(MsgId));
+            if (!CFE_SB_IsValidRouteIdx(RouteIdx)){
+                CFE_SB.HKTlmMsg.Payload.NoSubscribersCounter++;
+                CFE_SB_DecrBufUseCnt(BufDscPtr);
+                CFE_SB_CountBatchErr(&NoSubsErr, MsgId, 0, 0);
+                EntryPtr->BufDscPtr = NULL;
+                continue;
+            }/* end if */
 
-              CFE_ES_PerfLogEntry(CFE_MISSION_SB_MSG_LIM_PERF_ID);
-              CFE_ES_PerfLogExit(CFE_MISSION_SB_MSG_LIM_PERF_ID);
+            RtgTblPtr = CFE_SB_GetRoutePtrFromIdx(RouteIdx);
 
-              CFE_EVS_SendEventWithAppID(CFE_SB_MSGID_LIM_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
-                "Msg Limit Err,MsgId 0x%x,pipe %s,sender %s",
-                (unsigned int)CFE_SB_MsgIdToValue(RtgTblPtr->MsgId),
-                PipeName, CFE_SB_GetAppTskName(TskId,FullName));
+            /* For Tlm packets, increment the seq count if requested */
+            if ((CFE_SB_GetPktType(MsgId)==CFE_SB_PKTTYPE_TLM) &&
+                (TlmCntIncrements==CFE_SB_INCREMENT_TLM)){
+                RtgTblPtr->SeqCnt++;
+                CFE_SB_SetMsgSeqCnt((CFE_SB_Msg_t *)BufDscPtr->Buffer, RtgTblPtr->SeqCnt);
+            }/* end if */
 
-              /* clear the bit so the task may send this event again */
-              CFE_SB_FinishSendEvent(TskId,CFE_SB_MSGID_LIM_ERR_EID_BIT);
+            if ((RtgTblPtr->Topic != NULL) && (RtgTblPtr->Destinations > 0)){
+                EntryPtr->NumWake = CFE_SB_BcastPut_Unsync(RtgTblPtr, BufDscPtr, DelivPtr->PipeId);
+                continue;
             }/* end if */
 
-        }else if(SBSndErr.EvtBuf[i].EventId == CFE_SB_Q_FULL_ERR_EID){
+            for (DestIdx = 0; DestIdx < RtgTblPtr->Destinations; DestIdx++)
+            {
+                CFE_SB_ReserveDelivery_Unsync(DelivPtr, &RtgTblPtr->DestArray[DestIdx],
+                                              Context.AppId, TskId, false);
+            }/* end for */
+
+            CFE_SB_HandOffDelivery_Unsync(DelivPtr);
+        }/* end for */
+
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+        /* write the pipe queues and wake the broadcast readers without the lock */
+        HaveFailed = false;
+        for (n = 0; n < NumInChunk; n++)
+        {
+            if (Entry[n].BufDscPtr == NULL){
+                continue;
+            }/* end if */
 
-            /* Determine if event can be sent without causing recursive event problem */
-            if(CFE_SB_RequestToSendEvent(TskId,CFE_SB_Q_FULL_ERR_EID_BIT) == CFE_SB_GRANTED){
+            if (Entry[n].NumWake > 0){
+                CFE_SB_BcastWake(Entry[n].Delivery.PipeId, Entry[n].NumWake);
+            }else{
+                CFE_SB_WriteDelivery(&Entry[n].Delivery, CFE_SB_POLL);
+                if (Entry[n].Delivery.NumFailed > 0){
+                    HaveFailed = true;
+                }/* end if */
+            }/* end if */
+        }/* end for */
 
-              CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
+        /* refund the reservations of the queue writes that failed */
+        if (HaveFailed){
+            CFE_SB_LockSharedData(__func__,__LINE__);
 
-              CFE_ES_PerfLogEntry(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
-              CFE_ES_PerfLogExit(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
+            for (n = 0; n < NumInChunk; n++)
+            {
+                if ((Entry[n].BufDscPtr != NULL) && (Entry[n].Delivery.NumFailed > 0)){
+                    CFE_SB_RefundDelivery_Unsync(&Entry[n].Delivery, TskId);
+                }/* end if */
+            }/* end for */
 
-              CFE_EVS_SendEventWithAppID(CFE_SB_Q_FULL_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
-                  "Pipe Overflow,MsgId 0x%x,pipe %s,sender %s",
-                  (unsigned int)CFE_SB_MsgIdToValue(RtgTblPtr->MsgId),
-                  PipeName, CFE_SB_GetAppTskName(TskId,FullName));
+            CFE_SB_UnlockSharedData(__func__,__LINE__);
+        }/* end if */
 
-               /* clear the bit so the task may send this event again */
-              CFE_SB_FinishSendEvent(TskId,CFE_SB_Q_FULL_ERR_EID_BIT);
+        for (n = 0; n < NumInChunk; n++)
+        {
+            if (StatusArray != NULL){
+                StatusArray[Base + n] = Entry[n].Status;
             }/* end if */
 
-        }else{
+            if ((Status == CFE_SUCCESS) && (Entry[n].Status != CFE_SUCCESS)){
+                Status = Entry[n].Status;
+            }/* end if */
+        }/* end for */
 
-            /* Determine if event can be sent without causing recursive event problem */
-            if(CFE_SB_RequestToSendEvent(TskId,CFE_SB_Q_WR_ERR_EID_BIT) == CFE_SB_GRANTED){
+    }/* end for */
 
-              CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
+    /* send one event of each kind for the whole batch */
+    if (NullErr.Count > 0){
+        CFE_EVS_SendEventWithAppID(CFE_SB_SEND_BAD_ARG_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Send Err:Bad input argument,%d NULL msg(s) in batch,App %s",
+            (int)NullErr.Count,CFE_SB_GetAppTskName(TskId,FullName));
+    }/* end if */
 
-              CFE_EVS_SendEventWithAppID(CFE_SB_Q_WR_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
-                "Pipe Write Err,MsgId 0x%x,pipe %s,sender %s,stat 0x%x",
-                (unsigned int)CFE_SB_MsgIdToValue(RtgTblPtr->MsgId),
-                PipeName, CFE_SB_GetAppTskName(TskId,FullName),
-                (unsigned int)SBSndErr.EvtBuf[i].ErrStat);
+    if (InvIdErr.Count > 0){
+        CFE_EVS_SendEventWithAppID(CFE_SB_SEND_INV_MSGID_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Send Err:Invalid MsgId(0x%x)in msg,App %s,%d in batch",
+            (unsigned int)CFE_SB_MsgIdToValue(InvIdErr.MsgId),
+            CFE_SB_GetAppTskName(TskId,FullName),(int)InvIdErr.Count);
+    }/* end if */
 
-               /* clear the bit so the task may send this event again */
-              CFE_SB_FinishSendEvent(TskId,CFE_SB_Q_WR_ERR_EID_BIT);
-            }/* end if */
+    if (TooBigErr.Count > 0){
+        CFE_EVS_SendEventWithAppID(CFE_SB_MSG_TOO_BIG_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Send Err:Msg Too Big MsgId=0x%x,app=%s,size=%d,MaxSz=%d,%d in batch",
+            (unsigned int)CFE_SB_MsgIdToValue(TooBigErr.MsgId),
+            CFE_SB_GetAppTskName(TskId,FullName),(int)TooBigErr.ErrStat,
+            CFE_MISSION_SB_MAX_SB_MSG_SIZE,(int)TooBigErr.Count);
+    }/* end if */
 
-        }/* end if */
-    }
+    if ((NoSubsErr.Count > 0) &&
+        (CFE_SB_RequestToSendEvent(TskId,CFE_SB_SEND_NO_SUBS_EID_BIT) == CFE_SB_GRANTED)){
+        CFE_EVS_SendEventWithAppID(CFE_SB_SEND_NO_SUBS_EID,CFE_EVS_EventType_INFORMATION,CFE_SB.AppId,
+            "No subscribers for MsgId 0x%x,sender %s,%d in batch",
+            (unsigned int)CFE_SB_MsgIdToValue(NoSubsErr.MsgId),
+            CFE_SB_GetAppTskName(TskId,FullName),(int)NoSubsErr.Count);
+        CFE_SB_FinishSendEvent(TskId,CFE_SB_SEND_NO_SUBS_EID_BIT);
+    }/* end if */
 
+    if ((BufErr.Count > 0) &&
+        (CFE_SB_RequestToSendEvent(TskId,CFE_SB_GET_BUF_ERR_EID_BIT) == CFE_SB_GRANTED)){
+        CFE_EVS_SendEventWithAppID(CFE_SB_GET_BUF_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Send Err:Request for Buffer Failed. MsgId 0x%x,app %s,size %d,%d in batch",
+            (unsigned int)CFE_SB_MsgIdToValue(BufErr.MsgId),
+            CFE_SB_GetAppTskName(TskId,FullName),(int)BufErr.ErrStat,(int)BufErr.Count);
+        CFE_SB_FinishSendEvent(TskId,CFE_SB_GET_BUF_ERR_EID_BIT);
+    }/* end if */
 
-    return CFE_SUCCESS;
+    return Status;
 
-}/* end CFE_SB_SendMsgFull */
+}/* end CFE_SB_SendMsgBatchFull */
 
 
 
@@ -1514,7 +2859,7 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t    *BufPtr,
                      int32              TimeOut)
 {
     int32                  Status;
-    CFE_SB_BufferD_t       *Message;
+    CFE_SB_QueueEntry_t    QueueEntry;
     CFE_SB_PipeD_t         *PipeDscPtr;
     CFE_SB_DestinationD_t  *DestPtr = NULL;
     CFE_ES_ResourceID_t    TskId;
@@ -1560,7 +2905,7 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t    *BufPtr,
     ** packet to the task according to mode.  Otherwise, return a status
     ** code indicating that no buffer was read.
     */
-    Status = CFE_SB_ReadQueue(PipeDscPtr, TskId, TimeOut, &Message);
+    Status = CFE_SB_ReadQueue(PipeDscPtr, TskId, TimeOut, &QueueEntry);
 
     /* take semaphore again to protect the remaining code in this call */
     CFE_SB_LockSharedData(__func__,__LINE__);
@@ -1575,20 +2920,28 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t    *BufPtr,
 
     }/* end if */
 
+    /* free any buffers still held from a batch receive */
+    CFE_SB_ReleaseBatchBuffs_Unsync(PipeDscPtr);
+
     if (Status == CFE_SUCCESS) {
 
+        /* get pointer to destination to be used in decrementing msg limit cnt*/
+        DestPtr = CFE_SB_GetQueuedDest_Unsync(PipeDscPtr, &QueueEntry);
+
+        /* a newer message may have replaced this one, see CFE_SB_ReserveDest_Unsync */
+        CFE_SB_TakeLatest_Unsync(DestPtr, &QueueEntry);
+
+        CFE_SB_RecordLatency_Unsync(PipeDscPtr, QueueEntry.BufDscPtr);
+
         /*
         ** Load the pipe tables 'CurrentBuff' with the buffer descriptor
         ** ptr corresponding to the message just read. This is done so that
         ** the buffer can be released on the next RcvMsg call for this pipe.
         */
-        PipeDscPtr->CurrentBuff = Message;
+        PipeDscPtr->CurrentBuff = QueueEntry.BufDscPtr;
 
         /* Set the Receivers pointer to the address of the actual message */
-        *BufPtr = (CFE_SB_MsgPtr_t) Message->Buffer;
-
-        /* get pointer to destination to be used in decrementing msg limit cnt*/
-        DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(PipeDscPtr->CurrentBuff->MsgId), PipeDscPtr->PipeId);
+        *BufPtr = (CFE_SB_MsgPtr_t) QueueEntry.BufDscPtr->Buffer;
 
         /*
         ** DestPtr would be NULL if the msg is unsubscribed to while it is on
@@ -1604,9 +2957,15 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t    *BufPtr,
 
         }/* end if DestPtr != NULL */
 
-        if (PipeDscPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE)
+        /* a broadcast topic message never took a slot of the pipe depth */
+        if ((PipeDscPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE) &&
+            (QueueEntry.Lane != CFE_SB_LANE_BCAST))
         {
         CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeDscPtr->PipeId].InUse--;
+        if ((QueueEntry.Lane == CFE_SB_LANE_HIGH) &&
+            (CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeDscPtr->PipeId].HighInUse > 0)){
+            CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeDscPtr->PipeId].HighInUse--;
+        }/* end if */
         }
 
     }else{
@@ -1630,91 +2989,176 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t    *BufPtr,
 
 
 /*
- * Function: CFE_SB_ZeroCopyGetPtr - See API and header file for details
+ * Function: CFE_SB_RcvMsgBatch - See API and header file for details
  */
-CFE_SB_Msg_t  *CFE_SB_ZeroCopyGetPtr(uint16 MsgSize,
-                                     CFE_SB_ZeroCopyHandle_t *BufferHandle)
+int32  CFE_SB_RcvMsgBatch(CFE_SB_MsgPtr_t    *BufPtrArray,
+                          uint32             MaxCount,
+                          uint32             *CountPtr,
+                          CFE_SB_PipeId_t    PipeId,
+                          int32              TimeOut)
 {
-   int32                stat1;
-   CFE_ES_ResourceID_t  AppId;
-   cpuaddr              address = 0;
-   CFE_SB_ZeroCopyD_t  *zcd = NULL;
-   CFE_SB_BufferD_t    *bd = NULL;
+    int32                  Status;
+    CFE_SB_QueueEntry_t    QueueEntry[CFE_PLATFORM_SB_MAX_RCV_BATCH];
+    uint32                 NumRead = 0;
+    uint32                 i;
+    CFE_SB_PipeD_t         *PipeDscPtr;
+    CFE_SB_DestinationD_t  *DestPtr = NULL;
+    CFE_ES_ResourceID_t    TskId;
+    char                   FullName[(OS_MAX_API_NAME * 2)];
 
-    CFE_SB_LockSharedData(__func__,__LINE__);
+    /* get task id for events */
+    CFE_ES_GetTaskID(&TskId);
 
-    /* Allocate a new zero copy descriptor from the SB memory pool.*/
-    stat1 = CFE_ES_GetPoolBuf((uint32 **)&zcd, CFE_SB.Mem.PoolHdl,  sizeof(CFE_SB_ZeroCopyD_t));
-    if(stat1 < 0){
+    /* Check input parameters */
+    if((BufPtrArray == NULL)||(CountPtr == NULL)||(MaxCount == 0)||(TimeOut < (-1))){
+        CFE_SB_LockSharedData(__func__,__LINE__);
+        CFE_SB.HKTlmMsg.Payload.MsgReceiveErrorCounter++;
         CFE_SB_UnlockSharedData(__func__,__LINE__);
-        return NULL;
-    }
-
-    /* Add the size of a zero copy descriptor to the memory-in-use ctr and */
-    /* adjust the high water mark if needed */
-    CFE_SB.StatTlmMsg.Payload.MemInUse+=stat1;
-    if(CFE_SB.StatTlmMsg.Payload.MemInUse > CFE_SB.StatTlmMsg.Payload.PeakMemInUse){
-       CFE_SB.StatTlmMsg.Payload.PeakMemInUse = CFE_SB.StatTlmMsg.Payload.MemInUse;
+        CFE_EVS_SendEventWithAppID(CFE_SB_RCV_BAD_ARG_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Rcv Err:Bad Input Arg:BufPtr 0x%lx,pipe %d,t/o %d,app %s",
+            (unsigned long)BufPtrArray,(int)PipeId,(int)TimeOut,CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_BAD_ARGUMENT;
     }/* end if */
 
-    /* Allocate a new buffer (from the SB memory pool) to hold the message  */
-    stat1 = CFE_ES_GetPoolBuf((uint32 **)&bd, CFE_SB.Mem.PoolHdl, MsgSize + sizeof(CFE_SB_BufferD_t));
-    if((stat1 < 0)||(bd==NULL)){
-        /*deallocate the first buffer if the second buffer creation fails*/
-        stat1 = CFE_ES_PutPoolBuf(CFE_SB.Mem.PoolHdl, (uint32 *)zcd);
-        if(stat1 > 0){
-            CFE_SB.StatTlmMsg.Payload.MemInUse-=stat1;
-        }
+    *CountPtr = 0;
+
+    PipeDscPtr = CFE_SB_GetPipePtr(PipeId);
+    /* If the pipe does not exist or PipeId is out of range... */
+    if (PipeDscPtr == NULL) {
+        CFE_SB_LockSharedData(__func__,__LINE__);
+        CFE_SB.HKTlmMsg.Payload.MsgReceiveErrorCounter++;
         CFE_SB_UnlockSharedData(__func__,__LINE__);
-        return NULL;
-    }
+        CFE_EVS_SendEventWithAppID(CFE_SB_BAD_PIPEID_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+            "Rcv Err:PipeId %d does not exist,app %s",
+            (int)PipeId,CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    if (MaxCount > CFE_PLATFORM_SB_MAX_RCV_BATCH){
+        MaxCount = CFE_PLATFORM_SB_MAX_RCV_BATCH;
+    }/* end if */
+
+    /* Save off any buffer in use from CFE_SB_RcvMsg to free later */
+    PipeDscPtr->ToTrashBuff = PipeDscPtr->CurrentBuff;
+    PipeDscPtr->CurrentBuff = NULL;
+
+    /*
+    ** Pend for the first buffer using the specified timeout option, then
+    ** drain whatever else is already on the pipe without waiting.
+    */
+    Status = CFE_SB_ReadQueue(PipeDscPtr, TskId, TimeOut, &QueueEntry[0]);
+
+    if (Status == CFE_SUCCESS) {
+
+        NumRead = 1;
+
+        while ((NumRead < MaxCount) &&
+               (CFE_SB_ReadQueue(PipeDscPtr, TskId, CFE_SB_POLL, &QueueEntry[NumRead]) == CFE_SUCCESS)){
+            NumRead++;
+        }/* end while */
 
-    /* Increment the number of buffers in use by one even though two buffers */
-    /* were allocated. SBBuffersInUse increments on a per-message basis */
-    CFE_SB.StatTlmMsg.Payload.SBBuffersInUse++;
-    if(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse > CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse){
-        CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse = CFE_SB.StatTlmMsg.Payload.SBBuffersInUse;
     }/* end if */
 
-    /* Add the size of the actual buffer to the memory-in-use ctr and */
-    /* adjust the high water mark if needed */
-    CFE_SB.StatTlmMsg.Payload.MemInUse+=stat1;
-    if(CFE_SB.StatTlmMsg.Payload.MemInUse > CFE_SB.StatTlmMsg.Payload.PeakMemInUse){
-       CFE_SB.StatTlmMsg.Payload.PeakMemInUse = CFE_SB.StatTlmMsg.Payload.MemInUse;
+    /* release and account for every buffer in one critical section */
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    if (PipeDscPtr->ToTrashBuff != NULL) {
+
+        /* Decrement the Buffer Use Count and Free buffer if cnt=0) */
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->ToTrashBuff);
+
+        PipeDscPtr->ToTrashBuff = NULL;
+
     }/* end if */
 
-    /* first set ptr to actual msg buffer the same as ptr to descriptor */
-    address = (cpuaddr)bd;
+    CFE_SB_ReleaseBatchBuffs_Unsync(PipeDscPtr);
 
-    /* increment actual msg buffer ptr beyond the descriptor */
-    address += sizeof(CFE_SB_BufferD_t);
+    for (i = 0; i < NumRead; i++) {
 
-    /* Initialize the zero copy descriptor structure. */
-    zcd->Size      = MsgSize;
-    zcd->Buffer    = (void *)address;
-    zcd->Next      = NULL;
+        DestPtr = CFE_SB_GetQueuedDest_Unsync(PipeDscPtr, &QueueEntry[i]);
 
-    /* Add this Zero Copy Descriptor to the end of the chain */
-    if(CFE_SB.ZeroCopyTail != NULL){
-        ((CFE_SB_ZeroCopyD_t *) CFE_SB.ZeroCopyTail)->Next = (void *)zcd;
-    }
-    zcd->Prev = CFE_SB.ZeroCopyTail;
-    CFE_SB.ZeroCopyTail = (void *)zcd;
+        /* a newer message may have replaced this one, see CFE_SB_ReserveDest_Unsync */
+        CFE_SB_TakeLatest_Unsync(DestPtr, &QueueEntry[i]);
+
+        CFE_SB_RecordLatency_Unsync(PipeDscPtr, QueueEntry[i].BufDscPtr);
+
+        /* hold the buffer until the next receive on this pipe */
+        PipeDscPtr->BatchBuff[i] = QueueEntry[i].BufDscPtr;
+
+        BufPtrArray[i] = (CFE_SB_MsgPtr_t) QueueEntry[i].BufDscPtr->Buffer;
+
+        /* DestPtr may be NULL if the msg was unsubscribed while on the pipe */
+        if ((DestPtr != NULL) && (DestPtr->BuffCount > 0)){
+            DestPtr->BuffCount--;
+        }/* end if */
+
+        if ((PipeDscPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE) &&
+            (QueueEntry[i].Lane != CFE_SB_LANE_BCAST) &&
+            (CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeDscPtr->PipeId].InUse > 0)){
+            CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeDscPtr->PipeId].InUse--;
+        }/* end if */
 
+        if ((PipeDscPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE) &&
+            (QueueEntry[i].Lane == CFE_SB_LANE_HIGH) &&
+            (CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeDscPtr->PipeId].HighInUse > 0)){
+            CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeDscPtr->PipeId].HighInUse--;
+        }/* end if */
+
+    }/* end for */
+
+    PipeDscPtr->BatchCount = NumRead;
+
+    /* release the semaphore */
     CFE_SB_UnlockSharedData(__func__,__LINE__);
 
+    *CountPtr = NumRead;
+
+    /*
+    ** If status is not CFE_SUCCESS, then no packet was received.  If this was
+    ** caused by an unexpected error, then CFE_SB_ReadQueue() will report the
+    ** error.
+    */
+    return Status;
+
+}/* end CFE_SB_RcvMsgBatch */
+
+
+/*
+ * Function: CFE_SB_ZeroCopyGetPtr - See API and header file for details
+ */
+CFE_SB_Msg_t  *CFE_SB_ZeroCopyGetPtr(uint16 MsgSize,
+                                     CFE_SB_ZeroCopyHandle_t *BufferHandle)
+{
+   CFE_ES_ResourceID_t  AppId;
+   CFE_SB_BufferD_t    *bd = NULL;
+
     /* get callers AppId */
     CFE_ES_GetAppID(&AppId);
-    zcd->AppID     = AppId;
 
-    (*BufferHandle) = (CFE_SB_ZeroCopyHandle_t) zcd;
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    /*
+    ** One allocation holds the descriptor and the message; the buffer
+    ** descriptor doubles as the zero copy descriptor.
+    */
+    bd = CFE_SB_GetBufferFromPool(CFE_SB_INVALID_MSG_ID, MsgSize);
+    if(bd == NULL){
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        return NULL;
+    }
+
+    /* Add the buffer to the zero copy chain of the caller */
+    if(CFE_SB_ZeroCopyLink_Unsync(bd, AppId) != CFE_SUCCESS){
+        CFE_SB_ReturnBufferToPool(bd);
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        return NULL;
+    }
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
 
-    /* Initialize the buffer descriptor structure. */
-    bd->UseCount  = 1;
-    bd->Size      = MsgSize;
-    bd->Buffer    = (void *)address;
+    (*BufferHandle) = (CFE_SB_ZeroCopyHandle_t) bd;
 
-    return (CFE_SB_Msg_t *)address;
+    return (CFE_SB_Msg_t *)bd->Buffer;
 
 }/* CFE_SB_ZeroCopyGetPtr */
 
@@ -1726,22 +3170,20 @@ int32 CFE_SB_ZeroCopyReleasePtr(CFE_SB_Msg_t  *Ptr2Release,
                                 CFE_SB_ZeroCopyHandle_t BufferHandle)
 {
     int32    Status;
-    int32    Stat2;
-    cpuaddr  Addr = (cpuaddr)Ptr2Release;
+    CFE_ES_ResourceID_t AppId;
 
-    Status = CFE_SB_ZeroCopyReleaseDesc(Ptr2Release, BufferHandle);
+    CFE_ES_GetAppID(&AppId);
 
     CFE_SB_LockSharedData(__func__,__LINE__);
 
+    Status = CFE_SB_ZeroCopyReleaseDesc_Unsync(Ptr2Release, BufferHandle, AppId);
+
     if(Status == CFE_SUCCESS){
-        /* give the buffer back to the buffer pool */
-        Stat2 = CFE_ES_PutPoolBuf(CFE_SB.Mem.PoolHdl,
-                                  (uint32 *) (Addr - sizeof(CFE_SB_BufferD_t)));
-        if(Stat2 > 0){
-             /* Substract the size of the actual buffer from the Memory in use ctr */
-            CFE_SB.StatTlmMsg.Payload.MemInUse-=Stat2;
-            CFE_SB.StatTlmMsg.Payload.SBBuffersInUse--;
-        }/* end if */
+        /*
+        ** Drop the handle's reference; a retained buffer may still be
+        ** held by other pipes, so it is only freed when the count hits 0
+        */
+        CFE_SB_DecrBufUseCnt((CFE_SB_BufferD_t *) BufferHandle);
     }
 
     CFE_SB_UnlockSharedData(__func__,__LINE__);
@@ -1778,40 +3220,65 @@ int32 CFE_SB_ZeroCopyReleaseDesc(CFE_SB_Msg_t  *Ptr2Release,
                                  CFE_SB_ZeroCopyHandle_t  BufferHandle)
 {
     int32    Stat;
-    CFE_SB_ZeroCopyD_t *zcd = (CFE_SB_ZeroCopyD_t *) BufferHandle;
+    CFE_ES_ResourceID_t AppId;
+
+    CFE_ES_GetAppID(&AppId);
 
     CFE_SB_LockSharedData(__func__,__LINE__);
 
-    Stat = CFE_ES_GetPoolBufInfo(CFE_SB.Mem.PoolHdl, (uint32 *)zcd);
+    Stat = CFE_SB_ZeroCopyReleaseDesc_Unsync(Ptr2Release, BufferHandle, AppId);
 
-    if((Ptr2Release == NULL) || (Stat < 0) || (zcd->Buffer != (void *)Ptr2Release)){
-        CFE_SB_UnlockSharedData(__func__,__LINE__);
-        return CFE_SB_BUFFER_INVALID;
-    }
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
 
-    /* delink the descriptor */
-    if(zcd->Prev != NULL){
-        ((CFE_SB_ZeroCopyD_t *) (zcd->Prev))->Next = zcd->Next;
-    }
-    if(zcd->Next != NULL){
-        ((CFE_SB_ZeroCopyD_t *) (zcd->Next))->Prev = zcd->Prev;
-    }
-    if(CFE_SB.ZeroCopyTail == (void *)zcd){
-        CFE_SB.ZeroCopyTail = zcd->Prev;
-    }
+    return Stat;
 
-    /* give the descriptor back to the buffer pool */
-    Stat = CFE_ES_PutPoolBuf(CFE_SB.Mem.PoolHdl, (uint32 *)zcd);
-    if(Stat > 0){
-        /* Substract the size of the actual buffer from the Memory in use ctr */
-        CFE_SB.StatTlmMsg.Payload.MemInUse-=Stat;
-    }/* end if */
+}/* end CFE_SB_ZeroCopyReleaseDesc */
 
-    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+/******************************************************************************
+** Name:    CFE_SB_ZeroCopyReleaseDesc_Unsync
+**
+** Purpose: Releases a zero copy descriptor.  Same as
+**          CFE_SB_ZeroCopyReleaseDesc, but the caller must hold the shared
+**          data lock.
+**
+** Assumptions, External Events, and Notes:
+**          The descriptor is the buffer descriptor of the message, so this
+**          only drops one handle from the buffer (taking it off its owner's
+**          zero copy chain once the owner holds none); the reference the
+**          handle held on the buffer passes to the caller.
+**
+** Input Arguments:
+**          Ptr2Release
+**          BufferHandle
+**          AppId - application releasing the handle
+**
+** Output Arguments:
+**          None
+**
+** Return Values:
+**          Status
+**
+******************************************************************************/
+int32 CFE_SB_ZeroCopyReleaseDesc_Unsync(CFE_SB_Msg_t  *Ptr2Release,
+                                        CFE_SB_ZeroCopyHandle_t  BufferHandle,
+                                        CFE_ES_ResourceID_t  AppId)
+{
+    int32    Stat;
+    CFE_SB_BufferD_t *bd = (CFE_SB_BufferD_t *) BufferHandle;
+
+    Stat = CFE_ES_GetPoolBufInfo(CFE_SB.Mem.PoolHdl, (uint32 *)bd);
+
+    if((Ptr2Release == NULL) || (Stat < 0) || (bd->Buffer != (void *)Ptr2Release) ||
+       (bd->HandleCount == 0)){
+        return CFE_SB_BUFFER_INVALID;
+    }
+
+    CFE_SB_ZeroCopyDropHandle_Unsync(bd, AppId);
 
     return CFE_SUCCESS;
 
-}/* end CFE_SB_ZeroCopyReleaseDesc */
+}/* end CFE_SB_ZeroCopyReleaseDesc_Unsync */
 
 
 /*
@@ -1825,7 +3292,7 @@ int32 CFE_SB_ZeroCopySend(CFE_SB_Msg_t   *MsgPtr,
     Status = CFE_SB_ZeroCopyReleaseDesc(MsgPtr, BufferHandle);
 
     if(Status == CFE_SUCCESS){
-        Status = CFE_SB_SendMsgFull(MsgPtr,CFE_SB_INCREMENT_TLM,CFE_SB_SEND_ZEROCOPY);
+        Status = CFE_SB_SendMsgFull(MsgPtr,CFE_SB_INCREMENT_TLM,CFE_SB_SEND_ZEROCOPY,CFE_SB_POLL);
     }
 
     return Status;
@@ -1844,7 +3311,7 @@ int32 CFE_SB_ZeroCopyPass(CFE_SB_Msg_t   *MsgPtr,
     Status = CFE_SB_ZeroCopyReleaseDesc(MsgPtr, BufferHandle);
 
     if(Status == CFE_SUCCESS){
-        Status = CFE_SB_SendMsgFull(MsgPtr,CFE_SB_DO_NOT_INCREMENT,CFE_SB_SEND_ZEROCOPY);
+        Status = CFE_SB_SendMsgFull(MsgPtr,CFE_SB_DO_NOT_INCREMENT,CFE_SB_SEND_ZEROCOPY,CFE_SB_POLL);
     }
 
     return Status;
@@ -1852,13 +3319,142 @@ int32 CFE_SB_ZeroCopyPass(CFE_SB_Msg_t   *MsgPtr,
 }/* end CFE_SB_ZeroCopyPass */
 
 
+/*
+ * Function: CFE_SB_ZeroCopySendBatch - See API and header file for details
+ */
+int32 CFE_SB_ZeroCopySendBatch(CFE_SB_Msg_t            **MsgArray,
+                               CFE_SB_ZeroCopyHandle_t  *HandleArray,
+                               uint32                   Count,
+                               int32                    *StatusArray)
+{
+    int32   Status = 0;
+
+    Status = CFE_SB_SendMsgBatchFull(MsgArray,HandleArray,Count,StatusArray,
+                                     CFE_SB_INCREMENT_TLM,CFE_SB_SEND_ZEROCOPY);
+
+    return Status;
+
+}/* end CFE_SB_ZeroCopySendBatch */
+
+
+/*
+ * Function: CFE_SB_RetainMsg - See API and header file for details
+ */
+int32 CFE_SB_RetainMsg(CFE_SB_Msg_t            *MsgPtr,
+                       CFE_SB_PipeId_t          PipeId,
+                       CFE_SB_ZeroCopyHandle_t *BufferHandle)
+{
+    CFE_ES_ResourceID_t  AppId;
+    CFE_SB_PipeD_t      *PipeDscPtr;
+    CFE_SB_BufferD_t   **SlotPtr;
+    CFE_SB_BufferD_t    *bd;
+
+    if((MsgPtr == NULL)||(BufferHandle == NULL)){
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    CFE_ES_GetAppID(&AppId);
+
+    PipeDscPtr = CFE_SB_GetPipePtr(PipeId);
+    if((PipeDscPtr == NULL)||(!CFE_ES_ResourceID_Equal(PipeDscPtr->AppId, AppId))){
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    /* find the slot of the pipe still holding the message */
+    SlotPtr = CFE_SB_FindRcvSlot_Unsync(PipeDscPtr, MsgPtr);
+    if(SlotPtr == NULL){
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        return CFE_SB_BUFFER_INVALID;
+    }/* end if */
+
+    bd = *SlotPtr;
+
+    /*
+    ** The same message delivered to several pipes may be retained through
+    ** each of them; every handle shares the one buffer descriptor
+    */
+    if(CFE_SB_ZeroCopyAddHandle_Unsync(bd, AppId) != CFE_SUCCESS){
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    /*
+    ** The reference the pipe held on the buffer now belongs to the
+    ** handle, so the next receive on the pipe leaves the buffer alone
+    */
+    *SlotPtr = NULL;
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    (*BufferHandle) = (CFE_SB_ZeroCopyHandle_t) bd;
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_RetainMsg */
+
+
+/*
+ * Function: CFE_SB_ReleaseRetained - See API and header file for details
+ */
+int32 CFE_SB_ReleaseRetained(CFE_SB_Msg_t            *MsgPtr,
+                             CFE_SB_ZeroCopyHandle_t  BufferHandle)
+{
+    /* a retained buffer is held like any other zero copy buffer */
+    return CFE_SB_ZeroCopyReleasePtr(MsgPtr, BufferHandle);
+
+}/* end CFE_SB_ReleaseRetained */
+
+
+/*
+ * Function: CFE_SB_GetMsgSender - See API and header file for details
+ */
+int32 CFE_SB_GetMsgSender(const CFE_SB_Msg_t    *MsgPtr,
+                          CFE_SB_PipeId_t        PipeId,
+                          CFE_ES_ResourceID_t   *SenderIdPtr)
+{
+    CFE_ES_ResourceID_t  AppId;
+    CFE_SB_PipeD_t      *PipeDscPtr;
+    CFE_SB_BufferD_t   **SlotPtr;
+
+    if((MsgPtr == NULL)||(SenderIdPtr == NULL)){
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    CFE_ES_GetAppID(&AppId);
+
+    PipeDscPtr = CFE_SB_GetPipePtr(PipeId);
+    if((PipeDscPtr == NULL)||(!CFE_ES_ResourceID_Equal(PipeDscPtr->AppId, AppId))){
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    SlotPtr = CFE_SB_FindRcvSlot_Unsync(PipeDscPtr, MsgPtr);
+    if(SlotPtr != NULL){
+        (*SenderIdPtr) = (*SlotPtr)->SenderId;
+    }/* end if */
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    if(SlotPtr == NULL){
+        return CFE_SB_BUFFER_INVALID;
+    }/* end if */
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_GetMsgSender */
+
+
 /******************************************************************************
 **  Function:  CFE_SB_ReadQueue()
 **
 **  Purpose:
-**    Read an SB message from the system queue.  The message is represented
-**    by a pointer to the buffer descriptor of the message.  Several options
-**    are available for the timeout, as described below.
+**    Read an SB message from the pipe queue.  The message is represented
+**    by a queue entry holding the buffer descriptor of the message and the
+**    destination it was delivered through.  Several options are available
+**    for the timeout, as described below.
 **
 **  Arguments:
 **    PipeDscPtr: Pointer to pipe descriptor.
@@ -1867,8 +3463,8 @@ int32 CFE_SB_ZeroCopyPass(CFE_SB_Msg_t   *MsgPtr,
 **                  CFE_SB_PEND_FOREVER  = wait forever until a packet arrives
 **                  CFE_SB_POLL = check the pipe for packets but don't wait
 **                  value in milliseconds = wait up to a specified time
-**    Message   : Pointer to a variable that will receive the buffer
-**                descriptor of the message.
+**    EntryPtr  : Pointer to a variable that will receive the queue entry
+**                of the message.
 **
 **  Return:
 **    CFE_SB status code indicating the result of the operation:
@@ -1881,10 +3477,9 @@ int32 CFE_SB_ZeroCopyPass(CFE_SB_Msg_t   *MsgPtr,
 int32  CFE_SB_ReadQueue (CFE_SB_PipeD_t         *PipeDscPtr,
                          CFE_ES_ResourceID_t    TskId,
                          CFE_SB_TimeOut_t       Time_Out,
-                         CFE_SB_BufferD_t       **Message)
+                         CFE_SB_QueueEntry_t    *EntryPtr)
 {
     int32              Status,TimeOut;
-    uint32             Nbytes;
     char               FullName[(OS_MAX_API_NAME * 2)];
     char               PipeName[OS_MAX_API_NAME] = {'\0'};
 
@@ -1906,16 +3501,14 @@ int32  CFE_SB_ReadQueue (CFE_SB_PipeD_t         *PipeDscPtr,
     }/* end switch */
 
     /* Read the buffer descriptor address from the queue.  */
-    Status = OS_QueueGet(PipeDscPtr->SysQueueId,
-                        (void *)Message,
-                        sizeof(CFE_SB_BufferD_t *),
-                        &Nbytes,
-                        TimeOut);
+    Status = CFE_SB_QueueGet(PipeDscPtr, EntryPtr, TimeOut);
 
     /* translate the return value */
     switch(Status){
 
       case OS_SUCCESS:
+          /* the read made room for a sender waiting on a lossless pipe */
+          CFE_SB_QueueSignalSpace(PipeDscPtr);
           Status = CFE_SUCCESS;
           break;
 
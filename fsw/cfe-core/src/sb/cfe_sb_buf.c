@@ -90,8 +90,15 @@ CFE_SB_BufferD_t * CFE_SB_GetBufferFromPool(CFE_SB_MsgId_t MsgId, uint16 Size) {
     /* Initialize the buffer descriptor structure. */
     bd->MsgId     = MsgId;
     bd->UseCount  = 1;
+    bd->HandleCount  = 0;
+    bd->OwnerHandles = 0;
+    bd->RetiredNext  = NULL;
     bd->Size      = Size;
     bd->Buffer    = (void *)address;
+    bd->SenderId  = CFE_ES_RESOURCEID_UNDEFINED;
+    bd->AppId     = CFE_ES_RESOURCEID_UNDEFINED;
+    bd->Next      = NULL;
+    bd->Prev      = NULL;
 
     return bd;
 
@@ -167,7 +174,9 @@ int32 CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd){
 **
 **  Note:
 **    UseCount is a variable in the CFE_SB_BufferD_t and is used only to
-**    determine when a buffer may be returned to the memory pool.
+**    determine when a buffer may be returned to the memory pool.  It is
+**    changed atomically, as readers of a broadcast topic take references
+**    without the shared data lock (see CFE_SB_BcastGet).
 **
 **  Arguments:
 **    bd : Pointer to the buffer descriptor.
@@ -180,9 +189,13 @@ int32 CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd){
     /* range check the UseCount variable */
     if(bd->UseCount > 0){
 
+#ifdef CFE_SB_LOCKFREE_ROUTING
+        if (__sync_sub_and_fetch(&bd->UseCount, 1) == 0) {
+#else
         bd->UseCount--;
 
         if (bd->UseCount == 0) {
+#endif
            CFE_SB_ReturnBufferToPool(bd);
         }/* end if */
 
@@ -195,24 +208,177 @@ int32 CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd){
 
 
 /******************************************************************************
-**  Function:   CFE_SB_GetDestinationBlk()
+**  Function:   CFE_SB_ZeroCopyLink_Unsync()
+**
+**  Purpose:
+**    Hands a buffer to an application as a zero copy buffer, adding it to
+**    the head of that application's zero copy chain.  The chains are kept
+**    per application so that releasing an application's buffers at clean
+**    up does not need to look at the buffers of any other application.
+**    The buffer gains one handle, owned by the application.
+**
+**    The caller must hold the shared data lock.
+**
+**  Arguments:
+**    bd    : Pointer to the buffer descriptor.
+**    AppId : Application taking ownership of the buffer.
+**
+**  Return:
+**    CFE_SUCCESS, or CFE_SB_BAD_ARGUMENT if AppId is not a valid application
+*/
+int32 CFE_SB_ZeroCopyLink_Unsync(CFE_SB_BufferD_t *bd, CFE_ES_ResourceID_t AppId){
+
+    uint32    AppIdx;
+
+    if((CFE_ES_AppID_ToIndex(AppId, &AppIdx) != CFE_SUCCESS)||
+       (AppIdx >= CFE_PLATFORM_ES_MAX_APPLICATIONS)){
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    bd->AppId = AppId;
+    bd->HandleCount++;
+    bd->OwnerHandles = 1;
+    bd->Prev  = NULL;
+    bd->Next  = CFE_SB.ZeroCopyHead[AppIdx];
+    if(bd->Next != NULL){
+        ((CFE_SB_BufferD_t *) bd->Next)->Prev = bd;
+    }/* end if */
+    CFE_SB.ZeroCopyHead[AppIdx] = bd;
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_ZeroCopyLink_Unsync */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_ZeroCopyUnlink_Unsync()
+**
+**  Purpose:
+**    Takes a zero copy buffer off the chain of its owning application.  The
+**    buffer keeps its use count and the handles of other applications; the
+**    caller decides what becomes of it.
+**
+**    The caller must hold the shared data lock.
+**
+**  Arguments:
+**    bd : Pointer to the buffer descriptor.
+**
+**  Return:
+**    None
+*/
+void CFE_SB_ZeroCopyUnlink_Unsync(CFE_SB_BufferD_t *bd){
+
+    uint32    AppIdx;
+
+    if(bd->Prev != NULL){
+        ((CFE_SB_BufferD_t *) bd->Prev)->Next = bd->Next;
+    }else if(CFE_ES_AppID_ToIndex(bd->AppId, &AppIdx) == CFE_SUCCESS &&
+             AppIdx < CFE_PLATFORM_ES_MAX_APPLICATIONS){
+        CFE_SB.ZeroCopyHead[AppIdx] = bd->Next;
+    }/* end if */
+
+    if(bd->Next != NULL){
+        ((CFE_SB_BufferD_t *) bd->Next)->Prev = bd->Prev;
+    }/* end if */
+
+    bd->AppId = CFE_ES_RESOURCEID_UNDEFINED;
+    bd->OwnerHandles = 0;
+    bd->Next  = NULL;
+    bd->Prev  = NULL;
+
+}/* end CFE_SB_ZeroCopyUnlink_Unsync */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_ZeroCopyAddHandle_Unsync()
+**
+**  Purpose:
+**    Adds a zero copy handle to a buffer for an application, which takes
+**    over one UseCount reference from the caller.  A buffer without an owner
+**    is linked into the chain of the application; a buffer that already has
+**    one only counts the handle, as a buffer is on one chain at a time.
+**
+**    The caller must hold the shared data lock.
+**
+**  Arguments:
+**    bd    : Pointer to the buffer descriptor.
+**    AppId : Application taking the handle.
+**
+**  Return:
+**    CFE_SUCCESS, or CFE_SB_BAD_ARGUMENT if AppId is not a valid application
+*/
+int32 CFE_SB_ZeroCopyAddHandle_Unsync(CFE_SB_BufferD_t *bd, CFE_ES_ResourceID_t AppId){
+
+    if(!CFE_ES_ResourceID_IsDefined(bd->AppId)){
+        return CFE_SB_ZeroCopyLink_Unsync(bd, AppId);
+    }/* end if */
+
+    bd->HandleCount++;
+    if(CFE_ES_ResourceID_Equal(bd->AppId, AppId)){
+        bd->OwnerHandles++;
+    }/* end if */
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_ZeroCopyAddHandle_Unsync */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_ZeroCopyDropHandle_Unsync()
 **
 **  Purpose:
-**    This function gets a destination descriptor from the SB memory pool.
+**    Removes one zero copy handle from a buffer; the UseCount reference it
+**    held passes to the caller.  The buffer leaves the chain of its owner
+**    once the owner holds no handle on it, even if other applications still
+**    do.
+**
+**    The caller must hold the shared data lock.
 **
 **  Arguments:
+**    bd    : Pointer to the buffer descriptor.
+**    AppId : Application giving up the handle.
+**
+**  Return:
 **    None
+*/
+void CFE_SB_ZeroCopyDropHandle_Unsync(CFE_SB_BufferD_t *bd, CFE_ES_ResourceID_t AppId){
+
+    bd->HandleCount--;
+
+    if((bd->OwnerHandles > 0) && CFE_ES_ResourceID_Equal(bd->AppId, AppId)){
+        bd->OwnerHandles--;
+    }/* end if */
+
+    if(CFE_ES_ResourceID_IsDefined(bd->AppId) &&
+       ((bd->HandleCount == 0)||(bd->OwnerHandles == 0))){
+        CFE_SB_ZeroCopyUnlink_Unsync(bd);
+    }/* end if */
+
+}/* end CFE_SB_ZeroCopyDropHandle_Unsync */
+
+
+
+/******************************************************************************
+**  Function:   CFE_SB_GetDestinationBlk()
+**
+**  Purpose:
+**    This function gets an array of destination descriptors from the SB
+**    memory pool.
+**
+**  Arguments:
+**    NumDests - Number of destination descriptors the array must hold
 **
 **  Return:
-**    Pointer to the destination descriptor
+**    Pointer to the first destination descriptor, or NULL on failure
 */
-CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
+CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(uint16 NumDests)
 {
     int32 Stat;
     CFE_SB_DestinationD_t *Dest = NULL;
 
-    /* Allocate a new destination descriptor from the SB memory pool.*/
-    Stat = CFE_ES_GetPoolBuf((uint32 **)&Dest, CFE_SB.Mem.PoolHdl,  sizeof(CFE_SB_DestinationD_t));
+    /* Allocate a new destination array from the SB memory pool.*/
+    Stat = CFE_ES_GetPoolBuf((uint32 **)&Dest, CFE_SB.Mem.PoolHdl,
+                             NumDests * sizeof(CFE_SB_DestinationD_t));
     if(Stat < 0){
         return NULL;
     }
@@ -233,13 +399,14 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
 **  Function:   CFE_SB_PutDestinationBlk()
 **
 **  Purpose:
-**    This function returns a destination descriptor to the SB memory pool.
+**    This function returns a destination descriptor array to the SB memory
+**    pool.
 **
 **  Arguments:
-**    None
+**    Dest - Pointer to the first destination descriptor of the array
 **
 **  Return:
-**    Pointer to the destination descriptor
+**    CFE_SUCCESS, or CFE_SB_BAD_ARGUMENT for a NULL pointer
 */
 int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest)
 {
@@ -249,10 +416,10 @@ int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest)
         return CFE_SB_BAD_ARGUMENT;
     }/* end if */
 
-    /* give the destination block back to the SB memory pool */
+    /* give the destination array back to the SB memory pool */
     Stat = CFE_ES_PutPoolBuf(CFE_SB.Mem.PoolHdl, (uint32 *)Dest);
     if(Stat > 0){
-        /* Substract the size of the destination block from the Memory in use ctr */
+        /* Substract the size of the destination array from the Memory in use ctr */
         CFE_SB.StatTlmMsg.Payload.MemInUse-=Stat;
     }/* end if */
 
@@ -127,7 +127,25 @@ int32 CFE_SB_EarlyInit (void) {
                    sizeof(CFE_SB.StatTlmMsg),
                    true);    
 
-    CFE_SB.ZeroCopyTail = NULL;
+    /* Initialize the SB Latency Statistics Pkt */
+    CFE_SB_InitMsg(&CFE_SB.LatencyTlmMsg,
+                   CFE_SB_ValueToMsgId(CFE_SB_LATENCY_TLM_MID),
+                   sizeof(CFE_SB.LatencyTlmMsg),
+                   true);
+
+    memset(CFE_SB.ZeroCopyHead, 0, sizeof(CFE_SB.ZeroCopyHead));
+
+    /* No pipe errors waiting to be reported */
+    memset(CFE_SB.SendErrTbl, 0, sizeof(CFE_SB.SendErrTbl));
+    CFE_SB.SendErrsLost = 0;
+
+    /* No info file being written */
+    memset(&CFE_SB.Dump, 0, sizeof(CFE_SB.Dump));
+    CFE_SB.Dump.Kind = CFE_SB_DUMP_IDLE;
+
+    /* No elastic pipe or broadcast topic waiting for the SB task */
+    CFE_SB.ElasticPending = 0;
+    CFE_SB.BcastPending = 0;
 
     return Stat;
 
@@ -194,6 +212,13 @@ void CFE_SB_InitPipeTbl(void){
         CFE_SB.PipeTbl[i].SysQueueId    = CFE_SB_UNUSED_QUEUE;
         CFE_SB.PipeTbl[i].PipeId        = CFE_SB_INVALID_PIPE;
         CFE_SB.PipeTbl[i].CurrentBuff   = NULL;
+        CFE_SB.PipeTbl[i].PendingPuts   = 0;
+        CFE_SB.PipeTbl[i].BatchCount    = 0;
+        CFE_SB.PipeTbl[i].Ring.Slots    = NULL;
+        CFE_SB.PipeTbl[i].AltRing.Slots = NULL;
+        CFE_SB.PipeTbl[i].DestGen       = 0;
+        CFE_SB.PipeTbl[i].BcastMask     = 0;
+        memset(CFE_SB.PipeTbl[i].RouteMap, 0, sizeof(CFE_SB.PipeTbl[i].RouteMap));
     }/* end for */
 
 }/* end CFE_SB_InitPipeTbl */
@@ -216,11 +241,16 @@ void CFE_SB_InitPipeTbl(void){
 */
 void CFE_SB_InitMsgMap(void){
 
-    CFE_SB_MsgKey_Atom_t   KeyVal;
+    uint32   SlotIdx;
 
-    for (KeyVal=0; KeyVal < CFE_SB_MAX_NUMBER_OF_MSG_KEYS; KeyVal++)
+    for (SlotIdx=0; SlotIdx < CFE_SB_MSGMAP_SIZE; SlotIdx++)
     {
-        CFE_SB.MsgMap[KeyVal] = CFE_SB_INVALID_ROUTE_IDX;
+#ifdef CFE_PLATFORM_SB_MSGMAP_HASH
+        CFE_SB.MsgMap[SlotIdx].KeyIdx = CFE_SB_INVALID_MSG_KEY.KeyIdx;
+        CFE_SB.MsgMap[SlotIdx].RouteIdx = CFE_SB_INVALID_ROUTE_IDX.RouteIdx;
+#else
+        CFE_SB.MsgMap[SlotIdx] = CFE_SB_INVALID_ROUTE_IDX;
+#endif
     }
 
 }/* end CFE_SB_InitMsgMap */
@@ -251,8 +281,23 @@ void CFE_SB_InitRoutingTbl(void){
         CFE_SB.RoutingTbl[i].MsgId = CFE_SB_INVALID_MSG_ID;
         CFE_SB.RoutingTbl[i].SeqCnt = 0;
         CFE_SB.RoutingTbl[i].Destinations = 0;
-        CFE_SB.RoutingTbl[i].ListHeadPtr = NULL;
+        CFE_SB.RoutingTbl[i].DestArraySize = 0;
+        CFE_SB.RoutingTbl[i].DestArray = NULL;
+        CFE_SB.RoutingTbl[i].Topic = NULL;
+#ifdef CFE_PLATFORM_SB_MSGID_LATENCY_HIST
+        memset(&CFE_SB.RoutingTbl[i].Latency, 0, sizeof(CFE_SB.RoutingTbl[i].Latency));
+#endif
+
+    }/* end for */
 
+    /* No broadcast topics */
+    for(i=0;i<CFE_PLATFORM_SB_MAX_BCAST_TOPICS;i++){
+        CFE_SB.BcastTbl[i].MsgId = CFE_SB_INVALID_MSG_ID;
+        CFE_SB.BcastTbl[i].Slots = NULL;
+        CFE_SB.BcastTbl[i].Readers = 0;
+        CFE_SB.BcastTbl[i].Retired = NULL;
+        CFE_SB.BcastTbl[i].RetiredSlots = NULL;
+        memset((void *)CFE_SB.BcastTbl[i].WaitMask, 0, sizeof(CFE_SB.BcastTbl[i].WaitMask));
     }/* end for */
 
 }/* end CFE_SB_InitRoutingTbl */
@@ -79,13 +79,16 @@
 #include "common_types.h"
 #include "osapi.h"
 #include "private/cfe_private.h"
+#include "cfe_sb_events.h"
 #include "cfe_sb_priv.h"
 #include "cfe_sb.h"
 #include "ccsds.h"
 #include "cfe_error.h"
 #include "cfe_es.h"
 #include "cfe_msg_api.h"
+#include "cfe_psp.h"
 #include <string.h>
+#include <stdlib.h>
 
 /******************************************************************************
 **  Function:  CFE_SB_InitIdxStack()
@@ -253,7 +256,7 @@ uint8 CFE_SB_GetPipeIdx(CFE_SB_PipeId_t PipeId){
     /* search the pipe table for the for the given pipe id */
     for(i=0;i<CFE_PLATFORM_SB_MAX_PIPES;i++){
 
-        if((CFE_SB.PipeTbl[i].PipeId == PipeId)&&(CFE_SB.PipeTbl[i].InUse == 1)){
+        if((CFE_SB.PipeTbl[i].PipeId == PipeId)&&(CFE_SB.PipeTbl[i].InUse == CFE_SB_IN_USE)){
             return i;
         }/* end if */
 
@@ -364,6 +367,40 @@ CFE_SB_PipeD_t *CFE_SB_GetPipePtr(CFE_SB_PipeId_t PipeId) {
 }/* end CFE_SB_GetPipePtr */
 
 
+/******************************************************************************
+**  Function:  CFE_SB_FindRcvSlot_Unsync()
+**
+**  Purpose:
+**    Finds the slot of a pipe that holds a message returned by the last
+**    receive on the pipe, either CurrentBuff or one of BatchBuff.  The
+**    caller must hold the shared data lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**    MsgPtr     : Pointer to the message
+**
+**  Return:
+**    Pointer to the slot, or NULL if the pipe does not hold the message
+*/
+CFE_SB_BufferD_t **CFE_SB_FindRcvSlot_Unsync(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_Msg_t *MsgPtr){
+
+    uint16  i;
+
+    if((PipeDscPtr->CurrentBuff != NULL)&&(PipeDscPtr->CurrentBuff->Buffer == (const void *)MsgPtr)){
+        return &PipeDscPtr->CurrentBuff;
+    }/* end if */
+
+    for(i = 0; i < PipeDscPtr->BatchCount; i++){
+        if((PipeDscPtr->BatchBuff[i] != NULL)&&(PipeDscPtr->BatchBuff[i]->Buffer == (const void *)MsgPtr)){
+            return &PipeDscPtr->BatchBuff[i];
+        }/* end if */
+    }/* end for */
+
+    return NULL;
+
+}/* end CFE_SB_FindRcvSlot_Unsync */
+
+
 
 /******************************************************************************
 **  Function:  CFE_SB_GetDestPtr()
@@ -384,7 +421,8 @@ CFE_SB_DestinationD_t  *CFE_SB_GetDestPtr(CFE_SB_MsgKey_t MsgKey,
                                           CFE_SB_PipeId_t PipeId){
 
     CFE_SB_MsgRouteIdx_t    Idx;
-    CFE_SB_DestinationD_t   *DestPtr;
+    CFE_SB_RouteEntry_t     *RoutePtr;
+    uint16                  i;
 
     Idx = CFE_SB_GetRoutingTblIdx(MsgKey);
 
@@ -393,17 +431,15 @@ CFE_SB_DestinationD_t  *CFE_SB_GetDestPtr(CFE_SB_MsgKey_t MsgKey,
         return NULL;
     }/* end if */
 
-    DestPtr = CFE_SB_GetRoutePtrFromIdx(Idx)->ListHeadPtr;
+    RoutePtr = CFE_SB_GetRoutePtrFromIdx(Idx);
 
-    while(DestPtr != NULL){
+    for(i = 0; i < RoutePtr->Destinations; i++){
 
-        if(DestPtr -> PipeId == PipeId){
-            return DestPtr;
+        if(RoutePtr->DestArray[i].PipeId == PipeId){
+            return &RoutePtr->DestArray[i];
         }/* end if */
 
-        DestPtr = DestPtr->Next;
-
-    }/* end while */
+    }/* end for */
 
     return NULL;
 
@@ -431,7 +467,36 @@ CFE_SB_DestinationD_t  *CFE_SB_GetDestPtr(CFE_SB_MsgKey_t MsgKey,
 */
 CFE_SB_MsgRouteIdx_t CFE_SB_GetRoutingTblIdx(CFE_SB_MsgKey_t MsgKey){
 
+#ifdef CFE_PLATFORM_SB_MSGMAP_HASH
+    uint32                    Slot;
+    uint32                    Probes;
+    CFE_SB_MsgKey_Atom_t      KeyIdx;
+    CFE_SB_MsgRouteIdx_t      RouteIdx;
+
+    Slot = CFE_SB_MsgMapHash(MsgKey);
+
+    for(Probes = 0; Probes < CFE_SB_MSGMAP_SIZE; Probes++){
+
+        KeyIdx = CFE_SB.MsgMap[Slot].KeyIdx;
+
+        if(KeyIdx == MsgKey.KeyIdx){
+            RouteIdx.RouteIdx = CFE_SB.MsgMap[Slot].RouteIdx;
+            return RouteIdx;
+        }/* end if */
+
+        /* an unused slot ends the probe sequence */
+        if(KeyIdx == CFE_SB_INVALID_MSG_KEY.KeyIdx){
+            break;
+        }/* end if */
+
+        Slot = (Slot + 1) & (CFE_SB_MSGMAP_SIZE - 1);
+
+    }/* end for */
+
+    return CFE_SB_INVALID_ROUTE_IDX;
+#else
     return CFE_SB.MsgMap[CFE_SB_MsgKeyToValue(MsgKey)];
+#endif
 
 }/* end CFE_SB_GetRoutingTblIdx */
 
@@ -446,6 +511,11 @@ CFE_SB_MsgRouteIdx_t CFE_SB_GetRoutingTblIdx(CFE_SB_MsgKey_t MsgKey){
 **    for quick routing table index lookups of a given message ID. The cost of
 **    this quick lookup is 8K bytes of memory(for CCSDS).
 **
+**    With CFE_PLATFORM_SB_MSGMAP_HASH a new key is placed in the first unused
+**    slot of its probe sequence.  Setting an invalid value removes the key and
+**    shifts the keys after it back, so that no removed slot is left in a probe
+**    sequence and a miss stops at the end of the cluster.
+**
 **  Assumptions:
 **    Calls to this are predicated by a call to CFE_SB_IsValidMsgKey
 **    which already check the MsgKey argument
@@ -459,11 +529,105 @@ CFE_SB_MsgRouteIdx_t CFE_SB_GetRoutingTblIdx(CFE_SB_MsgKey_t MsgKey){
 */
 void CFE_SB_SetRoutingTblIdx(CFE_SB_MsgKey_t MsgKey, CFE_SB_MsgRouteIdx_t Value){
 
+#ifdef CFE_PLATFORM_SB_MSGMAP_HASH
+    uint32                    Slot;
+    uint32                    Hole;
+    uint32                    Probes;
+    CFE_SB_MsgKey_t           NextKey;
+    CFE_SB_MsgKey_Atom_t      KeyIdx = CFE_SB_INVALID_MSG_KEY.KeyIdx;
+
+    Slot = CFE_SB_MsgMapHash(MsgKey);
+
+    for(Probes = 0; Probes < CFE_SB_MSGMAP_SIZE; Probes++){
+
+        KeyIdx = CFE_SB.MsgMap[Slot].KeyIdx;
+
+        if((KeyIdx == MsgKey.KeyIdx) || (KeyIdx == CFE_SB_INVALID_MSG_KEY.KeyIdx)){
+            break;
+        }/* end if */
+
+        Slot = (Slot + 1) & (CFE_SB_MSGMAP_SIZE - 1);
+
+    }/* end for */
+
+    /* no room (cannot happen while routes <= slots) */
+    if(Probes == CFE_SB_MSGMAP_SIZE){
+        return;
+    }/* end if */
+
+    if(CFE_SB_IsValidRouteIdx(Value)){
+
+        CFE_SB.MsgMap[Slot].KeyIdx   = MsgKey.KeyIdx;
+        CFE_SB.MsgMap[Slot].RouteIdx = Value.RouteIdx;
+        return;
+
+    }/* end if */
+
+    /* nothing to remove */
+    if(KeyIdx != MsgKey.KeyIdx){
+        return;
+    }/* end if */
+
+    /*
+    ** Move each following key of the cluster whose home slot does not lie
+    ** between the hole and the key into the hole, until an unused slot.
+    */
+    Hole = Slot;
+    Slot = (Slot + 1) & (CFE_SB_MSGMAP_SIZE - 1);
+
+    while(CFE_SB.MsgMap[Slot].KeyIdx != CFE_SB_INVALID_MSG_KEY.KeyIdx){
+
+        NextKey.KeyIdx = CFE_SB.MsgMap[Slot].KeyIdx;
+
+        if(((Slot - CFE_SB_MsgMapHash(NextKey)) & (CFE_SB_MSGMAP_SIZE - 1)) >=
+           ((Slot - Hole) & (CFE_SB_MSGMAP_SIZE - 1))){
+            CFE_SB.MsgMap[Hole].KeyIdx   = CFE_SB.MsgMap[Slot].KeyIdx;
+            CFE_SB.MsgMap[Hole].RouteIdx = CFE_SB.MsgMap[Slot].RouteIdx;
+            Hole = Slot;
+        }/* end if */
+
+        Slot = (Slot + 1) & (CFE_SB_MSGMAP_SIZE - 1);
+
+    }/* end while */
+
+    CFE_SB.MsgMap[Hole].RouteIdx = CFE_SB_INVALID_ROUTE_IDX.RouteIdx;
+    CFE_SB.MsgMap[Hole].KeyIdx   = CFE_SB_INVALID_MSG_KEY.KeyIdx;
+#else
     CFE_SB.MsgMap[CFE_SB_MsgKeyToValue(MsgKey)] = Value;
+#endif
 
 }/* end CFE_SB_SetRoutingTblIdx */
 
 
+/******************************************************************************
+**  Function:  CFE_SB_GetMsgMapEntry()
+**
+**  Purpose:
+**    SB internal function to read the routing table index held in one slot
+**    of the message map, for walking the whole map regardless of how it is
+**    organized.
+**
+**  Arguments:
+**    SlotIdx  : Slot to read, 0 to CFE_SB_MSGMAP_SIZE - 1
+**
+**  Return:
+**    The routing table index held in the slot, invalid if the slot is unused
+*/
+CFE_SB_MsgRouteIdx_t CFE_SB_GetMsgMapEntry(uint32 SlotIdx){
+
+#ifdef CFE_PLATFORM_SB_MSGMAP_HASH
+    CFE_SB_MsgRouteIdx_t      RouteIdx;
+
+    RouteIdx.RouteIdx = CFE_SB.MsgMap[SlotIdx].RouteIdx;
+
+    return RouteIdx;
+#else
+    return CFE_SB.MsgMap[SlotIdx];
+#endif
+
+}/* end CFE_SB_GetMsgMapEntry */
+
+
 /******************************************************************************
 **  Function:  CFE_SB_GetRoutePtrFromIdx()
 **
@@ -505,28 +669,23 @@ int32 CFE_SB_DuplicateSubscribeCheck(CFE_SB_MsgKey_t MsgKey,
                                        CFE_SB_PipeId_t PipeId){
 
     CFE_SB_MsgRouteIdx_t    Idx;
-    CFE_SB_DestinationD_t   *DestPtr;
+    CFE_SB_RouteEntry_t     *RoutePtr;
+    uint16                  i;
 
     Idx = CFE_SB_GetRoutingTblIdx(MsgKey);
 
-    if(!CFE_SB_IsValidRouteIdx(Idx))
-    {
-        DestPtr = NULL;
-    }
-    else
+    if(CFE_SB_IsValidRouteIdx(Idx))
     {
-        DestPtr = CFE_SB_GetRoutePtrFromIdx(Idx)->ListHeadPtr;
-    }/* end if */
-
-    while(DestPtr != NULL){
+        RoutePtr = CFE_SB_GetRoutePtrFromIdx(Idx);
 
-        if(DestPtr -> PipeId == PipeId){
-            return CFE_SB_DUPLICATE;
-        }/* end if */
+        for(i = 0; i < RoutePtr->Destinations; i++){
 
-        DestPtr = DestPtr->Next;
+            if(RoutePtr->DestArray[i].PipeId == PipeId){
+                return CFE_SB_DUPLICATE;
+            }/* end if */
 
-    }/* end while */
+        }/* end for */
+    }/* end if */
 
     return CFE_SB_NO_DUPLICATE;
 
@@ -595,7 +754,7 @@ int32 CFE_SB_ValidateMsgId(CFE_SB_MsgId_t MsgId){
 int32 CFE_SB_ValidatePipeId(CFE_SB_PipeId_t PipeId){
 
     if((PipeId >= CFE_PLATFORM_SB_MAX_PIPES)||
-       (CFE_SB.PipeTbl[PipeId].InUse == CFE_SB_NOT_IN_USE))
+       (CFE_SB.PipeTbl[PipeId].InUse != CFE_SB_IN_USE))
     {
         return CFE_SB_FAILED;
     }else{
@@ -727,44 +886,90 @@ void CFE_SB_FinishSendEvent(CFE_ES_ResourceID_t TaskId, uint32 Bit){
 **  Function:  CFE_SB_AddDest()
 **
 **  Purpose:
-**      This function will add the given node to the head of the list.
+**      This function will add a copy of the given destination to the front
+**      of the destination array of the route, growing the array from the SB
+**      memory pool if it is full.
+**
+**      Destinations that move invalidate the destination handles queued on
+**      their pipes; receivers then look the destination up again.
+**
+**      If the MsgId is a broadcast topic the pipe starts reading the topic
+**      with the next message sent.  The route is added to the route map of
+**      the pipe.
 **
 **  Arguments:
-**      RtgTblIdx - Routing table index
-**      Dest - Pointer to the destination block to add to the list
+**      RouteEntry - Pointer to the route
+**      NewDest - Pointer to the destination to add
 **
 **  Return:
-**
+**      Pointer to the stored destination, or NULL if the array could not be
+**      grown
 */
-int32 CFE_SB_AddDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *NewNode){
+CFE_SB_DestinationD_t *CFE_SB_AddDest(CFE_SB_RouteEntry_t *RouteEntry, const CFE_SB_DestinationD_t *NewDest){
 
-    CFE_SB_DestinationD_t *WBS;/* Will Be Second (WBS) node */
+    CFE_SB_DestinationD_t *DestArray = RouteEntry->DestArray;
+    uint16                 NewSize = RouteEntry->DestArraySize;
+    uint16                 i;
 
-    /* if first node in list */
-    if(RouteEntry->ListHeadPtr == NULL){
+    /* if the array is full, allocate a larger one */
+    if(RouteEntry->Destinations >= RouteEntry->DestArraySize){
 
-        /* initialize the new node */
-        NewNode->Next = NULL;
-        NewNode->Prev = NULL;
+        NewSize = RouteEntry->DestArraySize * 2;
+        if(NewSize < CFE_SB_MIN_DEST_ARRAY_SIZE){
+            NewSize = CFE_SB_MIN_DEST_ARRAY_SIZE;
+        }/* end if */
+        if(NewSize > CFE_PLATFORM_SB_MAX_DEST_PER_PKT){
+            NewSize = CFE_PLATFORM_SB_MAX_DEST_PER_PKT;
+        }/* end if */
 
-        /* insert the new node */
-        RouteEntry->ListHeadPtr = NewNode;
+        DestArray = CFE_SB_GetDestinationBlk(NewSize);
+        if(DestArray == NULL){
+            return NULL;
+        }/* end if */
 
-    }else{
+    }/* end if */
+
+    /* every existing destination moves up one slot */
+    for(i = 0; i < RouteEntry->Destinations; i++){
+        if(RouteEntry->DestArray[i].PipeId < CFE_PLATFORM_SB_MAX_PIPES){
+            CFE_SB.PipeTbl[RouteEntry->DestArray[i].PipeId].DestGen++;
+        }/* end if */
+    }/* end for */
 
-        WBS = RouteEntry->ListHeadPtr;
+    if(RouteEntry->Destinations > 0){
+        memmove(&DestArray[1], RouteEntry->DestArray,
+                RouteEntry->Destinations * sizeof(CFE_SB_DestinationD_t));
+    }/* end if */
+
+    DestArray[0] = *NewDest;
+
+    if(DestArray != RouteEntry->DestArray){
+
+        if(RouteEntry->DestArray != NULL){
+            CFE_SB_PutDestinationBlk(RouteEntry->DestArray);
+        }/* end if */
+
+        RouteEntry->DestArray = DestArray;
+        RouteEntry->DestArraySize = NewSize;
 
-        /* initialize the new node */
-        NewNode->Next = WBS;
-        NewNode->Prev = NULL;
+    }/* end if */
 
-        /* insert the new node */
-        WBS -> Prev = NewNode;
-        RouteEntry->ListHeadPtr = NewNode;
+    RouteEntry->Destinations++;
 
+    if(NewDest->PipeId < CFE_PLATFORM_SB_MAX_PIPES){
+        i = (uint16)(RouteEntry - CFE_SB.RoutingTbl);
+        CFE_SB.PipeTbl[NewDest->PipeId].RouteMap[i / 32] |= (1UL << (i % 32));
     }/* end if */
 
-    return CFE_SUCCESS;
+    if((RouteEntry->Topic != NULL) && (NewDest->PipeId < CFE_PLATFORM_SB_MAX_PIPES)){
+        /* the cursor is set before the reader of the pipe can see the topic */
+        i = (uint16)(RouteEntry->Topic - CFE_SB.BcastTbl);
+        CFE_SB.PipeTbl[NewDest->PipeId].BcastNext[i] = RouteEntry->Topic->Head;
+        CFE_SB_MEMORY_BARRIER();
+        CFE_SB.PipeTbl[NewDest->PipeId].BcastMask |= (1UL << i);
+    }/* end if */
+
+    return &DestArray[0];
 
 }/* CFE_SB_AddDest */
 
@@ -774,99 +979,1455 @@ int32 CFE_SB_AddDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *New
 **  Function:  CFE_SB_RemoveDest()
 **
 **  Purpose:
-**      This function will remove the given node from the list.
-**      This function assumes there is at least one node in the list.
+**      This function will remove the given destination from the destination
+**      array of the route, closing the gap it leaves, and the route from the
+**      route map of the pipe.  The array is returned to the SB memory pool
+**      when its last destination is removed.
+**      This function assumes the destination is in the array.
 **
 **  Arguments:
-**      RtgTblIdx - Routing table index
-**      Dest - Pointer to the destination block to remove from the list
+**      RouteEntry - Pointer to the route
+**      DestToRemove - Pointer to the destination to remove from the array
 **
 **  Return:
 **
 */
-int32 CFE_SB_RemoveDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *NodeToRemove){
+int32 CFE_SB_RemoveDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *DestToRemove){
+
+    uint16 Idx = (uint16)(DestToRemove - RouteEntry->DestArray);
+    uint16 i;
+
+    /* release a message held for a latest value pipe */
+    if(DestToRemove->LatestBuff != NULL){
+        CFE_SB_DecrBufUseCnt(DestToRemove->LatestBuff);
+        DestToRemove->LatestBuff = NULL;
+    }/* end if */
+
+    if(DestToRemove->PipeId < CFE_PLATFORM_SB_MAX_PIPES){
+        i = (uint16)(RouteEntry - CFE_SB.RoutingTbl);
+        CFE_SB.PipeTbl[DestToRemove->PipeId].RouteMap[i / 32] &= ~(1UL << (i % 32));
+    }/* end if */
+
+    /* the pipe stops reading the broadcast topic, unread messages are skipped */
+    if((RouteEntry->Topic != NULL) && (DestToRemove->PipeId < CFE_PLATFORM_SB_MAX_PIPES)){
+        CFE_SB.PipeTbl[DestToRemove->PipeId].BcastMask &=
+            ~(1UL << (uint32)(RouteEntry->Topic - CFE_SB.BcastTbl));
+    }/* end if */
 
-    CFE_SB_DestinationD_t *PrevNode;
-    CFE_SB_DestinationD_t *NextNode;
+    /* a sender waiting for room on the pipe gives up on the removed destination */
+    if(DestToRemove->PipeId < CFE_PLATFORM_SB_MAX_PIPES){
+        CFE_SB_QueueWakeWriters(&CFE_SB.PipeTbl[DestToRemove->PipeId]);
+    }/* end if */
 
-    /* if this is the only node in the list */
-    if((NodeToRemove->Prev == NULL) && (NodeToRemove->Next == NULL)){
+    /* invalidate the destination handles queued on the removed and moved pipes */
+    for(i = Idx; i < RouteEntry->Destinations; i++){
+        if(RouteEntry->DestArray[i].PipeId < CFE_PLATFORM_SB_MAX_PIPES){
+            CFE_SB.PipeTbl[RouteEntry->DestArray[i].PipeId].DestGen++;
+        }/* end if */
+    }/* end for */
 
-        RouteEntry->ListHeadPtr = NULL;
+    RouteEntry->Destinations--;
 
-    /* if first node in the list and list has more than one */
-    }else if(NodeToRemove->Prev == NULL){
+    if(RouteEntry->Destinations == 0){
 
-        NextNode = NodeToRemove->Next;
+        CFE_SB_PutDestinationBlk(RouteEntry->DestArray);
+        RouteEntry->DestArray = NULL;
+        RouteEntry->DestArraySize = 0;
 
-        NextNode -> Prev = NULL;
+    }else if(Idx < RouteEntry->Destinations){
 
-        RouteEntry->ListHeadPtr = NextNode;
+        memmove(&RouteEntry->DestArray[Idx], &RouteEntry->DestArray[Idx + 1],
+                (RouteEntry->Destinations - Idx) * sizeof(CFE_SB_DestinationD_t));
 
-    /* if last node in the list and list has more than one */
-    }else if(NodeToRemove->Next == NULL){
+    }/* end if */
 
-        PrevNode = NodeToRemove->Prev;
+    return CFE_SUCCESS;
 
-        PrevNode -> Next = NULL;
+}/* CFE_SB_RemoveDest */
 
-    /* NodeToRemove has node(s) before and node(s) after */
-    }else{
 
-        PrevNode = NodeToRemove->Prev;
-        NextNode = NodeToRemove->Next;
+/******************************************************************************
+**  Function:  CFE_SB_PendingPutBegin_Unsync()
+**
+**  Purpose:
+**      Records that a sender has reserved a slot on a pipe and is about to
+**      write its queue outside of the shared data lock.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      PipeDscPtr - Pointer to the pipe descriptor
+**
+**  Return:
+**      None
+*/
+void CFE_SB_PendingPutBegin_Unsync(CFE_SB_PipeD_t *PipeDscPtr){
+
+#ifdef CFE_SB_LOCKFREE_ROUTING
+    __sync_add_and_fetch(&PipeDscPtr->PendingPuts, 1);
+#else
+    PipeDscPtr->PendingPuts++;
+#endif
+
+}/* end CFE_SB_PendingPutBegin_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_PendingPutEnd()
+**
+**  Purpose:
+**      Records that a queue write reserved by CFE_SB_PendingPutBegin_Unsync
+**      has completed.  The last pending write to a pipe that was deleted
+**      meanwhile completes the deletion.  Called without the shared data lock.
+**
+**  Arguments:
+**      PipeDscPtr - Pointer to the pipe descriptor
+**
+**  Return:
+**      None
+*/
+void CFE_SB_PendingPutEnd(CFE_SB_PipeD_t *PipeDscPtr){
+
+    uint32 Pending;
+
+#ifdef CFE_SB_LOCKFREE_ROUTING
+    /* the atomic decrement orders the load of InUse below after it */
+    Pending = __sync_sub_and_fetch(&PipeDscPtr->PendingPuts, 1);
+#else
+    CFE_SB_LockSharedData(__func__,__LINE__);
+    Pending = --PipeDscPtr->PendingPuts;
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+#endif
+
+    if((Pending == 0) && (PipeDscPtr->InUse == CFE_SB_PIPE_DELETING)){
+        CFE_SB_FinishPipeDelete(PipeDscPtr);
+    }/* end if */
+
+}/* end CFE_SB_PendingPutEnd */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_AddSubscription_Unsync()
+**
+**  Purpose:
+**      Adds a pipe to the destinations of one MsgId, taking a routing table
+**      entry for the MsgId if this is its first subscription.  The pipe,
+**      owner, MsgId and scope must have been checked by the caller.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      MsgId   - Message Id to subscribe to
+**      PipeId  - Pipe to add to the destinations
+**      Quality - Quality of service, a non zero priority uses the high
+**                priority lane of the pipe
+**      MsgLim  - Max number of messages with this MsgId on the pipe at a time
+**      Scope   - Local subscription or broadcasted to peers
+**
+**  Return:
+**      CFE_SUCCESS
+**      CFE_SB_DUPLICATE if the pipe is already subscribed to the MsgId
+**      CFE_SB_MAX_MSGS_MET if no routing table entry is free
+**      CFE_SB_MAX_DESTS_MET if the MsgId has the max number of destinations
+**      CFE_SB_BUF_ALOC_ERR if the destination or the high priority lane
+**          could not be allocated
+*/
+int32 CFE_SB_AddSubscription_Unsync(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
+                                    CFE_SB_Qos_t Quality, uint16 MsgLim, uint8 Scope){
+
+    CFE_SB_MsgRouteIdx_t  RouteIdx;
+    CFE_SB_RouteEntry_t   *RoutePtr;
+    CFE_SB_MsgKey_t       MsgKey;
+    CFE_SB_DestinationD_t NewDest;
+    bool                  NewRoute = false;
 
-        PrevNode -> Next = NextNode;
-        NextNode -> Prev = PrevNode;
+    /* Convert the API MsgId into the SB internal representation MsgKey */
+    MsgKey = CFE_SB_ConvertMsgIdtoMsgKey(MsgId);
 
+    /* check for duplicate subscription */
+    if(CFE_SB_DuplicateSubscribeCheck(MsgKey,PipeId)==CFE_SB_DUPLICATE){
+        return CFE_SB_DUPLICATE;
     }/* end if */
 
+    /* the high priority lane is made before any routing state is taken */
+    if((Quality.Priority != 0) &&
+       (CFE_SB_QueueAddLane_Unsync(&CFE_SB.PipeTbl[PipeId]) != OS_SUCCESS)){
+        return CFE_SB_BUF_ALOC_ERR;
+    }/* end if */
+
+    /*
+    ** If there has been a subscription for this message id earlier,
+    ** get the element number in the routing table.
+    */
+    RouteIdx = CFE_SB_GetRoutingTblIdx(MsgKey);
+
+    /* if not first subscription for this message KEY ... */
+    if(CFE_SB_IsValidRouteIdx(RouteIdx))
+    {
+        RoutePtr = CFE_SB_GetRoutePtrFromIdx(RouteIdx);
+
+        /*
+         * FIXME: If a hash or other conversion is used between MsgId and MsgKey,
+         * then it is possible that this existing route is for a different MsgId.
+         *
+         * The MsgId should be checked against the "MsgId" in the route here.
+         *
+         * However it is not possible to have a mismatch in the default case where
+         * MsgKey == MsgId.  The hashed message map (CFE_PLATFORM_SB_MSGMAP_HASH)
+         * stores the full key in each slot, so it cannot mismatch either.
+         */
+    }
+    else
+    {
+        /* Get the index to the first available element in the routing table */
+        RouteIdx = CFE_SB_RouteIdxPop_Unsync();
+
+        /* if all routing table elements are used */
+        if(!CFE_SB_IsValidRouteIdx(RouteIdx)){
+            return CFE_SB_MAX_MSGS_MET;
+        }/* end if */
+
+        NewRoute = true;
+
+        /* Increment the MsgIds in use ctr and if it's > the high water mark,*/
+        /* adjust the high water mark */
+        CFE_SB.StatTlmMsg.Payload.MsgIdsInUse++;
+        if(CFE_SB.StatTlmMsg.Payload.MsgIdsInUse > CFE_SB.StatTlmMsg.Payload.PeakMsgIdsInUse){
+           CFE_SB.StatTlmMsg.Payload.PeakMsgIdsInUse = CFE_SB.StatTlmMsg.Payload.MsgIdsInUse;
+        }/* end if */
+
+        /* populate the look up table with the routing table index */
+        CFE_SB_SetRoutingTblIdx(MsgKey,RouteIdx);
+
+        /* label the new routing block with the message identifier */
+        RoutePtr = CFE_SB_GetRoutePtrFromIdx(RouteIdx);
+        RoutePtr->MsgId = MsgId;
+        RoutePtr->Topic = CFE_SB_FindBcastTopic(MsgId);
+#ifdef CFE_PLATFORM_SB_MSGID_LATENCY_HIST
+        memset(&RoutePtr->Latency, 0, sizeof(RoutePtr->Latency));
+#endif
+
+    }/* end if */
 
-    /* initialize the node before returning it to the heap */
-    NodeToRemove -> Next = NULL;
-    NodeToRemove -> Prev = NULL;
+    if(RoutePtr->Destinations >= CFE_PLATFORM_SB_MAX_DEST_PER_PKT){
+        return CFE_SB_MAX_DESTS_MET;
+    }/* end if */
+
+    /* initialize destination descriptor */
+    memset(&NewDest, 0, sizeof(NewDest));
+    NewDest.PipeId = PipeId;
+    NewDest.MsgId2PipeLim = (uint16)MsgLim;
+    NewDest.Active = CFE_SB_ACTIVE;
+    NewDest.BuffCount = 0;
+    NewDest.DestCnt = 0;
+    NewDest.Scope = Scope;
+    NewDest.Priority = Quality.Priority;
+
+    /* add destination to the front of the array, growing it if needed */
+    if(CFE_SB_AddDest(RoutePtr, &NewDest) == NULL){
+
+        /* give back a routing table entry taken for this subscription */
+        if(NewRoute){
+            CFE_SB_SetRoutingTblIdx(MsgKey, CFE_SB_INVALID_ROUTE_IDX);
+            RoutePtr->MsgId = CFE_SB_INVALID_MSG_ID;
+            RoutePtr->Topic = NULL;
+            CFE_SB_RouteIdxPush_Unsync(RouteIdx);
+            CFE_SB.StatTlmMsg.Payload.MsgIdsInUse--;
+        }/* end if */
+
+        return CFE_SB_BUF_ALOC_ERR;
+    }/* end if */
+
+    CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse++;
+    if(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse > CFE_SB.StatTlmMsg.Payload.PeakSubscriptionsInUse)
+    {
+       CFE_SB.StatTlmMsg.Payload.PeakSubscriptionsInUse = CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse;
+    }/* end if */
 
     return CFE_SUCCESS;
 
-}/* CFE_SB_RemoveDest */
+}/* end CFE_SB_AddSubscription_Unsync */
 
 
 /******************************************************************************
-** Name:    CFE_SB_ZeroCopyReleaseAppId
+**  Function:  CFE_SB_UndoSubscriptions_Unsync()
 **
-** Purpose: API used for releasing all pointers to a buffers (for zero copy mode
-**          only) for a specific Application. This function is used for cleaning
-**          up when an application crashes.
+**  Purpose:
+**      Removes the subscriptions of a pipe made since its route map was
+**      copied, and frees the routing table entries taken since then.  Used
+**      to back out a subscription to several MsgIds that failed partway.
+**      Routing table entries are popped from the top of the free stack, so
+**      the entries taken are the ones between the two stack tops.
 **
-** Assumptions, External Events, and Notes:
-**          None
+**      The caller must hold the shared data lock.
 **
-** Date Written:
-**          07/23/2009
+**  Arguments:
+**      PipeId          - Pipe the subscriptions were made for
+**      PrevRouteMap    - Copy of the route map of the pipe before they were
+**                        made
+**      PrevRouteIdxTop - Top of the routing table free stack before they
+**                        were made
 **
-** Input Arguments:
-**          AppId
+**  Return:
+**      None
+*/
+void CFE_SB_UndoSubscriptions_Unsync(CFE_SB_PipeId_t PipeId, const uint32 *PrevRouteMap,
+                                     uint16 PrevRouteIdxTop){
+
+    CFE_SB_RouteEntry_t  *RoutePtr;
+    CFE_SB_MsgRouteIdx_t RouteIdx;
+    uint32  Added;
+    uint32  i;
+    uint32  Bit;
+    uint16  DestIdx;
+
+    for(i = 0; i < CFE_SB_ROUTE_MAP_WORDS; i++){
+
+        Added = CFE_SB.PipeTbl[PipeId].RouteMap[i] & ~PrevRouteMap[i];
+
+        for(Bit = 0; Added != 0; Bit++, Added >>= 1){
+
+            if((Added & 1) == 0){
+                continue;
+            }/* end if */
+
+            RoutePtr = &CFE_SB.RoutingTbl[(i * 32) + Bit];
+
+            for (DestIdx = 0; DestIdx < RoutePtr->Destinations && RoutePtr->DestArray[DestIdx].PipeId != PipeId; DestIdx++)
+                ;
+
+            if(DestIdx < RoutePtr->Destinations){
+                CFE_SB_RemoveDest(RoutePtr, &RoutePtr->DestArray[DestIdx]);
+                CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse--;
+            }/* end if */
+
+        }/* end for */
+
+    }/* end for */
+
+    while(CFE_SB.RouteIdxTop > PrevRouteIdxTop){
+
+        RouteIdx = CFE_SB.RouteIdxStack[CFE_SB.RouteIdxTop - 1];
+        RoutePtr = CFE_SB_GetRoutePtrFromIdx(RouteIdx);
+
+        CFE_SB_SetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(RoutePtr->MsgId), CFE_SB_INVALID_ROUTE_IDX);
+        RoutePtr->MsgId = CFE_SB_INVALID_MSG_ID;
+        RoutePtr->Topic = NULL;
+        CFE_SB_RouteIdxPush_Unsync(RouteIdx);
+        CFE_SB.StatTlmMsg.Payload.MsgIdsInUse--;
+
+    }/* end while */
+
+}/* end CFE_SB_UndoSubscriptions_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_MsgIdSetFirst()
 **
-** Output Arguments:
-**          None
+**  Purpose:
+**      Gets the lowest MsgId value in a MsgId set.  A set with a Mask is
+**      expected to start at 0 (see CFE_SB_SubscribeMask), otherwise the
+**      lowest value may be missed and the set reported as empty.
 **
-** Return Values:
-**          Status
+**  Arguments:
+**      SetPtr   - Pointer to the set
+**      ValuePtr - Receives the MsgId value
 **
-******************************************************************************/
-int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_ResourceID_t         AppId)
-{
-    CFE_SB_ZeroCopyD_t *prev = NULL;
-    CFE_SB_ZeroCopyD_t *zcd = (CFE_SB_ZeroCopyD_t *) (CFE_SB.ZeroCopyTail);
-
-    while(zcd != NULL){
-        prev = (CFE_SB_ZeroCopyD_t *) (zcd->Prev);
-        if( CFE_ES_ResourceID_Equal(zcd->AppID, AppId) )
-        {
-            CFE_SB_ZeroCopyReleasePtr((CFE_SB_Msg_t *) zcd->Buffer, (CFE_SB_ZeroCopyHandle_t) zcd);
-        }
-        zcd = prev;
-    }
+**  Return:
+**      false if the set is empty
+*/
+bool CFE_SB_MsgIdSetFirst(const CFE_SB_MsgIdSet_t *SetPtr, CFE_SB_MsgId_Atom_t *ValuePtr){
+
+    CFE_SB_MsgId_Atom_t Value;
+
+    if(SetPtr->First > SetPtr->Last){
+        return false;
+    }/* end if */
+
+    /* the masked bits are fixed, the others start from the bottom of the range */
+    Value = (SetPtr->First & ~SetPtr->Mask) | (SetPtr->Value & SetPtr->Mask);
+    if((Value < SetPtr->First) || (Value > SetPtr->Last)){
+        return false;
+    }/* end if */
+
+    *ValuePtr = Value;
+    return true;
+
+}/* end CFE_SB_MsgIdSetFirst */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_MsgIdSetNext()
+**
+**  Purpose:
+**      Steps to the next MsgId value in a MsgId set.  Only the bits outside
+**      of the mask are counted, so each step costs the same however sparse
+**      the set is.
+**
+**  Arguments:
+**      SetPtr   - Pointer to the set
+**      ValuePtr - Current MsgId value on input, next one on output
+**
+**  Return:
+**      false if there are no more values in the set
+*/
+bool CFE_SB_MsgIdSetNext(const CFE_SB_MsgIdSet_t *SetPtr, CFE_SB_MsgId_Atom_t *ValuePtr){
+
+    CFE_SB_MsgId_Atom_t Value;
+
+    Value = (((*ValuePtr | SetPtr->Mask) + 1) & ~SetPtr->Mask) | (SetPtr->Value & SetPtr->Mask);
+    if((Value <= *ValuePtr) || (Value > SetPtr->Last)){
+        return false;
+    }/* end if */
+
+    *ValuePtr = Value;
+    return true;
+
+}/* end CFE_SB_MsgIdSetNext */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_CompareMsgIdValues()
+**
+**  Purpose:
+**      qsort comparison of two MsgId values, in ascending order.
+**
+**  Arguments:
+**      A, B - Pointers to the values to compare
+**
+**  Return:
+**      Less than, equal to or greater than 0 as A is below, equal to or
+**      above B
+*/
+static int CFE_SB_CompareMsgIdValues(const void *A, const void *B){
+
+    CFE_SB_MsgId_Atom_t ValueA = *(const CFE_SB_MsgId_Atom_t *)A;
+    CFE_SB_MsgId_Atom_t ValueB = *(const CFE_SB_MsgId_Atom_t *)B;
+
+    return (ValueA > ValueB) - (ValueA < ValueB);
+
+}/* end CFE_SB_CompareMsgIdValues */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_SortMsgIdValues()
+**
+**  Purpose:
+**      Sorts a list of MsgId values in ascending order and drops the values
+**      listed more than once.  Called without the shared data lock.
+**
+**  Arguments:
+**      Values - The values to sort, the distinct values are left first
+**      Count  - Number of values in the list
+**
+**  Return:
+**      Number of distinct values
+*/
+uint32 CFE_SB_SortMsgIdValues(CFE_SB_MsgId_Atom_t *Values, uint32 Count){
+
+    uint32 NumDistinct;
+    uint32 i;
+
+    if(Count == 0){
+        return 0;
+    }/* end if */
+
+    qsort(Values, Count, sizeof(CFE_SB_MsgId_Atom_t), CFE_SB_CompareMsgIdValues);
+
+    NumDistinct = 1;
+    for(i = 1; i < Count; i++){
+        if(Values[i] != Values[NumDistinct - 1]){
+            Values[NumDistinct] = Values[i];
+            NumDistinct++;
+        }/* end if */
+    }/* end for */
+
+    return NumDistinct;
+
+}/* end CFE_SB_SortMsgIdValues */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_PolicyAccepts_Unsync()
+**
+**  Purpose:
+**      Applies the delivery policy of a destination to a message being sent.
+**      PolicyCount counts the messages since the last one delivered for
+**      CFE_SB_DELIVER_EVERY_NTH; for the other modes it is non-zero once a
+**      message has been delivered, and PolicyLast then holds the time (in
+**      milliseconds) or the field value of that message.
+**
+**      A message held back advances the policy state here.  A message to be
+**      delivered does not; its value is returned so the caller can commit it
+**      with CFE_SB_PolicyCommit_Unsync once the destination is reserved.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      DestPtr  - Pointer to the destination descriptor
+**      MsgPtr   - Pointer to the message being sent
+**      ValuePtr - Set to the policy value of the message if it is accepted
+**
+**  Return:
+**      true if the message is to be delivered to the destination
+*/
+bool CFE_SB_PolicyAccepts_Unsync(CFE_SB_DestinationD_t *DestPtr, const CFE_SB_Msg_t *MsgPtr,
+                                 uint32 *ValuePtr){
+
+    uint32         Value = 0;
+    uint16         i;
+    const uint8   *FieldPtr;
+
+    switch(DestPtr->Policy.Mode){
+
+      case CFE_SB_DELIVER_EVERY_NTH:
+          if(DestPtr->PolicyCount != 0){
+              DestPtr->PolicyCount++;
+              if(DestPtr->PolicyCount >= DestPtr->Policy.Param){
+                  DestPtr->PolicyCount = 0;
+              }/* end if */
+              return false;
+          }/* end if */
+          break;
+
+      case CFE_SB_DELIVER_INTERVAL:
+          Value = CFE_SB_MsecNow();
+          if((DestPtr->PolicyCount != 0) &&
+             ((uint32)(Value - DestPtr->PolicyLast) < DestPtr->Policy.Param)){
+              return false;
+          }/* end if */
+          break;
+
+      case CFE_SB_DELIVER_ON_CHANGE:
+          if(((uint32)DestPtr->Policy.FieldOffset + DestPtr->Policy.FieldSize) >
+             CFE_SB_GetTotalMsgLength(MsgPtr)){
+              return true;
+          }/* end if */
+          FieldPtr = (const uint8 *)MsgPtr + DestPtr->Policy.FieldOffset;
+          for(i = 0; i < DestPtr->Policy.FieldSize; i++){
+              Value = (Value << 8) | FieldPtr[i];
+          }/* end for */
+          if((DestPtr->PolicyCount != 0) && (Value == DestPtr->PolicyLast)){
+              return false;
+          }/* end if */
+          break;
+
+      default:
+          break;
+
+    }/* end switch */
+
+    *ValuePtr = Value;
+
+    return true;
+
+}/* end CFE_SB_PolicyAccepts_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_PolicyCommit_Unsync()
+**
+**  Purpose:
+**      Records a message accepted by CFE_SB_PolicyAccepts_Unsync as the last
+**      one delivered to the destination.  Called only once the destination
+**      has been reserved, so a message dropped at the MsgId to pipe limit
+**      does not hold back the next one.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      DestPtr - Pointer to the destination descriptor
+**      Value   - Policy value returned by CFE_SB_PolicyAccepts_Unsync
+**
+**  Return:
+**      None
+*/
+void CFE_SB_PolicyCommit_Unsync(CFE_SB_DestinationD_t *DestPtr, uint32 Value){
+
+    switch(DestPtr->Policy.Mode){
+
+      case CFE_SB_DELIVER_ALL:
+          break;
+
+      case CFE_SB_DELIVER_EVERY_NTH:
+          DestPtr->PolicyCount = (DestPtr->Policy.Param > 1) ? 1 : 0;
+          break;
+
+      default:
+          DestPtr->PolicyCount = 1;
+          DestPtr->PolicyLast  = Value;
+          break;
+
+    }/* end switch */
+
+}/* end CFE_SB_PolicyCommit_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_LatencyNow()
+**
+**  Purpose:
+**      Returns the time base of the latency histograms, the PSP local time in
+**      microseconds.  Only differences of two values are meaningful; they are
+**      correct across a wrap of the 32 bit value.
+**
+**  Arguments:
+**      None
+**
+**  Return:
+**      Current time in microseconds
+*/
+uint32 CFE_SB_LatencyNow(void){
+
+    OS_time_t   Now;
+
+    CFE_PSP_GetTime(&Now);
+
+    return ((uint32)Now.seconds * 1000000) + (uint32)Now.microsecs;
+
+}/* end CFE_SB_LatencyNow */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_MsecNow()
+**
+**  Purpose:
+**      Returns the PSP local time in milliseconds, the time base of the
+**      delivery policy intervals and of the deadline of a lossless send.
+**      Only differences of two values are meaningful.
+**
+**  Arguments:
+**      None
+**
+**  Return:
+**      Current time in milliseconds
+*/
+uint32 CFE_SB_MsecNow(void){
+
+    OS_time_t   Now;
+
+    CFE_PSP_GetTime(&Now);
+
+    return ((uint32)Now.seconds * 1000) + ((uint32)Now.microsecs / 1000);
+
+}/* end CFE_SB_MsecNow */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_AddLatencySample()
+**
+**  Purpose:
+**      Counts one latency in a histogram, in the bucket of its log2 as
+**      described for CFE_SB_LatencyHist_t.
+**
+**  Arguments:
+**      HistPtr - Pointer to the histogram
+**      Latency - Latency in microseconds
+**
+**  Return:
+**      None
+*/
+void CFE_SB_AddLatencySample(CFE_SB_LatencyHist_t *HistPtr, uint32 Latency){
+
+    uint32  Bucket = 0;
+    uint32  Value = Latency;
+
+    while((Value != 0) && (Bucket < (CFE_SB_LATENCY_HIST_BUCKETS - 1))){
+        Value >>= 1;
+        Bucket++;
+    }/* end while */
+
+    HistPtr->Bucket[Bucket]++;
+    HistPtr->Samples++;
+    if(Latency > HistPtr->MaxLatency){
+        HistPtr->MaxLatency = Latency;
+    }/* end if */
+
+}/* end CFE_SB_AddLatencySample */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_RecordLatency_Unsync()
+**
+**  Purpose:
+**      Adds the time a buffer waited, from its send until now, to the latency
+**      histogram of the pipe it was received from and, when
+**      CFE_PLATFORM_SB_MSGID_LATENCY_HIST is defined, of its MsgId.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      PipeDscPtr - Pointer to the pipe descriptor
+**      BufDscPtr  - Pointer to the buffer descriptor just received
+**
+**  Return:
+**      None
+*/
+void CFE_SB_RecordLatency_Unsync(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_BufferD_t *BufDscPtr){
+
+    uint32  Latency;
+#ifdef CFE_PLATFORM_SB_MSGID_LATENCY_HIST
+    CFE_SB_MsgRouteIdx_t  RouteIdx;
+#endif
+
+    Latency = CFE_SB_LatencyNow() - BufDscPtr->SendTime;
+
+    CFE_SB_AddLatencySample(&PipeDscPtr->Latency, Latency);
+
+#ifdef CFE_PLATFORM_SB_MSGID_LATENCY_HIST
+    RouteIdx = CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(BufDscPtr->MsgId));
+    if(CFE_SB_IsValidRouteIdx(RouteIdx)){
+        CFE_SB_AddLatencySample(&CFE_SB_GetRoutePtrFromIdx(RouteIdx)->Latency, Latency);
+    }/* end if */
+#endif
+
+}/* end CFE_SB_RecordLatency_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_ReserveDest_Unsync()
+**
+**  Purpose:
+**      Decides whether a message is to be written to one destination and, if
+**      so, charges the destination and pipe counters for it.  The queue write
+**      itself is done by the caller after the shared data lock is released.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      DestPtr      - Pointer to the destination descriptor
+**      AppId        - Id of the sending app
+**      MsgPtr       - Pointer to the message, for the delivery policy
+**
+**  Return:
+**      CFE_SB_DEST_RESERVED if a slot was reserved on the pipe
+**      CFE_SB_DEST_SKIPPED if the destination does not take this message
+**      CFE_SB_DEST_AT_LIMIT if the MsgId to pipe limit has been reached
+**      CFE_SB_DEST_REPLACED if the message is to replace the one pending on
+**          a latest value pipe or for a coalescing subscription, see
+**          CFE_SB_ReplaceLatest_Unsync
+*/
+uint32 CFE_SB_ReserveDest_Unsync(CFE_SB_DestinationD_t *DestPtr, CFE_ES_ResourceID_t AppId,
+                                 const CFE_SB_Msg_t *MsgPtr){
+
+    CFE_SB_PipeD_t          *PipeDscPtr;
+    CFE_SB_PipeDepthStats_t *StatObj;
+    uint32                  PolicyValue = 0;
+
+    if (DestPtr->Active == CFE_SB_INACTIVE){
+        return CFE_SB_DEST_SKIPPED;
+    }/* end if */
+
+    PipeDscPtr = &CFE_SB.PipeTbl[DestPtr->PipeId];
+
+    if((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_IGNOREMINE) &&
+       CFE_ES_ResourceID_Equal(PipeDscPtr->AppId, AppId)){
+        return CFE_SB_DEST_SKIPPED;
+    }/* end if */
+
+    /* messages held back by the delivery policy take no pipe depth or buffer */
+    if((DestPtr->Policy.Mode != CFE_SB_DELIVER_ALL) &&
+       !CFE_SB_PolicyAccepts_Unsync(DestPtr, MsgPtr, &PolicyValue)){
+        DestPtr->SkipCnt++;
+        return CFE_SB_DEST_SKIPPED;
+    }/* end if */
+
+    /* a latest value pipe, or a coalescing subscription, holds one message
+       per MsgId, the new one replaces it */
+    if(((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_LATEST) || DestPtr->Coalesce) &&
+       (DestPtr->BuffCount > 0)){
+        DestPtr->DestCnt++;   /* used for statistics */
+        CFE_SB_PolicyCommit_Unsync(DestPtr, PolicyValue);
+        return CFE_SB_DEST_REPLACED;
+    }/* end if */
+
+    /* a lossless pipe is only limited by its depth, which senders may wait on */
+    if((DestPtr->BuffCount >= DestPtr->MsgId2PipeLim) &&
+       ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_LOSSLESS) == 0)){
+        CFE_SB.HKTlmMsg.Payload.MsgLimitErrorCounter++;
+        PipeDscPtr->SendErrors++;
+        return CFE_SB_DEST_AT_LIMIT;
+    }/* end if */
+
+    CFE_SB_PendingPutBegin_Unsync(PipeDscPtr);
+    CFE_SB_PolicyCommit_Unsync(DestPtr, PolicyValue);
+
+    DestPtr->BuffCount++; /* used for checking MsgId2PipeLimit */
+    DestPtr->DestCnt++;   /* used for statistics */
+
+    if (DestPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE){
+        StatObj = &CFE_SB.StatTlmMsg.Payload.PipeDepthStats[DestPtr->PipeId];
+        StatObj->InUse++;
+        if((StatObj->InUse > StatObj->PeakInUse) && (StatObj->InUse <= StatObj->Depth)){
+            StatObj->PeakInUse = StatObj->InUse;
+        }/* end if */
+        if(DestPtr->Priority != 0){
+            StatObj->HighInUse++;
+            if(StatObj->HighInUse > StatObj->HighPeakInUse){
+                StatObj->HighPeakInUse = StatObj->HighInUse;
+            }/* end if */
+        }/* end if */
+    }/* end if */
+
+    return CFE_SB_DEST_RESERVED;
+
+}/* end CFE_SB_ReserveDest_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_ReplaceLatest_Unsync()
+**
+**  Purpose:
+**      Makes a buffer the newest message of a destination on a latest value
+**      pipe or of a coalescing subscription, releasing the message it
+**      replaces.  The caller hands one
+**      reference of the buffer to the destination, and the buffer must
+**      already hold the complete message.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      DestPtr   - Pointer to the destination descriptor
+**      BufDscPtr - Pointer to the buffer descriptor of the new message
+**
+**  Return:
+**      None
+*/
+void CFE_SB_ReplaceLatest_Unsync(CFE_SB_DestinationD_t *DestPtr, CFE_SB_BufferD_t *BufDscPtr){
+
+    if(DestPtr->LatestBuff != NULL){
+        CFE_SB_DecrBufUseCnt(DestPtr->LatestBuff);
+    }/* end if */
+
+    DestPtr->LatestBuff = BufDscPtr;
+
+}/* end CFE_SB_ReplaceLatest_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_TakeLatest_Unsync()
+**
+**  Purpose:
+**      Swaps the buffer of a queue entry just read for the newest message of
+**      its destination, if a newer one has replaced it.  The replaced buffer
+**      is released.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      DestPtr  - Pointer to the destination descriptor, may be NULL
+**      EntryPtr - Pointer to the queue entry that was read
+**
+**  Return:
+**      None
+*/
+void CFE_SB_TakeLatest_Unsync(CFE_SB_DestinationD_t *DestPtr, CFE_SB_QueueEntry_t *EntryPtr){
+
+    if((DestPtr != NULL) && (DestPtr->LatestBuff != NULL)){
+        CFE_SB_DecrBufUseCnt(EntryPtr->BufDscPtr);
+        EntryPtr->BufDscPtr = DestPtr->LatestBuff;
+        DestPtr->LatestBuff = NULL;
+    }/* end if */
+
+}/* end CFE_SB_TakeLatest_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_RefundDest_Unsync()
+**
+**  Purpose:
+**      Gives back the counters charged by CFE_SB_ReserveDest_Unsync when the
+**      queue write for that destination failed, and counts the failure.  The
+**      delivery policy forgets the last message delivered, so the next one
+**      is not held back by a message that never reached the pipe.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      DestPtr   - Pointer to the destination descriptor, NULL if the
+**                  destination was removed since it was reserved
+**      PipeId    - Pipe the write was made to
+**      Lane      - Lane of the pipe the write was made to
+**      PutStatus - Status returned by the queue write
+**
+**  Return:
+**      None
+*/
+void CFE_SB_RefundDest_Unsync(CFE_SB_DestinationD_t *DestPtr,
+                              CFE_SB_PipeId_t PipeId, uint32 Lane, int32 PutStatus){
+
+    CFE_SB_PipeDepthStats_t *StatObj = NULL;
+
+    if (DestPtr != NULL){
+        if (DestPtr->BuffCount > 0){
+            DestPtr->BuffCount--;
+        }
+        if (DestPtr->DestCnt > 0){
+            DestPtr->DestCnt--;
+        }
+        DestPtr->PolicyCount = 0;
+    }/* end if */
+
+    if (PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE){
+        StatObj = &CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId];
+        if (StatObj->InUse > 0){
+            StatObj->InUse--;
+        }/* end if */
+        if ((Lane == CFE_SB_LANE_HIGH) && (StatObj->HighInUse > 0)){
+            StatObj->HighInUse--;
+        }/* end if */
+    }/* end if */
+
+    if (PutStatus == OS_QUEUE_FULL){
+        CFE_SB.HKTlmMsg.Payload.PipeOverflowErrorCounter++;
+        if (StatObj != NULL){
+            if (Lane == CFE_SB_LANE_HIGH){
+                StatObj->HighOverflows++;
+            }else{
+                StatObj->Overflows++;
+            }/* end if */
+        }/* end if */
+    }else{ /* Unexpected error while writing to queue. */
+        CFE_SB.HKTlmMsg.Payload.InternalErrorCounter++;
+    }/* end if */
+
+    if (PipeId < CFE_PLATFORM_SB_MAX_PIPES){
+        CFE_SB.PipeTbl[PipeId].SendErrors++;
+    }/* end if */
+
+}/* end CFE_SB_RefundDest_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_InitDelivery()
+**
+**  Purpose:
+**      Starts the delivery of a message, with no buffer and no destination
+**      reserved yet.
+**
+**  Arguments:
+**      DelivPtr     - Pointer to the delivery
+**      MsgPtr       - Pointer to the message as given by the sender
+**      MsgId        - MsgId of the message
+**      TotalMsgSize - Size of the message
+**      CopyMode     - CFE_SB_SEND_ONECOPY or CFE_SB_SEND_ZEROCOPY
+**
+**  Return:
+**      None
+*/
+void CFE_SB_InitDelivery(CFE_SB_Delivery_t *DelivPtr, CFE_SB_Msg_t *MsgPtr, CFE_SB_MsgId_t MsgId,
+                         uint16 TotalMsgSize, uint32 CopyMode){
+
+    DelivPtr->MsgPtr       = MsgPtr;
+    DelivPtr->MsgId        = MsgId;
+    DelivPtr->BufDscPtr    = NULL;
+    DelivPtr->TotalMsgSize = TotalMsgSize;
+    DelivPtr->CopyMode     = CopyMode;
+    DelivPtr->SetSeqCnt    = false;
+    DelivPtr->SeqCnt       = 0;
+    DelivPtr->Copied       = false;
+    DelivPtr->NumReserved  = 0;
+    DelivPtr->NumReplaced  = 0;
+    DelivPtr->NumFailed    = 0;
+
+}/* end CFE_SB_InitDelivery */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_CopyDelivery()
+**
+**  Purpose:
+**      Copies the message into the SB buffer of the delivery and sets its
+**      sequence count, unless that was done already.
+**
+**  Arguments:
+**      DelivPtr - Pointer to the delivery, which must have a buffer
+**
+**  Return:
+**      None
+*/
+void CFE_SB_CopyDelivery(CFE_SB_Delivery_t *DelivPtr){
+
+    if(DelivPtr->Copied){
+        return;
+    }/* end if */
+
+    if(DelivPtr->CopyMode != CFE_SB_SEND_ZEROCOPY){
+        memcpy(DelivPtr->BufDscPtr->Buffer, DelivPtr->MsgPtr, DelivPtr->TotalMsgSize);
+    }/* end if */
+
+    if(DelivPtr->SetSeqCnt){
+        CFE_SB_SetMsgSeqCnt((CFE_SB_Msg_t *)DelivPtr->BufDscPtr->Buffer, DelivPtr->SeqCnt);
+    }/* end if */
+
+    DelivPtr->Copied = true;
+
+}/* end CFE_SB_CopyDelivery */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_ReserveDelivery_Unsync()
+**
+**  Purpose:
+**      Reserves one destination for the delivery (see
+**      CFE_SB_ReserveDest_Unsync).  A destination whose pending message is
+**      replaced takes the buffer at once, so the message is copied now.
+**      A destination at its limit is recorded for the SB task to report.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      DelivPtr - Pointer to the delivery, which must have a buffer
+**      DestPtr  - Pointer to the destination descriptor
+**      AppId    - Application Id of the sender
+**      TskId    - Task Id of the sender
+**      MayWait  - The sender waits on a full lossless pipe
+**
+**  Return:
+**      None
+*/
+void CFE_SB_ReserveDelivery_Unsync(CFE_SB_Delivery_t *DelivPtr, CFE_SB_DestinationD_t *DestPtr,
+                                   CFE_ES_ResourceID_t AppId, CFE_ES_ResourceID_t TskId, bool MayWait){
+
+    uint16 n = DelivPtr->NumReserved;
+
+    if(n >= CFE_PLATFORM_SB_MAX_DEST_PER_PKT){
+        return;
+    }/* end if */
+
+    switch(CFE_SB_ReserveDest_Unsync(DestPtr, AppId, DelivPtr->MsgPtr)){
+
+        case CFE_SB_DEST_RESERVED:
+            DelivPtr->PipeId[n]   = DestPtr->PipeId;
+            DelivPtr->Lossless[n] = (MayWait &&
+                                     (CFE_SB.PipeTbl[DestPtr->PipeId].Opts & CFE_SB_PIPEOPTS_LOSSLESS));
+            CFE_SB_SetQueueEntry_Unsync(&DelivPtr->QueueEntry[n], DelivPtr->BufDscPtr, DestPtr);
+            DelivPtr->NumReserved++;
+            break;
+
+        case CFE_SB_DEST_REPLACED:
+            /*
+            ** Latest value pipe or coalescing subscription with a message
+            ** already pending: the new one takes its place without a queue
+            ** write.  The reader can take it as soon as the lock is
+            ** released, so it is copied now.
+            */
+            CFE_SB_CopyDelivery(DelivPtr);
+            CFE_SB_ReplaceLatest_Unsync(DestPtr, DelivPtr->BufDscPtr);
+            DelivPtr->NumReplaced++;
+            break;
+
+        case CFE_SB_DEST_AT_LIMIT:
+            CFE_SB_RecordSendErr_Unsync(DelivPtr->MsgId, DestPtr->PipeId, CFE_SB_MSGID_LIM_ERR_EID, 0, TskId);
+            break;
+
+        default:
+            break;
+
+    }/* end switch */
+
+}/* end CFE_SB_ReserveDelivery_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_HandOffDelivery_Unsync()
+**
+**  Purpose:
+**      Gives each reserved or replaced destination a reference on the buffer
+**      of the delivery.  The buffer UseCount is initialized to 1 when the
+**      buffer is allocated; that reference goes to the first destination, or
+**      is dropped here (freeing the buffer) when there are none, e.g.
+**      because every destination has been disabled via ground command.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      DelivPtr - Pointer to the delivery
+**
+**  Return:
+**      None
+*/
+void CFE_SB_HandOffDelivery_Unsync(CFE_SB_Delivery_t *DelivPtr){
+
+    if((DelivPtr->NumReserved + DelivPtr->NumReplaced) == 0){
+        CFE_SB_DecrBufUseCnt(DelivPtr->BufDscPtr);
+        DelivPtr->BufDscPtr = NULL;
+    }else{
+        DelivPtr->BufDscPtr->UseCount += (DelivPtr->NumReserved + DelivPtr->NumReplaced - 1);
+    }/* end if */
+
+}/* end CFE_SB_HandOffDelivery_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_WriteDelivery()
+**
+**  Purpose:
+**      Copies the message, unless done already, and writes the buffer to the
+**      queue of each reserved destination.  A full lossless pipe is waited
+**      on until the deadline of the send, set when the first wait starts
+**      and shared by all the destinations.  The receiver may consume (and
+**      release) the buffer as soon as it is written, so the descriptor is
+**      not touched again after a good write.  Writes that failed are
+**      counted in NumFailed for CFE_SB_RefundDelivery_Unsync.
+**
+**      Called without the shared data lock.
+**
+**  Arguments:
+**      DelivPtr - Pointer to the delivery
+**      TimeOut  - Time the sender may wait for lossless pipes, in
+**                 milliseconds, or CFE_SB_POLL or CFE_SB_PEND_FOREVER
+**
+**  Return:
+**      true if a lossless pipe stayed full until the deadline
+*/
+bool CFE_SB_WriteDelivery(CFE_SB_Delivery_t *DelivPtr, int32 TimeOut){
+
+    CFE_SB_PipeD_t *PipeDscPtr;
+    bool    TimedOut = false;
+    bool    HaveDeadline = false;
+    uint32  Deadline = 0;
+    uint16  i;
+
+    if(DelivPtr->NumReserved == 0){
+        return false;
+    }/* end if */
+
+    CFE_SB_CopyDelivery(DelivPtr);
+
+    for(i = 0; i < DelivPtr->NumReserved; i++){
+
+        PipeDscPtr = &CFE_SB.PipeTbl[DelivPtr->PipeId[i]];
+
+        DelivPtr->PutStatus[i] = CFE_SB_WriteQueue(PipeDscPtr, &DelivPtr->QueueEntry[i]);
+
+        /* a full lossless pipe is waited on instead of dropped, the pending
+           put holds off its deletion meanwhile */
+        if((DelivPtr->PutStatus[i] == OS_QUEUE_FULL) && DelivPtr->Lossless[i] &&
+           (TimeOut != CFE_SB_POLL)){
+            if(!HaveDeadline){
+                Deadline = CFE_SB_MsecNow() + (uint32)TimeOut;
+                HaveDeadline = true;
+            }/* end if */
+            DelivPtr->PutStatus[i] = CFE_SB_WaitWriteQueue(PipeDscPtr, &DelivPtr->QueueEntry[i],
+                                                           TimeOut, Deadline);
+            if(DelivPtr->PutStatus[i] == OS_QUEUE_FULL){
+                TimedOut = true;
+            }/* end if */
+        }/* end if */
+
+        CFE_SB_PendingPutEnd(PipeDscPtr);
+
+        if(DelivPtr->PutStatus[i] != OS_SUCCESS){
+            DelivPtr->NumFailed++;
+        }/* end if */
+
+    }/* end for */
+
+    return TimedOut;
+
+}/* end CFE_SB_WriteDelivery */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_RefundDelivery_Unsync()
+**
+**  Purpose:
+**      Refunds the reservation of each queue write of the delivery that
+**      failed, records the failure for the SB task to report and drops the
+**      reference the destination held on the buffer.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      DelivPtr - Pointer to the delivery
+**      TskId    - Task Id of the sender
+**
+**  Return:
+**      None
+*/
+void CFE_SB_RefundDelivery_Unsync(CFE_SB_Delivery_t *DelivPtr, CFE_ES_ResourceID_t TskId){
+
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SB_PipeId_t PipeId;
+    uint16  i;
+
+    for(i = 0; (i < DelivPtr->NumReserved) && (DelivPtr->NumFailed > 0); i++){
+
+        if(DelivPtr->PutStatus[i] == OS_SUCCESS){
+            continue;
+        }/* end if */
+
+        PipeId = DelivPtr->PipeId[i];
+
+        /* the destination may have been unsubscribed in the meantime */
+        DestPtr = CFE_SB_GetQueuedDest_Unsync(&CFE_SB.PipeTbl[PipeId], &DelivPtr->QueueEntry[i]);
+
+        CFE_SB_RefundDest_Unsync(DestPtr, PipeId, DelivPtr->QueueEntry[i].Lane, DelivPtr->PutStatus[i]);
+
+        if(DelivPtr->PutStatus[i] == OS_QUEUE_FULL){
+            CFE_SB_RecordSendErr_Unsync(DelivPtr->MsgId, PipeId, CFE_SB_Q_FULL_ERR_EID, 0, TskId);
+        }else{ /* Unexpected error while writing to queue. */
+            CFE_SB_RecordSendErr_Unsync(DelivPtr->MsgId, PipeId, CFE_SB_Q_WR_ERR_EID,
+                                        DelivPtr->PutStatus[i], TskId);
+        }/* end if */
+
+        /* Decrement the buffer UseCount and free buffer if cnt=0 */
+        CFE_SB_DecrBufUseCnt(DelivPtr->BufDscPtr);
+
+        DelivPtr->NumFailed--;
+
+    }/* end for */
+
+}/* end CFE_SB_RefundDelivery_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_SetQueueEntry_Unsync()
+**
+**  Purpose:
+**      Fills in the pipe queue entry for a delivery through a destination,
+**      stamping it with the current destination generation of the pipe and
+**      the lane the destination delivers through.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      EntryPtr  - Pointer to the queue entry to fill in
+**      BufDscPtr - Pointer to the buffer descriptor being delivered
+**      DestPtr   - Pointer to the destination descriptor
+**
+**  Return:
+**      None
+*/
+void CFE_SB_SetQueueEntry_Unsync(CFE_SB_QueueEntry_t *EntryPtr, CFE_SB_BufferD_t *BufDscPtr,
+                                 CFE_SB_DestinationD_t *DestPtr){
+
+    EntryPtr->BufDscPtr = BufDscPtr;
+    EntryPtr->DestPtr   = DestPtr;
+    EntryPtr->DestGen   = CFE_SB.PipeTbl[DestPtr->PipeId].DestGen;
+
+    if(DestPtr->Priority != 0){
+        EntryPtr->Lane = CFE_SB_LANE_HIGH;
+    }else{
+        EntryPtr->Lane = CFE_SB_LANE_NORMAL;
+    }/* end if */
+
+}/* end CFE_SB_SetQueueEntry_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_GetQueuedDest_Unsync()
+**
+**  Purpose:
+**      Returns the destination a queue entry was delivered through.  The
+**      handle in the entry is used directly unless a destination of the pipe
+**      has been removed since the entry was queued; the route is searched
+**      only in that case.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      PipeDscPtr - Pointer to the pipe descriptor the entry was read from
+**      EntryPtr   - Pointer to the queue entry
+**
+**  Return:
+**      Pointer to the destination descriptor, or NULL if the message was
+**      unsubscribed while it was on the pipe or read from a broadcast topic
+*/
+CFE_SB_DestinationD_t *CFE_SB_GetQueuedDest_Unsync(CFE_SB_PipeD_t *PipeDscPtr,
+                                                   const CFE_SB_QueueEntry_t *EntryPtr){
+
+    /* a broadcast topic message is not delivered through a destination */
+    if(EntryPtr->Lane == CFE_SB_LANE_BCAST){
+        return NULL;
+    }/* end if */
+
+    if(EntryPtr->DestGen == PipeDscPtr->DestGen){
+        return EntryPtr->DestPtr;
+    }/* end if */
+
+    return CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(EntryPtr->BufDscPtr->MsgId),
+                             PipeDscPtr->PipeId);
+
+}/* end CFE_SB_GetQueuedDest_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_CountBatchErr()
+**
+**  Purpose:
+**      Counts one error of a batch send, keeping the details of the first
+**      occurrence for the event sent at the end of the batch.
+**
+**  Arguments:
+**      ErrPtr  - Pointer to the error accumulator
+**      MsgId   - Message Id the error occurred on
+**      PipeId  - Pipe the error occurred on, if any
+**      ErrStat - Additional status for the event, if any
+**
+**  Return:
+**      None
+*/
+void CFE_SB_CountBatchErr(CFE_SB_BatchErr_t *ErrPtr, CFE_SB_MsgId_t MsgId,
+                          CFE_SB_PipeId_t PipeId, int32 ErrStat){
+
+    if (ErrPtr->Count == 0){
+        ErrPtr->MsgId   = MsgId;
+        ErrPtr->PipeId  = PipeId;
+        ErrPtr->ErrStat = ErrStat;
+    }/* end if */
+
+    ErrPtr->Count++;
+
+}/* end CFE_SB_CountBatchErr */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_RecordSendErr_Unsync()
+**
+**  Purpose:
+**      Records a pipe error of the send path for CFE_SB_SendErrReports.  Errors
+**      with the same MsgId, pipe and event share one record, so the cost to
+**      the sender does not depend on how many errors have occurred.  If the
+**      table is full the error is only counted as lost.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      MsgId   - Message Id the error occurred on
+**      PipeId  - Pipe the error occurred on
+**      EventId - Event to report the error with
+**      ErrStat - Additional status for the event, if any
+**      TskId   - Sending task
+**
+**  Return:
+**      None
+*/
+void CFE_SB_RecordSendErr_Unsync(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint16 EventId,
+                                 int32 ErrStat, CFE_ES_ResourceID_t TskId){
+
+    CFE_SB_SendErrRec_t *RecPtr;
+    CFE_SB_SendErrRec_t *FreePtr = NULL;
+    uint32 i;
+
+    for(i = 0; i < CFE_SB_SEND_ERR_TBL_SIZE; i++){
+        RecPtr = &CFE_SB.SendErrTbl[i];
+        if(RecPtr->Count == 0){
+            if(FreePtr == NULL){
+                FreePtr = RecPtr;
+            }/* end if */
+        }else if((RecPtr->EventId == EventId) && (RecPtr->PipeId == PipeId) &&
+                 CFE_SB_MsgId_Equal(RecPtr->MsgId, MsgId)){
+            RecPtr->Count++;
+            return;
+        }/* end if */
+    }/* end for */
+
+    if(FreePtr == NULL){
+        CFE_SB.SendErrsLost++;
+        return;
+    }/* end if */
+
+    FreePtr->MsgId   = MsgId;
+    FreePtr->PipeId  = PipeId;
+    FreePtr->EventId = EventId;
+    FreePtr->ErrStat = ErrStat;
+    FreePtr->TskId   = TskId;
+    FreePtr->Count   = 1;
+
+}/* end CFE_SB_RecordSendErr_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_ReleaseBatchBuffs_Unsync()
+**
+**  Purpose:
+**      Releases the buffers handed to the application by the last
+**      CFE_SB_RcvMsgBatch call on a pipe.
+**
+**      The caller must hold the shared data lock.
+**
+**  Arguments:
+**      PipeDscPtr - Pointer to the pipe descriptor
+**
+**  Return:
+**      None
+*/
+void CFE_SB_ReleaseBatchBuffs_Unsync(CFE_SB_PipeD_t *PipeDscPtr){
+
+    uint16 i;
+
+    for(i = 0; i < PipeDscPtr->BatchCount; i++){
+        /* buffers retained by the application are no longer held here */
+        if(PipeDscPtr->BatchBuff[i] != NULL){
+            /* Decrement the Buffer Use Count and Free buffer if cnt=0) */
+            CFE_SB_DecrBufUseCnt(PipeDscPtr->BatchBuff[i]);
+            PipeDscPtr->BatchBuff[i] = NULL;
+        }/* end if */
+    }/* end for */
+
+    PipeDscPtr->BatchCount = 0;
+
+}/* end CFE_SB_ReleaseBatchBuffs_Unsync */
+
+
+/******************************************************************************
+** Name:    CFE_SB_ZeroCopyReleaseAppId
+**
+** Purpose: API used for releasing all pointers to a buffers (for zero copy mode
+**          only) for a specific Application. This function is used for cleaning
+**          up when an application crashes.
+**
+** Assumptions, External Events, and Notes:
+**          None
+**
+** Date Written:
+**          07/23/2009
+**
+** Input Arguments:
+**          AppId
+**
+** Output Arguments:
+**          None
+**
+** Return Values:
+**          Status
+**
+******************************************************************************/
+int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_ResourceID_t         AppId)
+{
+    uint32            AppIdx;
+    uint16            Owned;
+    CFE_SB_BufferD_t *bd;
+
+    if((CFE_ES_AppID_ToIndex(AppId, &AppIdx) != CFE_SUCCESS)||
+       (AppIdx >= CFE_PLATFORM_ES_MAX_APPLICATIONS)){
+        return CFE_SUCCESS;
+    }
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    /*
+    ** Only the chain of this application needs to be walked.  Each of the
+    ** application's handles on a buffer holds a reference; handles other
+    ** applications hold through retains stay valid.
+    */
+    while(CFE_SB.ZeroCopyHead[AppIdx] != NULL){
+        bd = CFE_SB.ZeroCopyHead[AppIdx];
+        Owned = bd->OwnerHandles;
+        if(Owned == 0){
+            Owned = 1;
+        }
+        bd->HandleCount -= Owned;
+        CFE_SB_ZeroCopyUnlink_Unsync(bd);
+        while(Owned > 0){
+            CFE_SB_DecrBufUseCnt(bd);
+            Owned--;
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
 
     return CFE_SUCCESS;
 
@@ -68,6 +68,8 @@
 
 #define CFE_SB_NOT_IN_USE               0
 #define CFE_SB_IN_USE                   1
+#define CFE_SB_PIPE_DELETING            2   /* deleted, waiting on pending puts */
+#define CFE_SB_PIPE_CLOSING             3   /* pipe resources being released */
 
 #define CFE_SB_DISABLE                  0
 #define CFE_SB_ENABLE                   1
@@ -78,6 +80,101 @@
 #define CFE_SB_DO_NOT_INCREMENT         0
 #define CFE_SB_INCREMENT_TLM            1
 
+/*
+ * The pipe rings, broadcast topics and pending queue write counts are read
+ * and updated without the shared data lock when the toolchain provides a
+ * full memory barrier and atomic add/subtract.  On other toolchains they are
+ * accessed under the lock.
+ */
+#if defined(__GNUC__)
+#define CFE_SB_LOCKFREE_ROUTING
+#define CFE_SB_MEMORY_BARRIER()         __sync_synchronize()
+#else
+#define CFE_SB_MEMORY_BARRIER()
+#endif
+
+/*
+ * Results of reserving a destination for a send (see CFE_SB_ReserveDest_Unsync)
+ */
+#define CFE_SB_DEST_RESERVED            0
+#define CFE_SB_DEST_SKIPPED             1
+#define CFE_SB_DEST_AT_LIMIT            2
+#define CFE_SB_DEST_REPLACED            3
+
+/*
+ * Lanes of a pipe queue (see CFE_SB_QueueEntry_t)
+ */
+#define CFE_SB_LANE_NORMAL              0
+#define CFE_SB_LANE_HIGH                1
+#define CFE_SB_LANE_BCAST               2   /* read from a broadcast topic ring */
+
+/*
+ * Number of messages of a batch send that are routed per acquisition of
+ * the shared data lock.  Bounds the per-message state, which includes the
+ * delivery of the message, kept on the stack.
+ */
+#define CFE_SB_SEND_BATCH_CHUNK         8
+
+/*
+ * Ring pipes (CFE_SB_PIPEOPTS_RING) keep their OSAL queue only for the pipe
+ * name and as a doorbell for a blocked reader, so it holds a single token
+ */
+#define CFE_SB_RING_DOORBELL_DEPTH      1
+
+/*
+ * Ring of an elastic pipe used by a generation (see CFE_SB_PipeD_t)
+ */
+#define CFE_SB_ELASTIC_RING(PipeDscPtr, Gen) \
+    (((Gen) & 1) ? &(PipeDscPtr)->AltRing : &(PipeDscPtr)->Ring)
+
+/*
+ * While an elastic pipe waits for its reader to leave a ring, or a removed
+ * broadcast topic for its readers to leave, the SB task waits at most this
+ * period for a command before it looks again
+ */
+#define CFE_SB_ELASTIC_STEP_MSEC        10
+
+/*
+ * Initial number of descriptors in a route destination array.  The array
+ * doubles on subscribe when full, up to CFE_PLATFORM_SB_MAX_DEST_PER_PKT.
+ */
+#define CFE_SB_MIN_DEST_ARRAY_SIZE      4
+
+/*
+ * Number of words in the route map of a pipe, one bit per routing table entry
+ */
+#define CFE_SB_ROUTE_MAP_WORDS          ((CFE_PLATFORM_SB_MAX_MSG_IDS + 31) / 32)
+
+/*
+ * Number of words in the wait map of a broadcast topic, one bit per pipe
+ */
+#define CFE_SB_BCAST_WAIT_WORDS         ((CFE_PLATFORM_SB_MAX_PIPES + 31) / 32)
+
+/*
+ * Routing, pipe and map info files are written by the SB task in steps
+ * between commands (see CFE_SB_DumpFileStep).  Each step copies a bounded
+ * part of the tables under the shared data lock and writes it with a single
+ * file write after releasing the lock.  A route is never split across two
+ * steps, so a step holds at least the destinations of one route.  While a
+ * file is being written the SB task waits at most the step period for a
+ * command before it takes the next step.
+ */
+#define CFE_SB_DUMP_IDLE                0
+#define CFE_SB_DUMP_ROUTING             1
+#define CFE_SB_DUMP_PIPES               2
+#define CFE_SB_DUMP_MAP                 3
+
+#define CFE_SB_DUMP_ENTRIES_PER_STEP    (CFE_PLATFORM_SB_MAX_DEST_PER_PKT * 2)
+#define CFE_SB_DUMP_PIPES_PER_STEP      4
+#define CFE_SB_DUMP_SLOTS_PER_STEP      512
+#define CFE_SB_DUMP_STEP_MSEC           10
+
+/* 
+ * Macro to reflect size of PipeDepthStats Telemetry array - 
+ * this may or may not be the same as CFE_SB_MSG_MAX_PIPES
+ */
+#define CFE_SB_TLM_PIPEDEPTHSTATS_SIZE     (sizeof(CFE_SB.StatTlmMsg.Payload.PipeDepthStats) / sizeof(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[0]))
+
 #define CFE_SB_MAIN_LOOP_ERR_DLY        1000
 #define CFE_SB_CMD_PIPE_DEPTH           32
 #define CFE_SB_CMD_PIPE_NAME            "SB_CMD_PIPE"
@@ -91,12 +188,15 @@
 #define CFE_SB_USECNT_ERR               (-3)
 #define CFE_SB_FILE_IO_ERR              (-5)
 
+/*
+ * Number of distinct MsgId/pipe/error combinations that can be held between
+ * two send error reports, see CFE_SB_SendErrReports()
+ */
+#define CFE_SB_SEND_ERR_TBL_SIZE        16
+
 /* bit map for stopping recursive event problem */
 #define CFE_SB_SEND_NO_SUBS_EID_BIT     0
 #define CFE_SB_GET_BUF_ERR_EID_BIT      1
-#define CFE_SB_MSGID_LIM_ERR_EID_BIT    2
-#define CFE_SB_Q_FULL_ERR_EID_BIT       3
-#define CFE_SB_Q_WR_ERR_EID_BIT         4
 
 /*
  * Using the default configuration where there is a 1:1 mapping between MsgID
@@ -105,6 +205,31 @@
  * If using an alternative key function / hash, this may change.
  */
 #define CFE_SB_MAX_NUMBER_OF_MSG_KEYS   (1+CFE_PLATFORM_SB_HIGHEST_VALID_MSGID)
+
+#ifdef CFE_PLATFORM_SB_MSGMAP_HASH
+/*
+ * The hashed message map keeps at least twice as many slots as there can be
+ * routes, so linear probe sequences stay short.  The slot count is a power of
+ * two so the hash can be reduced with a shift.
+ */
+#if CFE_PLATFORM_SB_MAX_MSG_IDS <= 32
+#define CFE_SB_MSGMAP_HASH_BITS         6
+#elif CFE_PLATFORM_SB_MAX_MSG_IDS <= 64
+#define CFE_SB_MSGMAP_HASH_BITS         7
+#elif CFE_PLATFORM_SB_MAX_MSG_IDS <= 128
+#define CFE_SB_MSGMAP_HASH_BITS         8
+#elif CFE_PLATFORM_SB_MAX_MSG_IDS <= 256
+#define CFE_SB_MSGMAP_HASH_BITS         9
+#elif CFE_PLATFORM_SB_MAX_MSG_IDS <= 512
+#define CFE_SB_MSGMAP_HASH_BITS         10
+#else
+#define CFE_SB_MSGMAP_HASH_BITS         11
+#endif
+
+#define CFE_SB_MSGMAP_SIZE              (1 << CFE_SB_MSGMAP_HASH_BITS)
+#else
+#define CFE_SB_MSGMAP_SIZE              CFE_SB_MAX_NUMBER_OF_MSG_KEYS
+#endif
 /*
 ** Type Definitions
 */
@@ -156,12 +281,40 @@ typedef struct
 } CFE_SB_MsgRouteIdx_t;
 
 
+/******************************************************************************
+**  Typedef:  CFE_SB_MsgMapSlot_t
+**
+**  Purpose:
+**     This structure defines one slot of the hashed message map.  A slot with
+**     an invalid MsgKey is unused and ends a probe sequence.  The routing
+**     table index of a slot is invalid only while its key is being added.
+*/
+
+typedef struct {
+     volatile CFE_SB_MsgKey_Atom_t      KeyIdx;
+     volatile CFE_SB_MsgRouteIdx_Atom_t RouteIdx;
+} CFE_SB_MsgMapSlot_t;
+
+
 /******************************************************************************
 **  Typedef:  CFE_SB_BufferD_t
 **
 **  Purpose:
 **     This structure defines a BUFFER DESCRIPTOR used to specify the MsgId
-**     and address of each packet buffer.
+**     and address of each packet buffer.  SendTime is the time of the send,
+**     from CFE_SB_LatencyNow, for the latency histograms, and SenderId the
+**     application that sent it, see CFE_SB_GetMsgSender.
+**
+**     The descriptor also serves as the zero copy descriptor: while an
+**     application holds the buffer through a zero copy handle (the handle
+**     is the address of the descriptor), AppId is the owner and Next/Prev
+**     link the buffer into that application's zero copy chain.  AppId is
+**     undefined otherwise.  A received message may be retained through
+**     several handles, each holding one UseCount reference: HandleCount
+**     counts them all and OwnerHandles those of the owner, which are the
+**     ones released when the owner is cleaned up.  RetiredNext links a
+**     message overwritten in a broadcast topic while readers may still be
+**     taking it, see CFE_SB_BcastPut_Unsync.
 **
 **     Note: Changing the size of this structure may require the memory pool
 **     block sizes to change.
@@ -170,8 +323,16 @@ typedef struct
 typedef struct {
      CFE_SB_MsgId_t    MsgId;
      uint16            UseCount;
+     uint16            HandleCount;
+     uint16            OwnerHandles;
      uint32            Size;
+     uint32            SendTime;
      void              *Buffer;
+     CFE_ES_ResourceID_t SenderId;
+     CFE_ES_ResourceID_t AppId;
+     void              *Next;
+     void              *Prev;
+     void              *RetiredNext;
 } CFE_SB_BufferD_t;
 
 
@@ -182,6 +343,16 @@ typedef struct {
 **     This structure defines a DESTINATION DESCRIPTOR used to specify
 **     each destination pipe for a message.
 **
+**     Descriptors are stored by value in the destination array of a route,
+**     so the fields read on every send are kept together at the front.
+**     LatestBuff holds the newest message for a CFE_SB_PIPEOPTS_LATEST pipe,
+**     or for a subscription with Coalesce set, when it has replaced the one
+**     still on the pipe.
+**     PolicyCount and PolicyLast hold the state of the delivery policy, see
+**     CFE_SB_PolicyAccepts_Unsync.
+**     Priority is the CFE_SB_Qos_t priority of the subscription; a non zero
+**     priority delivers through the high priority lane of the pipe.
+**
 **     Note: Changing the size of this structure may require the memory pool
 **     block sizes to change.
 */
@@ -193,30 +364,65 @@ typedef struct {
      uint16          BuffCount;
      uint16          DestCnt;
      uint8           Scope;
-     uint8           Spare[3];
-     void            *Prev;
-     void            *Next;
+     uint8           Priority;
+     uint8           Coalesce;
+     uint8           Spare;
+     CFE_SB_DeliveryPolicy_t Policy;
+     uint32          PolicyCount;
+     uint32          PolicyLast;
+     uint16          SkipCnt;
+     CFE_SB_BufferD_t *LatestBuff;
 } CFE_SB_DestinationD_t;
 
 
 /******************************************************************************
-**  Typedef:  CFE_SB_ZeroCopyD_t
+**  Typedef:  CFE_SB_BcastSlot_t
 **
 **  Purpose:
-**     This structure defines a ZERO COPY BUFFER DESCRIPTOR used to specify
-**     the buffer provided to a requestor.
+**     This structure defines one slot of a broadcast topic.  Seq is odd while
+**     the slot is being written and (2 * n + 2) once it holds the n'th
+**     message of the topic, so a reader can tell whether the message it took
+**     is the one it was after.
+*/
+
+typedef struct {
+     volatile uint32        Seq;
+     CFE_SB_BufferD_t      *BufDscPtr;
+} CFE_SB_BcastSlot_t;
+
+
+/******************************************************************************
+**  Typedef:  CFE_SB_BcastTopic_t
 **
-**     Note: Changing the size of this structure may require the memory pool
-**     block sizes to change.
+**  Purpose:
+**     This structure defines a broadcast topic.  Every message sent with the
+**     MsgId is stored once in Slots, which is allocated from the SB pool with
+**     a power of two number of entries; the ring holds the only reference to
+**     the buffer.  Head is the number of messages stored so far.  Each
+**     subscribing pipe reads the ring from its own cursor (see BcastNext in
+**     CFE_SB_PipeD_t) without the shared data lock.  MsgId is
+**     CFE_SB_INVALID_MSG_ID while the entry is free.
+**
+**     Readers is the number of pipes reading the topic at the moment.  A
+**     message overwritten while it is not zero goes to the Retired list, as
+**     a reader may still be taking it, and is released once no reader is
+**     left.  In the same way the slots of a topic removed while it is not
+**     zero are kept in RetiredSlots until the SB task sees no reader; the
+**     entry is not reused until then.  Bit n of WaitMask is set while pipe n is blocked waiting for a
+**     message, so a send wakes the blocked subscribers without looking at
+**     the others.
 */
 
 typedef struct {
-     CFE_ES_ResourceID_t AppID;
-     uint32            Size;
-     void              *Buffer;
-     void              *Next;
-     void              *Prev;
-} CFE_SB_ZeroCopyD_t;
+     CFE_SB_MsgId_t        MsgId;
+     CFE_SB_BcastSlot_t    *Slots;
+     uint32                Mask;
+     volatile uint32       Head;
+     volatile uint32       Readers;
+     CFE_SB_BufferD_t      *Retired;
+     CFE_SB_BcastSlot_t    *RetiredSlots;
+     volatile uint32       WaitMask[CFE_SB_BCAST_WAIT_WORDS];
+} CFE_SB_BcastTopic_t;
 
 
 /******************************************************************************
@@ -224,22 +430,124 @@ typedef struct {
 **
 **  Purpose:
 **     This structure defines an entry in the routing table
+**
+**     DestArray holds the Destinations of the route contiguously, newest
+**     subscription first.  It is allocated from the SB memory pool and grown
+**     on subscribe; DestArraySize is the number of descriptors it can hold.
+**
+**     Topic is the broadcast topic of the MsgId, NULL if it has none.
+**
+**     Latency is only kept when CFE_PLATFORM_SB_MSGID_LATENCY_HIST is defined.
 */
 
 typedef struct {
      CFE_SB_MsgId_t        MsgId;    /**< Original Message Id when the subscription was created */
      uint16                Destinations;
+     uint16                DestArraySize;
      uint32                SeqCnt;
-     CFE_SB_DestinationD_t *ListHeadPtr;
+     CFE_SB_DestinationD_t *DestArray;
+     CFE_SB_BcastTopic_t   *Topic;
+#ifdef CFE_PLATFORM_SB_MSGID_LATENCY_HIST
+     CFE_SB_LatencyHist_t  Latency;
+#endif
 } CFE_SB_RouteEntry_t;
 
 
+/******************************************************************************
+**  Typedef:  CFE_SB_QueueEntry_t
+**
+**  Purpose:
+**     This structure defines an entry of a pipe queue.  DestPtr is the
+**     destination the buffer was delivered through; it may only be used while
+**     DestGen still matches the DestGen of the pipe, which changes whenever a
+**     destination of the pipe is removed.  Lane is the lane of the pipe the
+**     entry is written to; entries read from a broadcast topic have the lane
+**     CFE_SB_LANE_BCAST and no destination.
+*/
+
+typedef struct {
+     CFE_SB_BufferD_t      *BufDscPtr;
+     CFE_SB_DestinationD_t *DestPtr;
+     uint32                 DestGen;
+     uint32                 Lane;
+} CFE_SB_QueueEntry_t;
+
+
+/******************************************************************************
+**  Typedef:  CFE_SB_RingSlot_t
+**
+**  Purpose:
+**     This structure defines one slot of a ring pipe.  Seq tells writers and
+**     readers whose turn it is to use the slot (bounded MPMC ring).
+*/
+
+typedef struct {
+     volatile uint32        Seq;
+     CFE_SB_QueueEntry_t    Entry;
+} CFE_SB_RingSlot_t;
+
+
+/******************************************************************************
+**  Typedef:  CFE_SB_PipeRing_t
+**
+**  Purpose:
+**     This structure defines the in-process queue of a ring pipe.  Slots is
+**     allocated from the SB pool with a power of two number of entries, at
+**     least the pipe depth; Count holds the pipe to its depth.  The reader sets
+**     ReaderWaiting before it blocks on the doorbell queue so writers know
+**     when a wakeup is needed.
+**
+**     Depth, Writers and Readers are only used by the two rings of an
+**     elastic pipe: Depth is the depth of the ring, Writers and Readers count
+**     the puts and gets in progress on it, see CFE_SB_ElasticPut.
+*/
+
+typedef struct {
+     CFE_SB_RingSlot_t     *Slots;
+     uint32                 Mask;
+     volatile uint32        Head;
+     volatile uint32        Tail;
+     volatile uint32        Count;
+     volatile uint32        ReaderWaiting;
+     uint16                 Depth;
+     volatile uint32        Writers;
+     volatile uint32        Readers;
+} CFE_SB_PipeRing_t;
+
+
 /******************************************************************************
 **  Typedef:  CFE_SB_PipeD_t
 **
 **  Purpose:
 **     This structure defines a pipe descriptor used to specify the
-**     characteristics and status of a pipe.
+**     characteristics and status of a pipe.  HighLane is the high priority
+**     lane of the pipe; its Slots are NULL until a subscription with a non
+**     zero priority is made on the pipe.  Latency is the histogram of the
+**     time messages waited on the pipe, see CFE_SB_RecordLatency_Unsync.
+**     Bit n of BcastMask is set while the pipe is subscribed to broadcast
+**     topic n, and BcastNext[n] is the count of the next message of that
+**     topic the pipe reads.
+**
+**     QueueDepth is the current depth of the pipe.  It is BaseDepth, the
+**     depth given at creation, except for an elastic pipe which may grow up
+**     to MaxDepth; ElasticPeak and QuietCycles decide when it shrinks back,
+**     see CFE_SB_ShrinkElasticPipes.  The high priority lane always has the
+**     base depth.
+**
+**     An elastic pipe changes depth by moving to its other ring, Ring for an
+**     even generation and AltRing for an odd one.  Writers put to the ring of
+**     WriteGen and the reader gets from the ring of ReadGen, which follows
+**     WriteGen once the older ring is empty.  StandbyReady is set while the
+**     SB task has the next, larger, ring ready for a writer that finds the
+**     pipe full; see CFE_SB_ElasticPut and CFE_SB_ElasticStep_Unsync.
+**
+**     Bit n of RouteMap is set while the pipe is a destination of routing
+**     table entry n, so deleting a pipe only visits the routes of that pipe.
+**     Routing table entries are only freed while they have no destination,
+**     so the bits stay valid.
+**
+**     SpaceSemId is the semaphore senders wait on for room on a lossless
+**     pipe, WritersWaiting the number of them; see CFE_SB_WaitWriteQueue.
 */
 
 typedef struct {
@@ -252,9 +560,29 @@ typedef struct {
      osal_id_t          SysQueueId;
      uint32             LastSender;
      uint16             QueueDepth;
+     uint16             BaseDepth;
+     uint16             MaxDepth;
+     uint16             ElasticPeak;
+     uint16             QuietCycles;
      uint16             SendErrors;
      CFE_SB_BufferD_t  *CurrentBuff;
      CFE_SB_BufferD_t  *ToTrashBuff;
+     volatile uint32    PendingPuts;
+     uint16             BatchCount;
+     CFE_SB_BufferD_t  *BatchBuff[CFE_PLATFORM_SB_MAX_RCV_BATCH];
+     CFE_SB_PipeRing_t  Ring;
+     CFE_SB_PipeRing_t  AltRing;
+     volatile uint32    WriteGen;
+     volatile uint32    ReadGen;
+     volatile uint32    StandbyReady;
+     CFE_SB_PipeRing_t  HighLane;
+     osal_id_t          SpaceSemId;
+     volatile uint32    WritersWaiting;
+     uint32             DestGen;
+     uint32             BcastMask;
+     uint32             BcastNext[CFE_PLATFORM_SB_MAX_BCAST_TOPICS];
+     uint32             RouteMap[CFE_SB_ROUTE_MAP_WORDS];
+     CFE_SB_LatencyHist_t Latency;
 } CFE_SB_PipeD_t;
 
 
@@ -273,6 +601,66 @@ typedef struct {
 } CFE_SB_MemParams_t;
 
 
+/******************************************************************************
+**  Typedef:  CFE_SB_MsgIdSet_t
+**
+**  Purpose:
+**     This structure describes the MsgIds of a range or mask subscription.
+**     A MsgId value is in the set if it is within First to Last and its
+**     bits selected by Mask are equal to those of Value.
+*/
+typedef struct{
+  CFE_SB_MsgId_Atom_t   First;
+  CFE_SB_MsgId_Atom_t   Last;
+  CFE_SB_MsgId_Atom_t   Mask;
+  CFE_SB_MsgId_Atom_t   Value;
+}CFE_SB_MsgIdSet_t;
+
+
+/******************************************************************************
+**  Typedef:  CFE_SB_SendErrRec_t
+**
+**  Purpose:
+**     This structure counts the pipe errors of one MsgId, pipe and event
+**     between two reports by the SB task.  A record is free when Count is 0.
+*/
+typedef struct{
+  CFE_SB_MsgId_t        MsgId;
+  CFE_SB_PipeId_t       PipeId;
+  uint16                EventId;
+  int32                 ErrStat;    /* status of the first error, write errors only */
+  uint32                Count;
+  CFE_ES_ResourceID_t   TskId;      /* first sender since the last report */
+}CFE_SB_SendErrRec_t;
+
+
+/******************************************************************************
+**  Typedef:  CFE_SB_DumpState_t
+**
+**  Purpose:
+**     This structure holds the state of the info file being written by the
+**     SB task.  Cursor is the next MsgMap slot or pipe table index to be
+**     copied.  Snapshot holds the entries of one step between copying them
+**     under the shared data lock and writing them to the file.
+*/
+typedef struct {
+    uint8               Kind;
+    osal_id_t           FileDesc;
+    uint32              Cursor;
+    uint32              FileSize;
+    uint32              EntryCount;
+    char                Filename[OS_MAX_PATH_LEN];
+    union {
+        struct {
+            CFE_SB_RoutingFileEntry_t Entry[CFE_SB_DUMP_ENTRIES_PER_STEP];
+            CFE_ES_ResourceID_t       AppId[CFE_SB_DUMP_ENTRIES_PER_STEP];
+        } Rtg;
+        CFE_SB_PipeD_t            Pipe[CFE_SB_DUMP_PIPES_PER_STEP];
+        CFE_SB_MsgMapFileEntry_t  Map[CFE_SB_DUMP_ENTRIES_PER_STEP];
+    } Snapshot;
+} CFE_SB_DumpState_t;
+
+
 /******************************************************************************
 **  Typedef:  cfe_sb_t
 **
@@ -285,15 +673,21 @@ typedef struct {
     uint32              SenderReporting;
     CFE_ES_ResourceID_t AppId;
     uint32              StopRecurseFlags[OS_MAX_TASKS];
-    void               *ZeroCopyTail;
+    CFE_SB_BufferD_t   *ZeroCopyHead[CFE_PLATFORM_ES_MAX_APPLICATIONS];
     CFE_SB_PipeD_t      PipeTbl[CFE_PLATFORM_SB_MAX_PIPES];
     CFE_SB_HousekeepingTlm_t        HKTlmMsg;
     CFE_SB_StatsTlm_t               StatTlmMsg;
+    CFE_SB_LatencyTlm_t             LatencyTlmMsg;
     CFE_SB_PipeId_t     CmdPipe;
     CFE_SB_Msg_t        *CmdPipePktPtr;
     CFE_SB_MemParams_t  Mem;
-    CFE_SB_MsgRouteIdx_t      MsgMap[CFE_SB_MAX_NUMBER_OF_MSG_KEYS];
+#ifdef CFE_PLATFORM_SB_MSGMAP_HASH
+    CFE_SB_MsgMapSlot_t       MsgMap[CFE_SB_MSGMAP_SIZE];
+#else
+    CFE_SB_MsgRouteIdx_t      MsgMap[CFE_SB_MSGMAP_SIZE];
+#endif
     CFE_SB_RouteEntry_t RoutingTbl[CFE_PLATFORM_SB_MAX_MSG_IDS];
+    CFE_SB_BcastTopic_t BcastTbl[CFE_PLATFORM_SB_MAX_BCAST_TOPICS];
     CFE_SB_AllSubscriptionsTlm_t    PrevSubMsg;
     CFE_SB_SingleSubscriptionTlm_t  SubRprtMsg;
     CFE_EVS_BinFilter_t EventFilters[CFE_SB_MAX_CFG_FILE_EVENTS_TO_FILTER];
@@ -301,32 +695,77 @@ typedef struct {
     uint16 RouteIdxTop;
     CFE_SB_MsgRouteIdx_t RouteIdxStack[CFE_PLATFORM_SB_MAX_MSG_IDS];
 
+    CFE_SB_SendErrRec_t SendErrTbl[CFE_SB_SEND_ERR_TBL_SIZE];
+    uint32              SendErrsLost;
+
+    CFE_SB_DumpState_t  Dump;
+
+    volatile uint32     ElasticPending;
+    volatile uint32     BcastPending;
+
 }cfe_sb_t;
 
 
 /******************************************************************************
-**  Typedef:  CFE_SB_SendErrEventBuf_t
+**  Typedef:  CFE_SB_Delivery_t
 **
 **  Purpose:
-**     This structure is used to store event information during a send.
+**     This structure holds the delivery of one message to the destinations of
+**     its route, from reserving them under the shared data lock through
+**     writing their pipe queues to refunding the writes that failed.  The
+**     per-destination arrays hold the NumReserved reserved destinations.
+**     The send paths keep one on the stack and reuse it for each message.
 */
 typedef struct{
-  uint32            EventId;
-  int32             ErrStat;
-  CFE_SB_PipeId_t   PipeId;
-}CFE_SB_SendErrEventBuf_t;
+  CFE_SB_Msg_t      *MsgPtr;
+  CFE_SB_MsgId_t    MsgId;
+  CFE_SB_BufferD_t  *BufDscPtr;
+  uint16            TotalMsgSize;
+  uint32            CopyMode;
+  bool              SetSeqCnt;
+  uint32            SeqCnt;
+  bool              Copied;
+  uint16            NumReserved;
+  uint16            NumReplaced;
+  uint16            NumFailed;
+  CFE_SB_PipeId_t   PipeId[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
+  bool              Lossless[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
+  CFE_SB_QueueEntry_t QueueEntry[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
+  int32             PutStatus[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
+}CFE_SB_Delivery_t;
 
 
 /******************************************************************************
-**  Typedef:  CFE_SB_EventBuf_t
+**  Typedef:  CFE_SB_BatchEntry_t
 **
 **  Purpose:
-**     This structure is used to store event information during a send.
+**     This structure holds the state of one message of a batch send from
+**     allocating its buffer until its pipe queues are written.  The MsgId
+**     and size of the message are kept in the buffer descriptor.  NumWake
+**     is the number of pipes of a broadcast topic to wake, their Ids are
+**     kept in the PipeId array of the delivery.
 */
 typedef struct{
-  uint32    EvtsToSnd;
-  CFE_SB_SendErrEventBuf_t  EvtBuf[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
-}CFE_SB_EventBuf_t;
+  CFE_SB_BufferD_t  *BufDscPtr;
+  int32             Status;
+  uint16            NumWake;
+  CFE_SB_Delivery_t Delivery;
+}CFE_SB_BatchEntry_t;
+
+
+/******************************************************************************
+**  Typedef:  CFE_SB_BatchErr_t
+**
+**  Purpose:
+**     This structure counts one kind of error during a batch send so that a
+**     single event can be sent for the whole batch.
+*/
+typedef struct{
+  uint32            Count;
+  CFE_SB_MsgId_t    MsgId;
+  CFE_SB_PipeId_t   PipeId;
+  int32             ErrStat;
+}CFE_SB_BatchErr_t;
 
 
 /*
@@ -347,15 +786,57 @@ void   CFE_SB_LockSharedData(const char *FuncName, int32 LineNumber);
 void   CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber);
 void   CFE_SB_ReleaseBuffer (CFE_SB_BufferD_t *bd, CFE_SB_DestinationD_t *dest);
 int32  CFE_SB_ReadQueue(CFE_SB_PipeD_t *PipeDscPtr,CFE_ES_ResourceID_t TskId,
-                        CFE_SB_TimeOut_t Time_Out,CFE_SB_BufferD_t **Message );
-int32  CFE_SB_WriteQueue(CFE_SB_PipeD_t *pd,uint32 TskId,
-                         const CFE_SB_BufferD_t *bd,CFE_SB_MsgId_t MsgId );
+                        CFE_SB_TimeOut_t Time_Out,CFE_SB_QueueEntry_t *EntryPtr );
+int32  CFE_SB_WriteQueue(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_QueueEntry_t *EntryPtr);
+int32  CFE_SB_WaitWriteQueue(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_QueueEntry_t *EntryPtr,
+                             int32 TimeOut, uint32 Deadline);
+void   CFE_SB_AddWritersWaiting(CFE_SB_PipeD_t *PipeDscPtr, int32 Delta);
+void   CFE_SB_QueueSignalSpace(CFE_SB_PipeD_t *PipeDscPtr);
+void   CFE_SB_QueueWakeWriters(CFE_SB_PipeD_t *PipeDscPtr);
+int32  CFE_SB_QueueAddSpaceSignal_Unsync(CFE_SB_PipeD_t *PipeDscPtr);
+int32  CFE_SB_QueueCreate_Unsync(CFE_SB_PipeD_t *PipeDscPtr, const char *PipeName, uint16 Depth, uint8 Opts);
+void   CFE_SB_QueueDelete_Unsync(CFE_SB_PipeD_t *PipeDscPtr);
+int32  CFE_SB_QueueAddLane_Unsync(CFE_SB_PipeD_t *PipeDscPtr);
+int32  CFE_SB_RingCreate_Unsync(CFE_SB_PipeRing_t *RingPtr, uint16 Depth);
+void   CFE_SB_RingDelete_Unsync(CFE_SB_PipeRing_t *RingPtr);
+int32  CFE_SB_QueueGet(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_QueueEntry_t *EntryPtr, int32 TimeOut);
+int32  CFE_SB_QueueTryGet(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_QueueEntry_t *EntryPtr);
+int32  CFE_SB_RingPut(CFE_SB_PipeRing_t *RingPtr, const CFE_SB_QueueEntry_t *EntryPtr, uint16 Depth);
+int32  CFE_SB_RingGet(CFE_SB_PipeRing_t *RingPtr, CFE_SB_QueueEntry_t *EntryPtr);
+int32  CFE_SB_RingPut_Unsync(CFE_SB_PipeRing_t *RingPtr, const CFE_SB_QueueEntry_t *EntryPtr, uint16 Depth);
+int32  CFE_SB_RingGet_Unsync(CFE_SB_PipeRing_t *RingPtr, CFE_SB_QueueEntry_t *EntryPtr);
+int32  CFE_SB_ElasticPut(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_QueueEntry_t *EntryPtr);
+int32  CFE_SB_ElasticGet(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_QueueEntry_t *EntryPtr);
+bool   CFE_SB_ElasticLeave(CFE_SB_PipeD_t *PipeDscPtr, uint32 Gen);
+void   CFE_SB_ElasticHandover(CFE_SB_PipeD_t *PipeDscPtr);
+int32  CFE_SB_ElasticPrepare_Unsync(CFE_SB_PipeD_t *PipeDscPtr);
+bool   CFE_SB_ElasticStep_Unsync(CFE_SB_PipeD_t *PipeDscPtr);
+bool   CFE_SB_ElasticShrink_Unsync(CFE_SB_PipeD_t *PipeDscPtr);
+void   CFE_SB_UpdateElasticPipes(void);
+void   CFE_SB_ShrinkElasticPipes(void);
+void   CFE_SB_QueueWake(CFE_SB_PipeD_t *PipeDscPtr);
+int32  CFE_SB_BcastCreate_Unsync(CFE_SB_BcastTopic_t *TopicPtr, uint16 Depth);
+void   CFE_SB_BcastDelete_Unsync(CFE_SB_BcastTopic_t *TopicPtr);
+uint16 CFE_SB_BcastPut_Unsync(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_BufferD_t *BufDscPtr,
+                              CFE_SB_PipeId_t *WakeList);
+void   CFE_SB_BcastReclaim_Unsync(CFE_SB_BcastTopic_t *TopicPtr);
+void   CFE_SB_BcastRelease_Unsync(CFE_SB_BcastTopic_t *TopicPtr);
+void   CFE_SB_UpdateBcastTopics(void);
+void   CFE_SB_BcastWake(const CFE_SB_PipeId_t *WakeList, uint16 Count);
+int32  CFE_SB_BcastGet(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_QueueEntry_t *EntryPtr);
+void   CFE_SB_BcastSetWaiting(CFE_SB_PipeD_t *PipeDscPtr, bool Waiting);
+CFE_SB_BcastTopic_t *CFE_SB_FindBcastTopic(CFE_SB_MsgId_t MsgId);
+void   CFE_SB_SetQueueEntry_Unsync(CFE_SB_QueueEntry_t *EntryPtr, CFE_SB_BufferD_t *BufDscPtr,
+                                   CFE_SB_DestinationD_t *DestPtr);
+CFE_SB_DestinationD_t *CFE_SB_GetQueuedDest_Unsync(CFE_SB_PipeD_t *PipeDscPtr,
+                                                   const CFE_SB_QueueEntry_t *EntryPtr);
 CFE_SB_MsgRouteIdx_t CFE_SB_GetRoutingTblIdx(CFE_SB_MsgKey_t MsgKey);
 uint8  CFE_SB_GetPipeIdx(CFE_SB_PipeId_t PipeId);
 int32  CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
 void   CFE_SB_ProcessCmdPipePkt(void);
 int32  CFE_SB_DuplicateSubscribeCheck(CFE_SB_MsgKey_t MsgKey,CFE_SB_PipeId_t PipeId);
 void   CFE_SB_SetRoutingTblIdx(CFE_SB_MsgKey_t MsgKey, CFE_SB_MsgRouteIdx_t Value);
+CFE_SB_MsgRouteIdx_t CFE_SB_GetMsgMapEntry(uint32 SlotIdx);
 CFE_SB_RouteEntry_t* CFE_SB_GetRoutePtrFromIdx(CFE_SB_MsgRouteIdx_t RouteIdx);
 void   CFE_SB_ResetCounters(void);
 void   CFE_SB_SetMsgSeqCnt(CFE_SB_MsgPtr_t MsgPtr,uint32 Count);
@@ -363,27 +844,54 @@ char   *CFE_SB_GetAppTskName(CFE_ES_ResourceID_t TaskId, char* FullName);
 CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(CFE_SB_MsgId_t MsgId, uint16 Size);
 CFE_SB_BufferD_t *CFE_SB_GetBufferFromCaller(CFE_SB_MsgId_t MsgId, void *Address);
 CFE_SB_PipeD_t   *CFE_SB_GetPipePtr(CFE_SB_PipeId_t PipeId);
+CFE_SB_BufferD_t **CFE_SB_FindRcvSlot_Unsync(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_Msg_t *MsgPtr);
 CFE_SB_PipeId_t  CFE_SB_GetAvailPipeIdx(void);
 CFE_SB_DestinationD_t *CFE_SB_GetDestPtr (CFE_SB_MsgKey_t MsgKey, CFE_SB_PipeId_t PipeId);
 int32 CFE_SB_DeletePipeWithAppId(CFE_SB_PipeId_t PipeId,CFE_ES_ResourceID_t AppId);
 int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId,CFE_ES_ResourceID_t AppId);
+int32 CFE_SB_CreatePipeFull(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, uint16 MaxDepth,
+                            const char *PipeName, uint8 Opts);
 int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
                            CFE_SB_PipeId_t  PipeId,
                            CFE_SB_Qos_t     Quality,
                            uint16           MsgLim,
                            uint8            Scope);
+int32 CFE_SB_SubscribeSetFull(const CFE_SB_MsgIdSet_t *SetPtr,
+                              CFE_SB_PipeId_t  PipeId,
+                              CFE_SB_Qos_t     Quality,
+                              uint16           MsgLim,
+                              uint8            Scope);
+void  CFE_SB_SubRprtInit(CFE_SB_AllSubscriptionsTlm_t *RptPtr, uint32 NumEntries);
+void  CFE_SB_SubRprtAdd(CFE_SB_AllSubscriptionsTlm_t *RptPtr, CFE_SB_MsgId_t MsgId,
+                        CFE_SB_PipeId_t PipeId, CFE_SB_Qos_t Quality);
+void  CFE_SB_SubRprtFlush(CFE_SB_AllSubscriptionsTlm_t *RptPtr);
 
 int32 CFE_SB_UnsubscribeWithAppId(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
         CFE_ES_ResourceID_t AppId);
 
 int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
                               uint8 Scope, CFE_ES_ResourceID_t AppId);
-int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t   *MsgPtr, uint32 TlmCntIncrements, uint32 CopyMode);
+int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t   *MsgPtr, uint32 TlmCntIncrements, uint32 CopyMode,
+                          int32 TimeOut);
+int32  CFE_SB_SendMsgBatchFull(CFE_SB_Msg_t **MsgArray, CFE_SB_ZeroCopyHandle_t *HandleArray,
+                               uint32 Count, int32 *StatusArray, uint32 TlmCntIncrements, uint32 CopyMode);
 int32 CFE_SB_SendRtgInfo(const char *Filename);
 int32 CFE_SB_SendPipeInfo(const char *Filename);
 int32 CFE_SB_SendMapInfo(const char *Filename);
+int32 CFE_SB_StartDump(uint8 Kind, const char *Filename, const char *Description, uint32 SubType);
+bool  CFE_SB_DumpFileStep(void);
+int32 CFE_SB_RtgInfoStep(bool *Done);
+int32 CFE_SB_PipeInfoStep(bool *Done);
+int32 CFE_SB_MapInfoStep(bool *Done);
+int32 CFE_SB_DumpWrite(const void *Entries, uint32 EntrySize, uint32 Count);
 int32 CFE_SB_ZeroCopyReleaseDesc(CFE_SB_Msg_t *Ptr2Release, CFE_SB_ZeroCopyHandle_t BufferHandle);
+int32 CFE_SB_ZeroCopyReleaseDesc_Unsync(CFE_SB_Msg_t *Ptr2Release, CFE_SB_ZeroCopyHandle_t BufferHandle,
+                                        CFE_ES_ResourceID_t AppId);
 int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_ResourceID_t         AppId);
+int32 CFE_SB_ZeroCopyLink_Unsync(CFE_SB_BufferD_t *bd, CFE_ES_ResourceID_t AppId);
+void CFE_SB_ZeroCopyUnlink_Unsync(CFE_SB_BufferD_t *bd);
+int32 CFE_SB_ZeroCopyAddHandle_Unsync(CFE_SB_BufferD_t *bd, CFE_ES_ResourceID_t AppId);
+void CFE_SB_ZeroCopyDropHandle_Unsync(CFE_SB_BufferD_t *bd, CFE_ES_ResourceID_t AppId);
 int32 CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd);
 int32 CFE_SB_ValidateMsgId(CFE_SB_MsgId_t MsgId);
 int32 CFE_SB_ValidatePipeId(CFE_SB_PipeId_t PipeId);
@@ -393,10 +901,45 @@ void CFE_SB_SetSubscriptionReporting(uint32 state);
 uint32 CFE_SB_FindGlobalMsgIdCnt(void);
 uint32 CFE_SB_RequestToSendEvent(CFE_ES_ResourceID_t TaskId, uint32 Bit);
 void CFE_SB_FinishSendEvent(CFE_ES_ResourceID_t TaskId, uint32 Bit);
-CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void);
+CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(uint16 NumDests);
 int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest);
-int32 CFE_SB_AddDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *NewNode);
-int32 CFE_SB_RemoveDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *NodeToRemove);
+CFE_SB_DestinationD_t *CFE_SB_AddDest(CFE_SB_RouteEntry_t *RouteEntry, const CFE_SB_DestinationD_t *NewDest);
+int32 CFE_SB_RemoveDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *DestToRemove);
+void CFE_SB_PendingPutBegin_Unsync(CFE_SB_PipeD_t *PipeDscPtr);
+void CFE_SB_PendingPutEnd(CFE_SB_PipeD_t *PipeDscPtr);
+void CFE_SB_FinishPipeDelete(CFE_SB_PipeD_t *PipeDscPtr);
+int32 CFE_SB_AddSubscription_Unsync(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
+                                    CFE_SB_Qos_t Quality, uint16 MsgLim, uint8 Scope);
+void CFE_SB_UndoSubscriptions_Unsync(CFE_SB_PipeId_t PipeId, const uint32 *PrevRouteMap,
+                                     uint16 PrevRouteIdxTop);
+bool CFE_SB_MsgIdSetFirst(const CFE_SB_MsgIdSet_t *SetPtr, CFE_SB_MsgId_Atom_t *ValuePtr);
+bool CFE_SB_MsgIdSetNext(const CFE_SB_MsgIdSet_t *SetPtr, CFE_SB_MsgId_Atom_t *ValuePtr);
+uint32 CFE_SB_SortMsgIdValues(CFE_SB_MsgId_Atom_t *Values, uint32 Count);
+uint32 CFE_SB_LatencyNow(void);
+uint32 CFE_SB_MsecNow(void);
+void CFE_SB_AddLatencySample(CFE_SB_LatencyHist_t *HistPtr, uint32 Latency);
+void CFE_SB_RecordLatency_Unsync(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_BufferD_t *BufDscPtr);
+bool CFE_SB_PolicyAccepts_Unsync(CFE_SB_DestinationD_t *DestPtr, const CFE_SB_Msg_t *MsgPtr,
+                                 uint32 *ValuePtr);
+void CFE_SB_PolicyCommit_Unsync(CFE_SB_DestinationD_t *DestPtr, uint32 Value);
+uint32 CFE_SB_ReserveDest_Unsync(CFE_SB_DestinationD_t *DestPtr, CFE_ES_ResourceID_t AppId,
+                                 const CFE_SB_Msg_t *MsgPtr);
+void CFE_SB_ReplaceLatest_Unsync(CFE_SB_DestinationD_t *DestPtr, CFE_SB_BufferD_t *BufDscPtr);
+void CFE_SB_TakeLatest_Unsync(CFE_SB_DestinationD_t *DestPtr, CFE_SB_QueueEntry_t *EntryPtr);
+void CFE_SB_RefundDest_Unsync(CFE_SB_DestinationD_t *DestPtr, CFE_SB_PipeId_t PipeId, uint32 Lane, int32 PutStatus);
+void CFE_SB_InitDelivery(CFE_SB_Delivery_t *DelivPtr, CFE_SB_Msg_t *MsgPtr, CFE_SB_MsgId_t MsgId,
+                         uint16 TotalMsgSize, uint32 CopyMode);
+void CFE_SB_CopyDelivery(CFE_SB_Delivery_t *DelivPtr);
+void CFE_SB_ReserveDelivery_Unsync(CFE_SB_Delivery_t *DelivPtr, CFE_SB_DestinationD_t *DestPtr,
+                                   CFE_ES_ResourceID_t AppId, CFE_ES_ResourceID_t TskId, bool MayWait);
+void CFE_SB_HandOffDelivery_Unsync(CFE_SB_Delivery_t *DelivPtr);
+bool CFE_SB_WriteDelivery(CFE_SB_Delivery_t *DelivPtr, int32 TimeOut);
+void CFE_SB_RefundDelivery_Unsync(CFE_SB_Delivery_t *DelivPtr, CFE_ES_ResourceID_t TskId);
+void CFE_SB_CountBatchErr(CFE_SB_BatchErr_t *ErrPtr, CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, int32 ErrStat);
+void CFE_SB_RecordSendErr_Unsync(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint16 EventId,
+                                 int32 ErrStat, CFE_ES_ResourceID_t TskId);
+void CFE_SB_SendErrReports(void);
+void CFE_SB_ReleaseBatchBuffs_Unsync(CFE_SB_PipeD_t *PipeDscPtr);
 
 
 /*****************************************************************************/
@@ -440,6 +983,7 @@ int32 CFE_SB_SendHKTlmCmd(const CFE_SB_CmdHdr_t *data);
 int32 CFE_SB_EnableRouteCmd(const CFE_SB_EnableRoute_t *data);
 int32 CFE_SB_DisableRouteCmd(const CFE_SB_DisableRoute_t *data);
 int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStats_t *data);
+int32 CFE_SB_SendLatencyStatsCmd(const CFE_SB_SendLatencyStats_t *data);
 int32 CFE_SB_SendRoutingInfoCmd(const CFE_SB_SendRoutingInfo_t *data);
 int32 CFE_SB_SendPipeInfoCmd(const CFE_SB_SendPipeInfo_t *data);
 int32 CFE_SB_SendMapInfoCmd(const CFE_SB_SendMapInfo_t *data);
@@ -474,8 +1018,27 @@ extern cfe_sb_t CFE_SB;
  */
 static inline bool CFE_SB_IsValidMsgKey(CFE_SB_MsgKey_t MsgKey)
 {
+#ifdef CFE_PLATFORM_SB_MSGMAP_HASH
+    return (MsgKey.KeyIdx != 0);
+#else
     return (MsgKey.KeyIdx != 0 && MsgKey.KeyIdx <= CFE_SB_MAX_NUMBER_OF_MSG_KEYS);
+#endif
+}
+
+#ifdef CFE_PLATFORM_SB_MSGMAP_HASH
+/**
+ * @brief Computes the home slot of a CFE_SB_MsgKey_t in the hashed message map
+ *
+ * Uses multiplicative (Fibonacci) hashing, keeping the top bits of the product
+ * so that keys differing only in their upper subsystem/system bits still spread.
+ *
+ * @returns The message map slot where the probe sequence for the key starts
+ */
+static inline uint32 CFE_SB_MsgMapHash(CFE_SB_MsgKey_t MsgKey)
+{
+    return ((uint32)(MsgKey.KeyIdx * 0x9E3779B1u) >> (32 - CFE_SB_MSGMAP_HASH_BITS));
 }
+#endif
 
 /**
  * @brief Identifies whether a given CFE_SB_MsgRouteIdx_t is valid
@@ -0,0 +1,1941 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/******************************************************************************
+** File: cfe_sb_queue.c
+**
+** Purpose:
+**      This file contains the pipe queue backends.  A pipe either uses an
+**      OSAL queue to carry its buffer descriptors, or (CFE_SB_PIPEOPTS_RING)
+**      an in-process ring of descriptor pointers.  A ring pipe still owns a
+**      one deep OSAL queue, which registers the pipe name and is used as a
+**      doorbell to wake a reader that is blocked on an empty ring.
+**
+**      A pipe with a high priority subscription also has a high priority
+**      lane, a ring that is always read before the normal queue.  A write to
+**      the lane wakes a blocked reader through the OSAL queue of the pipe:
+**      a doorbell token for a ring pipe, or an entry without a buffer for an
+**      OSAL queue pipe.
+**
+**      A broadcast topic is a ring of buffers shared by every pipe that
+**      subscribes to its MsgId.  A send stores the buffer once and only wakes
+**      the subscribers that are blocked, the same way a lane write does; each
+**      pipe reads the ring from its own cursor.
+**
+**      An elastic pipe (CFE_SB_PIPEOPTS_ELASTIC) is a ring pipe with a pair
+**      of rings.  The SB task keeps the next, larger, ring ready; a write
+**      that finds the pipe full moves the writers to it, up to the maximum
+**      depth of the pipe, and the reader follows once it has emptied the
+**      older ring, which the SB task then releases.  The SB task moves the
+**      pipe back to its base depth the same way once it has been quiet for
+**      CFE_PLATFORM_SB_ELASTIC_QUIET_CYCLES housekeeping requests.  Puts and
+**      gets do not take the shared data lock.
+**
+**      A lossless pipe (CFE_SB_PIPEOPTS_LOSSLESS) also owns a counting
+**      semaphore that a reader gives after a read while a sender is waiting
+**      for room on the pipe, see CFE_SB_WaitWriteQueue.
+**
+******************************************************************************/
+
+/*
+**  Include Files
+*/
+
+#include "cfe_sb_priv.h"
+#include "cfe_sb.h"
+#include "osapi.h"
+#include "cfe_es.h"
+#include "cfe_error.h"
+#include <string.h>
+#include <stdio.h>
+
+
+/******************************************************************************
+**  Function:  CFE_SB_QueueCreate_Unsync()
+**
+**  Purpose:
+**    Creates the queue of a new pipe.  For a ring pipe the ring is allocated
+**    from the SB memory pool.  The caller must hold the shared data lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor of the new pipe
+**    PipeName   : Name of the pipe
+**    Depth      : Depth of the pipe
+**    Opts       : Pipe options, CFE_SB_PIPEOPTS_RING selects the ring backend
+**                 and CFE_SB_PIPEOPTS_LOSSLESS creates the space semaphore
+**
+**  Return:
+**    OS_SUCCESS, the OS_QueueCreate error, the CFE_ES_GetPoolBuf error or
+**    the OS_CountSemCreate error
+*/
+int32 CFE_SB_QueueCreate_Unsync(CFE_SB_PipeD_t *PipeDscPtr, const char *PipeName,
+                                uint16 Depth, uint8 Opts){
+
+    int32   Status;
+    osal_id_t SysQueueId;
+
+    PipeDscPtr->Ring.Slots          = NULL;
+    PipeDscPtr->Ring.ReaderWaiting  = 0;
+    PipeDscPtr->Ring.Count          = 0;
+    PipeDscPtr->Ring.Writers        = 0;
+    PipeDscPtr->Ring.Readers        = 0;
+    PipeDscPtr->AltRing.Slots       = NULL;
+    PipeDscPtr->AltRing.Count       = 0;
+    PipeDscPtr->AltRing.Writers     = 0;
+    PipeDscPtr->AltRing.Readers     = 0;
+    PipeDscPtr->WriteGen            = 0;
+    PipeDscPtr->ReadGen             = 0;
+    PipeDscPtr->StandbyReady        = 0;
+    PipeDscPtr->HighLane.Slots      = NULL;
+    PipeDscPtr->SpaceSemId          = OS_OBJECT_ID_UNDEFINED;
+    PipeDscPtr->WritersWaiting      = 0;
+
+    if((Opts & CFE_SB_PIPEOPTS_RING) == 0){
+        Status = OS_QueueCreate(&SysQueueId,PipeName,Depth,sizeof(CFE_SB_QueueEntry_t),0);
+    }else{
+        Status = OS_QueueCreate(&SysQueueId,PipeName,CFE_SB_RING_DOORBELL_DEPTH,
+                                sizeof(CFE_SB_BufferD_t *),0);
+    }/* end if */
+
+    if(Status != OS_SUCCESS){
+        PipeDscPtr->SysQueueId = SysQueueId;
+        return Status;
+    }/* end if */
+
+    if(Opts & CFE_SB_PIPEOPTS_RING){
+        Status = CFE_SB_RingCreate_Unsync(&PipeDscPtr->Ring, Depth);
+    }/* end if */
+
+    if((Status == OS_SUCCESS) && (Opts & CFE_SB_PIPEOPTS_LOSSLESS)){
+        Status = CFE_SB_QueueAddSpaceSignal_Unsync(PipeDscPtr);
+        if(Status != OS_SUCCESS){
+            CFE_SB_RingDelete_Unsync(&PipeDscPtr->Ring);
+        }/* end if */
+    }/* end if */
+
+    if(Status != OS_SUCCESS){
+        OS_QueueDelete(SysQueueId);
+        return Status;
+    }/* end if */
+
+    PipeDscPtr->SysQueueId = SysQueueId;
+
+    return OS_SUCCESS;
+
+}/* end CFE_SB_QueueCreate_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_QueueAddLane_Unsync()
+**
+**  Purpose:
+**    Gives a pipe its high priority lane, with the base depth of the pipe, if it
+**    does not have one yet.  The lane is kept until the pipe is deleted.
+**    The caller must hold the shared data lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**
+**  Return:
+**    OS_SUCCESS or the CFE_ES_GetPoolBuf error
+*/
+int32 CFE_SB_QueueAddLane_Unsync(CFE_SB_PipeD_t *PipeDscPtr){
+
+    if(PipeDscPtr->HighLane.Slots != NULL){
+        return OS_SUCCESS;
+    }/* end if */
+
+    return CFE_SB_RingCreate_Unsync(&PipeDscPtr->HighLane, PipeDscPtr->BaseDepth);
+
+}/* end CFE_SB_QueueAddLane_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_QueueAddSpaceSignal_Unsync()
+**
+**  Purpose:
+**    Gives a pipe the counting semaphore senders wait on for room on a full
+**    lossless pipe, if it does not have one yet.  The semaphore is kept until
+**    the pipe is deleted.  The caller must hold the shared data lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**
+**  Return:
+**    OS_SUCCESS or the OS_CountSemCreate error
+*/
+int32 CFE_SB_QueueAddSpaceSignal_Unsync(CFE_SB_PipeD_t *PipeDscPtr){
+
+    int32   Status;
+    osal_id_t SemId;
+    char    SemName[OS_MAX_API_NAME];
+
+    if(OS_ObjectIdDefined(PipeDscPtr->SpaceSemId)){
+        return OS_SUCCESS;
+    }/* end if */
+
+    snprintf(SemName, sizeof(SemName), "SBSpace%u",
+             (unsigned int)(PipeDscPtr - CFE_SB.PipeTbl));
+
+    Status = OS_CountSemCreate(&SemId, SemName, 0, 0);
+    if(Status == OS_SUCCESS){
+        PipeDscPtr->WritersWaiting = 0;
+        PipeDscPtr->SpaceSemId     = SemId;
+    }/* end if */
+
+    return Status;
+
+}/* end CFE_SB_QueueAddSpaceSignal_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_RingCreate_Unsync()
+**
+**  Purpose:
+**    Allocates the slots of a ring from the SB memory pool, rounded up to a
+**    power of two so a position maps to a slot by mask.  ReaderWaiting and
+**    the counts of puts and gets in progress are left as they are, as the
+**    rings of an elastic pipe are created again while the pipe is in use.
+**    The caller must hold the shared data lock.
+**
+**  Arguments:
+**    RingPtr    : Pointer to the ring
+**    Depth      : Number of entries the ring must hold
+**
+**  Return:
+**    OS_SUCCESS or the CFE_ES_GetPoolBuf error
+*/
+int32 CFE_SB_RingCreate_Unsync(CFE_SB_PipeRing_t *RingPtr, uint16 Depth){
+
+    int32   Status;
+    uint32  Capacity;
+    uint32  i;
+    CFE_SB_RingSlot_t *Slots = NULL;
+
+    Capacity = 1;
+    while(Capacity < Depth){
+        Capacity <<= 1;
+    }/* end while */
+
+    Status = CFE_ES_GetPoolBuf((uint32 **)&Slots, CFE_SB.Mem.PoolHdl,
+                               Capacity * sizeof(CFE_SB_RingSlot_t));
+    if(Status < 0){
+        return Status;
+    }/* end if */
+
+    CFE_SB.StatTlmMsg.Payload.MemInUse+=Status;
+    if(CFE_SB.StatTlmMsg.Payload.MemInUse > CFE_SB.StatTlmMsg.Payload.PeakMemInUse){
+        CFE_SB.StatTlmMsg.Payload.PeakMemInUse = CFE_SB.StatTlmMsg.Payload.MemInUse;
+    }/* end if */
+
+    for(i = 0; i < Capacity; i++){
+        Slots[i].Seq                = i;
+        Slots[i].Entry.BufDscPtr    = NULL;
+    }/* end for */
+
+    RingPtr->Mask          = Capacity - 1;
+    RingPtr->Head          = 0;
+    RingPtr->Tail          = 0;
+    RingPtr->Count         = 0;
+    RingPtr->Depth         = Depth;
+    RingPtr->Slots         = Slots;
+
+    return OS_SUCCESS;
+
+}/* end CFE_SB_RingCreate_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_RingDelete_Unsync()
+**
+**  Purpose:
+**    Returns the slots of a ring to the SB memory pool.  The caller must hold
+**    the shared data lock.
+**
+**  Arguments:
+**    RingPtr    : Pointer to the ring
+**
+**  Return:
+**    None
+*/
+void CFE_SB_RingDelete_Unsync(CFE_SB_PipeRing_t *RingPtr){
+
+    int32   Stat;
+
+    if(RingPtr->Slots != NULL){
+        Stat = CFE_ES_PutPoolBuf(CFE_SB.Mem.PoolHdl, (uint32 *)RingPtr->Slots);
+        if(Stat > 0){
+            CFE_SB.StatTlmMsg.Payload.MemInUse-=Stat;
+        }/* end if */
+        RingPtr->Slots = NULL;
+    }/* end if */
+
+}/* end CFE_SB_RingDelete_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_QueueDelete_Unsync()
+**
+**  Purpose:
+**    Deletes the queue of a pipe and returns the rings of a ring pipe, and
+**    the high priority lane, to the SB memory pool.  The space semaphore of
+**    a lossless pipe is deleted as well.  The pipe must have been drained
+**    and have no pending puts.  The caller must hold the shared data lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**
+**  Return:
+**    None
+*/
+void CFE_SB_QueueDelete_Unsync(CFE_SB_PipeD_t *PipeDscPtr){
+
+    OS_QueueDelete(PipeDscPtr->SysQueueId);
+
+    CFE_SB_RingDelete_Unsync(&PipeDscPtr->Ring);
+    CFE_SB_RingDelete_Unsync(&PipeDscPtr->AltRing);
+    CFE_SB_RingDelete_Unsync(&PipeDscPtr->HighLane);
+
+    if(OS_ObjectIdDefined(PipeDscPtr->SpaceSemId)){
+        OS_CountSemDelete(PipeDscPtr->SpaceSemId);
+        PipeDscPtr->SpaceSemId = OS_OBJECT_ID_UNDEFINED;
+    }/* end if */
+
+}/* end CFE_SB_QueueDelete_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_WriteQueue()
+**
+**  Purpose:
+**    Writes an entry to the queue, or the high priority lane, of a pipe.
+**    Called without the shared data lock.  A ring or lane write only touches
+**    the OSAL queue when the reader has announced that it is blocked.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**    EntryPtr   : Pointer to the queue entry to deliver
+**
+**  Return:
+**    OS_SUCCESS, OS_QUEUE_FULL or the OS_QueuePut error
+*/
+int32 CFE_SB_WriteQueue(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_QueueEntry_t *EntryPtr){
+
+    int32   Status;
+
+    if(EntryPtr->Lane == CFE_SB_LANE_HIGH){
+        Status = CFE_SB_RingPut(&PipeDscPtr->HighLane, EntryPtr, PipeDscPtr->BaseDepth);
+    }else if((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_RING) == 0){
+        return OS_QueuePut(PipeDscPtr->SysQueueId,(const void *)EntryPtr,
+                           sizeof(CFE_SB_QueueEntry_t),0);
+    }else if(PipeDscPtr->Opts & CFE_SB_PIPEOPTS_ELASTIC){
+        Status = CFE_SB_ElasticPut(PipeDscPtr, EntryPtr);
+    }else{
+        Status = CFE_SB_RingPut(&PipeDscPtr->Ring, EntryPtr, PipeDscPtr->QueueDepth);
+    }/* end if */
+
+    if(Status == OS_SUCCESS){
+
+        /* pairs with the barrier the reader issues after setting ReaderWaiting */
+        CFE_SB_MEMORY_BARRIER();
+
+        if(PipeDscPtr->Ring.ReaderWaiting){
+            CFE_SB_QueueWake(PipeDscPtr);
+        }/* end if */
+
+    }/* end if */
+
+    return Status;
+
+}/* end CFE_SB_WriteQueue */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_QueueWake()
+**
+**  Purpose:
+**    Wakes the reader of a pipe that is blocked on its OSAL queue: with a
+**    doorbell token for a ring pipe, or an entry without a buffer for an
+**    OSAL queue pipe.  Called without the shared data lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**
+**  Return:
+**    None
+*/
+void CFE_SB_QueueWake(CFE_SB_PipeD_t *PipeDscPtr){
+
+    CFE_SB_BufferD_t *Token = NULL;
+    CFE_SB_QueueEntry_t TokenEntry;
+
+    /* a full queue already holds a wakeup, so its status is not needed */
+    if(PipeDscPtr->Opts & CFE_SB_PIPEOPTS_RING){
+        OS_QueuePut(PipeDscPtr->SysQueueId,(void *)&Token,
+                    sizeof(CFE_SB_BufferD_t *),0);
+    }else{
+        memset(&TokenEntry, 0, sizeof(TokenEntry));
+        OS_QueuePut(PipeDscPtr->SysQueueId,(void *)&TokenEntry,
+                    sizeof(CFE_SB_QueueEntry_t),0);
+    }/* end if */
+
+}/* end CFE_SB_QueueWake */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_WaitWriteQueue()
+**
+**  Purpose:
+**    Waits for room on a full lossless pipe and writes an entry to it, until
+**    the write succeeds or the deadline passes.  The sender blocks on the
+**    space semaphore of the pipe, which a reader gives after each read while
+**    a sender is waiting (see CFE_SB_QueueSignalSpace); the shared data lock
+**    is not taken unless a destination of the pipe has been removed.  The
+**    caller keeps a pending put on the pipe for the whole wait, which holds
+**    off its deletion; a deletion or unsubscription wakes the sender, which
+**    then gives up.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**    EntryPtr   : Pointer to the queue entry to write
+**    TimeOut    : Timeout of the send, CFE_SB_PEND_FOREVER waits without limit
+**    Deadline   : Time, see CFE_SB_MsecNow, at which the wait ends; shared
+**                 by all the destinations of the send
+**
+**  Return:
+**    OS_SUCCESS, OS_QUEUE_FULL if there was no room in time or the OS
+**    error of the write
+*/
+int32 CFE_SB_WaitWriteQueue(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_QueueEntry_t *EntryPtr,
+                            int32 TimeOut, uint32 Deadline){
+
+    int32   Status = OS_QUEUE_FULL;
+    int32   WaitStatus = OS_SUCCESS;
+    int32   Remaining;
+    bool    Subscribed = true;
+
+    if((TimeOut == CFE_SB_POLL) || !OS_ObjectIdDefined(PipeDscPtr->SpaceSemId)){
+        return Status;
+    }/* end if */
+
+    CFE_SB_AddWritersWaiting(PipeDscPtr, 1);
+
+    while(true){
+
+        /* look again after announcing the wait, so a concurrent read is not missed */
+        Status = CFE_SB_WriteQueue(PipeDscPtr, EntryPtr);
+        if((Status != OS_QUEUE_FULL)||(WaitStatus != OS_SUCCESS)){
+            break;
+        }/* end if */
+
+        if(PipeDscPtr->InUse != CFE_SB_IN_USE){
+            Subscribed = false;
+            break;
+        }/* end if */
+
+        if(EntryPtr->DestGen != PipeDscPtr->DestGen){
+            /* unsubscribed while waiting, the reservation is refunded by the caller */
+            CFE_SB_LockSharedData(__func__,__LINE__);
+            Subscribed = (CFE_SB_GetQueuedDest_Unsync(PipeDscPtr, EntryPtr) != NULL);
+            CFE_SB_UnlockSharedData(__func__,__LINE__);
+            if(!Subscribed){
+                break;
+            }/* end if */
+        }/* end if */
+
+        if(TimeOut == CFE_SB_PEND_FOREVER){
+            WaitStatus = OS_CountSemTake(PipeDscPtr->SpaceSemId);
+        }else{
+            Remaining = (int32)(Deadline - CFE_SB_MsecNow());
+            if(Remaining <= 0){
+                break;
+            }/* end if */
+            /* a timeout still makes one last write attempt above */
+            WaitStatus = OS_CountSemTimedWait(PipeDscPtr->SpaceSemId, (uint32)Remaining);
+        }/* end if */
+
+    }/* end while */
+
+    CFE_SB_AddWritersWaiting(PipeDscPtr, -1);
+
+    /* pass a deletion or unsubscription wakeup on to the next waiting sender */
+    if(!Subscribed){
+        CFE_SB_QueueWakeWriters(PipeDscPtr);
+    }/* end if */
+
+    return Status;
+
+}/* end CFE_SB_WaitWriteQueue */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_AddWritersWaiting()
+**
+**  Purpose:
+**    Adds to the count of senders waiting for room on a lossless pipe.  With
+**    CFE_SB_LOCKFREE_ROUTING the update is atomic and a full barrier, so the
+**    write a sender retries after announcing itself is ordered after it.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**    Delta      : 1 when a sender starts waiting, -1 when it stops
+**
+**  Return:
+**    None
+*/
+void CFE_SB_AddWritersWaiting(CFE_SB_PipeD_t *PipeDscPtr, int32 Delta){
+
+#ifdef CFE_SB_LOCKFREE_ROUTING
+    __sync_add_and_fetch(&PipeDscPtr->WritersWaiting, (uint32)Delta);
+#else
+    CFE_SB_LockSharedData(__func__,__LINE__);
+    PipeDscPtr->WritersWaiting += (uint32)Delta;
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+#endif
+
+}/* end CFE_SB_AddWritersWaiting */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_QueueSignalSpace()
+**
+**  Purpose:
+**    Wakes one sender waiting for room on a lossless pipe, called by the
+**    reader after each entry it takes from the pipe.  A pipe without a space
+**    semaphore costs one test.  Called without the shared data lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**
+**  Return:
+**    None
+*/
+void CFE_SB_QueueSignalSpace(CFE_SB_PipeD_t *PipeDscPtr){
+
+    if(!OS_ObjectIdDefined(PipeDscPtr->SpaceSemId)){
+        return;
+    }/* end if */
+
+#ifdef CFE_SB_LOCKFREE_ROUTING
+    /* pairs with the atomic increment of a sender announcing its wait */
+    CFE_SB_MEMORY_BARRIER();
+    CFE_SB_QueueWakeWriters(PipeDscPtr);
+#else
+    CFE_SB_LockSharedData(__func__,__LINE__);
+    CFE_SB_QueueWakeWriters(PipeDscPtr);
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+#endif
+
+}/* end CFE_SB_QueueSignalSpace */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_QueueWakeWriters()
+**
+**  Purpose:
+**    Gives the space semaphore of a pipe if a sender is waiting on it.  Also
+**    used when a destination is removed or the pipe is deleted, so a waiting
+**    sender notices without waiting for a read.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**
+**  Return:
+**    None
+*/
+void CFE_SB_QueueWakeWriters(CFE_SB_PipeD_t *PipeDscPtr){
+
+    if(OS_ObjectIdDefined(PipeDscPtr->SpaceSemId) && (PipeDscPtr->WritersWaiting != 0)){
+        OS_CountSemGive(PipeDscPtr->SpaceSemId);
+    }/* end if */
+
+}/* end CFE_SB_QueueWakeWriters */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_QueueGet()
+**
+**  Purpose:
+**    Reads the next entry from the queue of a pipe, taking the high priority
+**    lane first and the broadcast topics of the pipe next.  Called without
+**    the shared data lock.  A ring, lane or topic read only blocks on the
+**    OSAL queue when every lane is empty and the caller asked to wait.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**    EntryPtr   : Set to the queue entry that was read
+**    TimeOut    : OS_PEND, OS_CHECK or a timeout in milliseconds
+**
+**  Return:
+**    OS_SUCCESS, OS_QUEUE_EMPTY, OS_QUEUE_TIMEOUT or the OS_QueueGet error
+**
+**  Notes:
+**    A doorbell token left by a write that the reader consumed without
+**    blocking wakes the next wait early; the reader then waits again, so a
+**    timed wait can last up to twice the requested timeout.
+*/
+int32 CFE_SB_QueueGet(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_QueueEntry_t *EntryPtr, int32 TimeOut){
+
+    int32   Status;
+    uint32  Nbytes;
+    bool    BcastWait;
+    CFE_SB_BufferD_t *Token;
+
+    if(((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_RING) == 0)&&(PipeDscPtr->HighLane.Slots == NULL)&&
+       (PipeDscPtr->BcastMask == 0)){
+        return OS_QueueGet(PipeDscPtr->SysQueueId,(void *)EntryPtr,
+                           sizeof(CFE_SB_QueueEntry_t),&Nbytes,TimeOut);
+    }/* end if */
+
+    Status = CFE_SB_QueueTryGet(PipeDscPtr, EntryPtr);
+
+    while((Status == OS_QUEUE_EMPTY)&&(TimeOut != OS_CHECK)){
+
+        /* announce the wait, then look again so a concurrent write is not missed */
+        PipeDscPtr->Ring.ReaderWaiting = 1;
+        BcastWait = (PipeDscPtr->BcastMask != 0);
+        if(BcastWait){
+            CFE_SB_BcastSetWaiting(PipeDscPtr, true);
+        }/* end if */
+        CFE_SB_MEMORY_BARRIER();
+
+        Status = CFE_SB_QueueTryGet(PipeDscPtr, EntryPtr);
+        if(Status == OS_QUEUE_EMPTY){
+            if(PipeDscPtr->Opts & CFE_SB_PIPEOPTS_RING){
+                Status = OS_QueueGet(PipeDscPtr->SysQueueId,(void *)&Token,
+                                     sizeof(CFE_SB_BufferD_t *),&Nbytes,TimeOut);
+            }else{
+                Status = OS_QueueGet(PipeDscPtr->SysQueueId,(void *)EntryPtr,
+                                     sizeof(CFE_SB_QueueEntry_t),&Nbytes,TimeOut);
+                if((Status == OS_SUCCESS)&&(EntryPtr->BufDscPtr != NULL)){
+                    PipeDscPtr->Ring.ReaderWaiting = 0;
+                    if(BcastWait){
+                        CFE_SB_BcastSetWaiting(PipeDscPtr, false);
+                    }/* end if */
+                    return OS_SUCCESS;
+                }/* end if */
+            }/* end if */
+            if(Status == OS_SUCCESS){
+                Status = CFE_SB_QueueTryGet(PipeDscPtr, EntryPtr);
+            }/* end if */
+        }/* end if */
+
+        PipeDscPtr->Ring.ReaderWaiting = 0;
+        if(BcastWait){
+            CFE_SB_BcastSetWaiting(PipeDscPtr, false);
+        }/* end if */
+
+    }/* end while */
+
+    return Status;
+
+}/* end CFE_SB_QueueGet */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_QueueTryGet()
+**
+**  Purpose:
+**    Reads the next entry of a pipe without waiting: from the high priority
+**    lane if it holds one, then from the broadcast topics of the pipe,
+**    otherwise from the normal queue.  Wakeup entries left in the OSAL queue
+**    of a pipe by lane and topic writes are skipped.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**    EntryPtr   : Set to the queue entry that was read
+**
+**  Return:
+**    OS_SUCCESS, OS_QUEUE_EMPTY or the OS_QueueGet error
+*/
+int32 CFE_SB_QueueTryGet(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_QueueEntry_t *EntryPtr){
+
+    int32   Status;
+    uint32  Nbytes;
+
+    for(;;){
+
+        if(PipeDscPtr->HighLane.Slots != NULL){
+            Status = CFE_SB_RingGet(&PipeDscPtr->HighLane, EntryPtr);
+            if(Status == OS_SUCCESS){
+                return OS_SUCCESS;
+            }/* end if */
+        }/* end if */
+
+        if(PipeDscPtr->BcastMask != 0){
+            Status = CFE_SB_BcastGet(PipeDscPtr, EntryPtr);
+            if(Status == OS_SUCCESS){
+                return OS_SUCCESS;
+            }/* end if */
+        }/* end if */
+
+        if(PipeDscPtr->Opts & CFE_SB_PIPEOPTS_ELASTIC){
+            return CFE_SB_ElasticGet(PipeDscPtr, EntryPtr);
+        }/* end if */
+
+        if(PipeDscPtr->Opts & CFE_SB_PIPEOPTS_RING){
+            return CFE_SB_RingGet(&PipeDscPtr->Ring, EntryPtr);
+        }/* end if */
+
+        Status = OS_QueueGet(PipeDscPtr->SysQueueId,(void *)EntryPtr,
+                             sizeof(CFE_SB_QueueEntry_t),&Nbytes,OS_CHECK);
+        if((Status != OS_SUCCESS)||(EntryPtr->BufDscPtr != NULL)){
+            return Status;
+        }/* end if */
+
+        /* a wakeup entry, look at the lane again */
+
+    }/* end for */
+
+}/* end CFE_SB_QueueTryGet */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_RingPut()
+**
+**  Purpose:
+**    Appends a queue entry to a ring.  Writers first claim one unit of
+**    the pipe depth in Count, which guarantees that the slot at the claimed
+**    position has been released by the reader of the previous lap.
+**
+**  Arguments:
+**    RingPtr    : Pointer to the ring
+**    EntryPtr   : Pointer to the queue entry to append
+**    Depth      : Depth of the pipe
+**
+**  Return:
+**    OS_SUCCESS or OS_QUEUE_FULL
+*/
+int32 CFE_SB_RingPut(CFE_SB_PipeRing_t *RingPtr, const CFE_SB_QueueEntry_t *EntryPtr, uint16 Depth){
+
+#ifdef CFE_SB_LOCKFREE_ROUTING
+    CFE_SB_RingSlot_t *SlotPtr;
+    uint32  Pos;
+    int32   Dif;
+
+    if(__sync_add_and_fetch(&RingPtr->Count, 1) > Depth){
+        __sync_sub_and_fetch(&RingPtr->Count, 1);
+        return OS_QUEUE_FULL;
+    }/* end if */
+
+    Pos = RingPtr->Head;
+    for(;;){
+        SlotPtr = &RingPtr->Slots[Pos & RingPtr->Mask];
+        Dif = (int32)(SlotPtr->Seq - Pos);
+
+        if(Dif == 0){
+            if(__sync_bool_compare_and_swap(&RingPtr->Head, Pos, Pos + 1)){
+                break;
+            }/* end if */
+        }else if(Dif < 0){
+            /* slot not yet released, cannot happen while Count holds the depth */
+            __sync_sub_and_fetch(&RingPtr->Count, 1);
+            return OS_QUEUE_FULL;
+        }/* end if */
+
+        Pos = RingPtr->Head;
+    }/* end for */
+
+    SlotPtr->Entry = *EntryPtr;
+    CFE_SB_MEMORY_BARRIER();
+    SlotPtr->Seq = Pos + 1;
+
+    return OS_SUCCESS;
+#else
+    int32   Status;
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+    Status = CFE_SB_RingPut_Unsync(RingPtr, EntryPtr, Depth);
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    return Status;
+#endif
+
+}/* end CFE_SB_RingPut */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_RingPut_Unsync()
+**
+**  Purpose:
+**    Appends a queue entry to a ring that is only used under the shared data
+**    lock.  The caller must hold the shared data lock.
+**
+**  Arguments:
+**    RingPtr    : Pointer to the ring
+**    EntryPtr   : Pointer to the queue entry to append
+**    Depth      : Depth of the pipe
+**
+**  Return:
+**    OS_SUCCESS or OS_QUEUE_FULL
+*/
+int32 CFE_SB_RingPut_Unsync(CFE_SB_PipeRing_t *RingPtr, const CFE_SB_QueueEntry_t *EntryPtr, uint16 Depth){
+
+    CFE_SB_RingSlot_t *SlotPtr;
+    uint32  Pos;
+
+    if(RingPtr->Count >= Depth){
+        return OS_QUEUE_FULL;
+    }/* end if */
+
+    Pos = RingPtr->Head++;
+    SlotPtr = &RingPtr->Slots[Pos & RingPtr->Mask];
+    SlotPtr->Entry = *EntryPtr;
+    SlotPtr->Seq = Pos + 1;
+    RingPtr->Count++;
+
+    return OS_SUCCESS;
+
+}/* end CFE_SB_RingPut_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_RingGet()
+**
+**  Purpose:
+**    Removes the oldest queue entry from a ring.  A slot that has been
+**    claimed by a writer but not yet filled reads as empty; that writer rings
+**    the doorbell if the reader goes on to block.
+**
+**  Arguments:
+**    RingPtr    : Pointer to the ring
+**    EntryPtr   : Set to the queue entry that was removed
+**
+**  Return:
+**    OS_SUCCESS or OS_QUEUE_EMPTY
+*/
+int32 CFE_SB_RingGet(CFE_SB_PipeRing_t *RingPtr, CFE_SB_QueueEntry_t *EntryPtr){
+
+#ifdef CFE_SB_LOCKFREE_ROUTING
+    CFE_SB_RingSlot_t *SlotPtr;
+    uint32  Pos;
+    int32   Dif;
+
+    Pos = RingPtr->Tail;
+    for(;;){
+        SlotPtr = &RingPtr->Slots[Pos & RingPtr->Mask];
+        Dif = (int32)(SlotPtr->Seq - (Pos + 1));
+
+        if(Dif == 0){
+            if(__sync_bool_compare_and_swap(&RingPtr->Tail, Pos, Pos + 1)){
+                break;
+            }/* end if */
+        }else if(Dif < 0){
+            return OS_QUEUE_EMPTY;
+        }/* end if */
+
+        Pos = RingPtr->Tail;
+    }/* end for */
+
+    *EntryPtr = SlotPtr->Entry;
+    CFE_SB_MEMORY_BARRIER();
+    SlotPtr->Seq = Pos + RingPtr->Mask + 1;
+
+    /* the depth is given back only after the slot has been released */
+    __sync_sub_and_fetch(&RingPtr->Count, 1);
+
+    return OS_SUCCESS;
+#else
+    int32   Status;
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+    Status = CFE_SB_RingGet_Unsync(RingPtr, EntryPtr);
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    return Status;
+#endif
+
+}/* end CFE_SB_RingGet */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_RingGet_Unsync()
+**
+**  Purpose:
+**    Removes the oldest queue entry from a ring that is only used under the
+**    shared data lock.  The caller must hold the shared data lock.
+**
+**  Arguments:
+**    RingPtr    : Pointer to the ring
+**    EntryPtr   : Pointer to where the queue entry is returned
+**
+**  Return:
+**    OS_SUCCESS or OS_QUEUE_EMPTY
+*/
+int32 CFE_SB_RingGet_Unsync(CFE_SB_PipeRing_t *RingPtr, CFE_SB_QueueEntry_t *EntryPtr){
+
+    CFE_SB_RingSlot_t *SlotPtr;
+    uint32  Pos;
+
+    if(RingPtr->Count == 0){
+        return OS_QUEUE_EMPTY;
+    }/* end if */
+
+    Pos = RingPtr->Tail++;
+    SlotPtr = &RingPtr->Slots[Pos & RingPtr->Mask];
+    *EntryPtr = SlotPtr->Entry;
+    SlotPtr->Seq = Pos + RingPtr->Mask + 1;
+    RingPtr->Count--;
+
+    return OS_SUCCESS;
+
+}/* end CFE_SB_RingGet_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_ElasticPut()
+**
+**  Purpose:
+**    Appends a queue entry to an elastic pipe, on the ring of its write
+**    generation.  When that ring is full and the SB task has the next ring
+**    ready, the writer hands the pipe over to it and puts the entry there.
+**    Called without the shared data lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**    EntryPtr   : Pointer to the queue entry to append
+**
+**  Return:
+**    OS_SUCCESS or OS_QUEUE_FULL
+**
+**  Notes:
+**    A writer is counted on the ring while it puts, and gives the ring up if
+**    the generation moved on before it was counted, so no put can land on a
+**    ring the reader has left (see CFE_SB_ElasticLeave).  Where the toolchain
+**    does not provide atomics the put is made under the shared data lock.
+*/
+int32 CFE_SB_ElasticPut(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_QueueEntry_t *EntryPtr){
+
+    CFE_SB_PipeRing_t *RingPtr;
+    int32   Status;
+    uint32  Gen;
+    uint32  Held;
+    bool    Claimed;
+
+#ifndef CFE_SB_LOCKFREE_ROUTING
+    CFE_SB_LockSharedData(__func__,__LINE__);
+#endif
+
+    for(;;){
+
+        Gen = PipeDscPtr->WriteGen;
+        RingPtr = CFE_SB_ELASTIC_RING(PipeDscPtr, Gen);
+
+#ifdef CFE_SB_LOCKFREE_ROUTING
+        __sync_add_and_fetch(&RingPtr->Writers, 1);
+        if(PipeDscPtr->WriteGen != Gen){
+            __sync_sub_and_fetch(&RingPtr->Writers, 1);
+            continue;
+        }/* end if */
+
+        Status = CFE_SB_RingPut(RingPtr, EntryPtr, RingPtr->Depth);
+        __sync_sub_and_fetch(&RingPtr->Writers, 1);
+#else
+        Status = CFE_SB_RingPut_Unsync(RingPtr, EntryPtr, RingPtr->Depth);
+#endif
+
+        if(Status != OS_QUEUE_FULL){
+            break;
+        }/* end if */
+
+        /* another writer moved the pipe meanwhile, try its new ring */
+        if(PipeDscPtr->WriteGen != Gen){
+            continue;
+        }/* end if */
+
+        /* a full ring moves the pipe to the next one, if it is ready */
+#ifdef CFE_SB_LOCKFREE_ROUTING
+        Claimed = __sync_bool_compare_and_swap(&PipeDscPtr->StandbyReady, 1, 0);
+#else
+        Claimed = (PipeDscPtr->StandbyReady != 0);
+        PipeDscPtr->StandbyReady = 0;
+#endif
+
+        if(Claimed){
+            CFE_SB_ElasticHandover(PipeDscPtr);
+        }else if(PipeDscPtr->WriteGen == Gen){
+            break;
+        }/* end if */
+
+    }/* end for */
+
+    Held = PipeDscPtr->Ring.Count + PipeDscPtr->AltRing.Count;
+    if(Held > PipeDscPtr->ElasticPeak){
+        PipeDscPtr->ElasticPeak = (uint16)Held;
+    }/* end if */
+
+#ifndef CFE_SB_LOCKFREE_ROUTING
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+#endif
+
+    return Status;
+
+}/* end CFE_SB_ElasticPut */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_ElasticGet()
+**
+**  Purpose:
+**    Removes the oldest queue entry from an elastic pipe, from the ring of its
+**    read generation.  Once that ring is empty and the writers have moved to
+**    the next one, the reader follows them.  Called without the shared data
+**    lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**    EntryPtr   : Pointer to where the queue entry is returned
+**
+**  Return:
+**    OS_SUCCESS or OS_QUEUE_EMPTY
+**
+**  Notes:
+**    The reader is counted on the ring while it gets, which keeps the SB task
+**    from releasing the ring under it (see CFE_SB_ElasticStep_Unsync).
+*/
+int32 CFE_SB_ElasticGet(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_QueueEntry_t *EntryPtr){
+
+    CFE_SB_PipeRing_t *RingPtr;
+    int32   Status;
+    uint32  Gen;
+    bool    Left;
+
+#ifndef CFE_SB_LOCKFREE_ROUTING
+    CFE_SB_LockSharedData(__func__,__LINE__);
+#endif
+
+    for(;;){
+
+        Gen = PipeDscPtr->ReadGen;
+        RingPtr = CFE_SB_ELASTIC_RING(PipeDscPtr, Gen);
+
+#ifdef CFE_SB_LOCKFREE_ROUTING
+        __sync_add_and_fetch(&RingPtr->Readers, 1);
+        if(PipeDscPtr->ReadGen == Gen){
+            Status = CFE_SB_RingGet(RingPtr, EntryPtr);
+            Left = (Status == OS_QUEUE_EMPTY) && CFE_SB_ElasticLeave(PipeDscPtr, Gen);
+        }else{
+            Status = OS_QUEUE_EMPTY;
+            Left = true;
+        }/* end if */
+        __sync_sub_and_fetch(&RingPtr->Readers, 1);
+#else
+        Status = CFE_SB_RingGet_Unsync(RingPtr, EntryPtr);
+        Left = (Status == OS_QUEUE_EMPTY) && CFE_SB_ElasticLeave(PipeDscPtr, Gen);
+#endif
+
+        if(!Left){
+            break;
+        }/* end if */
+
+    }/* end for */
+
+#ifndef CFE_SB_LOCKFREE_ROUTING
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+#endif
+
+    return Status;
+
+}/* end CFE_SB_ElasticGet */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_ElasticLeave()
+**
+**  Purpose:
+**    Moves the read generation of an elastic pipe past an empty ring that the
+**    writers have left, once no put is still in progress on it.  The SB task
+**    is told that the ring can be released.  Called by the reader, or by the
+**    SB task for a reader that is blocked.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**    Gen        : Read generation that was found empty
+**
+**  Return:
+**    true if the read generation is past Gen
+*/
+bool CFE_SB_ElasticLeave(CFE_SB_PipeD_t *PipeDscPtr, uint32 Gen){
+
+    CFE_SB_PipeRing_t *RingPtr = CFE_SB_ELASTIC_RING(PipeDscPtr, Gen);
+
+    if(PipeDscPtr->WriteGen == Gen){
+        return false;
+    }/* end if */
+
+    /* a writer counted from here on sees the new generation and gives the ring up */
+    CFE_SB_MEMORY_BARRIER();
+
+    if((RingPtr->Writers != 0)||(RingPtr->Count != 0)){
+        return false;
+    }/* end if */
+
+#ifdef CFE_SB_LOCKFREE_ROUTING
+    if(__sync_bool_compare_and_swap(&PipeDscPtr->ReadGen, Gen, Gen + 1)){
+        CFE_SB.ElasticPending = 1;
+    }/* end if */
+#else
+    if(PipeDscPtr->ReadGen == Gen){
+        PipeDscPtr->ReadGen = Gen + 1;
+        CFE_SB.ElasticPending = 1;
+    }/* end if */
+#endif
+
+    return true;
+
+}/* end CFE_SB_ElasticLeave */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_ElasticHandover()
+**
+**  Purpose:
+**    Moves the writers of an elastic pipe to its other ring and updates the
+**    depth of the pipe and its depth statistics.  Only called by the task
+**    that took the other ring: a writer that cleared StandbyReady, or the SB
+**    task while StandbyReady is clear.  Called with or without the shared
+**    data lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**
+**  Return:
+**    None
+*/
+void CFE_SB_ElasticHandover(CFE_SB_PipeD_t *PipeDscPtr){
+
+    CFE_SB_PipeRing_t *NextPtr = CFE_SB_ELASTIC_RING(PipeDscPtr, PipeDscPtr->WriteGen + 1);
+    CFE_SB_PipeDepthStats_t *StatPtr;
+    uint16  NewDepth = NextPtr->Depth;
+
+    if(PipeDscPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE){
+        StatPtr = &CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeDscPtr->PipeId];
+        if(NewDepth > PipeDscPtr->QueueDepth){
+            StatPtr->Grows++;
+        }else if(NewDepth < PipeDscPtr->QueueDepth){
+            StatPtr->Shrinks++;
+        }/* end if */
+        StatPtr->Depth = NewDepth;
+        if(NewDepth > StatPtr->PeakDepth){
+            StatPtr->PeakDepth = NewDepth;
+        }/* end if */
+    }/* end if */
+
+    PipeDscPtr->QueueDepth = NewDepth;
+
+    /* the ring is complete before writers move to it */
+    CFE_SB_MEMORY_BARRIER();
+    PipeDscPtr->WriteGen++;
+    CFE_SB_MEMORY_BARRIER();
+
+}/* end CFE_SB_ElasticHandover */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_ElasticPrepare_Unsync()
+**
+**  Purpose:
+**    Allocates the next ring of an elastic pipe, with twice the current depth
+**    up to the maximum depth, and makes it ready for a writer that finds the
+**    pipe full.  Does nothing if the pipe is at its maximum depth, already
+**    has a ring ready, or its other ring is still in use.  The caller must
+**    hold the shared data lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**
+**  Return:
+**    OS_SUCCESS or the CFE_ES_GetPoolBuf error
+*/
+int32 CFE_SB_ElasticPrepare_Unsync(CFE_SB_PipeD_t *PipeDscPtr){
+
+    CFE_SB_PipeRing_t *NextPtr;
+    int32   Status;
+    uint32  Gen = PipeDscPtr->WriteGen;
+    uint32  NewDepth;
+
+    NextPtr = CFE_SB_ELASTIC_RING(PipeDscPtr, Gen + 1);
+    if((PipeDscPtr->StandbyReady != 0)||(PipeDscPtr->ReadGen != Gen)||
+       (NextPtr->Slots != NULL)||(PipeDscPtr->QueueDepth >= PipeDscPtr->MaxDepth)){
+        return OS_SUCCESS;
+    }/* end if */
+
+    NewDepth = 2 * (uint32)PipeDscPtr->QueueDepth;
+    if(NewDepth > PipeDscPtr->MaxDepth){
+        NewDepth = PipeDscPtr->MaxDepth;
+    }/* end if */
+
+    Status = CFE_SB_RingCreate_Unsync(NextPtr, (uint16)NewDepth);
+    if(Status != OS_SUCCESS){
+        return Status;
+    }/* end if */
+
+    /* the ring is complete before a writer can take it */
+    CFE_SB_MEMORY_BARRIER();
+    PipeDscPtr->StandbyReady = 1;
+
+    return OS_SUCCESS;
+
+}/* end CFE_SB_ElasticPrepare_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_ElasticStep_Unsync()
+**
+**  Purpose:
+**    Carries an elastic pipe through a change of ring on behalf of the SB
+**    task: moves a blocked reader past the empty older ring, returns that
+**    ring to the SB memory pool once no reader is on it, and prepares the
+**    next ring.  The caller must hold the shared data lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**
+**  Return:
+**    true while the pipe still waits for its reader to leave the older ring
+**
+**  Notes:
+**    A memory pool error leaves the pipe without a next ring; the next
+**    housekeeping request tries again.
+*/
+bool CFE_SB_ElasticStep_Unsync(CFE_SB_PipeD_t *PipeDscPtr){
+
+    CFE_SB_PipeRing_t *OldPtr;
+    uint32  Gen;
+
+    /* the other ring is the one ready for writers */
+    if(PipeDscPtr->StandbyReady != 0){
+        return false;
+    }/* end if */
+
+    /* with no ring ready only the reader and the SB task move the pipe */
+    CFE_SB_MEMORY_BARRIER();
+    Gen = PipeDscPtr->WriteGen;
+
+    if((PipeDscPtr->ReadGen != Gen)&&(!CFE_SB_ElasticLeave(PipeDscPtr, Gen - 1))){
+        return true;
+    }/* end if */
+
+    OldPtr = CFE_SB_ELASTIC_RING(PipeDscPtr, Gen + 1);
+    if(OldPtr->Slots != NULL){
+        CFE_SB_MEMORY_BARRIER();
+        if(OldPtr->Readers != 0){
+            return true;
+        }/* end if */
+        CFE_SB_RingDelete_Unsync(OldPtr);
+    }/* end if */
+
+    CFE_SB_ElasticPrepare_Unsync(PipeDscPtr);
+
+    return false;
+
+}/* end CFE_SB_ElasticStep_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_ElasticShrink_Unsync()
+**
+**  Purpose:
+**    Moves the writers of an elastic pipe to a new ring of its base depth.
+**    A ring left ready for writers is taken back and released first.  The
+**    caller must hold the shared data lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**
+**  Return:
+**    true if the pipe was moved, false if a writer took the ready ring, the
+**    older ring is still in use or the new ring could not be allocated
+*/
+bool CFE_SB_ElasticShrink_Unsync(CFE_SB_PipeD_t *PipeDscPtr){
+
+    CFE_SB_PipeRing_t *NextPtr;
+    bool    Claimed;
+
+#ifdef CFE_SB_LOCKFREE_ROUTING
+    Claimed = __sync_bool_compare_and_swap(&PipeDscPtr->StandbyReady, 1, 0);
+#else
+    Claimed = (PipeDscPtr->StandbyReady != 0);
+    PipeDscPtr->StandbyReady = 0;
+#endif
+
+    CFE_SB_MEMORY_BARRIER();
+    if(PipeDscPtr->ReadGen != PipeDscPtr->WriteGen){
+        return false;
+    }/* end if */
+
+    NextPtr = CFE_SB_ELASTIC_RING(PipeDscPtr, PipeDscPtr->WriteGen + 1);
+    if(NextPtr->Slots != NULL){
+        if(!Claimed){
+            return false;
+        }/* end if */
+        CFE_SB_RingDelete_Unsync(NextPtr);
+    }/* end if */
+
+    if(CFE_SB_RingCreate_Unsync(NextPtr, PipeDscPtr->BaseDepth) != OS_SUCCESS){
+        return false;
+    }/* end if */
+
+    CFE_SB_ElasticHandover(PipeDscPtr);
+
+    return true;
+
+}/* end CFE_SB_ElasticShrink_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_UpdateElasticPipes()
+**
+**  Purpose:
+**    Called by the SB task while CFE_SB.ElasticPending is set, that is after
+**    the reader of an elastic pipe left a ring or a pipe was shrunk.  Steps
+**    every elastic pipe, see CFE_SB_ElasticStep_Unsync; the flag stays set
+**    while a pipe still waits for its reader.  Called without the shared
+**    data lock.
+**
+**  Arguments:
+**    None
+**
+**  Return:
+**    None
+*/
+void CFE_SB_UpdateElasticPipes(void){
+
+    CFE_SB_PipeD_t *PipeDscPtr;
+    uint32  i;
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    /* cleared first, so a reader leaving a ring meanwhile is not missed */
+    CFE_SB.ElasticPending = 0;
+    CFE_SB_MEMORY_BARRIER();
+
+    for(i = 0; i < CFE_PLATFORM_SB_MAX_PIPES; i++){
+
+        PipeDscPtr = &CFE_SB.PipeTbl[i];
+        if((PipeDscPtr->InUse != CFE_SB_IN_USE)||
+           ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_ELASTIC) == 0)){
+            continue;
+        }/* end if */
+
+        if(CFE_SB_ElasticStep_Unsync(PipeDscPtr)){
+            CFE_SB.ElasticPending = 1;
+        }/* end if */
+
+    }/* end for */
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+}/* end CFE_SB_UpdateElasticPipes */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_ShrinkElasticPipes()
+**
+**  Purpose:
+**    Called on every SB housekeeping request.  Steps each elastic pipe, see
+**    CFE_SB_ElasticStep_Unsync, and shrinks a pipe that has grown back to its
+**    base depth once it has not held more than its base depth for
+**    CFE_PLATFORM_SB_ELASTIC_QUIET_CYCLES requests in a row.  Called without
+**    the shared data lock.
+**
+**  Arguments:
+**    None
+**
+**  Return:
+**    None
+*/
+void CFE_SB_ShrinkElasticPipes(void){
+
+    CFE_SB_PipeD_t *PipeDscPtr;
+    uint32  Held;
+    uint32  i;
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    for(i = 0; i < CFE_PLATFORM_SB_MAX_PIPES; i++){
+
+        PipeDscPtr = &CFE_SB.PipeTbl[i];
+        if((PipeDscPtr->InUse != CFE_SB_IN_USE)||
+           ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_ELASTIC) == 0)){
+            continue;
+        }/* end if */
+
+        if(CFE_SB_ElasticStep_Unsync(PipeDscPtr)){
+            CFE_SB.ElasticPending = 1;
+        }/* end if */
+
+        if(PipeDscPtr->ElasticPeak <= PipeDscPtr->BaseDepth){
+            if(PipeDscPtr->QuietCycles < CFE_PLATFORM_SB_ELASTIC_QUIET_CYCLES){
+                PipeDscPtr->QuietCycles++;
+            }/* end if */
+        }else{
+            PipeDscPtr->QuietCycles = 0;
+        }/* end if */
+
+        /* the next period starts with what is still on the pipe */
+        Held = PipeDscPtr->Ring.Count + PipeDscPtr->AltRing.Count;
+        PipeDscPtr->ElasticPeak = (uint16)Held;
+
+        if((PipeDscPtr->QueueDepth > PipeDscPtr->BaseDepth)&&
+           (PipeDscPtr->QuietCycles >= CFE_PLATFORM_SB_ELASTIC_QUIET_CYCLES)&&
+           (Held <= PipeDscPtr->BaseDepth)&&
+           CFE_SB_ElasticShrink_Unsync(PipeDscPtr)){
+
+            PipeDscPtr->QuietCycles = 0;
+
+            /* an empty pipe leaves and releases the larger ring at once */
+            if(CFE_SB_ElasticStep_Unsync(PipeDscPtr)){
+                CFE_SB.ElasticPending = 1;
+            }/* end if */
+
+        }/* end if */
+
+    }/* end for */
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+}/* end CFE_SB_ShrinkElasticPipes */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_FindBcastTopic()
+**
+**  Purpose:
+**    Looks up the broadcast topic of a MsgId.  The caller must hold the
+**    shared data lock.
+**
+**  Arguments:
+**    MsgId      : Message Id of the topic
+**
+**  Return:
+**    Pointer to the topic, or NULL if the MsgId is not a broadcast topic
+**
+**  Notes:
+**    With CFE_SB_INVALID_MSG_ID a free entry is returned; an entry whose
+**    slots still wait for readers to leave is not free.
+*/
+CFE_SB_BcastTopic_t *CFE_SB_FindBcastTopic(CFE_SB_MsgId_t MsgId){
+
+    uint32  i;
+
+    for(i = 0; i < CFE_PLATFORM_SB_MAX_BCAST_TOPICS; i++){
+        if(CFE_SB_MsgId_Equal(CFE_SB.BcastTbl[i].MsgId, MsgId)&&
+           (CFE_SB.BcastTbl[i].RetiredSlots == NULL)){
+            return &CFE_SB.BcastTbl[i];
+        }/* end if */
+    }/* end for */
+
+    return NULL;
+
+}/* end CFE_SB_FindBcastTopic */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_BcastCreate_Unsync()
+**
+**  Purpose:
+**    Allocates the slots of a broadcast topic from the SB memory pool,
+**    rounded up to a power of two as for a ring.  The caller must hold the
+**    shared data lock.
+**
+**  Arguments:
+**    TopicPtr   : Pointer to the topic
+**    Depth      : Number of messages the topic must hold
+**
+**  Return:
+**    OS_SUCCESS or the CFE_ES_GetPoolBuf error
+*/
+int32 CFE_SB_BcastCreate_Unsync(CFE_SB_BcastTopic_t *TopicPtr, uint16 Depth){
+
+    int32   Status;
+    uint32  Capacity;
+    CFE_SB_BcastSlot_t *Slots = NULL;
+
+    Capacity = 1;
+    while(Capacity < Depth){
+        Capacity <<= 1;
+    }/* end while */
+
+    Status = CFE_ES_GetPoolBuf((uint32 **)&Slots, CFE_SB.Mem.PoolHdl,
+                               Capacity * sizeof(CFE_SB_BcastSlot_t));
+    if(Status < 0){
+        return Status;
+    }/* end if */
+
+    CFE_SB.StatTlmMsg.Payload.MemInUse+=Status;
+    if(CFE_SB.StatTlmMsg.Payload.MemInUse > CFE_SB.StatTlmMsg.Payload.PeakMemInUse){
+        CFE_SB.StatTlmMsg.Payload.PeakMemInUse = CFE_SB.StatTlmMsg.Payload.MemInUse;
+    }/* end if */
+
+    memset(Slots, 0, Capacity * sizeof(CFE_SB_BcastSlot_t));
+
+    TopicPtr->Mask    = Capacity - 1;
+    TopicPtr->Head    = 0;
+    TopicPtr->Retired = NULL;
+    TopicPtr->Slots   = Slots;
+
+    return OS_SUCCESS;
+
+}/* end CFE_SB_BcastCreate_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_BcastDelete_Unsync()
+**
+**  Purpose:
+**    Takes the slots away from a broadcast topic and frees the entry.  The
+**    slots and the messages they hold are released at once if no reader is
+**    in the topic, otherwise by the SB task once the last reader has left
+**    (see CFE_SB_UpdateBcastTopics).  A message a pipe has already read
+**    stays valid, the reader holds its own reference.  The caller must hold
+**    the shared data lock and must have taken the topic off its subscribers.
+**
+**  Arguments:
+**    TopicPtr   : Pointer to the topic
+**
+**  Return:
+**    None
+*/
+void CFE_SB_BcastDelete_Unsync(CFE_SB_BcastTopic_t *TopicPtr){
+
+    CFE_SB_BcastSlot_t *Slots = TopicPtr->Slots;
+
+    TopicPtr->MsgId = CFE_SB_INVALID_MSG_ID;
+
+    if(Slots == NULL){
+        return;
+    }/* end if */
+
+    /* a reader that comes in from here on finds no slots */
+    TopicPtr->Slots = NULL;
+    TopicPtr->RetiredSlots = Slots;
+    CFE_SB_MEMORY_BARRIER();
+
+    if(TopicPtr->Readers == 0){
+        CFE_SB_BcastRelease_Unsync(TopicPtr);
+    }else{
+        CFE_SB.BcastPending = 1;
+    }/* end if */
+
+}/* end CFE_SB_BcastDelete_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_BcastRelease_Unsync()
+**
+**  Purpose:
+**    Releases the messages held in the retired slots of a removed broadcast
+**    topic and returns the slots to the SB memory pool, which frees the
+**    entry for a new topic.  The caller must hold the shared data lock and
+**    must have seen no reader in the topic.
+**
+**  Arguments:
+**    TopicPtr   : Pointer to the topic
+**
+**  Return:
+**    None
+*/
+void CFE_SB_BcastRelease_Unsync(CFE_SB_BcastTopic_t *TopicPtr){
+
+    int32   Stat;
+    uint32  i;
+    CFE_SB_BcastSlot_t *Slots = TopicPtr->RetiredSlots;
+
+    for(i = 0; i <= TopicPtr->Mask; i++){
+        if(Slots[i].BufDscPtr != NULL){
+            CFE_SB_DecrBufUseCnt(Slots[i].BufDscPtr);
+        }/* end if */
+    }/* end for */
+
+    CFE_SB_BcastReclaim_Unsync(TopicPtr);
+
+    Stat = CFE_ES_PutPoolBuf(CFE_SB.Mem.PoolHdl, (uint32 *)Slots);
+    if(Stat > 0){
+        CFE_SB.StatTlmMsg.Payload.MemInUse-=Stat;
+    }/* end if */
+
+    TopicPtr->RetiredSlots = NULL;
+
+}/* end CFE_SB_BcastRelease_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_UpdateBcastTopics()
+**
+**  Purpose:
+**    Called by the SB task while CFE_SB.BcastPending is set, that is after
+**    a broadcast topic was removed while a reader was in it.  Releases the
+**    slots of every removed topic that no reader is in any more; the flag
+**    stays set while a topic still has a reader.  Called without the shared
+**    data lock.
+**
+**  Arguments:
+**    None
+**
+**  Return:
+**    None
+*/
+void CFE_SB_UpdateBcastTopics(void){
+
+    CFE_SB_BcastTopic_t *TopicPtr;
+    uint32  i;
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    CFE_SB.BcastPending = 0;
+
+    for(i = 0; i < CFE_PLATFORM_SB_MAX_BCAST_TOPICS; i++){
+
+        TopicPtr = &CFE_SB.BcastTbl[i];
+        if(TopicPtr->RetiredSlots == NULL){
+            continue;
+        }/* end if */
+
+        CFE_SB_MEMORY_BARRIER();
+        if(TopicPtr->Readers == 0){
+            CFE_SB_BcastRelease_Unsync(TopicPtr);
+        }else{
+            CFE_SB.BcastPending = 1;
+        }/* end if */
+
+    }/* end for */
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+}/* end CFE_SB_UpdateBcastTopics */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_BcastPut_Unsync()
+**
+**  Purpose:
+**    Stores a message in the broadcast topic of its route, taking over the
+**    reference of the sender; the oldest message of a full topic is
+**    released.  The message must already be in the buffer, since readers
+**    may take it as soon as it is stored.  Subscribers that are blocked on
+**    their pipe are returned to be woken by CFE_SB_BcastWake.  The caller
+**    must hold the shared data lock.
+**
+**  Arguments:
+**    RouteEntry : Pointer to the route, which must have a topic
+**    BufDscPtr  : Pointer to the buffer descriptor of the message
+**    WakeList   : Set to the pipes to wake, room for the max destinations
+**
+**  Return:
+**    Number of pipes in WakeList
+**
+**  Notes:
+**    The cost does not depend on the number of subscribers: only the pipes
+**    marked in the wait map of the topic are looked at.
+*/
+uint16 CFE_SB_BcastPut_Unsync(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_BufferD_t *BufDscPtr,
+                              CFE_SB_PipeId_t *WakeList){
+
+    CFE_SB_BcastTopic_t *TopicPtr = RouteEntry->Topic;
+    CFE_SB_BcastSlot_t *SlotPtr;
+    CFE_SB_BufferD_t *OldPtr;
+    CFE_SB_PipeD_t *PipeDscPtr;
+    uint32  Pos = TopicPtr->Head;
+    uint32  Bits;
+    uint32  w;
+    uint32  i;
+    uint16  NumWake = 0;
+
+    SlotPtr = &TopicPtr->Slots[Pos & TopicPtr->Mask];
+    OldPtr  = SlotPtr->BufDscPtr;
+
+    SlotPtr->Seq = (2 * Pos) + 1;
+    CFE_SB_MEMORY_BARRIER();
+    SlotPtr->BufDscPtr = BufDscPtr;
+    CFE_SB_MEMORY_BARRIER();
+    SlotPtr->Seq = (2 * Pos) + 2;
+
+    /* the slot is complete before the new head is published */
+    CFE_SB_MEMORY_BARRIER();
+    TopicPtr->Head = Pos + 1;
+
+    /* pairs with the barrier of a reader entering the topic or marking its wait */
+    CFE_SB_MEMORY_BARRIER();
+
+    /* a reader may still be taking the overwritten message */
+    if(OldPtr != NULL){
+        OldPtr->RetiredNext = TopicPtr->Retired;
+        TopicPtr->Retired = OldPtr;
+    }/* end if */
+
+    if(TopicPtr->Readers == 0){
+        CFE_SB_BcastReclaim_Unsync(TopicPtr);
+    }/* end if */
+
+    for(w = 0; w < CFE_SB_BCAST_WAIT_WORDS; w++){
+        Bits = TopicPtr->WaitMask[w];
+        for(i = 0; (Bits != 0) && (NumWake < CFE_PLATFORM_SB_MAX_DEST_PER_PKT); i++, Bits >>= 1){
+            if(Bits & 1){
+                /* the wakeup is posted after the lock is released */
+                PipeDscPtr = &CFE_SB.PipeTbl[(w * 32) + i];
+                CFE_SB_PendingPutBegin_Unsync(PipeDscPtr);
+                WakeList[NumWake++] = PipeDscPtr->PipeId;
+            }/* end if */
+        }/* end for */
+    }/* end for */
+
+    return NumWake;
+
+}/* end CFE_SB_BcastPut_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_BcastReclaim_Unsync()
+**
+**  Purpose:
+**    Releases the messages of a broadcast topic that were overwritten while
+**    readers were in the topic.  The caller must hold the shared data lock
+**    and must have seen no reader in the topic.
+**
+**  Arguments:
+**    TopicPtr   : Pointer to the topic
+**
+**  Return:
+**    None
+*/
+void CFE_SB_BcastReclaim_Unsync(CFE_SB_BcastTopic_t *TopicPtr){
+
+    CFE_SB_BufferD_t *BufDscPtr;
+
+    while(TopicPtr->Retired != NULL){
+        BufDscPtr = TopicPtr->Retired;
+        TopicPtr->Retired = BufDscPtr->RetiredNext;
+        BufDscPtr->RetiredNext = NULL;
+        CFE_SB_DecrBufUseCnt(BufDscPtr);
+    }/* end while */
+
+}/* end CFE_SB_BcastReclaim_Unsync */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_BcastWake()
+**
+**  Purpose:
+**    Wakes the pipes returned by CFE_SB_BcastPut_Unsync.  Called without the
+**    shared data lock.
+**
+**  Arguments:
+**    WakeList   : Pipes to wake
+**    Count      : Number of pipes in WakeList
+**
+**  Return:
+**    None
+*/
+void CFE_SB_BcastWake(const CFE_SB_PipeId_t *WakeList, uint16 Count){
+
+    uint16  i;
+
+    for(i = 0; i < Count; i++){
+        CFE_SB_QueueWake(&CFE_SB.PipeTbl[WakeList[i]]);
+        CFE_SB_PendingPutEnd(&CFE_SB.PipeTbl[WakeList[i]]);
+    }/* end for */
+
+}/* end CFE_SB_BcastWake */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_BcastGet()
+**
+**  Purpose:
+**    Reads the next message of the first broadcast topic of a pipe that
+**    holds one, taking a reference on the buffer.  A pipe that has fallen
+**    more than the topic depth behind skips to the oldest message still
+**    held; the skipped messages are counted as pipe overflows.  Called
+**    without the shared data lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**    EntryPtr   : Set to the queue entry for the message
+**
+**  Return:
+**    OS_SUCCESS or OS_QUEUE_EMPTY
+**
+**  Notes:
+**    Only the reader of the pipe moves its cursor, so the topic is read
+**    without the shared data lock where the toolchain provides atomics.
+**    The reader is counted in the topic while it reads, which keeps the
+**    messages it may find from being released (see CFE_SB_BcastPut_Unsync).
+**    A message overwritten while it was being read is counted as skipped.
+*/
+int32 CFE_SB_BcastGet(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_QueueEntry_t *EntryPtr){
+
+    CFE_SB_BcastTopic_t *TopicPtr;
+    CFE_SB_BcastSlot_t *Slots;
+    CFE_SB_BcastSlot_t *SlotPtr;
+    CFE_SB_BufferD_t *BufDscPtr;
+    uint32  Head;
+    uint32  Next;
+    uint32  Seq;
+    uint32  Skipped;
+    uint32  i;
+
+    for(i = 0; i < CFE_PLATFORM_SB_MAX_BCAST_TOPICS; i++){
+
+        if((PipeDscPtr->BcastMask & (1UL << i)) == 0){
+            continue;
+        }/* end if */
+
+        TopicPtr  = &CFE_SB.BcastTbl[i];
+        BufDscPtr = NULL;
+        Skipped   = 0;
+
+#ifdef CFE_SB_LOCKFREE_ROUTING
+        __sync_add_and_fetch(&TopicPtr->Readers, 1);
+#else
+        CFE_SB_LockSharedData(__func__,__LINE__);
+#endif
+
+        Slots = TopicPtr->Slots;
+        while(Slots != NULL){
+
+            Head = TopicPtr->Head;
+            CFE_SB_MEMORY_BARRIER();
+
+            Next = PipeDscPtr->BcastNext[i];
+            if(Head == Next){
+                break;
+            }/* end if */
+
+            if((Head - Next) > (TopicPtr->Mask + 1)){
+                Skipped += (Head - Next) - (TopicPtr->Mask + 1);
+                Next = Head - (TopicPtr->Mask + 1);
+            }/* end if */
+
+            SlotPtr = &Slots[Next & TopicPtr->Mask];
+            Seq = SlotPtr->Seq;
+            CFE_SB_MEMORY_BARRIER();
+            BufDscPtr = SlotPtr->BufDscPtr;
+            CFE_SB_MEMORY_BARRIER();
+
+            PipeDscPtr->BcastNext[i] = Next + 1;
+
+            if((Seq == (2 * Next) + 2) && (SlotPtr->Seq == Seq)){
+#ifdef CFE_SB_LOCKFREE_ROUTING
+                __sync_add_and_fetch(&BufDscPtr->UseCount, 1);
+#else
+                BufDscPtr->UseCount++;
+#endif
+                break;
+            }/* end if */
+
+            /* the writer came round to the slot, the message is gone */
+            Skipped++;
+            BufDscPtr = NULL;
+
+        }/* end while */
+
+#ifdef CFE_SB_LOCKFREE_ROUTING
+        __sync_sub_and_fetch(&TopicPtr->Readers, 1);
+
+        if(Skipped != 0){
+            CFE_SB_LockSharedData(__func__,__LINE__);
+        }/* end if */
+#endif
+
+        if(Skipped != 0){
+            CFE_SB.HKTlmMsg.Payload.PipeOverflowErrorCounter += (uint16)Skipped;
+            if(PipeDscPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE){
+                CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeDscPtr->PipeId].Overflows += (uint16)Skipped;
+            }/* end if */
+        }/* end if */
+
+#ifdef CFE_SB_LOCKFREE_ROUTING
+        if(Skipped != 0){
+            CFE_SB_UnlockSharedData(__func__,__LINE__);
+        }/* end if */
+#else
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+#endif
+
+        if(BufDscPtr != NULL){
+            EntryPtr->BufDscPtr = BufDscPtr;
+            EntryPtr->DestPtr   = NULL;
+            EntryPtr->DestGen   = 0;
+            EntryPtr->Lane      = CFE_SB_LANE_BCAST;
+
+            return OS_SUCCESS;
+        }/* end if */
+
+    }/* end for */
+
+    return OS_QUEUE_EMPTY;
+
+}/* end CFE_SB_BcastGet */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_BcastSetWaiting()
+**
+**  Purpose:
+**    Marks a pipe in the wait map of its broadcast topics before its reader
+**    blocks, or clears the marks after it woke up.  Called without the
+**    shared data lock.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**    Waiting    : true to mark the pipe, false to clear its marks
+**
+**  Return:
+**    None
+*/
+void CFE_SB_BcastSetWaiting(CFE_SB_PipeD_t *PipeDscPtr, bool Waiting){
+
+    CFE_SB_BcastTopic_t *TopicPtr;
+    uint32  Idx = (uint32)(PipeDscPtr - CFE_SB.PipeTbl);
+    uint32  Bit = 1UL << (Idx % 32);
+    uint32  i;
+
+#ifndef CFE_SB_LOCKFREE_ROUTING
+    CFE_SB_LockSharedData(__func__,__LINE__);
+#endif
+
+    for(i = 0; i < CFE_PLATFORM_SB_MAX_BCAST_TOPICS; i++){
+
+        TopicPtr = &CFE_SB.BcastTbl[i];
+
+        if(Waiting && (PipeDscPtr->BcastMask & (1UL << i))){
+#ifdef CFE_SB_LOCKFREE_ROUTING
+            __sync_fetch_and_or(&TopicPtr->WaitMask[Idx / 32], Bit);
+#else
+            TopicPtr->WaitMask[Idx / 32] |= Bit;
+#endif
+        }else if(!Waiting && (TopicPtr->WaitMask[Idx / 32] & Bit)){
+#ifdef CFE_SB_LOCKFREE_ROUTING
+            __sync_fetch_and_and(&TopicPtr->WaitMask[Idx / 32], ~Bit);
+#else
+            TopicPtr->WaitMask[Idx / 32] &= ~Bit;
+#endif
+        }/* end if */
+
+    }/* end for */
+
+#ifndef CFE_SB_LOCKFREE_ROUTING
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+#endif
+
+}/* end CFE_SB_BcastSetWaiting */
+
+/*****************************************************************************/
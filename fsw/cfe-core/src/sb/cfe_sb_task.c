@@ -64,6 +64,7 @@ CFE_SB_Qos_t            CFE_SB_Default_Qos;
 void CFE_SB_TaskMain(void)
 {
     int32  Status;
+    int32  TimeOut;
 
     CFE_ES_PerfLogEntry(CFE_MISSION_SB_MAIN_PERF_ID);
 
@@ -93,10 +94,25 @@ void CFE_SB_TaskMain(void)
 
         CFE_ES_PerfLogExit(CFE_MISSION_SB_MAIN_PERF_ID);
 
-        /* Pend on receipt of packet */
+        /*
+         * Pend on receipt of packet.  While an info file is being written
+         * the wait is limited to the step period, so the file is finished
+         * without holding off commands or spinning at the SB task priority.
+         * The same holds while an elastic pipe changes ring or a removed
+         * broadcast topic waits for its readers.
+         */
+        if(CFE_SB.Dump.Kind != CFE_SB_DUMP_IDLE)
+        {
+            TimeOut = CFE_SB_DUMP_STEP_MSEC;
+        }else if(CFE_SB.ElasticPending || CFE_SB.BcastPending){
+            TimeOut = CFE_SB_ELASTIC_STEP_MSEC;
+        }else{
+            TimeOut = CFE_SB_PEND_FOREVER;
+        }/* end if */
+
         Status = CFE_SB_RcvMsg(&CFE_SB.CmdPipePktPtr,
                                 CFE_SB.CmdPipe,
-                                CFE_SB_PEND_FOREVER);
+                                TimeOut);
 
         CFE_ES_PerfLogEntry(CFE_MISSION_SB_MAIN_PERF_ID);
 
@@ -104,10 +120,28 @@ void CFE_SB_TaskMain(void)
         {
             /* Process cmd pipe msg */
             CFE_SB_ProcessCmdPipePkt();
+        }else if(Status == CFE_SB_TIME_OUT){
+            Status = CFE_SUCCESS;
         }else{
             CFE_ES_WriteToSysLog("SB:Error reading cmd pipe,RC=0x%08X\n",(unsigned int)Status);
         }/* end if */
 
+        if(Status == CFE_SUCCESS)
+        {
+            /* Write the next part of an info file, if any */
+            CFE_SB_DumpFileStep();
+
+            /* Release and prepare the rings of elastic pipes */
+            if(CFE_SB.ElasticPending){
+                CFE_SB_UpdateElasticPipes();
+            }/* end if */
+
+            /* Release the slots of removed broadcast topics */
+            if(CFE_SB.BcastPending){
+                CFE_SB_UpdateBcastTopics();
+            }/* end if */
+        }/* end if */
+
     }/* end while */
 
     /* while loop exits only if CFE_SB_RcvMsg returns error */
@@ -457,6 +491,13 @@ void CFE_SB_ProcessCmdPipePkt(void) {
                 }
                 break;
 
+            case CFE_SB_SEND_LATENCY_STATS_CC:
+                if (CFE_SB_VerifyCmdLength(CFE_SB.CmdPipePktPtr, sizeof(CFE_SB_SendLatencyStats_t)))
+                {
+                    CFE_SB_SendLatencyStatsCmd((CFE_SB_SendLatencyStats_t *)CFE_SB.CmdPipePktPtr);
+                }
+                break;
+
             default:
                CFE_EVS_SendEvent(CFE_SB_BAD_CMD_CODE_EID,CFE_EVS_EventType_ERROR,
                      "Invalid Cmd, Unexpected Command Code %d",
@@ -543,7 +584,8 @@ int32 CFE_SB_DisableSubReportingCmd(const CFE_SB_DisableSubReporting_t *data)
 **  Function:  CFE_SB_SendHKTlmCmd()
 **
 **  Purpose:
-**    Function to send the SB housekeeping packet.
+**    Function to send the SB housekeeping packet.  Elastic pipes that have
+**    been quiet are shrunk on the same request.
 **
 **  Arguments:
 **    none
@@ -556,6 +598,10 @@ int32 CFE_SB_DisableSubReportingCmd(const CFE_SB_DisableSubReporting_t *data)
 */
 int32 CFE_SB_SendHKTlmCmd(const CFE_SB_CmdHdr_t *data)
 {
+    CFE_SB_ShrinkElasticPipes();
+
+    CFE_SB_SendErrReports();
+
     CFE_SB.HKTlmMsg.Payload.MemInUse        = CFE_SB.StatTlmMsg.Payload.MemInUse;
     CFE_SB.HKTlmMsg.Payload.UnmarkedMem     = CFE_PLATFORM_SB_BUF_MEMORY_BYTES - CFE_SB.StatTlmMsg.Payload.PeakMemInUse;
     
@@ -566,6 +612,87 @@ int32 CFE_SB_SendHKTlmCmd(const CFE_SB_CmdHdr_t *data)
 }/* end CFE_SB_SendHKTlmCmd */
 
 
+/******************************************************************************
+**  Function:  CFE_SB_SendErrReports()
+**
+**  Purpose:
+**    Sends one event for each MsgId, pipe and error recorded by the send
+**    path since the last call, with the number of occurrences.  Called from
+**    the SB task on each housekeeping request, which limits the event rate.
+**
+**  Arguments:
+**    none
+**
+**  Return:
+**    none
+*/
+void CFE_SB_SendErrReports(void)
+{
+    CFE_SB_SendErrRec_t Report[CFE_SB_SEND_ERR_TBL_SIZE];
+    uint32  NumReports = 0;
+    uint32  Lost;
+    uint32  i;
+    char    PipeName[OS_MAX_API_NAME];
+    char    FullName[(OS_MAX_API_NAME * 2)];
+
+    /* take a copy and free the records so the senders can use them again */
+    CFE_SB_LockSharedData(__func__,__LINE__);
+    for(i = 0; i < CFE_SB_SEND_ERR_TBL_SIZE; i++){
+        if(CFE_SB.SendErrTbl[i].Count != 0){
+            Report[NumReports] = CFE_SB.SendErrTbl[i];
+            NumReports++;
+            CFE_SB.SendErrTbl[i].Count = 0;
+        }/* end if */
+    }/* end for */
+    Lost = CFE_SB.SendErrsLost;
+    CFE_SB.SendErrsLost = 0;
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    for(i = 0; i < NumReports; i++){
+
+        CFE_SB_GetPipeName(PipeName, sizeof(PipeName), Report[i].PipeId);
+
+        if(Report[i].EventId == CFE_SB_MSGID_LIM_ERR_EID){
+
+            CFE_ES_PerfLogEntry(CFE_MISSION_SB_MSG_LIM_PERF_ID);
+            CFE_ES_PerfLogExit(CFE_MISSION_SB_MSG_LIM_PERF_ID);
+
+            CFE_EVS_SendEventWithAppID(CFE_SB_MSGID_LIM_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+                "Msg Limit Err,MsgId 0x%x,pipe %s,sender %s,count %u",
+                (unsigned int)CFE_SB_MsgIdToValue(Report[i].MsgId),
+                PipeName, CFE_SB_GetAppTskName(Report[i].TskId,FullName),
+                (unsigned int)Report[i].Count);
+
+        }else if(Report[i].EventId == CFE_SB_Q_FULL_ERR_EID){
+
+            CFE_ES_PerfLogEntry(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
+            CFE_ES_PerfLogExit(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
+
+            CFE_EVS_SendEventWithAppID(CFE_SB_Q_FULL_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+                "Pipe Overflow,MsgId 0x%x,pipe %s,sender %s,count %u",
+                (unsigned int)CFE_SB_MsgIdToValue(Report[i].MsgId),
+                PipeName, CFE_SB_GetAppTskName(Report[i].TskId,FullName),
+                (unsigned int)Report[i].Count);
+
+        }else{
+
+            CFE_EVS_SendEventWithAppID(CFE_SB_Q_WR_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+                "Pipe Write Err,MsgId 0x%x,pipe %s,sender %s,stat 0x%x,count %u",
+                (unsigned int)CFE_SB_MsgIdToValue(Report[i].MsgId),
+                PipeName, CFE_SB_GetAppTskName(Report[i].TskId,FullName),
+                (unsigned int)Report[i].ErrStat, (unsigned int)Report[i].Count);
+
+        }/* end if */
+    }/* end for */
+
+    if(Lost != 0){
+        CFE_ES_WriteToSysLog("SB:%u pipe errors not reported, send error table full\n",
+                             (unsigned int)Lost);
+    }/* end if */
+
+}/* end CFE_SB_SendErrReports */
+
+
 /******************************************************************************
 **  Function:  CFE_SB_ResetCounters()
 **
@@ -753,6 +880,80 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStats_t *data)
 }/* CFE_SB_SendStatsCmd */
 
 
+/******************************************************************************
+**  Function:  CFE_SB_SendLatencyStatsCmd()
+**
+**  Purpose:
+**    SB internal function to send the latency histograms of a pipe and,
+**    when they are kept, of a MsgId
+**
+**  Arguments:
+**    MsgPtr  : pointer to the message
+**
+**  Return:
+**    None
+*/
+int32 CFE_SB_SendLatencyStatsCmd(const CFE_SB_SendLatencyStats_t *data)
+{
+    CFE_SB_MsgId_t          MsgId;
+    CFE_SB_PipeId_t         PipeId;
+    CFE_SB_LatencyTlm_Payload_t *TlmPtr;
+    const CFE_SB_RouteCmd_Payload_t      *CmdPtr;
+#ifdef CFE_PLATFORM_SB_MSGID_LATENCY_HIST
+    CFE_SB_MsgRouteIdx_t    RouteIdx;
+#endif
+
+    CmdPtr = &data->Payload;
+    TlmPtr = &CFE_SB.LatencyTlmMsg.Payload;
+
+    MsgId  = CmdPtr->MsgId;
+    PipeId = CmdPtr->Pipe;
+
+    /* check cmd parameters */
+    if(CFE_SB_ValidatePipeId(PipeId) != CFE_SUCCESS){
+        CFE_EVS_SendEvent(CFE_SB_SND_LATENCY_ERR_EID,CFE_EVS_EventType_ERROR,
+                      "Send Latency Stats Cmd:Invalid Param,Pipe %d",(int)PipeId);
+        CFE_SB.HKTlmMsg.Payload.CommandErrorCounter++;
+        /*
+         * returning "success" here as there is no other recourse;
+         * the full extent of the error recovery has been done
+         */
+       return CFE_SUCCESS;
+    }/* end if */
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    TlmPtr->MsgId      = MsgId;
+    TlmPtr->PipeId     = PipeId;
+    TlmPtr->MsgIdValid = 0;
+    TlmPtr->PipeHist   = CFE_SB.PipeTbl[PipeId].Latency;
+    memset(&TlmPtr->MsgIdHist, 0, sizeof(TlmPtr->MsgIdHist));
+
+#ifdef CFE_PLATFORM_SB_MSGID_LATENCY_HIST
+    if(CFE_SB_IsValidMsgId(MsgId)){
+        RouteIdx = CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(MsgId));
+        if(CFE_SB_IsValidRouteIdx(RouteIdx)){
+            TlmPtr->MsgIdHist  = CFE_SB_GetRoutePtrFromIdx(RouteIdx)->Latency;
+            TlmPtr->MsgIdValid = 1;
+        }/* end if */
+    }/* end if */
+#endif
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &CFE_SB.LatencyTlmMsg);
+    CFE_SB_SendMsg((CFE_SB_Msg_t *)&CFE_SB.LatencyTlmMsg);
+
+    CFE_EVS_SendEvent(CFE_SB_SND_LATENCY_EID,CFE_EVS_EventType_DEBUG,
+                      "Latency statistics packet sent,Msg 0x%x,Pipe %d",
+                      (unsigned int)CFE_SB_MsgIdToValue(MsgId),(int)PipeId);
+
+    CFE_SB.HKTlmMsg.Payload.CommandCounter++;
+
+    return CFE_SUCCESS;
+}/* end CFE_SB_SendLatencyStatsCmd */
+
+
 /******************************************************************************
 **  Function:  CFE_SB_SendRoutingInfoCmd()
 **
@@ -848,39 +1049,107 @@ int32 CFE_SB_SendMapInfoCmd(const CFE_SB_SendMapInfo_t *data)
 **  Function:  CFE_SB_SendRoutingInfo()
 **
 **  Purpose:
-**    SB internal function to write the routing information to a file
+**    SB internal function to start writing the routing information to a file
 **
 **  Arguments:
 **    Pointer to a filename
 **
 **  Return:
-**    CFE_SB_FILE_IO_ERR for file I/O errors or CFE_SUCCESS
+**    CFE_SB_FILE_IO_ERR for file I/O errors or if another file is still being
+**    written, otherwise CFE_SUCCESS
 */
 int32 CFE_SB_SendRtgInfo(const char *Filename)
 {
-    CFE_SB_MsgRouteIdx_t        RtgTblIdx;
-    const CFE_SB_RouteEntry_t*  RtgTblPtr;
-    CFE_SB_MsgKey_Atom_t        MsgKeyVal;
-    osal_id_t                   fd;
-    int32                       Status;
-    uint32                      FileSize = 0;
-    uint32                      EntryCount = 0;
-    CFE_SB_RoutingFileEntry_t   Entry;
-    CFE_FS_Header_t             FileHdr;
-    CFE_SB_PipeD_t              *pd; 
-    CFE_SB_DestinationD_t       *DestPtr;
-
-    Status = OS_OpenCreate(&fd, Filename,
-            OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+    return CFE_SB_StartDump(CFE_SB_DUMP_ROUTING, Filename,
+                            "SB Routing Information", CFE_FS_SubType_SB_ROUTEDATA);
+
+}/* end CFE_SB_SendRtgInfo */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_SendPipeInfo()
+**
+**  Purpose:
+**    SB internal function to start writing the Pipe table to a file
+**
+**  Arguments:
+**    Pointer to a filename
+**
+**  Return:
+**    CFE_SB_FILE_IO_ERR for file I/O errors or if another file is still being
+**    written, otherwise CFE_SUCCESS
+*/
+int32 CFE_SB_SendPipeInfo(const char *Filename)
+{
+    return CFE_SB_StartDump(CFE_SB_DUMP_PIPES, Filename,
+                            "SB Pipe Information", CFE_FS_SubType_SB_PIPEDATA);
+
+}/* end CFE_SB_SendPipeInfo */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_SendMapInfo()
+**
+**  Purpose:
+**    SB internal function to start writing the Message Map to a file
+**
+**  Arguments:
+**    Pointer to a filename
+**
+**  Return:
+**    CFE_SB_FILE_IO_ERR for file I/O errors or if another file is still being
+**    written, otherwise CFE_SUCCESS
+*/
+int32 CFE_SB_SendMapInfo(const char *Filename)
+{
+    return CFE_SB_StartDump(CFE_SB_DUMP_MAP, Filename,
+                            "SB Message Map Information", CFE_FS_SubType_SB_MAPDATA);
+
+}/* end CFE_SB_SendMapInfo */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_StartDump()
+**
+**  Purpose:
+**    SB internal function to create an info file and write its header.  The
+**    entries are written by the SB task in later steps, see
+**    CFE_SB_DumpFileStep.
+**
+**  Arguments:
+**    Kind        : CFE_SB_DUMP_ROUTING, CFE_SB_DUMP_PIPES or CFE_SB_DUMP_MAP
+**    Filename    : Pointer to a filename
+**    Description : Description for the cFE file header
+**    SubType     : Subtype for the cFE file header
+**
+**  Return:
+**    CFE_SB_FILE_IO_ERR for file I/O errors or if another file is still being
+**    written, otherwise CFE_SUCCESS
+*/
+int32 CFE_SB_StartDump(uint8 Kind, const char *Filename, const char *Description, uint32 SubType)
+{
+    osal_id_t       fd;
+    int32           Status;
+    CFE_FS_Header_t FileHdr;
+
+    if(CFE_SB.Dump.Kind != CFE_SB_DUMP_IDLE){
+        CFE_EVS_SendEvent(CFE_SB_SND_RTG_BUSY_EID,CFE_EVS_EventType_ERROR,
+                          "%s not written, %s is still being written",
+                          Filename,CFE_SB.Dump.Filename);
+        return CFE_SB_FILE_IO_ERR;
+    }/* end if */
+
+    Status = OS_OpenCreate(&fd, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+
     if(Status < OS_SUCCESS){
         CFE_EVS_SendEvent(CFE_SB_SND_RTG_ERR1_EID,CFE_EVS_EventType_ERROR,
-                      "Error creating file %s, stat=0x%x",
-                      Filename,(unsigned int)Status);
+                          "Error creating file %s, stat=0x%x",
+                           Filename,(unsigned int)Status);
         return CFE_SB_FILE_IO_ERR;
     }/* end if */
 
     /* clear out the cfe file header fields, then populate description and subtype */
-    CFE_FS_InitHeader(&FileHdr, "SB Routing Information", CFE_FS_SubType_SB_ROUTEDATA);
+    CFE_FS_InitHeader(&FileHdr, Description, SubType);
 
     Status = CFE_FS_WriteHeader(fd, &FileHdr);
     if(Status != sizeof(CFE_FS_Header_t)){
@@ -889,227 +1158,304 @@ int32 CFE_SB_SendRtgInfo(const char *Filename)
         return CFE_SB_FILE_IO_ERR;
     }/* end if */
 
-    FileSize = Status;
+    CFE_SB.Dump.Kind       = Kind;
+    CFE_SB.Dump.FileDesc   = fd;
+    CFE_SB.Dump.Cursor     = 0;
+    CFE_SB.Dump.FileSize   = Status;
+    CFE_SB.Dump.EntryCount = 0;
+    strncpy(CFE_SB.Dump.Filename, Filename, sizeof(CFE_SB.Dump.Filename) - 1);
+    CFE_SB.Dump.Filename[sizeof(CFE_SB.Dump.Filename) - 1] = '\0';
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_StartDump */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_DumpFileStep()
+**
+**  Purpose:
+**    SB internal function to write the next part of the info file being
+**    written.  The file is closed after its last entries are written or on
+**    a write error; its completion is reported by event.
+**
+**  Arguments:
+**    None
+**
+**  Return:
+**    true if the file still has entries to be written, otherwise false
+*/
+bool CFE_SB_DumpFileStep(void)
+{
+    int32  Status;
+    bool   Done = false;
 
-    /* loop through the entire MsgMap */
-    for(MsgKeyVal=0; MsgKeyVal < CFE_SB_MAX_NUMBER_OF_MSG_KEYS; ++MsgKeyVal)
+    switch(CFE_SB.Dump.Kind)
     {
-        RtgTblIdx = CFE_SB.MsgMap[MsgKeyVal];
+        case CFE_SB_DUMP_ROUTING:
+            Status = CFE_SB_RtgInfoStep(&Done);
+            break;
+
+        case CFE_SB_DUMP_PIPES:
+            Status = CFE_SB_PipeInfoStep(&Done);
+            break;
+
+        case CFE_SB_DUMP_MAP:
+            Status = CFE_SB_MapInfoStep(&Done);
+            break;
+
+        default:
+            return false;
+    }/* end switch */
+
+    if((Status != CFE_SUCCESS) || Done){
+
+        OS_close(CFE_SB.Dump.FileDesc);
+        CFE_SB.Dump.Kind = CFE_SB_DUMP_IDLE;
+
+        if(Status == CFE_SUCCESS){
+            CFE_EVS_SendEvent(CFE_SB_SND_RTG_EID,CFE_EVS_EventType_DEBUG,
+                              "%s written:Size=%d,Entries=%d",
+                              CFE_SB.Dump.Filename,(int)CFE_SB.Dump.FileSize,
+                              (int)CFE_SB.Dump.EntryCount);
+        }/* end if */
+
+        return false;
+    }/* end if */
+
+    return true;
+
+}/* end CFE_SB_DumpFileStep */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_RtgInfoStep()
+**
+**  Purpose:
+**    SB internal function to write the destinations of the next routes to
+**    the routing info file
+**
+**  Arguments:
+**    Done : Set to true once the last route has been written
+**
+**  Return:
+**    CFE_SB_FILE_IO_ERR for file I/O errors or CFE_SUCCESS
+*/
+int32 CFE_SB_RtgInfoStep(bool *Done)
+{
+    CFE_SB_RoutingFileEntry_t  *Entry = CFE_SB.Dump.Snapshot.Rtg.Entry;
+    CFE_ES_ResourceID_t        *AppId = CFE_SB.Dump.Snapshot.Rtg.AppId;
+    CFE_SB_MsgRouteIdx_t        RtgTblIdx;
+    const CFE_SB_RouteEntry_t  *RtgTblPtr;
+    const CFE_SB_DestinationD_t *DestPtr;
+    CFE_SB_PipeD_t             *pd;
+    uint32                      SlotIdx;
+    uint32                      SlotEnd;
+    uint32                      Count = 0;
+    uint32                      i;
+    uint16                      DestIdx;
+
+    SlotIdx = CFE_SB.Dump.Cursor;
+    SlotEnd = SlotIdx + CFE_SB_DUMP_SLOTS_PER_STEP;
+    if(SlotEnd > CFE_SB_MSGMAP_SIZE){
+        SlotEnd = CFE_SB_MSGMAP_SIZE;
+    }/* end if */
+
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    for( ; SlotIdx < SlotEnd; ++SlotIdx)
+    {
+        RtgTblIdx = CFE_SB_GetMsgMapEntry(SlotIdx);
 
         /* Only process table entry if it is used. */
         if(!CFE_SB_IsValidRouteIdx(RtgTblIdx))
         {
-            DestPtr = NULL;
-            RtgTblPtr = NULL;
-        } 
-        else 
+            continue;
+        }
+
+        RtgTblPtr = CFE_SB_GetRoutePtrFromIdx(RtgTblIdx);
+
+        /* leave the route to the next step if its destinations do not fit */
+        if((Count + RtgTblPtr->Destinations) > CFE_SB_DUMP_ENTRIES_PER_STEP)
         {
-            RtgTblPtr = CFE_SB_GetRoutePtrFromIdx(RtgTblIdx);
-            DestPtr = RtgTblPtr->ListHeadPtr;
+            break;
         }
 
-        while(DestPtr != NULL){
+        for(DestIdx = 0; DestIdx < RtgTblPtr->Destinations; DestIdx++){
 
+            DestPtr = &RtgTblPtr->DestArray[DestIdx];
             pd = CFE_SB_GetPipePtr(DestPtr -> PipeId);
             /* If invalid id, continue on to next entry */
             if (pd != NULL) {
-            
-                Entry.MsgId     = RtgTblPtr->MsgId;
-                Entry.PipeId    = DestPtr -> PipeId;
-                Entry.State     = DestPtr -> Active;
-                Entry.MsgCnt    = DestPtr -> DestCnt;               
-            
-                Entry.AppName[0] = 0;
-                /* 
-                 * NOTE: as long as CFE_ES_GetAppName() returns success, then it 
-                 * guarantees null termination of the output.  Return code is not
-                 * checked here (bad) but in case of error it does not seem to touch
-                 * the buffer, therefore the initialization above will protect for now 
-                 */
-                CFE_ES_GetAppName(&Entry.AppName[0], pd->AppId, sizeof(Entry.AppName));
-                CFE_SB_GetPipeName(Entry.PipeName, sizeof(Entry.PipeName), Entry.PipeId);
-
-                Status = OS_write (fd, &Entry, sizeof(CFE_SB_RoutingFileEntry_t));
-                if(Status != sizeof(CFE_SB_RoutingFileEntry_t)){
-                    CFE_SB_FileWriteByteCntErr(Filename,
-                                           sizeof(CFE_SB_RoutingFileEntry_t),
-                                           Status);
-                    OS_close(fd);
-                    return CFE_SB_FILE_IO_ERR;
-                }/* end if */
 
-                FileSize += Status;
-                EntryCount ++;
+                Entry[Count].MsgId     = RtgTblPtr->MsgId;
+                Entry[Count].PipeId    = DestPtr -> PipeId;
+                Entry[Count].State     = DestPtr -> Active;
+                Entry[Count].MsgCnt    = DestPtr -> DestCnt;
+                Entry[Count].SkipCnt   = DestPtr -> SkipCnt;
+                AppId[Count]           = pd->AppId;
+                Count++;
             }
-            
-            DestPtr = DestPtr->Next;
 
-        }/* end while */
+        }/* end for */
 
     }/* end for */
 
-    OS_close(fd);
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
 
-    CFE_EVS_SendEvent(CFE_SB_SND_RTG_EID,CFE_EVS_EventType_DEBUG,
-                      "%s written:Size=%d,Entries=%d",
-                      Filename,(int)FileSize,(int)EntryCount);
+    CFE_SB.Dump.Cursor = SlotIdx;
+    *Done = (SlotIdx >= CFE_SB_MSGMAP_SIZE);
 
-    return CFE_SUCCESS;
+    /* the names are looked up without the lock, CFE_SB_GetPipeName takes it */
+    for(i = 0; i < Count; i++){
 
-}/* end CFE_SB_SendRtgInfo */
+        Entry[i].AppName[0] = 0;
+        Entry[i].PipeName[0] = 0;
+        /*
+         * NOTE: as long as CFE_ES_GetAppName() returns success, then it
+         * guarantees null termination of the output.  Return code is not
+         * checked here (bad) but in case of error it does not seem to touch
+         * the buffer, therefore the initialization above will protect for now
+         */
+        CFE_ES_GetAppName(&Entry[i].AppName[0], AppId[i], sizeof(Entry[i].AppName));
+        CFE_SB_GetPipeName(Entry[i].PipeName, sizeof(Entry[i].PipeName), Entry[i].PipeId);
+
+    }/* end for */
+
+    return CFE_SB_DumpWrite(Entry, sizeof(CFE_SB_RoutingFileEntry_t), Count);
+
+}/* end CFE_SB_RtgInfoStep */
 
 
 /******************************************************************************
-**  Function:  CFE_SB_SendPipeInfo()
+**  Function:  CFE_SB_PipeInfoStep()
 **
 **  Purpose:
-**    SB internal function to write the Pipe table to a file
+**    SB internal function to write the next pipes to the pipe info file
 **
 **  Arguments:
-**    Pointer to a filename
+**    Done : Set to true once the last pipe has been written
 **
 **  Return:
 **    CFE_SB_FILE_IO_ERR for file I/O errors or CFE_SUCCESS
 */
-int32 CFE_SB_SendPipeInfo(const char *Filename)
+int32 CFE_SB_PipeInfoStep(bool *Done)
 {
-    uint16 i;
-    osal_id_t  fd;
-    int32  Status;
-    uint32 FileSize = 0;
-    uint32 EntryCount = 0;
-    CFE_FS_Header_t FileHdr;
+    uint32 i;
+    uint32 Count = 0;
 
-    Status = OS_OpenCreate(&fd, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
-
-    if(Status < OS_SUCCESS){
-        CFE_EVS_SendEvent(CFE_SB_SND_RTG_ERR1_EID,CFE_EVS_EventType_ERROR,
-                          "Error creating file %s, stat=0x%x",
-                           Filename,(unsigned int)Status);
-        return CFE_SB_FILE_IO_ERR;
-    }/* end if */
-
-    /* clear out the cfe file header fields, then populate description and subtype */
-    CFE_FS_InitHeader(&FileHdr, "SB Pipe Information", CFE_FS_SubType_SB_PIPEDATA);
-    
-    Status = CFE_FS_WriteHeader(fd, &FileHdr);
-    if(Status != sizeof(CFE_FS_Header_t)){
-        CFE_SB_FileWriteByteCntErr(Filename,sizeof(CFE_FS_Header_t),Status);
-        OS_close(fd);
-        return CFE_SB_FILE_IO_ERR;
-    }/* end if */
-
-    FileSize = Status;
+    CFE_SB_LockSharedData(__func__,__LINE__);
 
-    /* loop through the pipe table */
-    for(i=0;i<CFE_PLATFORM_SB_MAX_PIPES;i++){
+    for(i = CFE_SB.Dump.Cursor;
+        (i < CFE_PLATFORM_SB_MAX_PIPES) && (Count < CFE_SB_DUMP_PIPES_PER_STEP); i++){
 
         if(CFE_SB.PipeTbl[i].InUse==CFE_SB_IN_USE){
-
-            Status = OS_write (fd, &(CFE_SB.PipeTbl[i]), sizeof(CFE_SB_PipeD_t));
-            if(Status != sizeof(CFE_SB_PipeD_t)){
-                CFE_SB_FileWriteByteCntErr(Filename,sizeof(CFE_SB_PipeD_t),Status);
-                OS_close(fd);
-                return CFE_SB_FILE_IO_ERR;
-            }/* end if */
-
-            FileSize += Status;
-            EntryCount ++;
-
+            CFE_SB.Dump.Snapshot.Pipe[Count] = CFE_SB.PipeTbl[i];
+            Count++;
         }/* end if */
 
     }/* end for */
 
-    OS_close(fd);
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
 
-    CFE_EVS_SendEvent(CFE_SB_SND_RTG_EID,CFE_EVS_EventType_DEBUG,
-                      "%s written:Size=%d,Entries=%d",
-                       Filename,(int)FileSize,(int)EntryCount);
+    CFE_SB.Dump.Cursor = i;
+    *Done = (i >= CFE_PLATFORM_SB_MAX_PIPES);
 
-    return CFE_SUCCESS;
+    return CFE_SB_DumpWrite(CFE_SB.Dump.Snapshot.Pipe, sizeof(CFE_SB_PipeD_t), Count);
 
-}/* end CFE_SB_SendPipeInfo */
+}/* end CFE_SB_PipeInfoStep */
 
 
 /******************************************************************************
-**  Function:  CFE_SB_SendMapInfo()
+**  Function:  CFE_SB_MapInfoStep()
 **
 **  Purpose:
-**    SB internal function to write the Message Map to a file
+**    SB internal function to write the next MsgMap entries to the map info
+**    file
 **
 **  Arguments:
-**    Pointer to a filename
+**    Done : Set to true once the last MsgMap entry has been written
 **
 **  Return:
 **    CFE_SB_FILE_IO_ERR for file I/O errors or CFE_SUCCESS
 */
-int32 CFE_SB_SendMapInfo(const char *Filename)
+int32 CFE_SB_MapInfoStep(bool *Done)
 {
-    const CFE_SB_RouteEntry_t*  RtgTblPtr;
+    CFE_SB_MsgMapFileEntry_t   *Entry = CFE_SB.Dump.Snapshot.Map;
+    const CFE_SB_RouteEntry_t  *RtgTblPtr;
     CFE_SB_MsgRouteIdx_t        RtgTblIdx;
-    CFE_SB_MsgKey_Atom_t        MsgKeyVal;
-    osal_id_t  fd;
-    int32  Status;
-    uint32 FileSize = 0;
-    uint32 EntryCount = 0;
-    CFE_SB_MsgMapFileEntry_t Entry;
-    CFE_FS_Header_t FileHdr;
-
-    Status = OS_OpenCreate(&fd, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
-
-    if (Status < OS_SUCCESS){
-        CFE_EVS_SendEvent(CFE_SB_SND_RTG_ERR1_EID,CFE_EVS_EventType_ERROR,
-                          "Error creating file %s, stat=0x%x",
-                           Filename,(unsigned int)Status);
-        return CFE_SB_FILE_IO_ERR;
-    }/* end if */
-
-    /* clear out the cfe file header fields, then populate description and subtype */
-    CFE_FS_InitHeader(&FileHdr, "SB Message Map Information", CFE_FS_SubType_SB_MAPDATA);
-
-    Status = CFE_FS_WriteHeader(fd, &FileHdr);
-    if(Status != sizeof(CFE_FS_Header_t)){
-        CFE_SB_FileWriteByteCntErr(Filename,sizeof(CFE_FS_Header_t),Status);
-        OS_close(fd);
-        return CFE_SB_FILE_IO_ERR;
+    uint32                      SlotIdx;
+    uint32                      SlotEnd;
+    uint32                      Count = 0;
+
+    SlotIdx = CFE_SB.Dump.Cursor;
+    SlotEnd = SlotIdx + CFE_SB_DUMP_SLOTS_PER_STEP;
+    if(SlotEnd > CFE_SB_MSGMAP_SIZE){
+        SlotEnd = CFE_SB_MSGMAP_SIZE;
     }/* end if */
 
-    FileSize = Status;
+    CFE_SB_LockSharedData(__func__,__LINE__);
 
-    /* loop through the entire MsgMap */
-    for(MsgKeyVal=0; MsgKeyVal < CFE_SB_MAX_NUMBER_OF_MSG_KEYS; ++MsgKeyVal)
+    for( ; (SlotIdx < SlotEnd) && (Count < CFE_SB_DUMP_ENTRIES_PER_STEP); ++SlotIdx)
     {
-        RtgTblIdx = CFE_SB_GetRoutingTblIdx(CFE_SB_ValueToMsgKey(MsgKeyVal));
+        RtgTblIdx = CFE_SB_GetMsgMapEntry(SlotIdx);
 
         if(CFE_SB_IsValidRouteIdx(RtgTblIdx))
         {
             RtgTblPtr = CFE_SB_GetRoutePtrFromIdx(RtgTblIdx);
 
-            Entry.MsgId = RtgTblPtr->MsgId;
-            Entry.Index = CFE_SB_RouteIdxToValue(RtgTblIdx);
+            Entry[Count].MsgId = RtgTblPtr->MsgId;
+            Entry[Count].Index = CFE_SB_RouteIdxToValue(RtgTblIdx);
+            Count++;
 
-            Status = OS_write (fd, &Entry, sizeof(CFE_SB_MsgMapFileEntry_t));
-            if(Status != sizeof(CFE_SB_MsgMapFileEntry_t)){
-                CFE_SB_FileWriteByteCntErr(Filename,sizeof(CFE_SB_MsgMapFileEntry_t),Status);
-                OS_close(fd);
-                return CFE_SB_FILE_IO_ERR;
-            }/* end if */
+        }/* end if */
+    }/* end for */
 
-            FileSize += Status;
-            EntryCount ++;
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
 
-        }/* end for */
-    }/* end for */
+    CFE_SB.Dump.Cursor = SlotIdx;
+    *Done = (SlotIdx >= CFE_SB_MSGMAP_SIZE);
+
+    return CFE_SB_DumpWrite(Entry, sizeof(CFE_SB_MsgMapFileEntry_t), Count);
+
+}/* end CFE_SB_MapInfoStep */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_DumpWrite()
+**
+**  Purpose:
+**    SB internal function to write the entries of one step to the info file
+**
+**  Arguments:
+**    Entries   : Pointer to the entries
+**    EntrySize : Size of one entry
+**    Count     : Number of entries
+**
+**  Return:
+**    CFE_SB_FILE_IO_ERR for file I/O errors or CFE_SUCCESS
+*/
+int32 CFE_SB_DumpWrite(const void *Entries, uint32 EntrySize, uint32 Count)
+{
+    int32  Status;
+    uint32 Size = EntrySize * Count;
 
-    OS_close(fd);
+    if(Count == 0){
+        return CFE_SUCCESS;
+    }/* end if */
 
-    CFE_EVS_SendEvent(CFE_SB_SND_RTG_EID,CFE_EVS_EventType_DEBUG,
-                      "%s written:Size=%d,Entries=%d",
-                      Filename,(int)FileSize,(int)EntryCount);
+    Status = OS_write(CFE_SB.Dump.FileDesc, Entries, Size);
+    if(Status != Size){
+        CFE_SB_FileWriteByteCntErr(CFE_SB.Dump.Filename,Size,Status);
+        return CFE_SB_FILE_IO_ERR;
+    }/* end if */
+
+    CFE_SB.Dump.FileSize += Status;
+    CFE_SB.Dump.EntryCount += Count;
 
     return CFE_SUCCESS;
 
-}/* end CFE_SB_SendMapInfo */
+}/* end CFE_SB_DumpWrite */
 
 
 
@@ -1134,7 +1480,9 @@ int32 CFE_SB_SendPrevSubsCmd(const CFE_SB_SendPrevSubs_t *data)
   uint32 EntryNum = 0;
   uint32 SegNum = 1;
   int32  Stat;
-  CFE_SB_DestinationD_t *DestPtr = NULL;
+  const CFE_SB_DestinationD_t *DestPtr = NULL;
+  uint16 DestIdx;
+  uint16 NumDests;
 
   /* Take semaphore to ensure data does not change during this function */
   CFE_SB_LockSharedData(__func__,__LINE__);
@@ -1145,14 +1493,16 @@ int32 CFE_SB_SendPrevSubsCmd(const CFE_SB_SendPrevSubs_t *data)
       RoutePtr = CFE_SB_GetRoutePtrFromIdx(CFE_SB_ValueToRouteIdx(i));
       if(!CFE_SB_IsValidMsgId(RoutePtr->MsgId))
       {
-          DestPtr = NULL;
+          NumDests = 0;
       }
       else
       {
-          DestPtr = CFE_SB.RoutingTbl[i].ListHeadPtr;
+          NumDests = RoutePtr->Destinations;
       }
         
-        while(DestPtr != NULL){
+        for(DestIdx = 0; DestIdx < NumDests; DestIdx++){
+
+            DestPtr = &RoutePtr->DestArray[DestIdx];
 
             if(DestPtr->Scope == CFE_SB_GLOBAL){
             
@@ -1182,11 +1532,8 @@ int32 CFE_SB_SendPrevSubsCmd(const CFE_SB_SendPrevSubs_t *data)
                 break;
                 
             }/* end if */
-            
-            /* Check next destination (if another exists) for global scope */
-            DestPtr = DestPtr -> Next;
         
-        }/* end while */
+        }/* end for */
   
   }/* end for */ 
 
@@ -1229,33 +1576,32 @@ uint32 CFE_SB_FindGlobalMsgIdCnt(void){
     CFE_SB_MsgRouteIdx_Atom_t i;
     uint32 cnt = 0;
     const CFE_SB_RouteEntry_t* RoutePtr;
-    CFE_SB_DestinationD_t *DestPtr = NULL;
+    uint16 DestIdx;
+    uint16 NumDests;
     
     for(i=0;i<CFE_PLATFORM_SB_MAX_MSG_IDS;i++)
     {
         RoutePtr = CFE_SB_GetRoutePtrFromIdx(CFE_SB_ValueToRouteIdx(i));
         if(!CFE_SB_IsValidMsgId(RoutePtr->MsgId))
         {
-            DestPtr = NULL;
+            NumDests = 0;
         }
         else
         {
-            DestPtr = RoutePtr->ListHeadPtr;
+            NumDests = RoutePtr->Destinations;
         }
         
-        while(DestPtr != NULL){
+        /* Check each destination for global scope */
+        for(DestIdx = 0; DestIdx < NumDests; DestIdx++){
     
-            if(DestPtr->Scope == CFE_SB_GLOBAL){
+            if(RoutePtr->DestArray[DestIdx].Scope == CFE_SB_GLOBAL){
 
                 cnt++;
                 break;
 
             }/* end if */
             
-            /* Check next destination (if another exists) for global scope */
-            DestPtr = DestPtr -> Next;
-            
-        }/* end while */
+        }/* end for */
 
     }/* end for */
 
@@ -54,12 +54,37 @@
     #error CFE_PLATFORM_SB_MAX_PIPE_DEPTH cannot be less than 1!
 #endif
 
+#if CFE_PLATFORM_SB_ELASTIC_QUIET_CYCLES < 1
+    #error CFE_PLATFORM_SB_ELASTIC_QUIET_CYCLES cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_RCV_BATCH < 1
+    #error CFE_PLATFORM_SB_MAX_RCV_BATCH cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_BCAST_TOPICS < 1
+    #error CFE_PLATFORM_SB_MAX_BCAST_TOPICS cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_BCAST_TOPICS > 32
+    #error CFE_PLATFORM_SB_MAX_BCAST_TOPICS cannot be greater than 32!
+#endif
+
 #if CFE_PLATFORM_SB_HIGHEST_VALID_MSGID < 1
   #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be less than 1!
 #endif
 
-#if CFE_PLATFORM_SB_HIGHEST_VALID_MSGID > 0xFFFF
-  #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be greater than 0xFFFF!
+#ifdef CFE_PLATFORM_SB_MSGMAP_HASH
+  #if CFE_PLATFORM_SB_HIGHEST_VALID_MSGID > 0xFFFFFFFE
+    #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be greater than 0xFFFFFFFE!
+  #endif
+  #if CFE_PLATFORM_SB_MAX_MSG_IDS > 1024
+    #error CFE_PLATFORM_SB_MAX_MSG_IDS cannot be greater than 1024 with CFE_PLATFORM_SB_MSGMAP_HASH!
+  #endif
+#else
+  #if CFE_PLATFORM_SB_HIGHEST_VALID_MSGID > 0xFFFF
+    #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be greater than 0xFFFF!
+  #endif
 #endif
 
 #if CFE_PLATFORM_SB_BUF_MEMORY_BYTES < 512
@@ -82,6 +107,10 @@
      #error CFE_MISSION_SB_MAX_SB_MSG_SIZE cannot be less than 6 (CCSDS Primary Hdr Size)!
 #endif
 
+#if CFE_MISSION_SB_MAX_SB_MSG_SIZE > 0xFFFF
+     #error CFE_MISSION_SB_MAX_SB_MSG_SIZE cannot be greater than 65535 (SB buffer requests are 16 bit)!
+#endif
+
 
 /*
 **  SB Memory Pool Block Sizes
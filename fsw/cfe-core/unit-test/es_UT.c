@@ -3911,6 +3911,7 @@ void TestAPI(void)
     uint32 RunStatus;
     CFE_ES_TaskInfo_t TaskInfo;
     CFE_ES_AppInfo_t AppInfo;
+    CFE_ES_TaskContext_t TaskContext;
     CFE_ES_AppRecord_t *UtAppRecPtr;
     CFE_ES_TaskRecord_t *UtTaskRecPtr;
 
@@ -4142,6 +4143,36 @@ void TestAPI(void)
               "CFE_ES_GetAppID",
               "Get application ID by name successful");
 
+    /* Test getting the task context, first from the tables then from the cache */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", &UtAppRecPtr, &UtTaskRecPtr);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetTaskContext(&TaskContext) == CFE_SUCCESS &&
+                  CFE_ES_GetTaskContext(&TaskContext) == CFE_SUCCESS &&
+                  CFE_ES_ResourceID_Equal(TaskContext.TaskId, CFE_ES_TaskRecordGetID(UtTaskRecPtr)) &&
+                  CFE_ES_ResourceID_Equal(TaskContext.AppId, CFE_ES_AppRecordGetID(UtAppRecPtr)) &&
+                  strcmp(TaskContext.AppName, "UT") == 0,
+              "CFE_ES_GetTaskContext",
+              "Get task context successful");
+
+    /* Test that the cached task context is not used once the parent app is gone */
+    CFE_ES_AppRecordSetFree(UtAppRecPtr);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetTaskContext(&TaskContext) == CFE_ES_ERR_APPID &&
+                  CFE_ES_ResourceID_Equal(TaskContext.TaskId, CFE_ES_TaskRecordGetID(UtTaskRecPtr)) &&
+                  CFE_ES_GetAppID(&AppId) == CFE_ES_ERR_APPID &&
+                  CFE_ES_GetTaskID(&TaskId) == CFE_SUCCESS,
+              "CFE_ES_GetTaskContext",
+              "Get task context; parent application not active");
+
+    /* Test that the cached task context is invalidated when the task is freed */
+    CFE_ES_TaskRecordSetFree(UtTaskRecPtr);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetTaskContext(&TaskContext) == CFE_ES_ERR_TASKID &&
+                  CFE_ES_GetTaskID(&TaskId) == CFE_ES_ERR_TASKID,
+              "CFE_ES_GetTaskContext",
+              "Get task context; task not active");
+
     /* Test getting the app name with a bad app ID */
     ES_ResetUnitTest();
     AppId = ES_UT_MakeAppIdForIndex(99999);
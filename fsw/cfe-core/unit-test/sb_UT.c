@@ -375,6 +375,8 @@ void Test_SB_Cmds(void)
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_Noop);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RstCtrs);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_Stats);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_LatencyStats);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_LatencyStatsInvParam);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoDef);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoSpec);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoCreateFail);
@@ -390,6 +392,7 @@ void Test_SB_Cmds(void)
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_MapInfoCreateFail);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_MapInfoHdrFail);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_MapInfoWriteFail);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_MapInfoSteps);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_EnRouteValParam);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_EnRouteNonExist);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_EnRouteInvParam);
@@ -488,6 +491,79 @@ void Test_SB_Cmds_Stats(void)
 
 } /* end Test_SB_Cmds_Stats */
 
+/*
+** Test send SB latency statistics command using a valid pipe
+*/
+void Test_SB_Cmds_LatencyStats(void)
+{
+    CFE_SB_SendLatencyStats_t LatencyCmd;
+    CFE_SB_PipeId_t   PipeId;
+    CFE_MSG_FcnCode_t FcnCode;
+    CFE_SB_MsgId_t    MsgId;
+    CFE_MSG_Size_t    Size;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 5, "LatencyTestPipe"));
+    CFE_SB.PipeTbl[PipeId].Latency.Samples = 3;
+
+    /* For internal SendMsg call */
+    MsgId = CFE_SB_ValueToMsgId(CFE_SB_LATENCY_TLM_MID);
+    Size = sizeof(CFE_SB.LatencyTlmMsg);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+
+    /* For Generic command processing */
+    MsgId = CFE_SB_ValueToMsgId(CFE_SB_CMD_MID);
+    Size = sizeof(LatencyCmd);
+    FcnCode = CFE_SB_SEND_LATENCY_STATS_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    LatencyCmd.Payload.MsgId = SB_UT_TLM_MID;
+    LatencyCmd.Payload.Pipe = PipeId;
+    CFE_SB.CmdPipePktPtr = (CFE_SB_MsgPtr_t) &LatencyCmd;
+    CFE_SB_ProcessCmdPipePkt();
+
+    ASSERT_EQ(CFE_SB.LatencyTlmMsg.Payload.PipeId, PipeId);
+    ASSERT_EQ(CFE_SB.LatencyTlmMsg.Payload.PipeHist.Samples, 3);
+    ASSERT_EQ(CFE_SB.LatencyTlmMsg.Payload.MsgIdValid, 0);
+
+    /* Pipe create, no subs event and command processing event */
+    EVTCNT(3);
+
+    EVTSENT(CFE_SB_SND_LATENCY_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SB_Cmds_LatencyStats */
+
+/*
+** Test send SB latency statistics command using an invalid pipe
+*/
+void Test_SB_Cmds_LatencyStatsInvParam(void)
+{
+    CFE_SB_SendLatencyStats_t LatencyCmd;
+    CFE_MSG_FcnCode_t FcnCode = CFE_SB_SEND_LATENCY_STATS_CC;
+    CFE_SB_MsgId_t    MsgIdCmd = CFE_SB_ValueToMsgId(CFE_SB_CMD_MID);
+    CFE_MSG_Size_t    Size = sizeof(LatencyCmd);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgIdCmd, sizeof(MsgIdCmd), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    LatencyCmd.Payload.MsgId = SB_UT_TLM_MID;
+    LatencyCmd.Payload.Pipe = 3;
+    CFE_SB.CmdPipePktPtr = (CFE_SB_MsgPtr_t) &LatencyCmd;
+    CFE_SB_ProcessCmdPipePkt();
+
+    EVTCNT(1);
+
+    EVTSENT(CFE_SB_SND_LATENCY_ERR_EID);
+
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.CommandErrorCounter, 1);
+
+} /* end Test_SB_Cmds_LatencyStatsInvParam */
+
 /*
 ** Test send routing information command using the default file name
 */
@@ -511,6 +587,9 @@ void Test_SB_Cmds_RoutingInfoDef(void)
 
     CFE_SB_ProcessCmdPipePkt();
 
+    /* The file is written by the SB task in later steps */
+    while (CFE_SB_DumpFileStep());
+
     EVTCNT(12);
 
     EVTSENT(CFE_SB_INIT_EID);
@@ -542,6 +621,7 @@ void Test_SB_Cmds_RoutingInfoSpec(void)
     CFE_SB.CmdPipePktPtr = (CFE_SB_MsgPtr_t) &WriteFileCmd;
 
     CFE_SB_ProcessCmdPipePkt();
+    while (CFE_SB_DumpFileStep());
 
     EVTCNT(1);
 
@@ -593,7 +673,7 @@ void Test_SB_Cmds_RoutingInfoHdrFail(void)
 
 /*
 ** Test send routing information command with a file write failure on
-** the second write
+** the first write of entries
 */
 void Test_SB_Cmds_RoutingInfoWriteFail(void)
 {
@@ -602,9 +682,15 @@ void Test_SB_Cmds_RoutingInfoWriteFail(void)
     /* Make some routing info by calling CFE_SB_AppInit */
     SETUP(CFE_SB_AppInit());
 
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, -1);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
 
-    ASSERT_EQ(CFE_SB_SendRtgInfo("RoutingTstFile"), CFE_SB_FILE_IO_ERR);
+    ASSERT_EQ(CFE_SB_SendRtgInfo("RoutingTstFile"), CFE_SUCCESS);
+    while (CFE_SB_DumpFileStep());
+    ASSERT_EQ(CFE_SB.Dump.Kind, CFE_SB_DUMP_IDLE);
+
+    /* The write error ends the dump and closes the file exactly once */
+    EVTSENT(CFE_SB_FILEWRITE_ERR_EID);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_close)), 1);
 
     EVTCNT(11);
 
@@ -614,8 +700,6 @@ void Test_SB_Cmds_RoutingInfoWriteFail(void)
 
     EVTSENT(CFE_SB_INIT_EID);
 
-    EVTSENT(CFE_SB_FILEWRITE_ERR_EID);
-
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
 } /* end Test_SB_Cmds_RoutingInfoWriteFail */
@@ -646,6 +730,7 @@ void Test_SB_Cmds_PipeInfoDef(void)
     CFE_SB.CmdPipePktPtr = (CFE_SB_MsgPtr_t) &WriteFileCmd;
 
     CFE_SB_ProcessCmdPipePkt();
+    while (CFE_SB_DumpFileStep());
 
     EVTCNT(4);
 
@@ -674,6 +759,7 @@ void Test_SB_Cmds_PipeInfoSpec(void)
     strncpy((char *)WriteFileCmd.Payload.Filename, "PipeTstFile", sizeof(WriteFileCmd.Payload.Filename));
     CFE_SB.CmdPipePktPtr = (CFE_SB_MsgPtr_t) &WriteFileCmd;
     CFE_SB_ProcessCmdPipePkt();
+    while (CFE_SB_DumpFileStep());
 
     EVTCNT(1);
 
@@ -711,7 +797,7 @@ void Test_SB_Cmds_PipeInfoHdrFail(void)
 
 /*
 ** Test send pipe information command with a file write failure on
-** the second write
+** the first write of entries
 */
 void Test_SB_Cmds_PipeInfoWriteFail(void)
 {
@@ -723,16 +809,20 @@ void Test_SB_Cmds_PipeInfoWriteFail(void)
     SETUP(CFE_SB_CreatePipe(&PipeId1, PipeDepth, "TestPipe1"));
     SETUP(CFE_SB_CreatePipe(&PipeId2, PipeDepth, "TestPipe2"));
     SETUP(CFE_SB_CreatePipe(&PipeId3, PipeDepth, "TestPipe3"));
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, -1);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
 
-    ASSERT_EQ(CFE_SB_SendPipeInfo("PipeTstFile"), CFE_SB_FILE_IO_ERR);
+    ASSERT_EQ(CFE_SB_SendPipeInfo("PipeTstFile"), CFE_SUCCESS);
+    while (CFE_SB_DumpFileStep());
+    ASSERT_EQ(CFE_SB.Dump.Kind, CFE_SB_DUMP_IDLE);
+
+    /* The write error ends the dump and closes the file exactly once */
+    EVTSENT(CFE_SB_FILEWRITE_ERR_EID);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_close)), 1);
 
     EVTCNT(4);
 
     EVTSENT(CFE_SB_PIPE_ADDED_EID);
 
-    EVTSENT(CFE_SB_FILEWRITE_ERR_EID);
-
     TEARDOWN(CFE_SB_DeletePipe(PipeId1));
     TEARDOWN(CFE_SB_DeletePipe(PipeId2));
     TEARDOWN(CFE_SB_DeletePipe(PipeId3));
@@ -778,6 +868,7 @@ void Test_SB_Cmds_MapInfoDef(void)
     CFE_SB.CmdPipePktPtr = (CFE_SB_MsgPtr_t) &WriteFileCmd;
 
     CFE_SB_ProcessCmdPipePkt();
+    while (CFE_SB_DumpFileStep());
 
     EVTCNT(18);
 
@@ -809,6 +900,7 @@ void Test_SB_Cmds_MapInfoSpec(void)
     strncpy((char *)WriteFileCmd.Payload.Filename, "MapTstFile", sizeof(WriteFileCmd.Payload.Filename));
     CFE_SB.CmdPipePktPtr = (CFE_SB_MsgPtr_t) &WriteFileCmd;
     CFE_SB_ProcessCmdPipePkt();
+    while (CFE_SB_DumpFileStep());
 
     EVTCNT(1);
 
@@ -846,7 +938,7 @@ void Test_SB_Cmds_MapInfoHdrFail(void)
 
 /*
 ** Test send map information command with a file write failure on
-** the second write
+** the first write of entries
 */
 void Test_SB_Cmds_MapInfoWriteFail(void)
 {
@@ -872,13 +964,17 @@ void Test_SB_Cmds_MapInfoWriteFail(void)
     SETUP(CFE_SB_Subscribe(MsgId3, PipeId3));
     SETUP(CFE_SB_Subscribe(MsgId4, PipeId3));
     SETUP(CFE_SB_Subscribe(MsgId5, PipeId2));
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, -1);
-
-    ASSERT_EQ(CFE_SB_SendMapInfo("MapTstFile"), CFE_SB_FILE_IO_ERR);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
 
-    EVTCNT(18);
+    ASSERT_EQ(CFE_SB_SendMapInfo("MapTstFile"), CFE_SUCCESS);
+    while (CFE_SB_DumpFileStep());
+    ASSERT_EQ(CFE_SB.Dump.Kind, CFE_SB_DUMP_IDLE);
 
+    /* The write error ends the dump and closes the file exactly once */
     EVTSENT(CFE_SB_FILEWRITE_ERR_EID);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_close)), 1);
+
+    EVTCNT(18);
 
     EVTSENT(CFE_SB_PIPE_ADDED_EID);
 
@@ -890,6 +986,47 @@ void Test_SB_Cmds_MapInfoWriteFail(void)
 
 } /* end Test_SB_Cmds_MapInfoWriteFail */
 
+/*
+** Test that the map information file is written in steps and that no
+** other file is started until it is complete
+*/
+void Test_SB_Cmds_MapInfoSteps(void)
+{
+    CFE_SB_PipeId_t PipeId;
+    uint16          PipeDepth = 10;
+    uint32          i;
+    uint32          Steps = 0;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+    for (i = 0; i <= CFE_SB_DUMP_ENTRIES_PER_STEP; i++)
+    {
+        SETUP(CFE_SB_Subscribe(CFE_SB_ValueToMsgId(SB_UT_TLM_MID_VALUE_BASE + i), PipeId));
+    }
+
+    ASSERT_EQ(CFE_SB_SendMapInfo("MapTstFile"), CFE_SUCCESS);
+    ASSERT_EQ(CFE_SB.Dump.Kind, CFE_SB_DUMP_MAP);
+
+    ASSERT_EQ(CFE_SB_SendRtgInfo("RoutingTstFile"), CFE_SB_FILE_IO_ERR);
+    EVTSENT(CFE_SB_SND_RTG_BUSY_EID);
+
+    while (CFE_SB_DumpFileStep())
+    {
+        Steps++;
+    }
+
+    ASSERT_TRUE(Steps >= 1);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_write)), 2);
+    ASSERT_EQ(CFE_SB.Dump.EntryCount, CFE_SB_DUMP_ENTRIES_PER_STEP + 1);
+    ASSERT_EQ(CFE_SB.Dump.Kind, CFE_SB_DUMP_IDLE);
+    EVTSENT(CFE_SB_SND_RTG_EID);
+
+    /* Nothing left to write */
+    ASSERT_TRUE(!CFE_SB_DumpFileStep());
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SB_Cmds_MapInfoSteps */
+
 /*
 ** Test command to enable a specific route using a valid route
 */
@@ -1521,6 +1658,9 @@ void Test_CreatePipe_API(void)
     SB_UT_ADD_SUBTEST(Test_CreatePipe_InvalPipeDepth);
     SB_UT_ADD_SUBTEST(Test_CreatePipe_MaxPipes);
     SB_UT_ADD_SUBTEST(Test_CreatePipe_SamePipeName);
+    SB_UT_ADD_SUBTEST(Test_CreatePipe_Ring);
+    SB_UT_ADD_SUBTEST(Test_CreatePipe_Elastic);
+    SB_UT_ADD_SUBTEST(Test_CreatePipe_ElasticErrors);
 } /* end Test_CreatePipe_API */
 
 /*
@@ -1655,6 +1795,231 @@ void Test_CreatePipe_SamePipeName(void)
 
 }
 
+/*
+** Test that a ring pipe delivers without the OS queue and reports overflow
+*/
+void Test_CreatePipe_Ring(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_MsgPtr_t  PtrArray[3];
+    uint32           Count = 0;
+    uint8            Opts = 0;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    uint32           i;
+
+    SETUP(CFE_SB_CreatePipeEx(&PipeId, 2, "RingTestPipe", CFE_SB_PIPEOPTS_RING));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    /* The third send overflows the two deep ring */
+    for (i = 0; i < 3; i++)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
+
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueuePut)), 0);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[CFE_SB_GetPipeIdx(PipeId)].InUse, 2);
+
+    ASSERT(CFE_SB_RcvMsgBatch(PtrArray, 3, &Count, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(Count, 2);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrArray[0], PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueueGet)), 0);
+
+    /* The queue backend is kept when the options are reset */
+    ASSERT(CFE_SB_SetPipeOpts(PipeId, 0));
+    ASSERT(CFE_SB_GetPipeOpts(PipeId, &Opts));
+    ASSERT_EQ(Opts, CFE_SB_PIPEOPTS_RING);
+
+    CFE_SB_SendErrReports();
+
+    EVTCNT(7);
+
+    EVTSENT(CFE_SB_Q_FULL_ERR_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_CreatePipe_Ring */
+
+/*
+** Test that an elastic pipe grows under burst and shrinks back when quiet
+*/
+void Test_CreatePipe_Elastic(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_MsgPtr_t  PtrArray[8];
+    CFE_SB_PipeDepthStats_t *StatPtr;
+    CFE_SB_PipeD_t  *PipeDscPtr;
+    uint32           Count = 0;
+    uint8            Opts = 0;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    uint32           i;
+
+    SETUP(CFE_SB_CreatePipeElastic(&PipeId, 2, 8, "ElasticTestPipe", 0));
+    SETUP(CFE_SB_SubscribeEx(MsgId, PipeId, CFE_SB_Default_Qos, 8));
+
+    PipeDscPtr = CFE_SB_GetPipePtr(PipeId);
+    StatPtr = &CFE_SB.StatTlmMsg.Payload.PipeDepthStats[CFE_SB_GetPipeIdx(PipeId)];
+    ASSERT_EQ(StatPtr->Depth, 2);
+    ASSERT_EQ(StatPtr->MaxDepth, 8);
+
+    /* The elastic pipe uses the ring backend, with the next ring ready */
+    ASSERT(CFE_SB_GetPipeOpts(PipeId, &Opts));
+    ASSERT_EQ(Opts, CFE_SB_PIPEOPTS_RING | CFE_SB_PIPEOPTS_ELASTIC);
+    ASSERT_EQ(PipeDscPtr->StandbyReady, 1);
+    ASSERT_EQ(PipeDscPtr->AltRing.Depth, 4);
+
+    /* Five messages move the writers to the ring of depth 4 */
+    for (i = 0; i < 5; i++)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
+
+    ASSERT_EQ(StatPtr->Depth, 4);
+    ASSERT_EQ(StatPtr->Grows, 1);
+    ASSERT_EQ(StatPtr->Overflows, 0);
+    ASSERT_EQ(StatPtr->InUse, 5);
+    ASSERT_EQ(PipeDscPtr->WriteGen, 1);
+    ASSERT_EQ(PipeDscPtr->ReadGen, 0);
+
+    /* The reader empties the older ring before it follows the writers */
+    ASSERT(CFE_SB_RcvMsgBatch(PtrArray, 8, &Count, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(Count, 5);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrArray[0], PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    ASSERT_EQ(PipeDscPtr->ReadGen, 1);
+    ASSERT_EQ(CFE_SB.ElasticPending, 1);
+
+    /* The SB task releases the older ring and readies the ring of depth 8 */
+    CFE_SB_UpdateElasticPipes();
+    ASSERT_EQ(CFE_SB.ElasticPending, 0);
+    ASSERT_EQ(PipeDscPtr->StandbyReady, 1);
+    ASSERT_EQ(PipeDscPtr->Ring.Depth, 8);
+
+    for (i = 0; i < 5; i++)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
+
+    ASSERT_EQ(StatPtr->Depth, 8);
+    ASSERT_EQ(StatPtr->PeakDepth, 8);
+    ASSERT_EQ(StatPtr->Grows, 2);
+    ASSERT_EQ(StatPtr->Overflows, 0);
+
+    ASSERT(CFE_SB_RcvMsgBatch(PtrArray, 8, &Count, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(Count, 5);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrArray[0], PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+
+    /* The burst ends the current period, the pipe shrinks after the quiet ones */
+    for (i = 0; i < CFE_PLATFORM_SB_ELASTIC_QUIET_CYCLES; i++)
+    {
+        CFE_SB_ShrinkElasticPipes();
+    }
+
+    ASSERT_EQ(StatPtr->Depth, 8);
+    ASSERT_EQ(StatPtr->Shrinks, 0);
+
+    CFE_SB_ShrinkElasticPipes();
+
+    ASSERT_EQ(StatPtr->Depth, 2);
+    ASSERT_EQ(StatPtr->PeakDepth, 8);
+    ASSERT_EQ(StatPtr->Shrinks, 1);
+
+    /* The empty pipe left the ring of depth 8 at once, the next ring is ready */
+    ASSERT_EQ(PipeDscPtr->ReadGen, PipeDscPtr->WriteGen);
+    ASSERT_EQ(PipeDscPtr->StandbyReady, 1);
+    ASSERT_EQ(CFE_SB_ELASTIC_RING(PipeDscPtr, PipeDscPtr->WriteGen + 1)->Depth, 4);
+
+    /* The elastic option is kept when the options are reset */
+    ASSERT(CFE_SB_SetPipeOpts(PipeId, 0));
+    ASSERT(CFE_SB_GetPipeOpts(PipeId, &Opts));
+    ASSERT_EQ(Opts, CFE_SB_PIPEOPTS_RING | CFE_SB_PIPEOPTS_ELASTIC);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+    ASSERT_EQ(StatPtr->MaxDepth, 0);
+    ASSERT_EQ(StatPtr->Grows, 0);
+
+} /* end Test_CreatePipe_Elastic */
+
+/*
+** Test elastic pipe response to bad depths and an exhausted memory pool
+*/
+void Test_CreatePipe_ElasticErrors(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_PipeDepthStats_t *StatPtr;
+    uint8            Opts = 0;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    uint32           i;
+
+    ASSERT_EQ(CFE_SB_CreatePipeElastic(&PipeId, 4, 2, "ElasticTestPipe", 0), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_CreatePipeElastic(&PipeId, 4, CFE_PLATFORM_SB_MAX_PIPE_DEPTH + 1,
+                                       "ElasticTestPipe", 0), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_CR_PIPE_BAD_ARG_EID);
+
+    /* The elastic option cannot be selected through CFE_SB_CreatePipeEx */
+    SETUP(CFE_SB_CreatePipeEx(&PipeId, 2, "ElasticTestPipe", CFE_SB_PIPEOPTS_ELASTIC));
+    ASSERT(CFE_SB_GetPipeOpts(PipeId, &Opts));
+    ASSERT_EQ(Opts, 0);
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+    /* The next ring cannot be allocated when the pipe is created */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 2, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    SETUP(CFE_SB_CreatePipeElastic(&PipeId, 2, 4, "ElasticTestPipe", 0));
+    SETUP(CFE_SB_SubscribeEx(MsgId, PipeId, CFE_SB_Default_Qos, 4));
+    StatPtr = &CFE_SB.StatTlmMsg.Payload.PipeDepthStats[CFE_SB_GetPipeIdx(PipeId)];
+    ASSERT_EQ(CFE_SB_GetPipePtr(PipeId)->StandbyReady, 0);
+
+    /* A pipe that cannot get memory to grow overflows as a full pipe */
+    for (i = 0; i < 3; i++)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
+
+    ASSERT_EQ(StatPtr->Depth, 2);
+    ASSERT_EQ(StatPtr->Grows, 0);
+    ASSERT_EQ(StatPtr->Overflows, 1);
+    EVTSENT(CFE_SB_Q_FULL_ERR_EID);
+
+    /* Housekeeping readies the ring again and the next message grows the pipe */
+    CFE_SB_ShrinkElasticPipes();
+    ASSERT_EQ(CFE_SB_GetPipePtr(PipeId)->StandbyReady, 1);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+
+    ASSERT_EQ(StatPtr->Depth, 4);
+    ASSERT_EQ(StatPtr->Grows, 1);
+    ASSERT_EQ(StatPtr->Overflows, 1);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_CreatePipe_ElasticErrors */
+
 /*
 ** Function for calling SB delete pipe API test functions
 */
@@ -1665,6 +2030,8 @@ void Test_DeletePipe_API(void)
     SB_UT_ADD_SUBTEST(Test_DeletePipe_InvalidPipeId);
     SB_UT_ADD_SUBTEST(Test_DeletePipe_InvalidPipeOwner);
     SB_UT_ADD_SUBTEST(Test_DeletePipe_WithAppid);
+    SB_UT_ADD_SUBTEST(Test_DeletePipe_RouteMap);
+    SB_UT_ADD_SUBTEST(Test_DeletePipe_PendingPut);
 } /* end Test_DeletePipe_API */
 
 /*
@@ -1704,9 +2071,11 @@ void Test_DeletePipe_WithSubs(void)
     SETUP(CFE_SB_Subscribe(MsgId3, PipedId));
     ASSERT(CFE_SB_DeletePipe(PipedId));
 
-    EVTCNT(14);
+    EVTCNT(11);
 
     EVTSENT(CFE_SB_PIPE_ADDED_EID);
+    EVTSENT(CFE_SB_SUBSCRIPTION_LIST_REMOVED_EID);
+    ASSERT_TRUE(!UT_EventIsInHistory(CFE_SB_SUBSCRIPTION_REMOVED_EID));
     EVTSENT(CFE_SB_PIPE_DELETED_EID);
 
 } /* end Test_DeletePipe_WithSubs */
@@ -1772,10 +2141,83 @@ void Test_DeletePipe_WithAppid(void)
 
     ASSERT(CFE_SB_DeletePipeWithAppId(PipedId, AppId));
 
-    EVTCNT(14);
+    EVTCNT(11);
+
+    EVTSENT(CFE_SB_SUBSCRIPTION_LIST_REMOVED_EID);
 
 } /* end Test_DeletePipe_WithAppid */
 
+/*
+** Test that deleting a pipe only removes the routes recorded for it
+*/
+void Test_DeletePipe_RouteMap(void)
+{
+    CFE_SB_PipeId_t PipeId1;
+    CFE_SB_PipeId_t PipeId2;
+    uint32          i;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId1, 10, "TestPipe1"));
+    SETUP(CFE_SB_CreatePipe(&PipeId2, 10, "TestPipe2"));
+    SETUP(CFE_SB_Subscribe(SB_UT_CMD_MID1, PipeId1));
+    SETUP(CFE_SB_Subscribe(SB_UT_CMD_MID2, PipeId1));
+    SETUP(CFE_SB_Subscribe(SB_UT_CMD_MID2, PipeId2));
+    SETUP(CFE_SB_Subscribe(SB_UT_CMD_MID3, PipeId2));
+    SETUP(CFE_SB_Unsubscribe(SB_UT_CMD_MID1, PipeId1));
+
+    /* route 0 is no longer recorded for the pipe */
+    ASSERT_EQ(CFE_SB.PipeTbl[PipeId1].RouteMap[0], 0x2);
+    ASSERT_EQ(CFE_SB.PipeTbl[PipeId2].RouteMap[0], 0x6);
+
+    ASSERT(CFE_SB_DeletePipe(PipeId1));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse, 2);
+    ASSERT_TRUE(CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(SB_UT_CMD_MID2), PipeId2) != NULL);
+    ASSERT_TRUE(CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(SB_UT_CMD_MID2), PipeId1) == NULL);
+    for (i = 0; i < CFE_SB_ROUTE_MAP_WORDS; i++)
+    {
+        ASSERT_EQ(CFE_SB.PipeTbl[PipeId1].RouteMap[i], 0);
+    }
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse, 0);
+
+} /* end Test_DeletePipe_RouteMap */
+
+/*
+** Test that a pipe with a queue write pending is released by the last writer
+*/
+void Test_DeletePipe_PendingPut(void)
+{
+    CFE_SB_PipeId_t PipeId;
+    CFE_SB_PipeId_t PipeId2;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 10, "TestPipe1"));
+    SETUP(CFE_SB_Subscribe(SB_UT_CMD_MID1, PipeId));
+
+    /* a sender reserved a slot and has not written the queue yet */
+    CFE_SB.PipeTbl[PipeId].PendingPuts = 1;
+
+    ASSERT(CFE_SB_DeletePipe(PipeId));
+    ASSERT_EQ(CFE_SB.PipeTbl[PipeId].InUse, CFE_SB_PIPE_DELETING);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipesInUse, 1);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueueDelete)), 0);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse, 0);
+
+    /* the pipe is gone for the API and its entry is not reused yet */
+    ASSERT_EQ(CFE_SB_DeletePipe(PipeId), CFE_SB_BAD_ARGUMENT);
+    SETUP(CFE_SB_CreatePipe(&PipeId2, 10, "TestPipe2"));
+    ASSERT_TRUE(PipeId2 != PipeId);
+
+    CFE_SB_PendingPutEnd(&CFE_SB.PipeTbl[PipeId]);
+
+    ASSERT_EQ(CFE_SB.PipeTbl[PipeId].InUse, CFE_SB_NOT_IN_USE);
+    ASSERT_EQ(CFE_SB.PipeTbl[PipeId].PendingPuts, 0);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipesInUse, 1);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueueDelete)), 1);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+
+} /* end Test_DeletePipe_PendingPut */
+
 /*
 ** Function for calling SB set pipe opts API test functions
 */
@@ -2029,11 +2471,25 @@ void Test_Subscribe_API(void)
     SB_UT_ADD_SUBTEST(Test_Subscribe_LocalSubscription);
     SB_UT_ADD_SUBTEST(Test_Subscribe_MaxDestCount);
     SB_UT_ADD_SUBTEST(Test_Subscribe_MaxMsgIdCount);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_AddDestErr);
     SB_UT_ADD_SUBTEST(Test_Subscribe_SendPrevSubs);
     SB_UT_ADD_SUBTEST(Test_Subscribe_FindGlobalMsgIdCnt);
     SB_UT_ADD_SUBTEST(Test_Subscribe_PipeNonexistent);
     SB_UT_ADD_SUBTEST(Test_Subscribe_SubscriptionReporting);
     SB_UT_ADD_SUBTEST(Test_Subscribe_InvalidPipeOwner);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_Range);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_Mask);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_SetErrors);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_PolicyEveryNth);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_PolicyInterval);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_PolicyOnChange);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_PolicyOnChangeFull);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_PolicyErrors);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_BcastTopic);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_BcastTopicReaders);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_BcastTopicErrors);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_Many);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_ManyErrors);
 } /* end Test_Subscribe_API */
 
 /*
@@ -2243,6 +2699,40 @@ void Test_Subscribe_MaxMsgIdCount(void)
 
 } /* end Test_Subscribe_MaxMsgIdCount */
 
+/*
+** Test that a first subscription whose destination cannot be allocated
+** gives back the routing table entry it took
+*/
+void Test_Subscribe_AddDestErr(void)
+{
+    CFE_SB_PipeId_t PipeId;
+    CFE_SB_MsgId_t  MsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgKey_t MsgKey = CFE_SB_ConvertMsgIdtoMsgKey(MsgId);
+    uint16          RouteIdxTop;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 4, "AddDestErrPipe"));
+
+    RouteIdxTop = CFE_SB.RouteIdxTop;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, -1);
+    ASSERT_EQ(CFE_SB_Subscribe(MsgId, PipeId), CFE_SB_BUF_ALOC_ERR);
+    EVTSENT(CFE_SB_DEST_BLK_ERR_EID);
+
+    ASSERT_TRUE(!CFE_SB_IsValidRouteIdx(CFE_SB_GetRoutingTblIdx(MsgKey)));
+    ASSERT_EQ(CFE_SB.RouteIdxTop, RouteIdxTop);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.MsgIdsInUse, 0);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse, 0);
+
+    /* the entry is taken again by the next subscription */
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    ASSERT_EQ(CFE_SB.RouteIdxTop, RouteIdxTop + 1);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.MsgIdsInUse, 1);
+    ASSERT_EQ(CFE_SB_GetRoutePtrFromIdx(CFE_SB_GetRoutingTblIdx(MsgKey))->Destinations, 1);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_Subscribe_AddDestErr */
+
 /*
 ** Test obtaining the list of current message subscriptions
 */
@@ -2274,8 +2764,8 @@ void Test_Subscribe_SendPrevSubs(void)
     SETUP(CFE_SB_Subscribe(MsgId2, PipeId1));
     SETUP(CFE_SB_Subscribe(MsgId0, PipeId2));
 
-    /* Set the last list header pointer to NULL to get branch path coverage */
-    CFE_SB.RoutingTbl[2].ListHeadPtr = NULL;
+    /* Empty the last destination array to get branch path coverage */
+    CFE_SB.RoutingTbl[2].Destinations = 0;
 
     /* For internal SendMsg call */
     MsgIdCmd = CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID);
@@ -2320,8 +2810,8 @@ void Test_Subscribe_FindGlobalMsgIdCnt(void)
     SETUP(CFE_SB_Subscribe(MsgId2, PipeId1));
     SETUP(CFE_SB_SubscribeLocal(MsgId0, PipeId2, MsgLim));
 
-    /* Set the last list head pointer to NULL for branch path coverage */
-    CFE_SB.RoutingTbl[2].ListHeadPtr = NULL;
+    /* Empty the last destination array for branch path coverage */
+    CFE_SB.RoutingTbl[2].Destinations = 0;
 
     ASSERT_EQ(CFE_SB_FindGlobalMsgIdCnt(), 2); /* 2 unique msg ids; the third is set to skip */
 
@@ -2424,1123 +2914,3217 @@ void Test_Subscribe_InvalidPipeOwner(void)
 } /* end Test_Subscribe_InvalidPipeOwner */
 
 /*
-** Function for calling SB unsubscribe API test functions
+** Test subscribing to a range of message ids, including one already subscribed
 */
-void Test_Unsubscribe_API(void)
+void Test_Subscribe_Range(void)
 {
-    SB_UT_ADD_SUBTEST(Test_Unsubscribe_Basic);
-    SB_UT_ADD_SUBTEST(Test_Unsubscribe_Local);
-    SB_UT_ADD_SUBTEST(Test_Unsubscribe_InvalParam);
-    SB_UT_ADD_SUBTEST(Test_Unsubscribe_NoMatch);
-    SB_UT_ADD_SUBTEST(Test_Unsubscribe_InvalidPipe);
-    SB_UT_ADD_SUBTEST(Test_Unsubscribe_InvalidPipeOwner);
-    SB_UT_ADD_SUBTEST(Test_Unsubscribe_FirstDestWithMany);
-    SB_UT_ADD_SUBTEST(Test_Unsubscribe_MiddleDestWithMany);
-    SB_UT_ADD_SUBTEST(Test_Unsubscribe_GetDestPtr);
-} /* end Test_Unsubscribe_API */
+    CFE_SB_PipeId_t      PipeId;
+    CFE_SB_MsgId_t       MsgId;
+    CFE_SB_MsgId_t       MsgIdRpt;
+    CFE_SB_RouteEntry_t  *RoutePtr;
+    SB_UT_Test_Tlm_t     TlmPkt;
+    CFE_SB_MsgPtr_t      TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_MsgPtr_t      PtrToMsg;
+    CFE_MSG_Size_t       Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t       Type = CFE_MSG_Type_Tlm;
+    uint16               PipeDepth = 10;
+    int32                i;
 
-/*
-** Test API used to unsubscribe to a message (successful)
-*/
-void Test_Unsubscribe_Basic(void)
-{
-    CFE_SB_PipeId_t TestPipe;
-    CFE_SB_MsgId_t  MsgId = SB_UT_INTERMEDIATE_VALID_MID;
-    uint16          PipeDepth = 50;
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+    SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID1, PipeId));
 
-    SETUP(CFE_SB_CreatePipe(&TestPipe, PipeDepth, "TestPipe"));
-    SETUP(CFE_SB_Subscribe(MsgId, TestPipe));
+    ASSERT(CFE_SB_SubscribeRange(SB_UT_TLM_MID, SB_UT_TLM_MID3, PipeId));
 
-    ASSERT(CFE_SB_Unsubscribe(MsgId, TestPipe));
+    EVTCNT(5);
 
-    EVTCNT(4);
+    EVTSENT(CFE_SB_SUBSCRIPTION_SET_RCVD_EID);
 
-    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+    /* every MsgId of the range has its own route to the pipe */
+    for (i = 0; i < 4; i++)
+    {
+        MsgId = CFE_SB_ValueToMsgId(CFE_SB_MsgIdToValue(SB_UT_TLM_MID) + i);
+        RoutePtr = CFE_SB_GetRoutePtrFromIdx(CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(MsgId)));
+        ASSERT_EQ(RoutePtr->Destinations, 1);
+        ASSERT_TRUE(CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId) != NULL);
+    }
 
-    /* Check unsubscribe after unsubscribe produces event */
-    UT_ClearEventHistory();
-    ASSERT(CFE_SB_Unsubscribe(MsgId, TestPipe));
-    EVTCNT(2);
-    EVTSENT(CFE_SB_UNSUB_NO_SUBS_EID);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.MsgIdsInUse, 4);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.DuplicateSubscriptionsCounter, 1);
 
-    TEARDOWN(CFE_SB_DeletePipe(TestPipe));
+    /* a message in the range is delivered like any other */
+    MsgId = SB_UT_TLM_MID2;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_SendMsg(TlmPktPtr));
 
-} /* end Test_Unsubscribe_Basic */
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+
+    /* a reported range is sent in one subscription packet, not one per MsgId */
+    CFE_SB_SetSubscriptionReporting(CFE_SB_ENABLE);
+    MsgIdRpt = CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID);
+    Size = sizeof(CFE_SB_AllSubscriptionsTlm_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgIdRpt, sizeof(MsgIdRpt), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+
+    ASSERT(CFE_SB_SubscribeRange(CFE_SB_ValueToMsgId(SB_UT_TLM_MID_VALUE_BASE + 10),
+                                 CFE_SB_ValueToMsgId(SB_UT_TLM_MID_VALUE_BASE + 13), PipeId));
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.NoSubscribersCounter, 1);
+    CFE_SB_SetSubscriptionReporting(CFE_SB_DISABLE);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_Subscribe_Range */
 
 /*
-** Test CFE internal API used to locally unsubscribe to a message (successful)
+** Test subscribing to all message ids matching a mask
 */
-void Test_Unsubscribe_Local(void)
+void Test_Subscribe_Mask(void)
 {
-    CFE_SB_PipeId_t TestPipe;
-    CFE_SB_MsgId_t  MsgId = SB_UT_TLM_MID;
-    uint16          PipeDepth = 50;
+    CFE_SB_PipeId_t      PipeId;
+    CFE_SB_MsgId_t       MsgId;
+    CFE_SB_MsgId_Atom_t  Base = CFE_SB_MsgIdToValue(SB_UT_TLM_MID) & ~3;
+    uint16               PipeDepth = 10;
+    int32                i;
 
-    SETUP(CFE_SB_CreatePipe(&TestPipe, PipeDepth, "TestPipe"));
-    SETUP(CFE_SB_Subscribe(MsgId, TestPipe));
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
 
-    ASSERT(CFE_SB_UnsubscribeLocal(SB_UT_LAST_VALID_MID, TestPipe));
+    ASSERT(CFE_SB_SubscribeMask(SB_UT_TLM_MID, (CFE_SB_MsgId_Atom_t)~3, PipeId));
 
-    EVTCNT(5);
+    EVTCNT(3);
 
-    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+    EVTSENT(CFE_SB_SUBSCRIPTION_SET_RCVD_EID);
 
-    TEARDOWN(CFE_SB_DeletePipe(TestPipe));
+    /* only the four MsgIds that differ in the two low bits match */
+    for (i = 0; i < 4; i++)
+    {
+        MsgId = CFE_SB_ValueToMsgId(Base + i);
+        ASSERT_TRUE(CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId) != NULL);
+    }
 
-} /* end Test_Unsubscribe_Local */
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.MsgIdsInUse, 4);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_Subscribe_Mask */
 
 /*
-** Test message unsubscription response to an invalid message ID
+** Test range and mask subscription error responses
 */
-void Test_Unsubscribe_InvalParam(void)
+void Test_Subscribe_SetErrors(void)
 {
-    CFE_SB_PipeId_t TestPipe;
-    CFE_ES_ResourceID_t  CallerId;
-    uint16          PipeDepth = 50;
-    CFE_SB_PipeId_t SavedPipeId;
+    CFE_SB_PipeId_t PipeId;
+    CFE_SB_PipeId_t BadPipeId = 2;
+    uint16          PipeDepth = 10;
+    uint16          RouteIdxTop;
 
-    SETUP(CFE_SB_CreatePipe(&TestPipe, PipeDepth, "TestPipe"));
+    ASSERT_EQ(CFE_SB_SubscribeRange(SB_UT_TLM_MID, SB_UT_TLM_MID3, BadPipeId), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_SUB_INV_PIPE_EID);
 
-    /* Perform test using a bad message ID */
-    ASSERT_EQ(CFE_SB_Unsubscribe(SB_UT_ALTERNATE_INVALID_MID, TestPipe), CFE_SB_BAD_ARGUMENT);
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
 
-    /* Get the caller's Application ID */
-    ASSERT(CFE_ES_GetAppID(&CallerId));
+    /* empty range */
+    ASSERT_EQ(CFE_SB_SubscribeRange(SB_UT_TLM_MID3, SB_UT_TLM_MID, PipeId), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_SUB_ARG_ERR_EID);
 
-    /* Perform test using a bad scope value */
-    ASSERT_EQ(CFE_SB_UnsubscribeFull(SB_UT_FIRST_VALID_MID, TestPipe, CFE_SB_LOCAL + 1, CallerId), CFE_SB_BAD_ARGUMENT);
+    /* invalid end of range */
+    ASSERT_EQ(CFE_SB_SubscribeRange(SB_UT_TLM_MID, SB_UT_ALTERNATE_INVALID_MID, PipeId), CFE_SB_BAD_ARGUMENT);
 
-    /* Perform test using an invalid pipe ID for branch path coverage.
-     * This situation cannot happen in normal circumstances since the
-     * bad pipe ID is caught by CFE_SB_GetPipeIdx() before it gets to
-     * CFE_SB_ValidatePipeId()
-     */
-    SavedPipeId = CFE_SB.PipeTbl[0].PipeId;
-    CFE_SB.PipeTbl[0].PipeId = CFE_PLATFORM_SB_MAX_PIPES;
-    CFE_SB.PipeTbl[0].InUse = 1;
-    ASSERT_EQ(CFE_SB_Unsubscribe(SB_UT_FIRST_VALID_MID, CFE_PLATFORM_SB_MAX_PIPES), CFE_SB_BAD_ARGUMENT);
+    /* more MsgIds than the routing table holds, nothing is subscribed */
+    ASSERT_EQ(CFE_SB_SubscribeRange(SB_UT_FIRST_VALID_MID,
+                                    CFE_SB_ValueToMsgId(CFE_PLATFORM_SB_MAX_MSG_IDS), PipeId),
+              CFE_SB_MAX_MSGS_MET);
+    EVTSENT(CFE_SB_MAX_MSGS_MET_EID);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.MsgIdsInUse, 0);
 
-    /* We must restore the old value so CFE_SB_DeletePipe() works */
-    CFE_SB.PipeTbl[0].PipeId = SavedPipeId;
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter, 3);
 
-    EVTCNT(4);
+    /* a destination that cannot be allocated backs out the whole set */
+    SETUP(CFE_SB_Subscribe(CFE_SB_ValueToMsgId(SB_UT_TLM_MID_VALUE_BASE + 1), PipeId));
+    RouteIdxTop = CFE_SB.RouteIdxTop;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 2, -1);
+    ASSERT_EQ(CFE_SB_SubscribeRange(SB_UT_TLM_MID, SB_UT_TLM_MID3, PipeId), CFE_SB_BUF_ALOC_ERR);
+    EVTSENT(CFE_SB_DEST_BLK_ERR_EID);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse, 1);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.MsgIdsInUse, 1);
+    ASSERT_EQ(CFE_SB.RouteIdxTop, RouteIdxTop);
+    ASSERT_TRUE(!CFE_SB_IsValidRouteIdx(CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(SB_UT_TLM_MID))));
+    ASSERT_TRUE(CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(CFE_SB_ValueToMsgId(SB_UT_TLM_MID_VALUE_BASE + 1)),
+                                  PipeId) != NULL);
 
-    EVTSENT(CFE_SB_UNSUB_ARG_ERR_EID);
+    ASSERT(CFE_SB_SubscribeRange(SB_UT_TLM_MID, SB_UT_TLM_MID3, PipeId));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse, 4);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.MsgIdsInUse, 4);
 
-    TEARDOWN(CFE_SB_DeletePipe(TestPipe));
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_Unsubscribe_InvalParam */
+} /* end Test_Subscribe_SetErrors */
 
 /*
-** Test message unsubscription response to a message ID that is not subscribed
+** Test delivering every Nth message of a subscription
 */
-void Test_Unsubscribe_NoMatch(void)
+void Test_Subscribe_PolicyEveryNth(void)
 {
-    CFE_SB_PipeId_t TestPipe;
-    CFE_SB_MsgId_t  MsgId = SB_UT_TLM_MID;
-    CFE_SB_MsgRouteIdx_t Idx;
-    uint16          PipeDepth = 50;
+    CFE_SB_PipeId_t         PipeId;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t        TlmPkt;
+    CFE_SB_MsgPtr_t         TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_DeliveryPolicy_t Policy;
+    CFE_SB_DestinationD_t   *DestPtr;
+    CFE_MSG_Size_t          Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
+    uint16                  PipeDepth = 10;
+    uint32                  i;
 
-    SETUP(CFE_SB_CreatePipe(&TestPipe, PipeDepth, "TestPipe"));
-    SETUP(CFE_SB_Subscribe(MsgId, TestPipe));
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+    memset(&Policy, 0, sizeof(Policy));
+    Policy.Mode  = CFE_SB_DELIVER_EVERY_NTH;
+    Policy.Param = 3;
 
-    ASSERT(CFE_SB_Unsubscribe(SB_UT_TLM_MID1, TestPipe));
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
 
-    /* Get index into routing table */
-    Idx = CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(MsgId));
-    CFE_SB.RoutingTbl[CFE_SB_RouteIdxToValue(Idx)].ListHeadPtr->PipeId = 1;
-    CFE_SB.RoutingTbl[CFE_SB_RouteIdxToValue(Idx)].ListHeadPtr->Next = NULL;
-    ASSERT(CFE_SB_Unsubscribe(MsgId, TestPipe));
+    ASSERT(CFE_SB_SetDeliveryPolicy(MsgId, PipeId, &Policy));
+    EVTSENT(CFE_SB_SET_POLICY_EID);
 
-    EVTCNT(7);
+    /* the 1st, 4th and 7th messages are delivered */
+    for (i = 0; i < 7; i++)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
 
-    EVTSENT(CFE_SB_UNSUB_NO_SUBS_EID);
+    DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId);
+    ASSERT_EQ(DestPtr->DestCnt, 3);
+    ASSERT_EQ(DestPtr->SkipCnt, 4);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, 3);
 
-    TEARDOWN(CFE_SB_DeletePipe(TestPipe));
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_Unsubscribe_NoMatch */
+} /* end Test_Subscribe_PolicyEveryNth */
 
 /*
-** Test message unsubscription response to an invalid pipe ID
+** Test delivering at most one message per interval
 */
-void Test_Unsubscribe_InvalidPipe(void)
+void Test_Subscribe_PolicyInterval(void)
 {
-    CFE_SB_PipeId_t TestPipe;
-    CFE_SB_MsgId_t  MsgId = SB_UT_TLM_MID;
-    uint16          PipeDepth = 50;
+    CFE_SB_PipeId_t         PipeId;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t        TlmPkt;
+    CFE_SB_MsgPtr_t         TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_DeliveryPolicy_t Policy;
+    CFE_SB_DestinationD_t   *DestPtr;
+    CFE_MSG_Size_t          Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
+    uint16                  PipeDepth = 10;
+    uint32                  SendTimeUsec[4] = {0, 500000, 999000, 1000000};
+    uint32                  i;
 
-    SETUP(CFE_SB_CreatePipe(&TestPipe, PipeDepth, "TestPipe"));
-    SETUP(CFE_SB_Subscribe(MsgId, TestPipe));
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+    memset(&Policy, 0, sizeof(Policy));
+    Policy.Mode  = CFE_SB_DELIVER_INTERVAL;
+    Policy.Param = 1000;
 
-    ASSERT_EQ(CFE_SB_Unsubscribe(MsgId, TestPipe + 1), CFE_SB_BAD_ARGUMENT);
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    SETUP(CFE_SB_SetDeliveryPolicy(MsgId, PipeId, &Policy));
 
-    EVTCNT(4);
+    /* only the sends at 0 and 1 second are delivered */
+    for (i = 0; i < 4; i++)
+    {
+        UT_SetBSP_Time(10 + (SendTimeUsec[i] / 1000000), SendTimeUsec[i] % 1000000);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
 
-    EVTSENT(CFE_SB_UNSUB_INV_PIPE_EID);
+    DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId);
+    ASSERT_EQ(DestPtr->DestCnt, 2);
+    ASSERT_EQ(DestPtr->SkipCnt, 2);
 
-    TEARDOWN(CFE_SB_DeletePipe(TestPipe));
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_Unsubscribe_InvalidPipe */
+} /* end Test_Subscribe_PolicyInterval */
 
 /*
-** Test message unsubscription response to an invalid pipe owner
+** Test delivering a message only when a field changes
 */
-void Test_Unsubscribe_InvalidPipeOwner(void)
+void Test_Subscribe_PolicyOnChange(void)
 {
-    CFE_SB_PipeId_t PipeId;
-    CFE_SB_MsgId_t  MsgId = SB_UT_TLM_MID;
-    CFE_ES_ResourceID_t RealOwner;
-    uint16          PipeDepth = 10;
+    CFE_SB_PipeId_t         PipeId;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t        TlmPkt;
+    CFE_SB_MsgPtr_t         TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_DeliveryPolicy_t Policy;
+    CFE_SB_DestinationD_t   *DestPtr;
+    CFE_MSG_Size_t          Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
+    uint16                  PipeDepth = 10;
+    uint8                   Values[5] = {1, 1, 2, 2, 1};
+    uint32                  i;
 
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+    memset(&Policy, 0, sizeof(Policy));
+    Policy.Mode        = CFE_SB_DELIVER_ON_CHANGE;
+    Policy.FieldOffset = offsetof(SB_UT_Test_Tlm_t, Tlm8Param1);
+    Policy.FieldSize   = 1;
 
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
     SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    SETUP(CFE_SB_SetDeliveryPolicy(MsgId, PipeId, &Policy));
 
-    /* Change owner of pipe through memory corruption */
-    RealOwner = CFE_SB.PipeTbl[PipeId].AppId;
-
-    /* Choose a value that is sure not be owner */
-    CFE_SB.PipeTbl[PipeId].AppId = UT_SB_ResourceID_Modify(RealOwner, 1);
-    ASSERT_EQ(CFE_SB_Unsubscribe(MsgId, PipeId), CFE_SB_BAD_ARGUMENT);
-
-    EVTCNT(4);
-
-    EVTSENT(CFE_SB_UNSUB_INV_CALLER_EID);
+    /* the 1st, 3rd and 5th messages change the field */
+    for (i = 0; i < 5; i++)
+    {
+        TlmPkt.Tlm8Param1 = Values[i];
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
 
-    CFE_SB.PipeTbl[PipeId].AppId = RealOwner;
+    DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId);
+    ASSERT_EQ(DestPtr->DestCnt, 3);
+    ASSERT_EQ(DestPtr->SkipCnt, 2);
 
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_Unsubscribe_InvalidPipeOwner */
+} /* end Test_Subscribe_PolicyOnChange */
 
 /*
-** Test message unsubscription response to the first pipe destination when
-** the message is subscribed to by multiple pipes
+** Test that a change dropped by a full pipe is delivered on the next send
 */
-void Test_Unsubscribe_FirstDestWithMany(void)
+void Test_Subscribe_PolicyOnChangeFull(void)
 {
-    CFE_SB_MsgId_t  MsgId = SB_UT_CMD_MID;
-    CFE_SB_PipeId_t TestPipe1;
-    CFE_SB_PipeId_t TestPipe2;
-    CFE_SB_PipeId_t TestPipe3;
-    uint16          PipeDepth = 50;
+    CFE_SB_PipeId_t         PipeId;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t        TlmPkt;
+    CFE_SB_MsgPtr_t         TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_MsgPtr_t         PtrToMsg;
+    CFE_SB_DeliveryPolicy_t Policy;
+    CFE_SB_DestinationD_t   *DestPtr;
+    CFE_MSG_Size_t          Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
+    uint16                  PipeDepth = 10;
+    uint8                   Values[4] = {1, 2, 2, 3};
+    uint32                  i;
 
-    SETUP(CFE_SB_CreatePipe(&TestPipe1, PipeDepth, "TestPipe1"));
-    SETUP(CFE_SB_CreatePipe(&TestPipe2, PipeDepth, "TestPipe2"));
-    SETUP(CFE_SB_CreatePipe(&TestPipe3, PipeDepth, "TestPipe3"));
-    SETUP(CFE_SB_Subscribe(MsgId, TestPipe1));
-    SETUP(CFE_SB_Subscribe(MsgId, TestPipe2));
-    SETUP(CFE_SB_Subscribe(MsgId, TestPipe3));
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+    memset(&Policy, 0, sizeof(Policy));
+    Policy.Mode        = CFE_SB_DELIVER_ON_CHANGE;
+    Policy.FieldOffset = offsetof(SB_UT_Test_Tlm_t, Tlm8Param1);
+    Policy.FieldSize   = 1;
 
-    ASSERT(CFE_SB_Unsubscribe(MsgId, TestPipe1));
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+    SETUP(CFE_SB_SubscribeEx(MsgId, PipeId, CFE_SB_Default_Qos, 1));
+    SETUP(CFE_SB_SetDeliveryPolicy(MsgId, PipeId, &Policy));
 
-    EVTCNT(10);
+    /* the change to 2 finds the pipe at its MsgId limit */
+    for (i = 0; i < 2; i++)
+    {
+        TlmPkt.Tlm8Param1 = Values[i];
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
 
-    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.MsgLimitErrorCounter, 1);
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)PtrToMsg)->Tlm8Param1, 1);
 
-    TEARDOWN(CFE_SB_DeletePipe(TestPipe1));
-    TEARDOWN(CFE_SB_DeletePipe(TestPipe2));
-    TEARDOWN(CFE_SB_DeletePipe(TestPipe3));
+    /* it is still a change once the pipe has room, and is delivered */
+    TlmPkt.Tlm8Param1 = Values[2];
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)PtrToMsg)->Tlm8Param1, 2);
 
-} /* end Test_Unsubscribe_FirstDestWithMany */
+    /* a change lost to a full queue is not taken as delivered either */
+    TlmPkt.Tlm8Param1 = Values[3];
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.PipeOverflowErrorCounter, 1);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)PtrToMsg)->Tlm8Param1, 3);
+
+    DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId);
+    ASSERT_EQ(DestPtr->SkipCnt, 0);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_Subscribe_PolicyOnChangeFull */
 
 /*
-** Test message unsubscription response to a middle pipe destination when
-** the message is subscribed to by multiple pipes
+** Test delivery policy error responses
 */
-void Test_Unsubscribe_MiddleDestWithMany(void)
+void Test_Subscribe_PolicyErrors(void)
 {
-    CFE_SB_MsgId_t  MsgId = SB_UT_CMD_MID;
-    CFE_SB_PipeId_t TestPipe1;
-    CFE_SB_PipeId_t TestPipe2;
-    CFE_SB_PipeId_t TestPipe3;
-    uint16          PipeDepth = 50;
+    CFE_SB_PipeId_t         PipeId;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    CFE_SB_DeliveryPolicy_t Policy;
+    uint16                  PipeDepth = 10;
 
-    SETUP(CFE_SB_CreatePipe(&TestPipe1, PipeDepth, "TestPipe1"));
-    SETUP(CFE_SB_CreatePipe(&TestPipe2, PipeDepth, "TestPipe2"));
-    SETUP(CFE_SB_CreatePipe(&TestPipe3, PipeDepth, "TestPipe3"));
-    SETUP(CFE_SB_Subscribe(MsgId, TestPipe1));
-    SETUP(CFE_SB_Subscribe(MsgId, TestPipe2));
-    SETUP(CFE_SB_Subscribe(MsgId, TestPipe3));
+    memset(&Policy, 0, sizeof(Policy));
 
-    ASSERT(CFE_SB_Unsubscribe(MsgId, TestPipe2));
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
 
-    EVTCNT(10);
+    /* not subscribed */
+    ASSERT_EQ(CFE_SB_SetDeliveryPolicy(MsgId, PipeId, &Policy), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_SET_POLICY_ERR_EID);
 
-    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
 
-    TEARDOWN(CFE_SB_DeletePipe(TestPipe1));
-    TEARDOWN(CFE_SB_DeletePipe(TestPipe2));
-    TEARDOWN(CFE_SB_DeletePipe(TestPipe3));
+    ASSERT_EQ(CFE_SB_SetDeliveryPolicy(MsgId, PipeId, NULL), CFE_SB_BAD_ARGUMENT);
 
-} /* end Test_Unsubscribe_MiddleDestWithMany */
+    Policy.Mode = CFE_SB_DELIVER_EVERY_NTH;
+    ASSERT_EQ(CFE_SB_SetDeliveryPolicy(MsgId, PipeId, &Policy), CFE_SB_BAD_ARGUMENT);
+
+    Policy.Mode = CFE_SB_DELIVER_ON_CHANGE;
+    Policy.FieldSize = 5;
+    ASSERT_EQ(CFE_SB_SetDeliveryPolicy(MsgId, PipeId, &Policy), CFE_SB_BAD_ARGUMENT);
+
+    Policy.Mode = 99;
+    ASSERT_EQ(CFE_SB_SetDeliveryPolicy(MsgId, PipeId, &Policy), CFE_SB_BAD_ARGUMENT);
+
+    Policy.Mode = CFE_SB_DELIVER_ALL;
+    ASSERT_EQ(CFE_SB_SetDeliveryPolicy(SB_UT_ALTERNATE_INVALID_MID, PipeId, &Policy), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_SetDeliveryPolicy(MsgId, CFE_PLATFORM_SB_MAX_PIPES, &Policy), CFE_SB_BAD_ARGUMENT);
+
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter, 7);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_Subscribe_PolicyErrors */
 
 /*
-** Test message unsubscription by verifying the message destination pointer no
-** longer points to the pipe
+** Test delivering messages through a broadcast topic
 */
-void Test_Unsubscribe_GetDestPtr(void)
+void Test_Subscribe_BcastTopic(void)
 {
-    CFE_SB_MsgId_t  MsgId = SB_UT_CMD_MID;
-    CFE_SB_PipeId_t TestPipe1;
-    CFE_SB_PipeId_t TestPipe2;
+    CFE_SB_PipeId_t  PipeId1;
+    CFE_SB_PipeId_t  PipeId2;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    uint16           PipeDepth = 10;
+    uint32           i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    SETUP(CFE_SB_CreatePipe(&PipeId1, PipeDepth, "TestPipe1"));
+    SETUP(CFE_SB_CreatePipe(&PipeId2, PipeDepth, "TestPipe2"));
+
+    /* one pipe subscribes before the topic is set, the other after */
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId1));
+    ASSERT(CFE_SB_SetBroadcastTopic(MsgId, 2));
+    EVTSENT(CFE_SB_BCAST_TOPIC_EID);
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId2));
+
+    ASSERT_TRUE(CFE_SB.PipeTbl[PipeId1].BcastMask != 0);
+    ASSERT_TRUE(CFE_SB.PipeTbl[PipeId2].BcastMask != 0);
+
+    /* the topic holds the last two messages, once for both pipes */
+    for (i = 0; i < 3; i++)
+    {
+        TlmPkt.Tlm8Param1 = i;
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
+
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, 2);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId1].InUse, 0);
+
+    /* the first message was overwritten before either pipe read it */
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId1, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)PtrToMsg)->Tlm8Param1, 1);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.PipeOverflowErrorCounter, 1);
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId1, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)PtrToMsg)->Tlm8Param1, 2);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId1, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId2, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)PtrToMsg)->Tlm8Param1, 1);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.PipeOverflowErrorCounter, 2);
+
+    /* removing the topic keeps the message PipeId2 is holding */
+    ASSERT(CFE_SB_SetBroadcastTopic(MsgId, 0));
+    ASSERT_EQ(CFE_SB.PipeTbl[PipeId1].BcastMask, 0);
+    ASSERT_EQ(CFE_SB.PipeTbl[PipeId2].BcastMask, 0);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, 1);
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)PtrToMsg)->Tlm8Param1, 1);
+
+    /* messages go through the pipe queues again */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId1].InUse, 1);
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId1, CFE_SB_POLL));
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+    TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+
+} /* end Test_Subscribe_BcastTopic */
+
+/*
+** Test the wait map, retired messages, overwritten slots and deferred removal
+** of a broadcast topic
+*/
+void Test_Subscribe_BcastTopicReaders(void)
+{
+    CFE_SB_PipeId_t      PipeId1;
+    CFE_SB_PipeId_t      PipeId2;
+    CFE_SB_MsgId_t       MsgId = SB_UT_TLM_MID;
+    CFE_SB_BcastTopic_t *TopicPtr;
+    SB_UT_Test_Tlm_t     TlmPkt;
+    CFE_SB_MsgPtr_t      TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_MsgPtr_t      PtrToMsg;
+    CFE_MSG_Size_t       Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t       Type = CFE_MSG_Type_Tlm;
+    uint16               PipeDepth = 10;
+    uint32               PutCount;
+    uint32               InUse;
+    uint32               i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    SETUP(CFE_SB_CreatePipe(&PipeId1, PipeDepth, "TestPipe1"));
+    SETUP(CFE_SB_CreatePipe(&PipeId2, PipeDepth, "TestPipe2"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId1));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId2));
+    SETUP(CFE_SB_SetBroadcastTopic(MsgId, 2));
+    TopicPtr = CFE_SB_FindBcastTopic(MsgId);
+
+    /* only the subscriber marked as blocked is woken */
+    CFE_SB_BcastSetWaiting(&CFE_SB.PipeTbl[PipeId2], true);
+    ASSERT_TRUE(TopicPtr->WaitMask[PipeId2 / 32] == (1UL << (PipeId2 % 32)));
+
+    PutCount = UT_GetStubCount(UT_KEY(OS_QueuePut));
+    TlmPkt.Tlm8Param1 = 0;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueuePut)), PutCount + 1);
+
+    CFE_SB_BcastSetWaiting(&CFE_SB.PipeTbl[PipeId2], false);
+    ASSERT_EQ(TopicPtr->WaitMask[PipeId2 / 32], 0);
+
+    /* a message overwritten while a reader is in the topic is kept until it leaves */
+    TopicPtr->Readers = 1;
+    for (i = 1; i < 3; i++)
+    {
+        TlmPkt.Tlm8Param1 = i;
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
+    ASSERT_TRUE(TopicPtr->Retired != NULL);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, 3);
+
+    TopicPtr->Readers = 0;
+    TlmPkt.Tlm8Param1 = 3;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT_TRUE(TopicPtr->Retired == NULL);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, 2);
+
+    /*
+    ** The pipe skips the two messages no longer held, and the next one as
+    ** its slot is being overwritten
+    */
+    TopicPtr->Slots[2 & TopicPtr->Mask].Seq = (2 * 4) + 1;
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId1, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)PtrToMsg)->Tlm8Param1, 3);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.PipeOverflowErrorCounter, 3);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId1, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+
+    /* a topic removed while a reader is in it is released by the SB task */
+    InUse = CFE_SB.StatTlmMsg.Payload.SBBuffersInUse;
+    TopicPtr->Readers = 1;
+    SETUP(CFE_SB_SetBroadcastTopic(MsgId, 0));
+    ASSERT_TRUE(TopicPtr->Slots == NULL);
+    ASSERT_TRUE(TopicPtr->RetiredSlots != NULL);
+    ASSERT_EQ(CFE_SB.BcastPending, 1);
+    ASSERT_TRUE(CFE_SB_FindBcastTopic(CFE_SB_INVALID_MSG_ID) != TopicPtr);
+
+    CFE_SB_UpdateBcastTopics();
+    ASSERT_EQ(CFE_SB.BcastPending, 1);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, InUse);
+
+    TopicPtr->Readers = 0;
+    CFE_SB_UpdateBcastTopics();
+    ASSERT_EQ(CFE_SB.BcastPending, 0);
+    ASSERT_TRUE(TopicPtr->RetiredSlots == NULL);
+    ASSERT_TRUE(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse < InUse);
+    ASSERT_TRUE(CFE_SB_FindBcastTopic(CFE_SB_INVALID_MSG_ID) == TopicPtr);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+    TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+
+} /* end Test_Subscribe_BcastTopicReaders */
+
+/*
+** Test broadcast topic error responses
+*/
+void Test_Subscribe_BcastTopicErrors(void)
+{
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    uint32           i;
+
+    ASSERT_EQ(CFE_SB_SetBroadcastTopic(SB_UT_ALTERNATE_INVALID_MID, 4), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_BCAST_TOPIC_ERR_EID);
+    ASSERT_EQ(CFE_SB_SetBroadcastTopic(MsgId, CFE_PLATFORM_SB_MAX_PIPE_DEPTH + 1), CFE_SB_BAD_ARGUMENT);
+
+    /* not a topic yet */
+    ASSERT_EQ(CFE_SB_SetBroadcastTopic(MsgId, 0), CFE_SB_BAD_ARGUMENT);
+
+    /* the ring cannot be allocated */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, -1);
+    ASSERT_EQ(CFE_SB_SetBroadcastTopic(MsgId, 4), CFE_SB_BUF_ALOC_ERR);
+
+    ASSERT(CFE_SB_SetBroadcastTopic(MsgId, 4));
+    ASSERT_EQ(CFE_SB_SetBroadcastTopic(MsgId, 4), CFE_SB_BAD_ARGUMENT);
+
+    /* every topic in use */
+    for (i = 1; i < CFE_PLATFORM_SB_MAX_BCAST_TOPICS; i++)
+    {
+        ASSERT(CFE_SB_SetBroadcastTopic(CFE_SB_ValueToMsgId(SB_UT_TLM_MID_VALUE_BASE + 10 + i), 4));
+    }
+    ASSERT_EQ(CFE_SB_SetBroadcastTopic(CFE_SB_ValueToMsgId(SB_UT_TLM_MID_VALUE_BASE + 10), 4),
+              CFE_SB_MAX_MSGS_MET);
+
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter, 6);
+
+    ASSERT(CFE_SB_SetBroadcastTopic(MsgId, 0));
+    for (i = 1; i < CFE_PLATFORM_SB_MAX_BCAST_TOPICS; i++)
+    {
+        ASSERT(CFE_SB_SetBroadcastTopic(CFE_SB_ValueToMsgId(SB_UT_TLM_MID_VALUE_BASE + 10 + i), 0));
+    }
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.MemInUse, 0);
+
+} /* end Test_Subscribe_BcastTopicErrors */
+
+/*
+** Test subscribing a pipe to a list of message IDs
+*/
+void Test_Subscribe_Many(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgIdList[CFE_SB_SUB_ENTRIES_PER_PKT + 5];
+    CFE_SB_MsgId_t   MsgIdRpt[2];
+    CFE_MSG_Size_t   Size[2];
+    uint32           i;
+
+    for (i = 0; i < CFE_SB_SUB_ENTRIES_PER_PKT + 5; i++)
+    {
+        MsgIdList[i] = CFE_SB_ValueToMsgId(SB_UT_TLM_MID_VALUE_BASE + 10 + i);
+    }
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 10, "TestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgIdList[1], PipeId));
+
+    ASSERT(CFE_SB_SubscribeMany(MsgIdList, 3, PipeId, CFE_SB_Default_Qos, 4));
+    EVTSENT(CFE_SB_SUBSCRIPTION_LIST_RCVD_EID);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.DuplicateSubscriptionsCounter, 1);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.MsgIdsInUse, 3);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse, 3);
+    ASSERT_EQ(CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgIdList[2]), PipeId)->MsgId2PipeLim, 4);
+
+    /* the list is reported in two packets rather than one per MsgId */
+    CFE_SB_SetSubscriptionReporting(CFE_SB_ENABLE);
+    MsgIdRpt[0] = CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID);
+    MsgIdRpt[1] = MsgIdRpt[0];
+    Size[0] = sizeof(CFE_SB_AllSubscriptionsTlm_t);
+    Size[1] = Size[0];
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIdRpt, sizeof(MsgIdRpt), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
+
+    ASSERT(CFE_SB_SubscribeMany(MsgIdList, CFE_SB_SUB_ENTRIES_PER_PKT + 5, PipeId, CFE_SB_Default_Qos,
+                                CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT));
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.NoSubscribersCounter, 2);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.DuplicateSubscriptionsCounter, 4);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse, CFE_SB_SUB_ENTRIES_PER_PKT + 5);
+    CFE_SB_SetSubscriptionReporting(CFE_SB_DISABLE);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse, 0);
+
+} /* end Test_Subscribe_Many */
+
+/*
+** Test list subscription error responses
+*/
+void Test_Subscribe_ManyErrors(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgIdList[3];
+    CFE_ES_ResourceID_t RealOwner;
+    uint32           i;
+
+    MsgIdList[0] = SB_UT_TLM_MID1;
+    MsgIdList[1] = SB_UT_ALTERNATE_INVALID_MID;
+    MsgIdList[2] = SB_UT_TLM_MID2;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 10, "TestPipe"));
+
+    ASSERT_EQ(CFE_SB_SubscribeMany(MsgIdList, 1, PipeId + 1, CFE_SB_Default_Qos, 4), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_SUB_INV_PIPE_EID);
+
+    RealOwner = CFE_SB.PipeTbl[PipeId].AppId;
+    CFE_SB.PipeTbl[PipeId].AppId = UT_SB_ResourceID_Modify(RealOwner, 1);
+    ASSERT_EQ(CFE_SB_SubscribeMany(MsgIdList, 1, PipeId, CFE_SB_Default_Qos, 4), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_SUB_INV_CALLER_EID);
+    CFE_SB.PipeTbl[PipeId].AppId = RealOwner;
+
+    ASSERT_EQ(CFE_SB_SubscribeMany(NULL, 1, PipeId, CFE_SB_Default_Qos, 4), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_SubscribeMany(MsgIdList, 0, PipeId, CFE_SB_Default_Qos, 4), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_SubscribeMany(MsgIdList, CFE_PLATFORM_SB_MAX_MSG_IDS + 1, PipeId, CFE_SB_Default_Qos, 4),
+              CFE_SB_BAD_ARGUMENT);
+
+    /* one bad MsgId rejects the whole list */
+    ASSERT_EQ(CFE_SB_SubscribeMany(MsgIdList, 3, PipeId, CFE_SB_Default_Qos, 4), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_SUB_ARG_ERR_EID);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse, 0);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter, 6);
+
+    /* a failed destination allocation backs out the MsgIds before it */
+    MsgIdList[1] = SB_UT_TLM_MID3;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 2, -1);
+    ASSERT_EQ(CFE_SB_SubscribeMany(MsgIdList, 3, PipeId, CFE_SB_Default_Qos, 4), CFE_SB_BUF_ALOC_ERR);
+    EVTSENT(CFE_SB_DEST_BLK_ERR_EID);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse, 0);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.MsgIdsInUse, 0);
+    ASSERT_TRUE(!CFE_SB_IsValidRouteIdx(CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(SB_UT_TLM_MID1))));
+    ASSERT_EQ(CFE_SB.PipeTbl[PipeId].RouteMap[0], 0);
+
+    ASSERT(CFE_SB_SubscribeMany(MsgIdList, 3, PipeId, CFE_SB_Default_Qos, 4));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse, 3);
+    SETUP(CFE_SB_UnsubscribeMany(MsgIdList, 3, PipeId));
+
+    /* a MsgId listed twice needs one routing table entry */
+    for (i = 0; CFE_SB.RouteIdxTop < (CFE_PLATFORM_SB_MAX_MSG_IDS - 1); i++)
+    {
+        SETUP(CFE_SB_Subscribe(CFE_SB_ValueToMsgId(i), PipeId));
+    }
+    MsgIdList[0] = CFE_SB_ValueToMsgId(CFE_PLATFORM_SB_MAX_MSG_IDS);
+    MsgIdList[1] = MsgIdList[0];
+    ASSERT(CFE_SB_SubscribeMany(MsgIdList, 2, PipeId, CFE_SB_Default_Qos, 4));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.MsgIdsInUse, CFE_PLATFORM_SB_MAX_MSG_IDS);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.DuplicateSubscriptionsCounter, 1);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_Subscribe_ManyErrors */
+
+/*
+** Function for calling SB unsubscribe API test functions
+*/
+void Test_Unsubscribe_API(void)
+{
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_Basic);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_Local);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_InvalParam);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_NoMatch);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_InvalidPipe);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_InvalidPipeOwner);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_FirstDestWithMany);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_MiddleDestWithMany);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_GetDestPtr);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_DestArray);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_Many);
+} /* end Test_Unsubscribe_API */
+
+/*
+** Test API used to unsubscribe to a message (successful)
+*/
+void Test_Unsubscribe_Basic(void)
+{
+    CFE_SB_PipeId_t TestPipe;
+    CFE_SB_MsgId_t  MsgId = SB_UT_INTERMEDIATE_VALID_MID;
+    uint16          PipeDepth = 50;
+
+    SETUP(CFE_SB_CreatePipe(&TestPipe, PipeDepth, "TestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, TestPipe));
+
+    ASSERT(CFE_SB_Unsubscribe(MsgId, TestPipe));
+
+    EVTCNT(4);
+
+    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+
+    /* Check unsubscribe after unsubscribe produces event */
+    UT_ClearEventHistory();
+    ASSERT(CFE_SB_Unsubscribe(MsgId, TestPipe));
+    EVTCNT(2);
+    EVTSENT(CFE_SB_UNSUB_NO_SUBS_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(TestPipe));
+
+} /* end Test_Unsubscribe_Basic */
+
+/*
+** Test CFE internal API used to locally unsubscribe to a message (successful)
+*/
+void Test_Unsubscribe_Local(void)
+{
+    CFE_SB_PipeId_t TestPipe;
+    CFE_SB_MsgId_t  MsgId = SB_UT_TLM_MID;
+    uint16          PipeDepth = 50;
+
+    SETUP(CFE_SB_CreatePipe(&TestPipe, PipeDepth, "TestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, TestPipe));
+
+    ASSERT(CFE_SB_UnsubscribeLocal(SB_UT_LAST_VALID_MID, TestPipe));
+
+    EVTCNT(5);
+
+    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(TestPipe));
+
+} /* end Test_Unsubscribe_Local */
+
+/*
+** Test message unsubscription response to an invalid message ID
+*/
+void Test_Unsubscribe_InvalParam(void)
+{
+    CFE_SB_PipeId_t TestPipe;
+    CFE_ES_ResourceID_t  CallerId;
+    uint16          PipeDepth = 50;
+    CFE_SB_PipeId_t SavedPipeId;
+
+    SETUP(CFE_SB_CreatePipe(&TestPipe, PipeDepth, "TestPipe"));
+
+    /* Perform test using a bad message ID */
+    ASSERT_EQ(CFE_SB_Unsubscribe(SB_UT_ALTERNATE_INVALID_MID, TestPipe), CFE_SB_BAD_ARGUMENT);
+
+    /* Get the caller's Application ID */
+    ASSERT(CFE_ES_GetAppID(&CallerId));
+
+    /* Perform test using a bad scope value */
+    ASSERT_EQ(CFE_SB_UnsubscribeFull(SB_UT_FIRST_VALID_MID, TestPipe, CFE_SB_LOCAL + 1, CallerId), CFE_SB_BAD_ARGUMENT);
+
+    /* Perform test using an invalid pipe ID for branch path coverage.
+     * This situation cannot happen in normal circumstances since the
+     * bad pipe ID is caught by CFE_SB_GetPipeIdx() before it gets to
+     * CFE_SB_ValidatePipeId()
+     */
+    SavedPipeId = CFE_SB.PipeTbl[0].PipeId;
+    CFE_SB.PipeTbl[0].PipeId = CFE_PLATFORM_SB_MAX_PIPES;
+    CFE_SB.PipeTbl[0].InUse = 1;
+    ASSERT_EQ(CFE_SB_Unsubscribe(SB_UT_FIRST_VALID_MID, CFE_PLATFORM_SB_MAX_PIPES), CFE_SB_BAD_ARGUMENT);
+
+    /* We must restore the old value so CFE_SB_DeletePipe() works */
+    CFE_SB.PipeTbl[0].PipeId = SavedPipeId;
+
+    EVTCNT(4);
+
+    EVTSENT(CFE_SB_UNSUB_ARG_ERR_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(TestPipe));
+
+} /* end Test_Unsubscribe_InvalParam */
+
+/*
+** Test message unsubscription response to a message ID that is not subscribed
+*/
+void Test_Unsubscribe_NoMatch(void)
+{
+    CFE_SB_PipeId_t TestPipe;
+    CFE_SB_MsgId_t  MsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgRouteIdx_t Idx;
     uint16          PipeDepth = 50;
 
-    SETUP(CFE_SB_CreatePipe(&TestPipe1, PipeDepth, "TestPipe1"));
-    SETUP(CFE_SB_CreatePipe(&TestPipe2, PipeDepth, "TestPipe2"));
-    SETUP(CFE_SB_Subscribe(MsgId, TestPipe1));
-    SETUP(CFE_SB_Subscribe(MsgId, TestPipe2));
-    SETUP(CFE_SB_Unsubscribe(MsgId, TestPipe2));
+    SETUP(CFE_SB_CreatePipe(&TestPipe, PipeDepth, "TestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, TestPipe));
+
+    ASSERT(CFE_SB_Unsubscribe(SB_UT_TLM_MID1, TestPipe));
+
+    /* Get index into routing table */
+    Idx = CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(MsgId));
+    CFE_SB.RoutingTbl[CFE_SB_RouteIdxToValue(Idx)].DestArray[0].PipeId = 1;
+    ASSERT(CFE_SB_Unsubscribe(MsgId, TestPipe));
+
+    EVTCNT(7);
+
+    EVTSENT(CFE_SB_UNSUB_NO_SUBS_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(TestPipe));
+
+} /* end Test_Unsubscribe_NoMatch */
+
+/*
+** Test message unsubscription response to an invalid pipe ID
+*/
+void Test_Unsubscribe_InvalidPipe(void)
+{
+    CFE_SB_PipeId_t TestPipe;
+    CFE_SB_MsgId_t  MsgId = SB_UT_TLM_MID;
+    uint16          PipeDepth = 50;
+
+    SETUP(CFE_SB_CreatePipe(&TestPipe, PipeDepth, "TestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, TestPipe));
+
+    ASSERT_EQ(CFE_SB_Unsubscribe(MsgId, TestPipe + 1), CFE_SB_BAD_ARGUMENT);
+
+    EVTCNT(4);
+
+    EVTSENT(CFE_SB_UNSUB_INV_PIPE_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(TestPipe));
+
+} /* end Test_Unsubscribe_InvalidPipe */
+
+/*
+** Test message unsubscription response to an invalid pipe owner
+*/
+void Test_Unsubscribe_InvalidPipeOwner(void)
+{
+    CFE_SB_PipeId_t PipeId;
+    CFE_SB_MsgId_t  MsgId = SB_UT_TLM_MID;
+    CFE_ES_ResourceID_t RealOwner;
+    uint16          PipeDepth = 10;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    /* Change owner of pipe through memory corruption */
+    RealOwner = CFE_SB.PipeTbl[PipeId].AppId;
+
+    /* Choose a value that is sure not be owner */
+    CFE_SB.PipeTbl[PipeId].AppId = UT_SB_ResourceID_Modify(RealOwner, 1);
+    ASSERT_EQ(CFE_SB_Unsubscribe(MsgId, PipeId), CFE_SB_BAD_ARGUMENT);
+
+    EVTCNT(4);
+
+    EVTSENT(CFE_SB_UNSUB_INV_CALLER_EID);
+
+    CFE_SB.PipeTbl[PipeId].AppId = RealOwner;
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_Unsubscribe_InvalidPipeOwner */
+
+/*
+** Test message unsubscription response to the first pipe destination when
+** the message is subscribed to by multiple pipes
+*/
+void Test_Unsubscribe_FirstDestWithMany(void)
+{
+    CFE_SB_MsgId_t  MsgId = SB_UT_CMD_MID;
+    CFE_SB_PipeId_t TestPipe1;
+    CFE_SB_PipeId_t TestPipe2;
+    CFE_SB_PipeId_t TestPipe3;
+    uint16          PipeDepth = 50;
+
+    SETUP(CFE_SB_CreatePipe(&TestPipe1, PipeDepth, "TestPipe1"));
+    SETUP(CFE_SB_CreatePipe(&TestPipe2, PipeDepth, "TestPipe2"));
+    SETUP(CFE_SB_CreatePipe(&TestPipe3, PipeDepth, "TestPipe3"));
+    SETUP(CFE_SB_Subscribe(MsgId, TestPipe1));
+    SETUP(CFE_SB_Subscribe(MsgId, TestPipe2));
+    SETUP(CFE_SB_Subscribe(MsgId, TestPipe3));
+
+    ASSERT(CFE_SB_Unsubscribe(MsgId, TestPipe1));
+
+    EVTCNT(10);
+
+    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(TestPipe1));
+    TEARDOWN(CFE_SB_DeletePipe(TestPipe2));
+    TEARDOWN(CFE_SB_DeletePipe(TestPipe3));
+
+} /* end Test_Unsubscribe_FirstDestWithMany */
+
+/*
+** Test message unsubscription response to a middle pipe destination when
+** the message is subscribed to by multiple pipes
+*/
+void Test_Unsubscribe_MiddleDestWithMany(void)
+{
+    CFE_SB_MsgId_t  MsgId = SB_UT_CMD_MID;
+    CFE_SB_PipeId_t TestPipe1;
+    CFE_SB_PipeId_t TestPipe2;
+    CFE_SB_PipeId_t TestPipe3;
+    uint16          PipeDepth = 50;
+
+    SETUP(CFE_SB_CreatePipe(&TestPipe1, PipeDepth, "TestPipe1"));
+    SETUP(CFE_SB_CreatePipe(&TestPipe2, PipeDepth, "TestPipe2"));
+    SETUP(CFE_SB_CreatePipe(&TestPipe3, PipeDepth, "TestPipe3"));
+    SETUP(CFE_SB_Subscribe(MsgId, TestPipe1));
+    SETUP(CFE_SB_Subscribe(MsgId, TestPipe2));
+    SETUP(CFE_SB_Subscribe(MsgId, TestPipe3));
+
+    ASSERT(CFE_SB_Unsubscribe(MsgId, TestPipe2));
+
+    EVTCNT(10);
+
+    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(TestPipe1));
+    TEARDOWN(CFE_SB_DeletePipe(TestPipe2));
+    TEARDOWN(CFE_SB_DeletePipe(TestPipe3));
+
+} /* end Test_Unsubscribe_MiddleDestWithMany */
+
+/*
+** Test message unsubscription by verifying the message destination pointer no
+** longer points to the pipe
+*/
+void Test_Unsubscribe_GetDestPtr(void)
+{
+    CFE_SB_MsgId_t  MsgId = SB_UT_CMD_MID;
+    CFE_SB_PipeId_t TestPipe1;
+    CFE_SB_PipeId_t TestPipe2;
+    uint16          PipeDepth = 50;
+
+    SETUP(CFE_SB_CreatePipe(&TestPipe1, PipeDepth, "TestPipe1"));
+    SETUP(CFE_SB_CreatePipe(&TestPipe2, PipeDepth, "TestPipe2"));
+    SETUP(CFE_SB_Subscribe(MsgId, TestPipe1));
+    SETUP(CFE_SB_Subscribe(MsgId, TestPipe2));
+    SETUP(CFE_SB_Unsubscribe(MsgId, TestPipe2));
+
+    ASSERT_TRUE(CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), TestPipe2) == NULL);
+
+    EVTCNT(7);
+
+    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(TestPipe1));
+    TEARDOWN(CFE_SB_DeletePipe(TestPipe2));
+
+} /* end Test_Unsubscribe_GetDestPtr */
+
+/*
+** Test that the destination array grows on subscribe, keeps the newest
+** subscription first, and closes the gap on unsubscribe
+*/
+void Test_Unsubscribe_DestArray(void)
+{
+    CFE_SB_MsgId_t       MsgId = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t      PipeId[CFE_SB_MIN_DEST_ARRAY_SIZE + 1];
+    CFE_SB_RouteEntry_t  *RoutePtr;
+    char                 PipeName[OS_MAX_API_NAME];
+    uint16               PipeDepth = 10;
+    int32                i;
+
+    for (i = 0; i < CFE_SB_MIN_DEST_ARRAY_SIZE + 1; i++)
+    {
+        snprintf(PipeName, OS_MAX_API_NAME, "TestPipe%ld", (long) i);
+        SETUP(CFE_SB_CreatePipe(&PipeId[i], PipeDepth, PipeName));
+    }
+
+    for (i = 0; i < CFE_SB_MIN_DEST_ARRAY_SIZE; i++)
+    {
+        SETUP(CFE_SB_Subscribe(MsgId, PipeId[i]));
+    }
+
+    RoutePtr = CFE_SB_GetRoutePtrFromIdx(CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(MsgId)));
+    ASSERT_EQ(RoutePtr->DestArraySize, CFE_SB_MIN_DEST_ARRAY_SIZE);
+
+    /* A failed grow leaves the array untouched */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, -1);
+    ASSERT_EQ(CFE_SB_Subscribe(MsgId, PipeId[CFE_SB_MIN_DEST_ARRAY_SIZE]), CFE_SB_BUF_ALOC_ERR);
+    ASSERT_EQ(RoutePtr->Destinations, CFE_SB_MIN_DEST_ARRAY_SIZE);
+    ASSERT_EQ(RoutePtr->DestArray[0].PipeId, PipeId[CFE_SB_MIN_DEST_ARRAY_SIZE - 1]);
+
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId[CFE_SB_MIN_DEST_ARRAY_SIZE]));
+    ASSERT_EQ(RoutePtr->DestArraySize, 2 * CFE_SB_MIN_DEST_ARRAY_SIZE);
+    ASSERT_EQ(RoutePtr->Destinations, CFE_SB_MIN_DEST_ARRAY_SIZE + 1);
+    ASSERT_EQ(RoutePtr->DestArray[0].PipeId, PipeId[CFE_SB_MIN_DEST_ARRAY_SIZE]);
+    ASSERT_EQ(RoutePtr->DestArray[CFE_SB_MIN_DEST_ARRAY_SIZE].PipeId, PipeId[0]);
+
+    /* Removing from the middle shifts the older subscriptions down */
+    SETUP(CFE_SB_Unsubscribe(MsgId, PipeId[2]));
+    ASSERT_EQ(RoutePtr->Destinations, CFE_SB_MIN_DEST_ARRAY_SIZE);
+    ASSERT_EQ(RoutePtr->DestArray[CFE_SB_MIN_DEST_ARRAY_SIZE - 2].PipeId, PipeId[1]);
+    ASSERT_EQ(RoutePtr->DestArray[CFE_SB_MIN_DEST_ARRAY_SIZE - 1].PipeId, PipeId[0]);
+    ASSERT_TRUE(CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId[1]) ==
+                &RoutePtr->DestArray[CFE_SB_MIN_DEST_ARRAY_SIZE - 2]);
+
+    EVTCNT(3 * (CFE_SB_MIN_DEST_ARRAY_SIZE + 1) + 2);
+
+    EVTSENT(CFE_SB_DEST_BLK_ERR_EID);
+
+    for (i = 0; i < CFE_SB_MIN_DEST_ARRAY_SIZE + 1; i++)
+    {
+        TEARDOWN(CFE_SB_DeletePipe(PipeId[i]));
+    }
+
+} /* end Test_Unsubscribe_DestArray */
+
+/*
+** Test unsubscribing a pipe from a list of message IDs
+*/
+void Test_Unsubscribe_Many(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_PipeId_t  OtherPipeId;
+    CFE_SB_MsgId_t   MsgIdList[4];
+    CFE_ES_ResourceID_t RealOwner;
+
+    MsgIdList[0] = SB_UT_TLM_MID1;
+    MsgIdList[1] = SB_UT_TLM_MID2;
+    MsgIdList[2] = SB_UT_TLM_MID3;
+    MsgIdList[3] = SB_UT_TLM_MID4;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 10, "TestPipe"));
+    SETUP(CFE_SB_CreatePipe(&OtherPipeId, 10, "OtherPipe"));
+    SETUP(CFE_SB_SubscribeMany(MsgIdList, 3, PipeId, CFE_SB_Default_Qos, 4));
+    SETUP(CFE_SB_Subscribe(MsgIdList[1], OtherPipeId));
+
+    ASSERT_EQ(CFE_SB_UnsubscribeMany(MsgIdList, 2, PipeId + 2), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_UNSUB_INV_PIPE_EID);
+
+    RealOwner = CFE_SB.PipeTbl[PipeId].AppId;
+    CFE_SB.PipeTbl[PipeId].AppId = UT_SB_ResourceID_Modify(RealOwner, 1);
+    ASSERT_EQ(CFE_SB_UnsubscribeMany(MsgIdList, 2, PipeId), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_UNSUB_INV_CALLER_EID);
+    CFE_SB.PipeTbl[PipeId].AppId = RealOwner;
+
+    ASSERT_EQ(CFE_SB_UnsubscribeMany(NULL, 2, PipeId), CFE_SB_BAD_ARGUMENT);
+    MsgIdList[3] = SB_UT_ALTERNATE_INVALID_MID;
+    ASSERT_EQ(CFE_SB_UnsubscribeMany(MsgIdList, 4, PipeId), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_UNSUB_ARG_ERR_EID);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse, 4);
+
+    /* MsgIds the pipe is not subscribed to are skipped */
+    MsgIdList[3] = SB_UT_TLM_MID5;
+    ASSERT(CFE_SB_UnsubscribeMany(&MsgIdList[1], 3, PipeId));
+    EVTSENT(CFE_SB_SUBSCRIPTION_LIST_REMOVED_EID);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse, 2);
+    ASSERT_TRUE(CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgIdList[0]), PipeId) != NULL);
+    ASSERT_TRUE(CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgIdList[1]), PipeId) == NULL);
+    ASSERT_TRUE(CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgIdList[1]), OtherPipeId) != NULL);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    TEARDOWN(CFE_SB_DeletePipe(OtherPipeId));
+
+} /* end Test_Unsubscribe_Many */
+
+/*
+** Function for calling SB send message API test functions
+*/
+void Test_SendMsg_API(void)
+{
+    SB_UT_ADD_SUBTEST(Test_SendMsg_NullPtr);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_NoSubscribers);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_MaxMsgSizePlusOne);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_BasicSend);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_SequenceCount);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_QueuePutError);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_PipeFull);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_MsgLimitExceeded);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_SendErrReports);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_GetPoolBufErr);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_ZeroCopyGetPtr);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_ZeroCopySend);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_ZeroCopyPass);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_ZeroCopyReleasePtr);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_DisabledDestination);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_SendWithMetadata);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_MaxMsgSizePlusOne_ZeroCopy);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_NoSubscribers_ZeroCopy);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_Batch);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_BatchErrors);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_ZeroCopySendBatch);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_LatestValuePipe);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_LatestValueUnsubscribe);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_Coalesce);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_PriorityLane);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_LosslessWait);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_LosslessTimeOut);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_LosslessSignal);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_Latency);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_IoVec);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_IoVecErrors);
+} /* end Test_SendMsg_API */
+
+/*
+** Test response to sending a null message on the software bus
+*/
+void Test_SendMsg_NullPtr(void)
+{
+    ASSERT_EQ(CFE_SB_SendMsg(NULL), CFE_SB_BAD_ARGUMENT);
+
+    EVTCNT(1);
+
+    EVTSENT(CFE_SB_SEND_BAD_ARG_EID);
+
+} /* end Test_SendMsg_NullPtr */
+
+/*
+** Test response to sending a message which has no subscribers
+*/
+void Test_SendMsg_NoSubscribers(void)
+{
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+
+    EVTCNT(1);
+
+    EVTSENT(CFE_SB_SEND_NO_SUBS_EID);
+
+} /* end Test_SendMsg_NoSubscribers */
+
+/*
+** Test response to sending a message with the message size larger than allowed
+*/
+void Test_SendMsg_MaxMsgSizePlusOne(void)
+{
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_MSG_Size_t   Size = CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+
+    ASSERT_EQ(CFE_SB_SendMsg(TlmPktPtr), CFE_SB_MSG_TOO_BIG);
+
+    EVTCNT(1);
+
+    EVTSENT(CFE_SB_MSG_TOO_BIG_EID);
+
+} /* end Test_SendMsg_MaxMsgSizePlusOne */
+
+/*
+** Test successfully sending a message on the software bus
+*/
+void Test_SendMsg_BasicSend(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    int32            PipeDepth = 2;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+
+    EVTCNT(3);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_BasicSend */
+
+/* Sequence count hook */
+static int32 UT_CheckSetSequenceCount(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    CFE_MSG_SequenceCount_t *SeqCntPtr = UserObj;
+
+    *SeqCntPtr = UT_Hook_GetArgValueByName(Context, "SeqCnt", CFE_MSG_SequenceCount_t);
+
+    return StubRetcode;
+}
+
+/*
+** Test successful send/receive for packet sequence count
+*/
+void Test_SendMsg_SequenceCount(void)
+{
+    CFE_SB_PipeId_t         PipeId;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t        TlmPkt;
+    CFE_SB_MsgPtr_t         TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_MSG_Size_t          Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
+    uint32                  PipeDepth = 10;
+    CFE_MSG_SequenceCount_t SeqCnt;
+
+    /* Set up hook for checking CFE_MSG_SetSequenceCount calls */
+    UT_SetHookFunction(UT_KEY(CFE_MSG_SetSequenceCount), UT_CheckSetSequenceCount, &SeqCnt);
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "SeqCntTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_SetSequenceCount)), 1);
+    ASSERT_EQ(SeqCnt, 1);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_PassMsg(TlmPktPtr));
+
+    /* Assert sequence count wasn't set */
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_SetSequenceCount)), 1);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT_EQ(SeqCnt, 2);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_SetSequenceCount)), 2);
+
+    EVTCNT(3);
+    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+
+    SETUP(CFE_SB_Unsubscribe(MsgId, PipeId)); /* should have no subscribers now */
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_SendMsg(TlmPktPtr)); /* increment to 3 */
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_SetSequenceCount)), 3);
+
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId)); /* resubscribe so we can receive a msg */
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_SendMsg(TlmPktPtr)); /* increment to 4 */
+    ASSERT_EQ(SeqCnt, 4);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_SetSequenceCount)), 4);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_SequenceCount */
+
+/*
+** Test send message response to a socket queue 'put' error
+*/
+void Test_SendMsg_QueuePutError(void)
+{
+    CFE_SB_PipeId_t  PipeId4Error;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    int32            PipeDepth = 2;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId4Error, PipeDepth, "TestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId4Error));
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+
+    CFE_SB_SendErrReports();
+
+    EVTCNT(5);
+
+    EVTSENT(CFE_SB_Q_WR_ERR_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId4Error));
+
+} /* end Test_SendMsg_QueuePutError */
+
+/*
+** Test send message response when the socket queue is full
+*/
+void Test_SendMsg_PipeFull(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    int32            PipeDepth = 1;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "PipeFullTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+
+    /* This send should pass */
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+
+    /* Tell the QueuePut stub to return OS_QUEUE_FULL on its next call */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+
+    /* Pipe overflow causes SendMsg to return CFE_SUCCESS */
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+
+    CFE_SB_SendErrReports();
+
+    EVTCNT(5);
+
+    EVTSENT(CFE_SB_Q_FULL_ERR_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_PipeFull */
+
+/*
+** Test that a send with a timeout waits for room on a full lossless pipe
+*/
+void Test_SendMsg_LosslessWait(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    int32            PipeDepth = 1;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "LosslessTestPipe"));
+    SETUP(CFE_SB_SetPipeOpts(PipeId, CFE_SB_PIPEOPTS_LOSSLESS));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    /* The pipe is full on the first write only */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsgTimeout(TlmPktPtr, 100));
+
+    /* the write made after announcing the wait finds room, no wait needed */
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueuePut)), 2);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_CountSemTimedWait)), 0);
+    ASSERT_EQ(CFE_SB.PipeTbl[PipeId].WritersWaiting, 0);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.PipeOverflowErrorCounter, 0);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].InUse, 1);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_LosslessWait */
+
+/*
+** Test that a send with a timeout drops the message for a lossless pipe
+** that stays full, and that other senders do not wait
+*/
+void Test_SendMsg_LosslessTimeOut(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    int32            PipeDepth = 1;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "LosslessTestPipe"));
+    SETUP(CFE_SB_SetPipeOpts(PipeId, CFE_SB_PIPEOPTS_LOSSLESS));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    UT_SetForceFail(UT_KEY(OS_QueuePut), OS_QUEUE_FULL);
+    UT_SetForceFail(UT_KEY(OS_CountSemTimedWait), OS_SEM_TIMEOUT);
+
+    /* one wait for the whole timeout, with a write before and after it */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT_EQ(CFE_SB_SendMsgTimeout(TlmPktPtr, 20), CFE_SB_TIME_OUT);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueuePut)), 3);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_CountSemTimedWait)), 1);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_TaskDelay)), 0);
+    ASSERT_EQ(CFE_SB.PipeTbl[PipeId].WritersWaiting, 0);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.PipeOverflowErrorCounter, 1);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].InUse, 0);
+
+    /* A plain send makes a single attempt */
+    UT_ResetState(UT_KEY(OS_QueuePut));
+    UT_SetForceFail(UT_KEY(OS_QueuePut), OS_QUEUE_FULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueuePut)), 1);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.PipeOverflowErrorCounter, 2);
+
+    UT_ClearForceFail(UT_KEY(OS_QueuePut));
+    UT_ClearForceFail(UT_KEY(OS_CountSemTimedWait));
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_LosslessTimeOut */
+
+/*
+** Test that readers and unsubscriptions wake the senders waiting on a
+** lossless pipe, and the life cycle of its space semaphore
+*/
+void Test_SendMsg_LosslessSignal(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_PipeId_t  PipeId2;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    int32            PipeDepth = 2;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "LosslessTestPipe"));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_CountSemCreate)), 0);
+
+    /* the semaphore is created once, when the pipe first becomes lossless */
+    SETUP(CFE_SB_SetPipeOpts(PipeId, CFE_SB_PIPEOPTS_LOSSLESS));
+    SETUP(CFE_SB_SetPipeOpts(PipeId, CFE_SB_PIPEOPTS_LOSSLESS));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_CountSemCreate)), 1);
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    /* a read only gives the semaphore while a sender is waiting */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_CountSemGive)), 0);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_SendMsg(TlmPktPtr));
+    CFE_SB.PipeTbl[PipeId].WritersWaiting = 1;
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_CountSemGive)), 1);
+
+    /* so does removing a destination of the pipe */
+    SETUP(CFE_SB_Unsubscribe(MsgId, PipeId));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_CountSemGive)), 2);
+    CFE_SB.PipeTbl[PipeId].WritersWaiting = 0;
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_CountSemDelete)), 1);
+
+    /* a pipe that cannot get its semaphore does not become lossless */
+    SETUP(CFE_SB_CreatePipe(&PipeId2, PipeDepth, "LosslessTestPipe2"));
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, OS_ERROR);
+    ASSERT_EQ(CFE_SB_SetPipeOpts(PipeId2, CFE_SB_PIPEOPTS_LOSSLESS), CFE_SB_INTERNAL_ERR);
+    ASSERT_EQ(CFE_SB.PipeTbl[PipeId2].Opts & CFE_SB_PIPEOPTS_LOSSLESS, 0);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.PipeOptsErrorCounter, 1);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_CountSemDelete)), 1);
+
+} /* end Test_SendMsg_LosslessSignal */
+
+/*
+** Test that the send to receive latency is recorded in the pipe histogram
+*/
+void Test_SendMsg_Latency(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    int32            PipeDepth = 2;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_SB_LatencyHist_t *HistPtr;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "LatencyTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    HistPtr = &CFE_SB.PipeTbl[PipeId].Latency;
+
+    UT_SetBSP_Time(10, 0);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+
+    /* 100 usec lands in the [64, 128) bucket */
+    UT_SetBSP_Time(10, 100);
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+
+    ASSERT_EQ(HistPtr->Samples, 1);
+    ASSERT_EQ(HistPtr->MaxLatency, 100);
+    ASSERT_EQ(HistPtr->Bucket[7], 1);
+
+    UT_SetBSP_Time(0, 0);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_Latency */
+
+/*
+** Test sending a message gathered from a header and payload fragments
+*/
+void Test_SendMsg_IoVec(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    SB_UT_Test_Tlm_t *RcvPtr;
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    CFE_SB_IoVec_t   IoVec[3];
+    uint32           Param = 0x12345678;
+    uint16           Params16[2] = { 11, 22 };
+    int32            PipeDepth = 2;
+    CFE_MSG_Size_t   Size = sizeof(CFE_SB_TlmHdr_t) + sizeof(Param) + sizeof(Params16);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    bool             HasSec = true;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    IoVec[0].Base   = &TlmPkt.Hdr;
+    IoVec[0].Length = sizeof(TlmPkt.Hdr);
+    IoVec[1].Base   = &Param;
+    IoVec[1].Length = sizeof(Param);
+    IoVec[2].Base   = Params16;
+    IoVec[2].Length = sizeof(Params16);
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "IoVecTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetHasSecondaryHeader), &HasSec, sizeof(HasSec), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsgV(IoVec, 3));
+
+    /* The header is fixed up in the SB buffer */
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_SetSize)), 1);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_GenerateChecksum)), 1);
+
+    /* A single buffer was used, and it went to the pipe */
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, 1);
+
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    RcvPtr = (SB_UT_Test_Tlm_t *)PtrToMsg;
+    ASSERT_EQ(RcvPtr->Tlm32Param1, 0x12345678);
+    ASSERT_EQ(RcvPtr->Tlm16Param1, 11);
+    ASSERT_EQ(RcvPtr->Tlm16Param2, 22);
+
+    /* An empty fragment is allowed */
+    IoVec[1].Base   = NULL;
+    IoVec[1].Length = 0;
+    Size = sizeof(CFE_SB_TlmHdr_t) + sizeof(Params16);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetHasSecondaryHeader), &HasSec, sizeof(HasSec), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsgV(IoVec, 3));
+
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    RcvPtr = (SB_UT_Test_Tlm_t *)PtrToMsg;
+    ASSERT_TRUE(memcmp(&RcvPtr->Tlm32Param1, Params16, sizeof(Params16)) == 0);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_IoVec */
+
+/*
+** Test response to bad fragments and buffer allocation failure in
+** CFE_SB_SendMsgV
+*/
+void Test_SendMsg_IoVecErrors(void)
+{
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_IoVec_t   IoVec[2];
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    bool             HasSec = true;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    IoVec[0].Base   = &TlmPkt.Hdr;
+    IoVec[0].Length = sizeof(TlmPkt.Hdr);
+    IoVec[1].Base   = NULL;
+    IoVec[1].Length = 4;
+
+    ASSERT_EQ(CFE_SB_SendMsgV(NULL, 1), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_SendMsgV(IoVec, 0), CFE_SB_BAD_ARGUMENT);
+
+    /* A fragment with a length but no data */
+    ASSERT_EQ(CFE_SB_SendMsgV(IoVec, 2), CFE_SB_BAD_ARGUMENT);
+
+    /* A first fragment shorter than the primary header */
+    IoVec[0].Length = sizeof(CFE_SB_Msg_t) - 1;
+    ASSERT_EQ(CFE_SB_SendMsgV(IoVec, 1), CFE_SB_BAD_ARGUMENT);
+
+    EVTCNT(4);
+    EVTSENT(CFE_SB_SEND_BAD_ARG_EID);
+
+    /* Total larger than the mission limit */
+    IoVec[0].Length = sizeof(TlmPkt.Hdr);
+    IoVec[1].Base   = &TlmPkt;
+    IoVec[1].Length = CFE_MISSION_SB_MAX_SB_MSG_SIZE;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetHasSecondaryHeader), &HasSec, sizeof(HasSec), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    ASSERT_EQ(CFE_SB_SendMsgV(IoVec, 2), CFE_SB_MSG_TOO_BIG);
+    EVTSENT(CFE_SB_MSG_TOO_BIG_EID);
+
+    /* Buffer allocation failure */
+    IoVec[1].Length = sizeof(TlmPkt) - sizeof(TlmPkt.Hdr);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetHasSecondaryHeader), &HasSec, sizeof(HasSec), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, -1);
+    ASSERT_EQ(CFE_SB_SendMsgV(IoVec, 2), CFE_SB_BUF_ALOC_ERR);
+    EVTSENT(CFE_SB_GET_BUF_ERR_EID);
+
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter, 6);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_SetSize)), 0);
+
+    /* A message shorter than the secondary header its first fragment declares */
+    IoVec[0].Length = sizeof(CFE_SB_Msg_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetHasSecondaryHeader), &HasSec, sizeof(HasSec), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    ASSERT_EQ(CFE_SB_SendMsgV(IoVec, 1), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter, 7);
+
+    /* The size cannot be set in the gathered header; the buffer is released */
+    IoVec[0].Length = sizeof(TlmPkt.Hdr);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetHasSecondaryHeader), &HasSec, sizeof(HasSec), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_SetSize), 1, CFE_MSG_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_SendMsgV(IoVec, 2), CFE_MSG_BAD_ARGUMENT);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_GenerateChecksum)), 0);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, 0);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter, 8);
+
+    /* The checksum cannot be generated; the buffer is released */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetHasSecondaryHeader), &HasSec, sizeof(HasSec), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_GenerateChecksum), 1, CFE_MSG_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_SendMsgV(IoVec, 2), CFE_MSG_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, 0);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter, 9);
+
+    /* A non-command packet is not an error even though no checksum is generated */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetHasSecondaryHeader), &HasSec, sizeof(HasSec), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_GenerateChecksum), 1, CFE_MSG_WRONG_MSG_TYPE);
+    ASSERT(CFE_SB_SendMsgV(IoVec, 2));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, 0);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter, 9);
+
+} /* end Test_SendMsg_IoVecErrors */
+
+/*
+** Test send message response to too many messages sent to the pipe
+*/
+void Test_SendMsg_MsgLimitExceeded(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    int32            PipeDepth = 5;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "MsgLimTestPipe"));
+
+    /* Set maximum allowed messages on the pipe at one time to 1 */
+    CFE_SB_SubscribeEx(MsgId, PipeId, CFE_SB_Default_Qos, 1);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
 
-    ASSERT_TRUE(CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), TestPipe2) == NULL);
+    /* First send should pass */
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
 
-    EVTCNT(7);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
 
-    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+    /* This send should produce a MsgId to Pipe Limit Exceeded message, but
+     * return success
+     */
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
 
-    TEARDOWN(CFE_SB_DeletePipe(TestPipe1));
-    TEARDOWN(CFE_SB_DeletePipe(TestPipe2));
+    CFE_SB_SendErrReports();
 
-} /* end Test_Unsubscribe_GetDestPtr */
+    EVTCNT(5);
+
+    EVTSENT(CFE_SB_MSGID_LIM_ERR_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_MsgLimitExceeded */
 
 /*
-** Function for calling SB send message API test functions
+** Test that a latest value pipe keeps only the newest message of a MsgId
 */
-void Test_SendMsg_API(void)
+void Test_SendMsg_LatestValuePipe(void)
 {
-    SB_UT_ADD_SUBTEST(Test_SendMsg_NullPtr);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_NoSubscribers);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_MaxMsgSizePlusOne);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_BasicSend);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_SequenceCount);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_QueuePutError);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_PipeFull);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_MsgLimitExceeded);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_GetPoolBufErr);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_ZeroCopyGetPtr);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_ZeroCopySend);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_ZeroCopyPass);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_ZeroCopyReleasePtr);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_DisabledDestination);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_SendWithMetadata);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_MaxMsgSizePlusOne_ZeroCopy);
-    SB_UT_ADD_SUBTEST(Test_SendMsg_NoSubscribers_ZeroCopy);
-} /* end Test_SendMsg_API */
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    int32            PipeDepth = 1;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    uint32           i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "LatestTestPipe"));
+    SETUP(CFE_SB_SetPipeOpts(PipeId, CFE_SB_PIPEOPTS_LATEST));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    /* more sends than the pipe depth or the msg limit allow */
+    for (i = 1; i <= 3; i++)
+    {
+        TlmPkt.Tlm32Param1 = i;
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
+
+    /* the queued message and the newest are held, the one between released */
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, 2);
+
+    CFE_SB_SendErrReports();
+    ASSERT_TRUE(!UT_EventIsInHistory(CFE_SB_Q_FULL_ERR_EID));
+    ASSERT_TRUE(!UT_EventIsInHistory(CFE_SB_MSGID_LIM_ERR_EID));
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.PipeOverflowErrorCounter, 0);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.MsgLimitErrorCounter, 0);
+
+    /* the reader gets the newest message, once */
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)PtrToMsg)->Tlm32Param1, 3);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_LatestValuePipe */
 
 /*
-** Test response to sending a null message on the software bus
+** Test that a high priority subscription is received ahead of earlier
+** normal priority messages on the same pipe
 */
-void Test_SendMsg_NullPtr(void)
+void Test_SendMsg_PriorityLane(void)
 {
-    ASSERT_EQ(CFE_SB_SendMsg(NULL), CFE_SB_BAD_ARGUMENT);
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   HighMsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t   NormMsgId = SB_UT_TLM_MID1;
+    CFE_SB_Qos_t     Quality = {1, 0};
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    int32            PipeDepth = 2;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_SB_PipeDepthStats_t *StatObj;
 
-    EVTCNT(1);
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
 
-    EVTSENT(CFE_SB_SEND_BAD_ARG_EID);
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "PriorityTestPipe"));
+    SETUP(CFE_SB_SubscribeEx(HighMsgId, PipeId, Quality, 1));
+    SETUP(CFE_SB_Subscribe(NormMsgId, PipeId));
+    StatObj = &CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId];
 
-} /* end Test_SendMsg_NullPtr */
+    /* the normal priority message is sent first */
+    TlmPkt.Tlm32Param1 = 1;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &NormMsgId, sizeof(NormMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+
+    TlmPkt.Tlm32Param1 = 2;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &HighMsgId, sizeof(HighMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+
+    ASSERT_EQ(StatObj->InUse, 2);
+    ASSERT_EQ(StatObj->HighInUse, 1);
+    ASSERT_EQ(StatObj->HighPeakInUse, 1);
+
+    /* the high priority message is received first */
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)PtrToMsg)->Tlm32Param1, 2);
+    ASSERT_EQ(StatObj->HighInUse, 0);
+
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)PtrToMsg)->Tlm32Param1, 1);
+    ASSERT_EQ(StatObj->InUse, 0);
+    ASSERT_EQ(StatObj->Overflows, 0);
+    ASSERT_EQ(StatObj->HighOverflows, 0);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_PriorityLane */
 
 /*
-** Test response to sending a message which has no subscribers
+** Test that unsubscribing releases the message held for a latest value pipe
 */
-void Test_SendMsg_NoSubscribers(void)
+void Test_SendMsg_LatestValueUnsubscribe(void)
 {
+    CFE_SB_PipeId_t  PipeId;
     CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
     SB_UT_Test_Tlm_t TlmPkt;
     CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    int32            PipeDepth = 1;
     CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    uint32           i;
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
 
-    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "LatestTestPipe"));
+    SETUP(CFE_SB_SetPipeOpts(PipeId, CFE_SB_PIPEOPTS_LATEST));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
 
-    EVTCNT(1);
+    for (i = 1; i <= 2; i++)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
 
-    EVTSENT(CFE_SB_SEND_NO_SUBS_EID);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, 2);
 
-} /* end Test_SendMsg_NoSubscribers */
+    /* the queued message stays on the pipe, the held one is released */
+    ASSERT(CFE_SB_Unsubscribe(MsgId, PipeId));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, 1);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, 0);
+
+} /* end Test_SendMsg_LatestValueUnsubscribe */
 
 /*
-** Test response to sending a message with the message size larger than allowed
+** Test that a coalescing subscription keeps one pending message in the pipe
+** while the other subscriptions of the pipe queue every message
 */
-void Test_SendMsg_MaxMsgSizePlusOne(void)
+void Test_SendMsg_Coalesce(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   HkMsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t   OtherMsgId = SB_UT_TLM_MID1;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    int32            PipeDepth = 2;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_SB_MsgId_t   SendMsgId[4];
+    uint32           i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "CoalesceTestPipe"));
+    SETUP(CFE_SB_Subscribe(HkMsgId, PipeId));
+    SETUP(CFE_SB_Subscribe(OtherMsgId, PipeId));
+
+    ASSERT_EQ(CFE_SB_SetCoalescing(SB_UT_ALTERNATE_INVALID_MID, PipeId, true), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_SetCoalescing(SB_UT_TLM_MID2, PipeId, true), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_SET_COALESCE_ERR_EID);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter, 2);
+
+    ASSERT(CFE_SB_SetCoalescing(HkMsgId, PipeId, true));
+    EVTSENT(CFE_SB_SET_COALESCE_EID);
+
+    /* a burst of the coalescing MsgId takes one slot of the pipe */
+    SendMsgId[0] = HkMsgId;
+    SendMsgId[1] = OtherMsgId;
+    SendMsgId[2] = HkMsgId;
+    SendMsgId[3] = HkMsgId;
+    for (i = 0; i < 4; i++)
+    {
+        TlmPkt.Tlm32Param1 = i + 1;
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &SendMsgId[i], sizeof(SendMsgId[i]), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
+
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].InUse, 2);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, 3);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.PipeOverflowErrorCounter, 0);
+
+    /* the newest message is received in the place of the first one */
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)PtrToMsg)->Tlm32Param1, 4);
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)PtrToMsg)->Tlm32Param1, 2);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+
+    /* with coalescing off every message is queued again */
+    ASSERT(CFE_SB_SetCoalescing(HkMsgId, PipeId, false));
+    for (i = 0; i < 2; i++)
+    {
+        TlmPkt.Tlm32Param1 = i + 5;
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &HkMsgId, sizeof(HkMsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].InUse, 2);
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)PtrToMsg)->Tlm32Param1, 5);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_Coalesce */
+
+/*
+** Test that pipe errors are counted by the send path and reported later
+** by the SB task, one event per MsgId, pipe and error
+*/
+void Test_SendMsg_SendErrReports(void)
 {
+    CFE_SB_PipeId_t  PipeId;
     CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
     SB_UT_Test_Tlm_t TlmPkt;
     CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
-    CFE_MSG_Size_t   Size = CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    uint32           i;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 5, "SendErrPipe"));
+    SETUP(CFE_SB_SubscribeEx(MsgId, PipeId, CFE_SB_Default_Qos, 1));
+
+    /* The first send passes, the others exceed the MsgId to pipe limit */
+    for (i = 0; i < 4; i++)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
+
+    /* Nothing is sent from the sender's context */
+    EVTCNT(3);
+    ASSERT_EQ(CFE_SB.SendErrTbl[0].Count, 3);
+    ASSERT_EQ(CFE_SB.SendErrTbl[0].EventId, CFE_SB_MSGID_LIM_ERR_EID);
+    ASSERT_EQ(CFE_SB.SendErrTbl[1].Count, 0);
+
+    /* One report, along with the pipe name lookup event */
+    CFE_SB_SendErrReports();
+    EVTCNT(5);
+    EVTSENT(CFE_SB_MSGID_LIM_ERR_EID);
+    ASSERT_EQ(CFE_SB.SendErrTbl[0].Count, 0);
+
+    /* Nothing new to report */
+    CFE_SB_SendErrReports();
+    EVTCNT(5);
+
+    /* Errors that do not fit in the table are only counted */
+    for (i = 0; i <= CFE_SB_SEND_ERR_TBL_SIZE; i++)
+    {
+        CFE_SB_RecordSendErr_Unsync(CFE_SB_ValueToMsgId(CFE_SB_MsgIdToValue(SB_UT_FIRST_VALID_MID) + i), PipeId,
+                                    CFE_SB_Q_FULL_ERR_EID, 0, CFE_ES_RESOURCEID_UNDEFINED);
+    }
+
+    ASSERT_EQ(CFE_SB.SendErrsLost, 1);
+
+    CFE_SB_SendErrReports();
+    EVTCNT(5 + 2 * CFE_SB_SEND_ERR_TBL_SIZE);
+    EVTSENT(CFE_SB_Q_FULL_ERR_EID);
+    ASSERT_EQ(CFE_SB.SendErrsLost, 0);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_SendErrReports */
+
+/*
+** Test send message response to a buffer descriptor allocation failure
+*/
+void Test_SendMsg_GetPoolBufErr(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    int32            PipeDepth;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
 
+    PipeDepth = 1;
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "GetPoolErrPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
 
-    ASSERT_EQ(CFE_SB_SendMsg(TlmPktPtr), CFE_SB_MSG_TOO_BIG);
+    /* Have GetPoolBuf stub return error on its next call (buf descriptor
+     * allocation failed)
+     */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    ASSERT_EQ(CFE_SB_SendMsg(TlmPktPtr), CFE_SB_BUF_ALOC_ERR);
+
+    EVTCNT(4);
+
+    EVTSENT(CFE_SB_GET_BUF_ERR_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_GetPoolBufErr */
+
+/*
+** Test getting a pointer to a buffer for zero copy mode with buffer
+** allocation failures
+*/
+void Test_SendMsg_ZeroCopyGetPtr(void)
+{
+    CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl;
+    uint16                  MsgSize = 10;
+
+    /* Have GetPoolBuf stub return error on its next call (buffer
+     * allocation failed)
+     */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    ASSERT_TRUE((cpuaddr) CFE_SB_ZeroCopyGetPtr(MsgSize, &ZeroCpyBufHndl) == (cpuaddr) NULL);
+
+    /* Have AppID_ToIndex fail so the buffer cannot be given an owner */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_AppID_ToIndex), 1, -1);
+    ASSERT_TRUE((cpuaddr) CFE_SB_ZeroCopyGetPtr(MsgSize, &ZeroCpyBufHndl) == (cpuaddr) NULL);
+
+    EVTCNT(0);
+
+    /* Increase the peak memory and buffers in use above the expected values in
+     * order to exercise branch paths
+     */
+    CFE_SB.StatTlmMsg.Payload.MemInUse = 0;
+    CFE_SB.StatTlmMsg.Payload.PeakMemInUse = MsgSize + sizeof(CFE_SB_BufferD_t) + 1;
+    CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse =
+      CFE_SB.StatTlmMsg.Payload.SBBuffersInUse + 2;
+    ASSERT_TRUE((cpuaddr) CFE_SB_ZeroCopyGetPtr(MsgSize, &ZeroCpyBufHndl) != (cpuaddr) NULL);
+
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PeakMemInUse, MsgSize + sizeof(CFE_SB_BufferD_t) + 1);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.MemInUse, MsgSize + sizeof(CFE_SB_BufferD_t));
+
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse, CFE_SB.StatTlmMsg.Payload.SBBuffersInUse + 1);
+
+    EVTCNT(0);
+
+} /* end Test_SendMsg_ZeroCopyGetPtr */
+
+/*
+** Test successfully sending a message in zero copy mode (telemetry source
+** sequence count increments)
+*/
+void Test_SendMsg_ZeroCopySend(void)
+{
+    CFE_SB_MsgPtr_t         PtrToMsg;
+    CFE_SB_PipeId_t         PipeId;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgPtr_t         ZeroCpyMsgPtr = NULL;
+    uint32                  PipeDepth = 10;
+    CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl = 0;
+    CFE_MSG_SequenceCount_t SeqCnt;
+    CFE_MSG_Size_t          Size = sizeof(SB_UT_Test_Tlm_t);
+    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
 
-    EVTCNT(1);
+    /* Set up hook for checking CFE_MSG_SetSequenceCount calls */
+    UT_SetHookFunction(UT_KEY(CFE_MSG_SetSequenceCount), UT_CheckSetSequenceCount, &SeqCnt);
 
-    EVTSENT(CFE_SB_MSG_TOO_BIG_EID);
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "ZeroCpyTestPipe"));
 
-} /* end Test_SendMsg_MaxMsgSizePlusOne */
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
 
-/*
-** Test successfully sending a message on the software bus
-*/
-void Test_SendMsg_BasicSend(void)
-{
-    CFE_SB_PipeId_t  PipeId;
-    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
-    SB_UT_Test_Tlm_t TlmPkt;
-    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
-    int32            PipeDepth = 2;
-    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
-    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    ZeroCpyMsgPtr = CFE_SB_ZeroCopyGetPtr(sizeof(SB_UT_Test_Tlm_t),&ZeroCpyBufHndl);
+    if (ZeroCpyMsgPtr == NULL)
+    {
+        UtAssert_Failed("Unexpected NULL pointer returned from ZeroCopyGetPtr");
+    }
 
+    /* Test response to a get pool information error */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBufInfo), 1, -1);
+    ASSERT_EQ(CFE_SB_ZeroCopySend(ZeroCpyMsgPtr, ZeroCpyBufHndl), CFE_SB_BUFFER_INVALID);
 
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
-    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
 
-    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    /* Test a successful zero copy send */
+    ASSERT(CFE_SB_ZeroCopySend(ZeroCpyMsgPtr, ZeroCpyBufHndl));
 
-    EVTCNT(3);
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_PEND_FOREVER));
 
-    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    ASSERT_TRUE(PtrToMsg != NULL);
 
-} /* end Test_SendMsg_BasicSend */
+    ASSERT_EQ(SeqCnt, 1);
 
-/* Sequence count hook */
-static int32 UT_CheckSetSequenceCount(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
-{
-    CFE_MSG_SequenceCount_t *SeqCntPtr = UserObj;
+    EVTCNT(3);
 
-    *SeqCntPtr = UT_Hook_GetArgValueByName(Context, "SeqCnt", CFE_MSG_SequenceCount_t);
+    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
 
-    return StubRetcode;
-}
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_ZeroCopySend */
 
 /*
-** Test successful send/receive for packet sequence count
+** Test successfully sending a message in zero copy mode (telemetry source
+** sequence count is unchanged)
 */
-void Test_SendMsg_SequenceCount(void)
+void Test_SendMsg_ZeroCopyPass(void)
 {
-    CFE_SB_PipeId_t         PipeId;
+    CFE_SB_MsgPtr_t PtrToMsg;
+    CFE_SB_PipeId_t PipeId;
     CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
-    SB_UT_Test_Tlm_t        TlmPkt;
-    CFE_SB_MsgPtr_t         TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
-    CFE_MSG_Size_t          Size = sizeof(TlmPkt);
-    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
+    CFE_SB_MsgPtr_t         ZeroCpyMsgPtr = NULL;
     uint32                  PipeDepth = 10;
-    CFE_MSG_SequenceCount_t SeqCnt;
+    CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl = 0;
+    CFE_MSG_SequenceCount_t SeqCnt = 22;
+    CFE_MSG_Size_t          Size = sizeof(SB_UT_Test_Tlm_t);
+    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
 
     /* Set up hook for checking CFE_MSG_SetSequenceCount calls */
     UT_SetHookFunction(UT_KEY(CFE_MSG_SetSequenceCount), UT_CheckSetSequenceCount, &SeqCnt);
 
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "SeqCntTestPipe"));
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "ZeroCpyPassTestPipe"));
     SETUP(CFE_SB_Subscribe(MsgId, PipeId));
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
-    SETUP(CFE_SB_SendMsg(TlmPktPtr));
-    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_SetSequenceCount)), 1);
-    ASSERT_EQ(SeqCnt, 1);
+    ZeroCpyMsgPtr = CFE_SB_ZeroCopyGetPtr(sizeof(SB_UT_Test_Tlm_t),
+                                          &ZeroCpyBufHndl);
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
-    ASSERT(CFE_SB_PassMsg(TlmPktPtr));
+    if (ZeroCpyMsgPtr == NULL)
+    {
+        UtAssert_Failed("Unexpected NULL pointer returned from ZeroCopyGetPtr");
+    }
 
-    /* Assert sequence count wasn't set */
-    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_SetSequenceCount)), 1);
+    /* Test response to a get pool information error */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBufInfo), 1, -1);
+    ASSERT_EQ(CFE_SB_ZeroCopyPass(ZeroCpyMsgPtr, ZeroCpyBufHndl), CFE_SB_BUFFER_INVALID);
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
-    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
-    ASSERT_EQ(SeqCnt, 2);
-    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_SetSequenceCount)), 2);
+
+    /* Test a successful zero copy pass */
+    ASSERT(CFE_SB_ZeroCopyPass(ZeroCpyMsgPtr, ZeroCpyBufHndl));
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_PEND_FOREVER));
+
+    ASSERT_TRUE(PtrToMsg != NULL);
+    ASSERT_EQ(SeqCnt, 22);
 
     EVTCNT(3);
+
     EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
 
-    SETUP(CFE_SB_Unsubscribe(MsgId, PipeId)); /* should have no subscribers now */
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
-    SETUP(CFE_SB_SendMsg(TlmPktPtr)); /* increment to 3 */
-    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_SetSequenceCount)), 3);
+} /* end Test_SendMsg_ZeroCopyPass */
 
-    SETUP(CFE_SB_Subscribe(MsgId, PipeId)); /* resubscribe so we can receive a msg */
+/*
+** Test releasing a pointer to a buffer for zero copy mode
+*/
+void Test_SendMsg_ZeroCopyReleasePtr(void)
+{
+    CFE_SB_MsgPtr_t         ZeroCpyMsgPtr1 = NULL;
+    CFE_SB_MsgPtr_t         ZeroCpyMsgPtr2 = NULL;
+    CFE_SB_MsgPtr_t         ZeroCpyMsgPtr3 = NULL;
+    CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl1 = 0;
+    CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl2 = 0;
+    CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl3 = 0;
+    uint16                  MsgSize = 10;
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
-    SETUP(CFE_SB_SendMsg(TlmPktPtr)); /* increment to 4 */
-    ASSERT_EQ(SeqCnt, 4);
-    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_SetSequenceCount)), 4);
+    ZeroCpyMsgPtr1 = CFE_SB_ZeroCopyGetPtr(MsgSize, &ZeroCpyBufHndl1);
+    ZeroCpyMsgPtr2 = CFE_SB_ZeroCopyGetPtr(MsgSize, &ZeroCpyBufHndl2);
+    ZeroCpyMsgPtr3 = CFE_SB_ZeroCopyGetPtr(MsgSize, &ZeroCpyBufHndl3);
+    SETUP(CFE_SB_ZeroCopyReleasePtr(ZeroCpyMsgPtr2, ZeroCpyBufHndl2));
 
-    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    /* Test response to an invalid buffer */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBufInfo), 1, -1);
+    ASSERT_EQ(CFE_SB_ZeroCopyReleasePtr(ZeroCpyMsgPtr2, ZeroCpyBufHndl2), CFE_SB_BUFFER_INVALID);
 
-} /* end Test_SendMsg_SequenceCount */
+    /* Test response to a null message pointer */
+    ASSERT_EQ(CFE_SB_ZeroCopyReleasePtr(NULL, ZeroCpyBufHndl2), CFE_SB_BUFFER_INVALID);
+
+    /* Test response to an invalid message pointer */
+    ASSERT_EQ(CFE_SB_ZeroCopyReleasePtr((CFE_SB_Msg_t *) 0x1234,
+                                       ZeroCpyBufHndl2), CFE_SB_BUFFER_INVALID);
+
+    /* Test response to releasing a buffer that was already released */
+    ASSERT_EQ(CFE_SB_ZeroCopyReleasePtr(ZeroCpyMsgPtr2, ZeroCpyBufHndl2), CFE_SB_BUFFER_INVALID);
+
+    /* Test path when return the buffer to the pool fails */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, -1);
+    ASSERT(CFE_SB_ZeroCopyReleasePtr(ZeroCpyMsgPtr3, ZeroCpyBufHndl3));
+
+    /* Test successful release of the first buffer */
+    ASSERT(CFE_SB_ZeroCopyReleasePtr(ZeroCpyMsgPtr1, ZeroCpyBufHndl1));
+
+    EVTCNT(0);
+
+} /* end Test_SendMsg_ZeroCopyReleasePtr */
 
 /*
-** Test send message response to a socket queue 'put' error
+** Test send message response with the destination disabled
 */
-void Test_SendMsg_QueuePutError(void)
+void Test_SendMsg_DisabledDestination(void)
 {
-    CFE_SB_PipeId_t  PipeId4Error;
-    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
-    SB_UT_Test_Tlm_t TlmPkt;
-    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
-    int32            PipeDepth = 2;
-    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
-    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_SB_PipeId_t       PipeId;
+    CFE_SB_MsgId_t        MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t      TlmPkt;
+    CFE_SB_MsgPtr_t       TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_DestinationD_t *DestPtr;
+    int32                 PipeDepth;
+    CFE_MSG_Type_t        Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t        Size = sizeof(TlmPkt);
+
+    PipeDepth = 2;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId);
+    DestPtr->Active = CFE_SB_INACTIVE;
 
-    SETUP(CFE_SB_CreatePipe(&PipeId4Error, PipeDepth, "TestPipe"));
-    SETUP(CFE_SB_Subscribe(MsgId, PipeId4Error));
-    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_ERROR);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
 
     ASSERT(CFE_SB_SendMsg(TlmPktPtr));
 
-    EVTCNT(5);
+    EVTCNT(3);
 
-    EVTSENT(CFE_SB_Q_WR_ERR_EID);
+    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
 
-    TEARDOWN(CFE_SB_DeletePipe(PipeId4Error));
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_SendMsg_QueuePutError */
+} /* end Test_SendMsg_DisabledDestination */
 
 /*
-** Test send message response when the socket queue is full
+** Test successfully sending a message with the metadata
 */
-void Test_SendMsg_PipeFull(void)
+void Test_SendMsg_SendWithMetadata(void)
 {
-    CFE_SB_PipeId_t  PipeId;
-    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
-    SB_UT_Test_Tlm_t TlmPkt;
-    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
-    int32            PipeDepth = 1;
-    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
-    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_SB_PipeId_t PipeId;
+    CFE_SB_MsgId_t  MsgId = SB_UT_TLM_MID;
 
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "PipeFullTestPipe"));
+    struct
+    {
+        /* To exercise the CFE_SB_SEND_ZEROCOPY feature,
+         * the packet data must already be enclosed in a
+         * buffer descriptor
+         */
+        CFE_SB_BufferD_t  BufDesc;
+        SB_UT_Test_Tlm_t  TlmPkt;
+    } TlmPktBufDesc;
+
+    CFE_SB_MsgPtr_t TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPktBufDesc.TlmPkt;
+    int32           PipeDepth;
+    CFE_MSG_Type_t  Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t  Size = sizeof(TlmPktBufDesc.TlmPkt);
+
+    memset(&TlmPktBufDesc, 0, sizeof(TlmPktBufDesc));
+    PipeDepth = 2;
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
     SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
 
-    /* This send should pass */
-    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT(CFE_SB_SendMsgFull(TlmPktPtr, CFE_SB_DO_NOT_INCREMENT,
+                                CFE_SB_SEND_ZEROCOPY, CFE_SB_POLL));
 
-    /* Tell the QueuePut stub to return OS_QUEUE_FULL on its next call */
-    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+    EVTCNT(3);
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_SendWithMetadata */
+
+/*
+** Test response to sending a message with the message size larger than allowed
+** and ZeroCopy is set
+*/
+void Test_SendMsg_MaxMsgSizePlusOne_ZeroCopy(void)
+{
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr;
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size = CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1;
 
-    /* Pipe overflow causes SendMsg to return CFE_SUCCESS */
-    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    TlmPktPtr = CFE_SB_ZeroCopyGetPtr(sizeof(SB_UT_Test_Tlm_t),
+    		                          (CFE_SB_ZeroCopyHandle_t *) &TlmPkt);
+    if (TlmPktPtr == NULL)
+    {
+        UtAssert_Failed("Unexpected NULL pointer returned from ZeroCopyGetPtr");
+    }
+    else
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
 
-    EVTCNT(5);
+        ASSERT_EQ(CFE_SB_SendMsgFull(TlmPktPtr, CFE_SB_INCREMENT_TLM,
+                CFE_SB_SEND_ZEROCOPY, CFE_SB_POLL), CFE_SB_MSG_TOO_BIG);
 
-    EVTSENT(CFE_SB_Q_FULL_ERR_EID);
+    }
 
-    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    EVTCNT(1);
 
-} /* end Test_SendMsg_PipeFull */
+    EVTSENT(CFE_SB_MSG_TOO_BIG_EID);
+
+} /* end Test_SendMsg_MaxMsgSizePlusOne_ZeroCopy */
 
 /*
-** Test send message response to too many messages sent to the pipe
+** Test response to sending a message which has no subscribers and ZeroCopy is
+** set
 */
-void Test_SendMsg_MsgLimitExceeded(void)
+void Test_SendMsg_NoSubscribers_ZeroCopy(void)
 {
-    CFE_SB_PipeId_t  PipeId;
     CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
     SB_UT_Test_Tlm_t TlmPkt;
-    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
-    int32            PipeDepth = 5;
-    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_SB_MsgPtr_t  TlmPktPtr;
     CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
 
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "MsgLimTestPipe"));
+    TlmPktPtr = CFE_SB_ZeroCopyGetPtr(sizeof(SB_UT_Test_Tlm_t),
+    		                          (CFE_SB_ZeroCopyHandle_t *) &TlmPkt);
+    if (TlmPktPtr == NULL)
+    {
+        UtAssert_Failed("Unexpected NULL pointer returned from ZeroCopyGetPtr");
+    }
+    else
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
 
-    /* Set maximum allowed messages on the pipe at one time to 1 */
-    CFE_SB_SubscribeEx(MsgId, PipeId, CFE_SB_Default_Qos, 1);
+        ASSERT(CFE_SB_SendMsgFull(TlmPktPtr, CFE_SB_INCREMENT_TLM,
+                                    CFE_SB_SEND_ZEROCOPY, CFE_SB_POLL));
+    }
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    EVTCNT(1);
 
-    /* First send should pass */
-    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    EVTSENT(CFE_SB_SEND_NO_SUBS_EID);
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+} /* end Test_SendMsg_NoSubscribers_ZeroCopy */
 
-    /* This send should produce a MsgId to Pipe Limit Exceeded message, but
-     * return success
-     */
-    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+/*
+** Test sending a batch of messages in one call
+*/
+void Test_SendMsg_Batch(void)
+{
+    CFE_SB_PipeId_t         PipeId;
+    CFE_SB_MsgId_t          MsgId[3] = {SB_UT_TLM_MID, SB_UT_TLM_MID, SB_UT_TLM_MID};
+    SB_UT_Test_Tlm_t        TlmPkt;
+    CFE_SB_Msg_t            *MsgArray[3];
+    int32                   StatusArray[3];
+    CFE_MSG_Size_t          Size[3] = {sizeof(TlmPkt), sizeof(TlmPkt), sizeof(TlmPkt)};
+    CFE_MSG_Type_t          Type[3] = {CFE_MSG_Type_Tlm, CFE_MSG_Type_Tlm, CFE_MSG_Type_Tlm};
+    CFE_MSG_SequenceCount_t SeqCnt;
+    uint32                  i;
 
-    EVTCNT(5);
+    /* Set up hook for checking CFE_MSG_SetSequenceCount calls */
+    UT_SetHookFunction(UT_KEY(CFE_MSG_SetSequenceCount), UT_CheckSetSequenceCount, &SeqCnt);
 
-    EVTSENT(CFE_SB_MSGID_LIM_ERR_EID);
+    SETUP(CFE_SB_CreatePipe(&PipeId, 10, "BatchTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId[0], PipeId));
 
-    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    for (i = 0; i < 3; i++)
+    {
+        MsgArray[i] = (CFE_SB_Msg_t *) &TlmPkt;
+        StatusArray[i] = -1;
+    }
 
-} /* end Test_SendMsg_MsgLimitExceeded */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), Type, sizeof(Type), false);
 
-/*
-** Test send message response to a buffer descriptor allocation failure
-*/
-void Test_SendMsg_GetPoolBufErr(void)
-{
-    CFE_SB_PipeId_t  PipeId;
-    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
-    SB_UT_Test_Tlm_t TlmPkt;
-    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
-    int32            PipeDepth;
-    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    ASSERT(CFE_SB_SendMsgBatch(MsgArray, 3, StatusArray));
 
-    PipeDepth = 1;
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "GetPoolErrPipe"));
-    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    for (i = 0; i < 3; i++)
+    {
+        ASSERT_EQ(StatusArray[i], CFE_SUCCESS);
+    }
 
-    /* Have GetPoolBuf stub return error on its next call (buf descriptor
-     * allocation failed)
-     */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
-    ASSERT_EQ(CFE_SB_SendMsg(TlmPktPtr), CFE_SB_BUF_ALOC_ERR);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_SetSequenceCount)), 3);
+    ASSERT_EQ(SeqCnt, 3);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[CFE_SB_GetPipeIdx(PipeId)].InUse, 3);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueuePut)), 3);
 
-    EVTCNT(4);
+    /* An empty batch is not an error */
+    ASSERT(CFE_SB_SendMsgBatch(MsgArray, 0, NULL));
 
-    EVTSENT(CFE_SB_GET_BUF_ERR_EID);
+    EVTCNT(3);
 
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_SendMsg_GetPoolBufErr */
+} /* end Test_SendMsg_Batch */
 
 /*
-** Test getting a pointer to a buffer for zero copy mode with buffer
-** allocation failures
+** Test that a batch send reports each failed message and sends one event
+** of each kind for the whole batch
 */
-void Test_SendMsg_ZeroCopyGetPtr(void)
+void Test_SendMsg_BatchErrors(void)
 {
-    CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl;
-    uint16                  MsgSize = 10;
-
-    /* Have GetPoolBuf stub return error on its next call (buf descriptor
-     * allocation failed)
-     */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
-    ASSERT_TRUE((cpuaddr) CFE_SB_ZeroCopyGetPtr(MsgSize, &ZeroCpyBufHndl) == (cpuaddr) NULL);
+    CFE_SB_MsgId_t   MsgId[3] = {SB_UT_TLM_MID, SB_UT_TLM_MID, SB_UT_TLM_MID};
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_Msg_t     *MsgArray[4];
+    int32            StatusArray[4];
+    CFE_MSG_Size_t   Size[3] = {sizeof(TlmPkt), sizeof(TlmPkt), sizeof(TlmPkt)};
 
-    /* Have GetPoolBuf stub return error on its second call (actual buffer
-     * allocation failed)
-     */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 2, CFE_ES_ERR_MEM_BLOCK_SIZE);
-    ASSERT_TRUE((cpuaddr) CFE_SB_ZeroCopyGetPtr(MsgSize, &ZeroCpyBufHndl) == (cpuaddr) NULL);
+    MsgArray[0] = (CFE_SB_Msg_t *) &TlmPkt;
+    MsgArray[1] = NULL;
+    MsgArray[2] = (CFE_SB_Msg_t *) &TlmPkt;
+    MsgArray[3] = (CFE_SB_Msg_t *) &TlmPkt;
 
-    /* Have GetPoolBuf stub return error on its second call (null buffer
-     * returned and error returning the memory to the buffer)
-     */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 2, -1);
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, 0);
-    ASSERT_TRUE((cpuaddr) CFE_SB_ZeroCopyGetPtr(MsgSize, &ZeroCpyBufHndl) == (cpuaddr) NULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
 
-    EVTCNT(0);
+    ASSERT_EQ(CFE_SB_SendMsgBatch(MsgArray, 4, StatusArray), CFE_SB_BAD_ARGUMENT);
 
-    /* Increase the peak memory and buffers in use above the expected values in
-     * order to exercise branch paths
-     */
-    CFE_SB.StatTlmMsg.Payload.MemInUse = 0;
-    CFE_SB.StatTlmMsg.Payload.PeakMemInUse = sizeof(CFE_SB_ZeroCopyD_t) + MsgSize +
-                                              sizeof(CFE_SB_BufferD_t) + 1;
-    CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse =
-      CFE_SB.StatTlmMsg.Payload.SBBuffersInUse + 2;
-    ASSERT_TRUE((cpuaddr) CFE_SB_ZeroCopyGetPtr(MsgSize, &ZeroCpyBufHndl) != (cpuaddr) NULL);
+    ASSERT_EQ(StatusArray[0], CFE_SUCCESS);
+    ASSERT_EQ(StatusArray[1], CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(StatusArray[2], CFE_SUCCESS);
+    ASSERT_EQ(StatusArray[3], CFE_SUCCESS);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.NoSubscribersCounter, 3);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter, 1);
 
-    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PeakMemInUse, sizeof(CFE_SB_ZeroCopyD_t) + MsgSize +
-        sizeof(CFE_SB_BufferD_t) + 1);
-    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.MemInUse, sizeof(CFE_SB_ZeroCopyD_t) + MsgSize +
-        sizeof(CFE_SB_BufferD_t));
+    /* Test response to a NULL message array */
+    ASSERT_EQ(CFE_SB_SendMsgBatch(NULL, 1, NULL), CFE_SB_BAD_ARGUMENT);
 
-    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse, CFE_SB.StatTlmMsg.Payload.SBBuffersInUse + 1);
+    EVTCNT(3);
 
-    EVTCNT(0);
+    EVTSENT(CFE_SB_SEND_NO_SUBS_EID);
+    EVTSENT(CFE_SB_SEND_BAD_ARG_EID);
 
-} /* end Test_SendMsg_ZeroCopyGetPtr */
+} /* end Test_SendMsg_BatchErrors */
 
 /*
-** Test successfully sending a message in zero copy mode (telemetry source
-** sequence count increments)
+** Test sending a batch of messages in zero copy mode
 */
-void Test_SendMsg_ZeroCopySend(void)
+void Test_SendMsg_ZeroCopySendBatch(void)
 {
-    CFE_SB_MsgPtr_t         PtrToMsg;
     CFE_SB_PipeId_t         PipeId;
-    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
-    CFE_SB_MsgPtr_t         ZeroCpyMsgPtr = NULL;
-    uint32                  PipeDepth = 10;
-    CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl = 0;
-    CFE_MSG_SequenceCount_t SeqCnt;
-    CFE_MSG_Size_t          Size = sizeof(SB_UT_Test_Tlm_t);
+    CFE_SB_MsgId_t          MsgId[2] = {SB_UT_TLM_MID, SB_UT_TLM_MID};
+    CFE_SB_Msg_t            *MsgArray[2];
+    CFE_SB_ZeroCopyHandle_t HandleArray[2];
+    CFE_SB_MsgPtr_t         PtrToMsg;
+    int32                   StatusArray[2];
+    CFE_MSG_Size_t          Size[2] = {sizeof(SB_UT_Test_Tlm_t), sizeof(SB_UT_Test_Tlm_t)};
     CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
 
-    /* Set up hook for checking CFE_MSG_SetSequenceCount calls */
-    UT_SetHookFunction(UT_KEY(CFE_MSG_SetSequenceCount), UT_CheckSetSequenceCount, &SeqCnt);
-
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "ZeroCpyTestPipe"));
-
-    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    SETUP(CFE_SB_CreatePipe(&PipeId, 10, "ZeroCpyBatchPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId[0], PipeId));
 
-    ZeroCpyMsgPtr = CFE_SB_ZeroCopyGetPtr(sizeof(SB_UT_Test_Tlm_t),&ZeroCpyBufHndl);
-    if (ZeroCpyMsgPtr == NULL)
+    MsgArray[0] = CFE_SB_ZeroCopyGetPtr(sizeof(SB_UT_Test_Tlm_t), &HandleArray[0]);
+    MsgArray[1] = CFE_SB_ZeroCopyGetPtr(sizeof(SB_UT_Test_Tlm_t), &HandleArray[1]);
+    if (MsgArray[0] == NULL || MsgArray[1] == NULL)
     {
         UtAssert_Failed("Unexpected NULL pointer returned from ZeroCopyGetPtr");
     }
 
-    /* Test response to a get pool information error */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBufInfo), 1, -1);
-    ASSERT_EQ(CFE_SB_ZeroCopySend(ZeroCpyMsgPtr, ZeroCpyBufHndl), CFE_SB_BUFFER_INVALID);
+    /* Test response to a NULL handle array */
+    ASSERT_EQ(CFE_SB_ZeroCopySendBatch(MsgArray, NULL, 2, StatusArray), CFE_SB_BAD_ARGUMENT);
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    /* Second buffer is not valid, so only the first one is sent */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBufInfo), 2, -1);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
 
-    /* Test a successful zero copy send */
-    ASSERT(CFE_SB_ZeroCopySend(ZeroCpyMsgPtr, ZeroCpyBufHndl));
+    ASSERT_EQ(CFE_SB_ZeroCopySendBatch(MsgArray, HandleArray, 2, StatusArray), CFE_SB_BUFFER_INVALID);
 
-    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_PEND_FOREVER));
+    ASSERT_EQ(StatusArray[0], CFE_SUCCESS);
+    ASSERT_EQ(StatusArray[1], CFE_SB_BUFFER_INVALID);
+    /* one for the NULL handle array, one for the invalid buffer */
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter, 2);
 
-    ASSERT_TRUE(PtrToMsg != NULL);
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_TRUE(PtrToMsg == MsgArray[0]);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
 
-    ASSERT_EQ(SeqCnt, 1);
+    /* The rejected buffer still belongs to the caller */
+    ASSERT(CFE_SB_ZeroCopyReleasePtr(MsgArray[1], HandleArray[1]));
 
-    EVTCNT(3);
+    EVTCNT(4);
 
-    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+    EVTSENT(CFE_SB_SEND_BAD_ARG_EID);
 
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_SendMsg_ZeroCopySend */
+} /* end Test_SendMsg_ZeroCopySendBatch */
 
 /*
-** Test successfully sending a message in zero copy mode (telemetry source
-** sequence count is unchanged)
+** Function for calling SB receive message API test functions
 */
-void Test_SendMsg_ZeroCopyPass(void)
+void Test_RcvMsg_API(void)
+{
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_InvalidPipeId);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_InvalidTimeout);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_Poll);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_Timeout);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_PipeReadError);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_PendForever);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_InvalidBufferPtr);
+    SB_UT_ADD_SUBTEST(Test_RcvMsgBatch_InvalidArgs);
+    SB_UT_ADD_SUBTEST(Test_RcvMsgBatch_Drain);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_RingPend);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_StaleDestHandle);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_RetainMsg);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_RetainInvalid);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_RetainPass);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_RetainShared);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_GetMsgSender);
+} /* end Test_RcvMsg_API */
+
+/*
+** Test receiving a message from the software bus with an invalid pipe ID
+*/
+void Test_RcvMsg_InvalidPipeId(void)
+{
+    CFE_SB_MsgPtr_t PtrToMsg;
+    CFE_SB_PipeId_t InvalidPipeId = 20;
+
+    CFE_SB.PipeTbl[InvalidPipeId].InUse = CFE_SB_NOT_IN_USE;
+
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, InvalidPipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+
+
+    EVTCNT(1);
+
+    EVTSENT(CFE_SB_BAD_PIPEID_EID);
+
+} /* end Test_RcvMsg_InvalidPipeId */
+
+/*
+** Test receiving a message response to invalid timeout value (< -1)
+*/
+void Test_RcvMsg_InvalidTimeout(void)
 {
     CFE_SB_MsgPtr_t PtrToMsg;
     CFE_SB_PipeId_t PipeId;
-    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
-    CFE_SB_MsgPtr_t         ZeroCpyMsgPtr = NULL;
-    uint32                  PipeDepth = 10;
-    CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl = 0;
-    CFE_MSG_SequenceCount_t SeqCnt = 22;
-    CFE_MSG_Size_t          Size = sizeof(SB_UT_Test_Tlm_t);
-    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
+    uint32          PipeDepth = 10;
+    int32           TimeOut = -5;
 
-    /* Set up hook for checking CFE_MSG_SetSequenceCount calls */
-    UT_SetHookFunction(UT_KEY(CFE_MSG_SetSequenceCount), UT_CheckSetSequenceCount, &SeqCnt);
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMsgTestPipe"));
 
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "ZeroCpyPassTestPipe"));
-    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, TimeOut), CFE_SB_BAD_ARGUMENT);
 
-    ZeroCpyMsgPtr = CFE_SB_ZeroCopyGetPtr(sizeof(SB_UT_Test_Tlm_t),
-                                          &ZeroCpyBufHndl);
+    EVTCNT(2);
 
-    if (ZeroCpyMsgPtr == NULL)
-    {
-        UtAssert_Failed("Unexpected NULL pointer returned from ZeroCopyGetPtr");
-    }
+    EVTSENT(CFE_SB_RCV_BAD_ARG_EID);
 
-    /* Test response to a get pool information error */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBufInfo), 1, -1);
-    ASSERT_EQ(CFE_SB_ZeroCopyPass(ZeroCpyMsgPtr, ZeroCpyBufHndl), CFE_SB_BUFFER_INVALID);
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+} /* end Test_RcvMsg_InvalidTimeout */
 
-    /* Test a successful zero copy pass */
-    ASSERT(CFE_SB_ZeroCopyPass(ZeroCpyMsgPtr, ZeroCpyBufHndl));
-    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_PEND_FOREVER));
+/*
+** Test receiving a message response when there is no message on the queue
+*/
+void Test_RcvMsg_Poll(void)
+{
+    CFE_SB_MsgPtr_t PtrToMsg;
+    CFE_SB_PipeId_t PipeId;
+    uint32          PipeDepth = 10;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMsgTestPipe"));
 
-    ASSERT_TRUE(PtrToMsg != NULL);
-    ASSERT_EQ(SeqCnt, 22);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
 
-    EVTCNT(3);
+    EVTCNT(1);
 
-    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+    EVTSENT(CFE_SB_PIPE_ADDED_EID);
 
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_SendMsg_ZeroCopyPass */
+} /* end Test_RcvMsg_Poll */
 
 /*
-** Test releasing a pointer to a buffer for zero copy mode
+** Test receiving a message response to a timeout
 */
-void Test_SendMsg_ZeroCopyReleasePtr(void)
+void Test_RcvMsg_Timeout(void)
 {
-    CFE_SB_MsgPtr_t         ZeroCpyMsgPtr1 = NULL;
-    CFE_SB_MsgPtr_t         ZeroCpyMsgPtr2 = NULL;
-    CFE_SB_MsgPtr_t         ZeroCpyMsgPtr3 = NULL;
-    CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl1 = 0;
-    CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl2 = 0;
-    CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl3 = 0;
-    uint16                  MsgSize = 10;
+    CFE_SB_MsgPtr_t PtrToMsg;
+    CFE_SB_PipeId_t PipeId;
+    uint32          PipeDepth = 10;
+    int32           TimeOut = 200;
 
-    ZeroCpyMsgPtr1 = CFE_SB_ZeroCopyGetPtr(MsgSize, &ZeroCpyBufHndl1);
-    ZeroCpyMsgPtr2 = CFE_SB_ZeroCopyGetPtr(MsgSize, &ZeroCpyBufHndl2);
-    ZeroCpyMsgPtr3 = CFE_SB_ZeroCopyGetPtr(MsgSize, &ZeroCpyBufHndl3);
-    SETUP(CFE_SB_ZeroCopyReleasePtr(ZeroCpyMsgPtr2, ZeroCpyBufHndl2));
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMsgTestPipe"));
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_TIMEOUT);
 
-    /* Test response to an invalid buffer */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBufInfo), 1, -1);
-    ASSERT_EQ(CFE_SB_ZeroCopyReleasePtr(ZeroCpyMsgPtr2, ZeroCpyBufHndl2), CFE_SB_BUFFER_INVALID);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, TimeOut), CFE_SB_TIME_OUT);
 
-    /* Test response to a null message pointer */
-    ASSERT_EQ(CFE_SB_ZeroCopyReleasePtr(NULL, ZeroCpyBufHndl2), CFE_SB_BUFFER_INVALID);
+    EVTCNT(1);
 
-    /* Test response to an invalid message pointer */
-    ASSERT_EQ(CFE_SB_ZeroCopyReleasePtr((CFE_SB_Msg_t *) 0x1234,
-                                       ZeroCpyBufHndl2), CFE_SB_BUFFER_INVALID);
+    EVTSENT(CFE_SB_PIPE_ADDED_EID);
 
-    /* Test path when return the descriptor to the pool fails in
-     * CFE_SB_ZeroCopyReleaseDesc
-     */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, -1);
-    ASSERT(CFE_SB_ZeroCopyReleasePtr(ZeroCpyMsgPtr2, ZeroCpyBufHndl2));
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-    /* Test path when return the buffer to the pool fails in
-     * CFE_SB_ZeroCopyReleasePtr
-     */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 2, -1);
-    ASSERT(CFE_SB_ZeroCopyReleasePtr(ZeroCpyMsgPtr2, ZeroCpyBufHndl2));
+} /* end Test_RcvMsg_Timeout */
 
-    /* Test successful release of the second buffer */
-    ASSERT(CFE_SB_ZeroCopyReleasePtr(ZeroCpyMsgPtr3, ZeroCpyBufHndl3));
+/*
+** Test receiving a message response to a pipe read error
+*/
+void Test_RcvMsg_PipeReadError(void)
+{
+    CFE_SB_MsgPtr_t PtrToMsg;
+    CFE_SB_PipeId_t PipeId;
+    uint32          PipeDepth = 10;
 
-    /* Test successful release of the third buffer */
-    ASSERT(CFE_SB_ZeroCopyReleasePtr(ZeroCpyMsgPtr1, ZeroCpyBufHndl1));
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMsgTestPipe"));
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_ERROR);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
 
-    EVTCNT(0);
+    EVTCNT(3);
 
-} /* end Test_SendMsg_ZeroCopyReleasePtr */
+    EVTSENT(CFE_SB_Q_RD_ERR_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_RcvMsg_PipeReadError */
 
 /*
-** Test send message response with the destination disabled
+** Test receiving a message response to a "pend forever" timeout
 */
-void Test_SendMsg_DisabledDestination(void)
+void Test_RcvMsg_PendForever(void)
 {
-    CFE_SB_PipeId_t       PipeId;
-    CFE_SB_MsgId_t        MsgId = SB_UT_TLM_MID;
-    SB_UT_Test_Tlm_t      TlmPkt;
-    CFE_SB_MsgPtr_t       TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
-    CFE_SB_DestinationD_t *DestPtr;
-    int32                 PipeDepth;
-    CFE_MSG_Type_t        Type = CFE_MSG_Type_Tlm;
-    CFE_MSG_Size_t        Size = sizeof(TlmPkt);
-
-    PipeDepth = 2;
-
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
-    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
-    DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId);
-    DestPtr->Active = CFE_SB_INACTIVE;
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeId;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_PipeD_t   *PipeDscPtr;
+    uint32           PipeDepth = 10;
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
 
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMsgTestPipe"));
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    SETUP(CFE_SB_SendMsg(TlmPktPtr));
 
-    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_PEND_FOREVER));
+  
+    ASSERT_TRUE(PtrToMsg != NULL);
 
     EVTCNT(3);
 
     EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
 
+    PipeDscPtr = CFE_SB_GetPipePtr(PipeId);
+    PipeDscPtr->ToTrashBuff = PipeDscPtr->CurrentBuff;
+    PipeDscPtr->CurrentBuff = NULL;
+    
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_SendMsg_DisabledDestination */
+} /* end Test_RcvMsg_PendForever */
 
 /*
-** Test successfully sending a message with the metadata
+** Test that a retained message survives the next receive on its pipe
 */
-void Test_SendMsg_SendWithMetadata(void)
+void Test_RcvMsg_RetainMsg(void)
 {
-    CFE_SB_PipeId_t PipeId;
-    CFE_SB_MsgId_t  MsgId = SB_UT_TLM_MID;
-
-    struct
-    {
-        /* To exercise the CFE_SB_SEND_ZEROCOPY feature,
-         * the packet data must already be enclosed in a
-         * buffer descriptor
-         */
-        CFE_SB_BufferD_t  BufDesc;
-        SB_UT_Test_Tlm_t  TlmPkt;
-    } TlmPktBufDesc;
+    CFE_SB_MsgPtr_t         PtrToMsg;
+    CFE_SB_MsgPtr_t         RetainedPtr;
+    CFE_SB_ZeroCopyHandle_t Handle = 0;
+    CFE_SB_ZeroCopyHandle_t Handle2 = 0;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t         PipeId;
+    SB_UT_Test_Tlm_t        TlmPkt;
+    CFE_SB_MsgPtr_t         TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    uint32                  PipeDepth = 10;
+    uint16                  BuffersInUse;
+    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t          Size = sizeof(TlmPkt);
 
-    CFE_SB_MsgPtr_t TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPktBufDesc.TlmPkt;
-    int32           PipeDepth;
-    CFE_MSG_Type_t  Type = CFE_MSG_Type_Tlm;
-    CFE_MSG_Size_t  Size = sizeof(TlmPktBufDesc.TlmPkt);
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
 
-    memset(&TlmPktBufDesc, 0, sizeof(TlmPktBufDesc));
-    PipeDepth = 2;
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RetainTestPipe"));
     SETUP(CFE_SB_Subscribe(MsgId, PipeId));
 
+    TlmPkt.Tlm32Param1 = 1;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_SendMsg(TlmPktPtr));
+    SETUP(CFE_SB_RcvMsg(&RetainedPtr, PipeId, CFE_SB_POLL));
+    BuffersInUse = CFE_SB.StatTlmMsg.Payload.SBBuffersInUse;
 
-    ASSERT(CFE_SB_SendMsgFull(TlmPktPtr, CFE_SB_DO_NOT_INCREMENT,
-                                CFE_SB_SEND_ZEROCOPY));
+    ASSERT(CFE_SB_RetainMsg(RetainedPtr, PipeId, &Handle));
+    ASSERT_TRUE(CFE_SB.PipeTbl[PipeId].CurrentBuff == NULL);
 
-    EVTCNT(3);
+    /* The pipe no longer holds the message, so it cannot be retained twice */
+    ASSERT_EQ(CFE_SB_RetainMsg(RetainedPtr, PipeId, &Handle2), CFE_SB_BUFFER_INVALID);
+
+    /* The next receive leaves the retained buffer alone */
+    TlmPkt.Tlm32Param1 = 2;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+
+    ASSERT_TRUE(PtrToMsg != RetainedPtr);
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *)RetainedPtr)->Tlm32Param1, 1);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, BuffersInUse + 1);
+
+    ASSERT(CFE_SB_ReleaseRetained(RetainedPtr, Handle));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, BuffersInUse);
 
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_SendMsg_SendWithMetadata */
+} /* end Test_RcvMsg_RetainMsg */
 
 /*
-** Test response to sending a message with the message size larger than allowed
-** and ZeroCopy is set
+** Test response of the retain and release calls to invalid arguments
 */
-void Test_SendMsg_MaxMsgSizePlusOne_ZeroCopy(void)
+void Test_RcvMsg_RetainInvalid(void)
 {
-    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
-    SB_UT_Test_Tlm_t TlmPkt;
-    CFE_SB_MsgPtr_t  TlmPktPtr;
-    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
-    CFE_MSG_Size_t   Size = CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1;
-
-    TlmPktPtr = CFE_SB_ZeroCopyGetPtr(sizeof(SB_UT_Test_Tlm_t),
-    		                          (CFE_SB_ZeroCopyHandle_t *) &TlmPkt);
-    if (TlmPktPtr == NULL)
-    {
-        UtAssert_Failed("Unexpected NULL pointer returned from ZeroCopyGetPtr");
-    }
-    else
-    {
-        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
-
-        ASSERT_EQ(CFE_SB_SendMsgFull(TlmPktPtr, CFE_SB_INCREMENT_TLM,
-                CFE_SB_SEND_ZEROCOPY), CFE_SB_MSG_TOO_BIG);
-
-    }
-
-    EVTCNT(1);
+    CFE_SB_MsgPtr_t         PtrToMsg;
+    CFE_SB_ZeroCopyHandle_t Handle = 0;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t         PipeId;
+    SB_UT_Test_Tlm_t        TlmPkt;
+    CFE_SB_MsgPtr_t         TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    uint32                  PipeDepth = 10;
+    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t          Size = sizeof(TlmPkt);
 
-    EVTSENT(CFE_SB_MSG_TOO_BIG_EID);
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
 
-} /* end Test_SendMsg_MaxMsgSizePlusOne_ZeroCopy */
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RetainTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
 
-/*
-** Test response to sending a message which has no subscribers and ZeroCopy is
-** set
-*/
-void Test_SendMsg_NoSubscribers_ZeroCopy(void)
-{
-    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
-    SB_UT_Test_Tlm_t TlmPkt;
-    CFE_SB_MsgPtr_t  TlmPktPtr;
-    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
-    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_SendMsg(TlmPktPtr));
+    SETUP(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
 
-    TlmPktPtr = CFE_SB_ZeroCopyGetPtr(sizeof(SB_UT_Test_Tlm_t),
-    		                          (CFE_SB_ZeroCopyHandle_t *) &TlmPkt);
-    if (TlmPktPtr == NULL)
-    {
-        UtAssert_Failed("Unexpected NULL pointer returned from ZeroCopyGetPtr");
-    }
-    else
-    {
-        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT_EQ(CFE_SB_RetainMsg(NULL, PipeId, &Handle), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_RetainMsg(PtrToMsg, PipeId, NULL), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_RetainMsg(PtrToMsg, CFE_PLATFORM_SB_MAX_PIPES, &Handle), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_RetainMsg(TlmPktPtr, PipeId, &Handle), CFE_SB_BUFFER_INVALID);
 
-        ASSERT(CFE_SB_SendMsgFull(TlmPktPtr, CFE_SB_INCREMENT_TLM,
-                                    CFE_SB_SEND_ZEROCOPY));
-    }
+    /* A failure to give the buffer an owner leaves the message with the pipe */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_AppID_ToIndex), 1, -1);
+    ASSERT_EQ(CFE_SB_RetainMsg(PtrToMsg, PipeId, &Handle), CFE_SB_BAD_ARGUMENT);
+    ASSERT_TRUE(CFE_SB.PipeTbl[PipeId].CurrentBuff != NULL);
 
-    EVTCNT(1);
+    SETUP(CFE_SB_RetainMsg(PtrToMsg, PipeId, &Handle));
+    ASSERT_EQ(CFE_SB_ReleaseRetained(NULL, Handle), CFE_SB_BUFFER_INVALID);
+    ASSERT_EQ(CFE_SB_ReleaseRetained(TlmPktPtr, Handle), CFE_SB_BUFFER_INVALID);
+    ASSERT(CFE_SB_ReleaseRetained(PtrToMsg, Handle));
 
-    EVTSENT(CFE_SB_SEND_NO_SUBS_EID);
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_SendMsg_NoSubscribers_ZeroCopy */
+} /* end Test_RcvMsg_RetainInvalid */
 
 /*
-** Function for calling SB receive message API test functions
+** Test forwarding a retained message without a copy
 */
-void Test_RcvMsg_API(void)
+void Test_RcvMsg_RetainPass(void)
 {
-    SB_UT_ADD_SUBTEST(Test_RcvMsg_InvalidPipeId);
-    SB_UT_ADD_SUBTEST(Test_RcvMsg_InvalidTimeout);
-    SB_UT_ADD_SUBTEST(Test_RcvMsg_Poll);
-    SB_UT_ADD_SUBTEST(Test_RcvMsg_Timeout);
-    SB_UT_ADD_SUBTEST(Test_RcvMsg_PipeReadError);
-    SB_UT_ADD_SUBTEST(Test_RcvMsg_PendForever);
-    SB_UT_ADD_SUBTEST(Test_RcvMsg_InvalidBufferPtr);
-} /* end Test_RcvMsg_API */
+    CFE_SB_MsgPtr_t         PtrToMsg;
+    CFE_SB_MsgPtr_t         RetainedPtr;
+    CFE_SB_ZeroCopyHandle_t Handle = 0;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t         PipeId;
+    SB_UT_Test_Tlm_t        TlmPkt;
+    CFE_SB_MsgPtr_t         TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    uint32                  PipeDepth = 10;
+    uint16                  BuffersInUse;
+    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t          Size = sizeof(TlmPkt);
 
-/*
-** Test receiving a message from the software bus with an invalid pipe ID
-*/
-void Test_RcvMsg_InvalidPipeId(void)
-{
-    CFE_SB_MsgPtr_t PtrToMsg;
-    CFE_SB_PipeId_t InvalidPipeId = 20;
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
 
-    CFE_SB.PipeTbl[InvalidPipeId].InUse = CFE_SB_NOT_IN_USE;
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RetainTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
 
-    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, InvalidPipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_SendMsg(TlmPktPtr));
+    SETUP(CFE_SB_RcvMsg(&RetainedPtr, PipeId, CFE_SB_POLL));
+    BuffersInUse = CFE_SB.StatTlmMsg.Payload.SBBuffersInUse;
 
+    SETUP(CFE_SB_RetainMsg(RetainedPtr, PipeId, &Handle));
 
-    EVTCNT(1);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_ZeroCopyPass(RetainedPtr, Handle));
 
-    EVTSENT(CFE_SB_BAD_PIPEID_EID);
+    /* The same buffer is delivered again */
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_TRUE(PtrToMsg == RetainedPtr);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, BuffersInUse);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_RcvMsg_InvalidPipeId */
+} /* end Test_RcvMsg_RetainPass */
 
 /*
-** Test receiving a message response to invalid timeout value (< -1)
+** Test retaining a message delivered to two pipes through both of them
 */
-void Test_RcvMsg_InvalidTimeout(void)
+void Test_RcvMsg_RetainShared(void)
 {
-    CFE_SB_MsgPtr_t PtrToMsg;
-    CFE_SB_PipeId_t PipeId;
-    uint32          PipeDepth = 10;
-    int32           TimeOut = -5;
+    CFE_SB_MsgPtr_t         PtrToMsg;
+    CFE_SB_ZeroCopyHandle_t Handle1 = 0;
+    CFE_SB_ZeroCopyHandle_t Handle2 = 0;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t         PipeId1;
+    CFE_SB_PipeId_t         PipeId2;
+    CFE_SB_BufferD_t        *bd;
+    CFE_ES_ResourceID_t     AppID;
+    uint32                  AppIdx;
+    SB_UT_Test_Tlm_t        TlmPkt;
+    CFE_SB_MsgPtr_t         TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    uint32                  PipeDepth = 10;
+    uint16                  BuffersInUse;
+    uint32                  i;
+    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t          Size = sizeof(TlmPkt);
 
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMsgTestPipe"));
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
 
-    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, TimeOut), CFE_SB_BAD_ARGUMENT);
+    CFE_ES_GetAppID(&AppID);
+    CFE_ES_AppID_ToIndex(AppID, &AppIdx);
 
-    EVTCNT(2);
+    SETUP(CFE_SB_CreatePipe(&PipeId1, PipeDepth, "RetainTestPipe1"));
+    SETUP(CFE_SB_CreatePipe(&PipeId2, PipeDepth, "RetainTestPipe2"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId1));
+    BuffersInUse = CFE_SB.StatTlmMsg.Payload.SBBuffersInUse;
 
-    EVTSENT(CFE_SB_RCV_BAD_ARG_EID);
+    /*
+    ** The first pass releases both handles with CFE_SB_ReleaseRetained,
+    ** the second through the zero copy clean up of the application
+    */
+    for(i = 0; i < 2; i++){
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+        SETUP(CFE_SB_SendMsg(TlmPktPtr));
+        SETUP(CFE_SB_RcvMsg(&PtrToMsg, PipeId1, CFE_SB_POLL));
+
+        /* Hand the same buffer to the second pipe, as a fan out receive would */
+        bd = CFE_SB.PipeTbl[PipeId1].CurrentBuff;
+        bd->UseCount++;
+        CFE_SB.PipeTbl[PipeId2].CurrentBuff = bd;
+
+        /* Both retains share the buffer, each holding one reference */
+        ASSERT(CFE_SB_RetainMsg(PtrToMsg, PipeId1, &Handle1));
+        ASSERT(CFE_SB_RetainMsg(PtrToMsg, PipeId2, &Handle2));
+        ASSERT_TRUE(Handle1 == (CFE_SB_ZeroCopyHandle_t) bd);
+        ASSERT_TRUE(Handle2 == (CFE_SB_ZeroCopyHandle_t) bd);
+        ASSERT_EQ(bd->UseCount, 2);
+        ASSERT_EQ(bd->HandleCount, 2);
+        ASSERT_EQ(bd->OwnerHandles, 2);
+        ASSERT_TRUE(CFE_SB.ZeroCopyHead[AppIdx] == bd);
+        ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, BuffersInUse + 1);
+
+        if(i == 0){
+            /* The buffer stays valid until the last handle is given up */
+            ASSERT(CFE_SB_ReleaseRetained(PtrToMsg, Handle1));
+            ASSERT_EQ(bd->UseCount, 1);
+            ASSERT_EQ(bd->HandleCount, 1);
+            ASSERT_TRUE(CFE_SB.ZeroCopyHead[AppIdx] == bd);
+            ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, BuffersInUse + 1);
+
+            ASSERT(CFE_SB_ReleaseRetained(PtrToMsg, Handle2));
+        }else{
+            ASSERT(CFE_SB_ZeroCopyReleaseAppId(AppID));
+        }/* end if */
+
+        ASSERT_TRUE(CFE_SB.ZeroCopyHead[AppIdx] == NULL);
+        ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, BuffersInUse);
+    }/* end for */
 
-    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+    TEARDOWN(CFE_SB_DeletePipe(PipeId2));
 
-} /* end Test_RcvMsg_InvalidTimeout */
+} /* end Test_RcvMsg_RetainShared */
 
 /*
-** Test receiving a message response when there is no message on the queue
+** Test getting the sender of a received message
 */
-void Test_RcvMsg_Poll(void)
+void Test_RcvMsg_GetMsgSender(void)
 {
-    CFE_SB_MsgPtr_t PtrToMsg;
-    CFE_SB_PipeId_t PipeId;
-    uint32          PipeDepth = 10;
+    CFE_SB_MsgPtr_t         PtrToMsg;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t         PipeId;
+    SB_UT_Test_Tlm_t        TlmPkt;
+    CFE_SB_MsgPtr_t         TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_ES_ResourceID_t     AppId;
+    CFE_ES_ResourceID_t     SenderId = CFE_ES_RESOURCEID_UNDEFINED;
+    uint32                  PipeDepth = 10;
+    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t          Size = sizeof(TlmPkt);
 
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMsgTestPipe"));
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
 
-    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    SETUP(CFE_ES_GetAppID(&AppId));
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "SenderTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
 
-    EVTCNT(1);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_SendMsg(TlmPktPtr));
+    SETUP(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
 
-    EVTSENT(CFE_SB_PIPE_ADDED_EID);
+    ASSERT(CFE_SB_GetMsgSender(PtrToMsg, PipeId, &SenderId));
+    ASSERT_TRUE(CFE_ES_ResourceID_Equal(SenderId, AppId));
+
+    ASSERT_EQ(CFE_SB_GetMsgSender(NULL, PipeId, &SenderId), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_GetMsgSender(PtrToMsg, PipeId, NULL), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_GetMsgSender(PtrToMsg, CFE_PLATFORM_SB_MAX_PIPES, &SenderId), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_GetMsgSender(TlmPktPtr, PipeId, &SenderId), CFE_SB_BUFFER_INVALID);
+
+    /* Only the owner of the pipe may ask */
+    CFE_SB.PipeTbl[PipeId].AppId = UT_SB_ResourceID_Modify(AppId, 1);
+    ASSERT_EQ(CFE_SB_GetMsgSender(PtrToMsg, PipeId, &SenderId), CFE_SB_BAD_ARGUMENT);
+    CFE_SB.PipeTbl[PipeId].AppId = AppId;
 
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_RcvMsg_Poll */
+} /* end Test_RcvMsg_GetMsgSender */
 
 /*
-** Test receiving a message response to a timeout
+** Test batch receive response to invalid arguments
 */
-void Test_RcvMsg_Timeout(void)
+void Test_RcvMsgBatch_InvalidArgs(void)
 {
-    CFE_SB_MsgPtr_t PtrToMsg;
+    CFE_SB_MsgPtr_t PtrToMsg[2];
     CFE_SB_PipeId_t PipeId;
-    uint32          PipeDepth = 10;
-    int32           TimeOut = 200;
+    CFE_SB_PipeId_t InvalidPipeId = 20;
+    uint32          Count = 0;
 
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMsgTestPipe"));
-    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_TIMEOUT);
+    SETUP(CFE_SB_CreatePipe(&PipeId, 10, "RcvBatchTestPipe"));
 
-    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, TimeOut), CFE_SB_TIME_OUT);
+    ASSERT_EQ(CFE_SB_RcvMsgBatch(NULL, 2, &Count, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_RcvMsgBatch(PtrToMsg, 2, NULL, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_RcvMsgBatch(PtrToMsg, 0, &Count, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_RcvMsgBatch(PtrToMsg, 2, &Count, PipeId, -5), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_RcvMsgBatch(PtrToMsg, 2, &Count, InvalidPipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
 
-    EVTCNT(1);
+    /* Empty pipe */
+    ASSERT_EQ(CFE_SB_RcvMsgBatch(PtrToMsg, 2, &Count, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    ASSERT_EQ(Count, 0);
 
-    EVTSENT(CFE_SB_PIPE_ADDED_EID);
+    EVTCNT(6);
+
+    EVTSENT(CFE_SB_RCV_BAD_ARG_EID);
+    EVTSENT(CFE_SB_BAD_PIPEID_EID);
 
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_RcvMsg_Timeout */
+} /* end Test_RcvMsgBatch_InvalidArgs */
 
 /*
-** Test receiving a message response to a pipe read error
+** Test draining several messages from a pipe with one batch receive
 */
-void Test_RcvMsg_PipeReadError(void)
+void Test_RcvMsgBatch_Drain(void)
 {
-    CFE_SB_MsgPtr_t PtrToMsg;
-    CFE_SB_PipeId_t PipeId;
-    uint32          PipeDepth = 10;
+    CFE_SB_MsgPtr_t         PtrToMsg[4];
+    CFE_SB_MsgPtr_t         SinglePtr;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t         PipeId;
+    CFE_SB_PipeD_t          *PipeDscPtr;
+    CFE_SB_DestinationD_t   *DestPtr;
+    SB_UT_Test_Tlm_t        TlmPkt[3];
+    CFE_SB_BufferD_t        BufDsc[3];
+    CFE_SB_QueueEntry_t     QueueData[3];
+    uint32                  Count = 0;
+    uint32                  i;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 10, "RcvBatchTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
 
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMsgTestPipe"));
-    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_ERROR);
-    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+    PipeDscPtr = CFE_SB_GetPipePtr(PipeId);
+    DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId);
 
-    EVTCNT(3);
+    /* Put three buffers on the pipe as a send would */
+    for (i = 0; i < 3; i++)
+    {
+        memset(&BufDsc[i], 0, sizeof(BufDsc[i]));
+        BufDsc[i].MsgId    = MsgId;
+        BufDsc[i].UseCount = 1;
+        BufDsc[i].Buffer   = &TlmPkt[i];
+        QueueData[i].BufDscPtr = &BufDsc[i];
+        QueueData[i].DestPtr   = DestPtr;
+        QueueData[i].DestGen   = PipeDscPtr->DestGen;
+        QueueData[i].Lane      = CFE_SB_LANE_NORMAL;
+    }
+    DestPtr->BuffCount = 3;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].InUse = 3;
+    UT_SetDataBuffer(UT_KEY(OS_QueueGet), QueueData, sizeof(QueueData), false);
 
-    EVTSENT(CFE_SB_Q_RD_ERR_EID);
+    ASSERT(CFE_SB_RcvMsgBatch(PtrToMsg, 4, &Count, PipeId, CFE_SB_PEND_FOREVER));
+
+    ASSERT_EQ(Count, 3);
+    for (i = 0; i < 3; i++)
+    {
+        ASSERT_TRUE(PtrToMsg[i] == (CFE_SB_MsgPtr_t) &TlmPkt[i]);
+        ASSERT_EQ(BufDsc[i].UseCount, 1);
+    }
+    ASSERT_EQ(DestPtr->BuffCount, 0);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].InUse, 0);
+    ASSERT_EQ(PipeDscPtr->BatchCount, 3);
+
+    /* The next receive releases the batch */
+    ASSERT_EQ(CFE_SB_RcvMsg(&SinglePtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    ASSERT_EQ(PipeDscPtr->BatchCount, 0);
+    for (i = 0; i < 3; i++)
+    {
+        ASSERT_EQ(BufDsc[i].UseCount, 0);
+    }
+
+    EVTCNT(3);
 
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_RcvMsg_PipeReadError */
+} /* end Test_RcvMsgBatch_Drain */
 
 /*
-** Test receiving a message response to a "pend forever" timeout
+** Test that a ring pipe reader blocks on the OS queue only when the ring is
+** empty, and that a write wakes it only while it is waiting
 */
-void Test_RcvMsg_PendForever(void)
+void Test_RcvMsg_RingPend(void)
 {
-    CFE_SB_MsgPtr_t  PtrToMsg;
-    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
     CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
     SB_UT_Test_Tlm_t TlmPkt;
     CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_MsgPtr_t  PtrToMsg;
     CFE_SB_PipeD_t   *PipeDscPtr;
-    uint32           PipeDepth = 10;
-    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
     CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
 
-    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMsgTestPipe"));
+    SETUP(CFE_SB_CreatePipeEx(&PipeId, 4, "RingPendTestPipe", CFE_SB_PIPEOPTS_RING));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    PipeDscPtr = CFE_SB_GetPipePtr(PipeId);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_TIMEOUT);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, 100), CFE_SB_TIME_OUT);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueueGet)), 1);
+    ASSERT_EQ(PipeDscPtr->Ring.ReaderWaiting, 0);
+
+    /* Pretend the reader is blocked so the send rings the doorbell */
+    PipeDscPtr->Ring.ReaderWaiting = 1;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
-    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
-    SETUP(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueuePut)), 1);
+    PipeDscPtr->Ring.ReaderWaiting = 0;
 
+    /* A waiting message is returned without blocking */
     ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_PEND_FOREVER));
-  
-    ASSERT_TRUE(PtrToMsg != NULL);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueueGet)), 1);
 
     EVTCNT(3);
 
-    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_RcvMsg_RingPend */
+
+/*
+** Test that the receive path accounts through the queued destination
+** handle, and falls back to the route when a destination of the pipe was
+** removed while the message was queued
+*/
+void Test_RcvMsg_StaleDestHandle(void)
+{
+    CFE_SB_MsgPtr_t       PtrToMsg;
+    CFE_SB_MsgId_t        MsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t        MsgId2 = SB_UT_TLM_MID2;
+    CFE_SB_PipeId_t       PipeId;
+    CFE_SB_PipeD_t        *PipeDscPtr;
+    CFE_SB_DestinationD_t *DestPtr;
+    SB_UT_Test_Tlm_t      TlmPkt;
+    CFE_SB_MsgPtr_t       TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_MSG_Type_t        Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t        Size = sizeof(TlmPkt);
+    uint32                DestGen;
 
+    SETUP(CFE_SB_CreatePipe(&PipeId, 10, "StaleDestTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    SETUP(CFE_SB_Subscribe(MsgId2, PipeId));
     PipeDscPtr = CFE_SB_GetPipePtr(PipeId);
-    PipeDscPtr->ToTrashBuff = PipeDscPtr->CurrentBuff;
-    PipeDscPtr->CurrentBuff = NULL;
-    
+    DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT_EQ(DestPtr->BuffCount, 1);
+
+    /* Removing another destination of the pipe invalidates the queued handle */
+    DestGen = PipeDscPtr->DestGen;
+    SETUP(CFE_SB_Unsubscribe(MsgId2, PipeId));
+    ASSERT_TRUE(PipeDscPtr->DestGen != DestGen);
+
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(DestPtr->BuffCount, 0);
+
+    /* A handle queued after the change is used as is */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT_EQ(DestPtr->BuffCount, 1);
+
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(DestPtr->BuffCount, 0);
+
+    EVTCNT(6);
+
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
-} /* end Test_RcvMsg_PendForever */
+} /* end Test_RcvMsg_StaleDestHandle */
 
 /*
 ** Test releasing zero copy buffers for all pipes owned by a given app ID
@@ -3551,8 +6135,10 @@ void Test_CleanupApp_API(void)
     CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl = 0;
     uint16                  PipeDepth = 50;
     CFE_ES_ResourceID_t     AppID;
+    uint32                  AppIdx;
 
     CFE_ES_GetAppID(&AppID);
+    CFE_ES_AppID_ToIndex(AppID, &AppIdx);
 
     SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
     CFE_SB_ZeroCopyGetPtr(PipeDepth, &ZeroCpyBufHndl);
@@ -3562,7 +6148,7 @@ void Test_CleanupApp_API(void)
     CFE_SB.PipeTbl[1].InUse = CFE_SB_IN_USE;
     CFE_SB.PipeTbl[1].AppId = AppID;
 
-    ASSERT_TRUE(CFE_SB.ZeroCopyTail != NULL);
+    ASSERT_TRUE(CFE_SB.ZeroCopyHead[AppIdx] != NULL);
 
     /* Attempt with a bad application ID first in order to get full branch path
      * coverage in CFE_SB_ZeroCopyReleaseAppId
@@ -3572,7 +6158,7 @@ void Test_CleanupApp_API(void)
     /* Attempt again with a valid application ID */
     CFE_SB_CleanUpApp(AppID);
 
-    ASSERT_TRUE(CFE_SB.ZeroCopyTail == NULL);
+    ASSERT_TRUE(CFE_SB.ZeroCopyHead[AppIdx] == NULL);
 
     EVTCNT(3);
 
@@ -3858,6 +6444,10 @@ void Test_SB_SpecialCases(void)
     SB_UT_ADD_SUBTEST(Test_RcvMsg_UnsubResubPath);
     SB_UT_ADD_SUBTEST(Test_MessageString);
     SB_UT_ADD_SUBTEST(Test_SB_IdxPushPop);
+    SB_UT_ADD_SUBTEST(Test_SB_MsgMap);
+    SB_UT_ADD_SUBTEST(Test_SB_MsgMap_Churn);
+    SB_UT_ADD_SUBTEST(Test_SB_SendMsgPaths_PutErrRefund);
+    SB_UT_ADD_SUBTEST(Test_SB_SendMsgBatch_PutErrRefund);
 } /* end Test_SB_SpecialCases */
 
 /*
@@ -3892,6 +6482,223 @@ void Test_SB_IdxPushPop()
 
 } /* end Test_SB_IdxPushPop */
 
+/*
+** Test setting, looking up, removing and walking message map entries
+*/
+void Test_SB_MsgMap(void)
+{
+    CFE_SB_MsgKey_t      Key[3];
+    CFE_SB_MsgRouteIdx_t Idx;
+    uint32               Slot;
+    uint32               InUse = 0;
+    int32                i;
+
+    CFE_SB_InitMsgMap();
+
+    Key[0] = CFE_SB_ConvertMsgIdtoMsgKey(SB_UT_TLM_MID1);
+    Key[1] = CFE_SB_ConvertMsgIdtoMsgKey(SB_UT_TLM_MID2);
+#ifdef CFE_PLATFORM_SB_MSGMAP_HASH
+    /* find a key that collides with the first, wider than 16 bits */
+    for (Key[2].KeyIdx = 0x10000; CFE_SB_MsgMapHash(Key[2]) != CFE_SB_MsgMapHash(Key[0]); Key[2].KeyIdx++)
+        ;
+#else
+    Key[2] = CFE_SB_ConvertMsgIdtoMsgKey(SB_UT_TLM_MID3);
+#endif
+
+    for (i = 0; i < 3; i++)
+    {
+        CFE_SB_SetRoutingTblIdx(Key[i], CFE_SB_ValueToRouteIdx(i));
+    }
+
+    for (i = 0; i < 3; i++)
+    {
+        Idx = CFE_SB_GetRoutingTblIdx(Key[i]);
+        ASSERT_TRUE(CFE_SB_IsValidRouteIdx(Idx));
+        ASSERT_EQ(CFE_SB_RouteIdxToValue(Idx), i);
+    }
+
+    /* Removing the first key must not hide the key after it */
+    CFE_SB_SetRoutingTblIdx(Key[0], CFE_SB_INVALID_ROUTE_IDX);
+    ASSERT_TRUE(!CFE_SB_IsValidRouteIdx(CFE_SB_GetRoutingTblIdx(Key[0])));
+    ASSERT_EQ(CFE_SB_RouteIdxToValue(CFE_SB_GetRoutingTblIdx(Key[2])), 2);
+
+    for (Slot = 0; Slot < CFE_SB_MSGMAP_SIZE; Slot++)
+    {
+        if (CFE_SB_IsValidRouteIdx(CFE_SB_GetMsgMapEntry(Slot)))
+        {
+            InUse++;
+        }
+    }
+    ASSERT_EQ(InUse, 2);
+
+    CFE_SB_SetRoutingTblIdx(Key[0], CFE_SB_ValueToRouteIdx(0));
+    ASSERT_EQ(CFE_SB_RouteIdxToValue(CFE_SB_GetRoutingTblIdx(Key[0])), 0);
+
+    EVTCNT(0);
+
+    CFE_SB_InitMsgMap();
+
+} /* end Test_SB_MsgMap */
+
+/*
+** Test that adding and removing message map entries leaves lookups short
+*/
+void Test_SB_MsgMap_Churn(void)
+{
+    const uint32         Live = CFE_PLATFORM_SB_MAX_MSG_IDS / 2;
+    const uint32         Cycles = 1000;
+    CFE_SB_MsgKey_t      Key;
+    uint32               c;
+#ifdef CFE_PLATFORM_SB_MSGMAP_HASH
+    uint32               Slot;
+    uint32               Probes;
+    uint32               InUse = 0;
+#endif
+
+    CFE_SB_InitMsgMap();
+
+    /* keep a sliding window of Live keys, removing the oldest on each add */
+    for (c = 0; c < Cycles; c++)
+    {
+        Key.KeyIdx = c + 1;
+        CFE_SB_SetRoutingTblIdx(Key, CFE_SB_ValueToRouteIdx(c % CFE_PLATFORM_SB_MAX_MSG_IDS));
+        if (c >= Live)
+        {
+            Key.KeyIdx = c + 1 - Live;
+            CFE_SB_SetRoutingTblIdx(Key, CFE_SB_INVALID_ROUTE_IDX);
+        }
+    }
+
+    for (c = 0; c < Cycles; c++)
+    {
+        Key.KeyIdx = c + 1;
+        if (c >= Cycles - Live)
+        {
+            ASSERT_EQ(CFE_SB_RouteIdxToValue(CFE_SB_GetRoutingTblIdx(Key)), c % CFE_PLATFORM_SB_MAX_MSG_IDS);
+        }
+        else
+        {
+            ASSERT_TRUE(!CFE_SB_IsValidRouteIdx(CFE_SB_GetRoutingTblIdx(Key)));
+        }
+    }
+
+#ifdef CFE_PLATFORM_SB_MSGMAP_HASH
+    /* removed keys leave no slot behind */
+    for (Slot = 0; Slot < CFE_SB_MSGMAP_SIZE; Slot++)
+    {
+        if (CFE_SB.MsgMap[Slot].KeyIdx != CFE_SB_INVALID_MSG_KEY.KeyIdx)
+        {
+            InUse++;
+            ASSERT_TRUE(CFE_SB_IsValidRouteIdx(CFE_SB_GetMsgMapEntry(Slot)));
+        }
+    }
+    ASSERT_EQ(InUse, Live);
+
+    /* a miss stops at the end of its cluster, not after the whole map */
+    for (c = 0; c < Cycles - Live; c++)
+    {
+        Key.KeyIdx = c + 1;
+        Slot = CFE_SB_MsgMapHash(Key);
+        for (Probes = 1; CFE_SB.MsgMap[Slot].KeyIdx != CFE_SB_INVALID_MSG_KEY.KeyIdx; Probes++)
+        {
+            Slot = (Slot + 1) & (CFE_SB_MSGMAP_SIZE - 1);
+        }
+        ASSERT_TRUE(Probes <= Live + 1);
+    }
+#endif
+
+    EVTCNT(0);
+
+    CFE_SB_InitMsgMap();
+
+} /* end Test_SB_MsgMap_Churn */
+
+/*
+** Test that a failed queue write gives back the slot reserved for it
+*/
+void Test_SB_SendMsgPaths_PutErrRefund(void)
+{
+    CFE_SB_PipeId_t        PipeId;
+    CFE_SB_MsgId_t         MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_SB_MsgPtr_t        TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_MSG_Size_t         Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t         Type = CFE_MSG_Type_Tlm;
+    uint8                  PipeIdx;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 2, "RefundPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
+
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+
+    CFE_SB_SendErrReports();
+
+    EVTSENT(CFE_SB_Q_FULL_ERR_EID);
+
+    DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId);
+    PipeIdx = CFE_SB_GetPipeIdx(PipeId);
+    ASSERT_EQ(DestPtr->BuffCount, 0);
+    ASSERT_EQ(CFE_SB.PipeTbl[PipeIdx].PendingPuts, 0);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeIdx].InUse, 0);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.PipeOverflowErrorCounter, 1);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SB_SendMsgPaths_PutErrRefund */
+
+/*
+** Test that a batch send refunds a failed queue write made after its lock
+** was released, without touching the writes of the chunk that succeeded
+*/
+void Test_SB_SendMsgBatch_PutErrRefund(void)
+{
+    CFE_SB_PipeId_t        PipeId;
+    CFE_SB_MsgId_t         MsgId[2] = {SB_UT_TLM_MID, SB_UT_TLM_MID};
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_SB_Msg_t          *MsgArray[2];
+    int32                  StatusArray[2];
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_MSG_Size_t         Size[2] = {sizeof(TlmPkt), sizeof(TlmPkt)};
+    CFE_MSG_Type_t         Type[2] = {CFE_MSG_Type_Tlm, CFE_MSG_Type_Tlm};
+    uint8                  PipeIdx;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 4, "BatchRefundPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId[0], PipeId));
+
+    MsgArray[0] = (CFE_SB_Msg_t *) &TlmPkt;
+    MsgArray[1] = (CFE_SB_Msg_t *) &TlmPkt;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 2, OS_QUEUE_FULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), Type, sizeof(Type), false);
+
+    ASSERT(CFE_SB_SendMsgBatch(MsgArray, 2, StatusArray));
+    ASSERT_EQ(StatusArray[0], CFE_SUCCESS);
+    ASSERT_EQ(StatusArray[1], CFE_SUCCESS);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueuePut)), 2);
+
+    CFE_SB_SendErrReports();
+
+    EVTSENT(CFE_SB_Q_FULL_ERR_EID);
+
+    DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId[0]), PipeId);
+    PipeIdx = CFE_SB_GetPipeIdx(PipeId);
+    ASSERT_EQ(DestPtr->BuffCount, 1);
+    ASSERT_EQ(CFE_SB.PipeTbl[PipeIdx].PendingPuts, 0);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeIdx].InUse, 1);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.PipeOverflowErrorCounter, 1);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SB_SendMsgBatch_PutErrRefund */
+
 /*
 ** Test pipe creation with semaphore take and give failures
 */
@@ -4081,7 +6888,7 @@ void Test_SB_SendMsgPaths_Nominal(void)
     MsgId = CFE_SB_ValueToMsgId(CFE_SB_SEND_HK_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
 
-    CFE_SB.MsgMap[CFE_SB_MsgKeyToValue(CFE_SB_ConvertMsgIdtoMsgKey(CFE_SB_HK_TLM_MID))] = CFE_SB_INVALID_ROUTE_IDX;
+    CFE_SB_SetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(CFE_SB_HK_TLM_MID), CFE_SB_INVALID_ROUTE_IDX);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
     CFE_SB_ProcessCmdPipePkt();
     ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter, 0);
@@ -4123,7 +6930,7 @@ void Test_SB_SendMsgPaths_LimitErr(void)
     CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
     CFE_MSG_Size_t   Size = sizeof(TlmPkt);
 
-    /* Test inhibiting sending a "message ID limit error" message */
+    /* Test that a "message ID limit error" is reported by the SB task only */
     MsgId = SB_UT_TLM_MID;
     SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "MsgLimTestPipe"));
 
@@ -4141,11 +6948,15 @@ void Test_SB_SendMsgPaths_LimitErr(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
 
-    CFE_SB.StopRecurseFlags[1] |= CFE_BIT(CFE_SB_MSGID_LIM_ERR_EID_BIT);
     ASSERT(CFE_SB_SendMsg(TlmPktPtr));
-    CFE_SB.StopRecurseFlags[1] = 0;
 
     ASSERT_TRUE(!UT_EventIsInHistory(CFE_SB_MSGID_LIM_ERR_EID));
+    ASSERT_EQ(CFE_SB.SendErrTbl[0].Count, 1);
+
+    /* One summarised report, along with the pipe name lookup event */
+    CFE_SB_SendErrReports();
+    EVTSENT(CFE_SB_MSGID_LIM_ERR_EID);
+    ASSERT_EQ(CFE_SB.SendErrTbl[0].Count, 0);
 
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
@@ -4162,7 +6973,7 @@ void Test_SB_SendMsgPaths_FullErr(void)
     CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
     CFE_MSG_Size_t   Size = sizeof(TlmPkt);
 
-    /* Test inhibiting sending a "pipe full" message */
+    /* Test that a "pipe full" error is reported by the SB task only */
     MsgId = SB_UT_TLM_MID;
     SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "PipeFullTestPipe"));
     SETUP(CFE_SB_Subscribe(MsgId, PipeId));
@@ -4180,14 +6991,17 @@ void Test_SB_SendMsgPaths_FullErr(void)
 
     /* Tell the QueuePut stub to return OS_QUEUE_FULL on its next call */
     UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
-    CFE_SB.StopRecurseFlags[1] |= CFE_BIT(CFE_SB_Q_FULL_ERR_EID_BIT);
     ASSERT(CFE_SB_SendMsg(TlmPktPtr));
-    CFE_SB.StopRecurseFlags[1] = 0;
 
-    ASSERT_TRUE(!UT_EventIsInHistory(CFE_SB_Q_FULL_ERR_EID_BIT));
+    ASSERT_TRUE(!UT_EventIsInHistory(CFE_SB_Q_FULL_ERR_EID));
 
     EVTCNT(3);
 
+    /* One summarised report, along with the pipe name lookup event */
+    CFE_SB_SendErrReports();
+    EVTCNT(5);
+    EVTSENT(CFE_SB_Q_FULL_ERR_EID);
+
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 } /* end Test_SB_SendMsgPaths */
 
@@ -4201,7 +7015,7 @@ void Test_SB_SendMsgPaths_WriteErr(void)
     CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
     CFE_MSG_Size_t   Size = sizeof(TlmPkt);
 
-    /* Test inhibiting sending a "pipe write error" message */
+    /* Test that a "pipe write error" is reported by the SB task only */
     MsgId = SB_UT_TLM_MID;
     SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
     SETUP(CFE_SB_Subscribe(MsgId, PipeId));
@@ -4211,9 +7025,7 @@ void Test_SB_SendMsgPaths_WriteErr(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetTypeFromMsgId), &Type, sizeof(Type), false);
 
-    CFE_SB.StopRecurseFlags[1] |= CFE_BIT(CFE_SB_Q_WR_ERR_EID_BIT);
     ASSERT(CFE_SB_SendMsg(TlmPktPtr));
-    CFE_SB.StopRecurseFlags[1] = 0;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
@@ -4225,6 +7037,11 @@ void Test_SB_SendMsgPaths_WriteErr(void)
 
     ASSERT_TRUE(!UT_EventIsInHistory(CFE_SB_Q_WR_ERR_EID));
 
+    /* One summarised report, along with the pipe name lookup event */
+    CFE_SB_SendErrReports();
+    EVTCNT(5);
+    EVTSENT(CFE_SB_Q_WR_ERR_EID);
+
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
 } /* end Test_SB_SendMsgPaths */
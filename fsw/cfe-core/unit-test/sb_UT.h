@@ -459,6 +459,9 @@ void Test_SB_Cmds_RstCtrs(void);
 ******************************************************************************/
 void Test_SB_Cmds_Stats(void);
 
+void Test_SB_Cmds_LatencyStats(void);
+void Test_SB_Cmds_LatencyStatsInvParam(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send routing information command using the default file name
@@ -1079,6 +1082,7 @@ void Test_SB_Cmds_MapInfoHdrFail(void);
 **
 ******************************************************************************/
 void Test_SB_Cmds_MapInfoWriteFail(void);
+void Test_SB_Cmds_MapInfoSteps(void);
 
 /*****************************************************************************/
 /**
@@ -1714,6 +1718,49 @@ void Test_CreatePipe_LongPipeName(void);
 ******************************************************************************/
 void Test_CreatePipe_SamePipeName(void);
 
+/*****************************************************************************/
+/**
+** \brief Test create pipe with the ring queue backend
+**
+** \par Description
+**        This function tests that a pipe created with CFE_SB_PIPEOPTS_RING
+**        delivers messages without the OS queue, reports a full ring as a
+**        pipe overflow, and keeps its backend across CFE_SB_SetPipeOpts.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #SB_ResetUnitTest, #CFE_SB_CreatePipeEx, #CFE_SB_SetPipeOpts
+**
+******************************************************************************/
+void Test_CreatePipe_Ring(void);
+
+/*****************************************************************************/
+/**
+** \brief Test create pipe with an elastic depth
+**
+** \par Description
+**        This function tests that a pipe created by CFE_SB_CreatePipeElastic
+**        grows under a burst, delivers its messages in order, shrinks back
+**        to its base depth after the quiet period and reports both in the
+**        pipe depth statistics.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #SB_ResetUnitTest, #CFE_SB_CreatePipeElastic, #CFE_SB_ShrinkElasticPipes
+**
+******************************************************************************/
+void Test_CreatePipe_Elastic(void);
+
+void Test_CreatePipe_ElasticErrors(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test create pipe response to too many pipes
@@ -1850,6 +1897,8 @@ void Test_DeletePipe_InvalidPipeOwner(void);
 **
 ******************************************************************************/
 void Test_DeletePipe_WithAppid(void);
+void Test_DeletePipe_RouteMap(void);
+void Test_DeletePipe_PendingPut(void);
 
 /*****************************************************************************/
 /**
@@ -2145,6 +2194,21 @@ void Test_Subscribe_SubscriptionReporting(void);
 ******************************************************************************/
 void Test_Subscribe_InvalidPipeOwner(void);
 
+void Test_Subscribe_Range(void);
+void Test_Subscribe_Mask(void);
+void Test_Subscribe_SetErrors(void);
+void Test_Subscribe_PolicyEveryNth(void);
+void Test_Subscribe_PolicyInterval(void);
+void Test_Subscribe_PolicyOnChange(void);
+void Test_Subscribe_PolicyOnChangeFull(void);
+void Test_Subscribe_PolicyErrors(void);
+void Test_Subscribe_BcastTopic(void);
+void Test_Subscribe_BcastTopicReaders(void);
+void Test_Subscribe_BcastTopicErrors(void);
+void Test_Subscribe_Many(void);
+void Test_Subscribe_ManyErrors(void);
+void Test_Subscribe_AddDestErr(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB unsubscribe API test functions
@@ -2383,6 +2447,29 @@ void Test_Unsubscribe_MiddleDestWithMany(void);
 ******************************************************************************/
 void Test_Unsubscribe_GetDestPtr(void);
 
+/*****************************************************************************/
+/**
+** \brief  Test destination array growth and compaction
+**
+** \par Description
+**        This function tests that the destination array of a route grows
+**        on subscribe, is left intact when growing fails, and is compacted
+**        on unsubscribe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #SB_ResetUnitTest, #CFE_SB_CreatePipe, #CFE_SB_Subscribe,
+** \sa #CFE_SB_Unsubscribe, #CFE_SB_GetDestPtr, #UT_GetNumEventsSent,
+** \sa #UT_EventIsInHistory, #CFE_SB_DeletePipe, #UT_Report
+**
+******************************************************************************/
+void Test_Unsubscribe_DestArray(void);
+void Test_Unsubscribe_Many(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB send message API test functions
@@ -2595,6 +2682,19 @@ void Test_SendMsg_PipeFull(void);
 ******************************************************************************/
 void Test_SendMsg_MsgLimitExceeded(void);
 
+void Test_SendMsg_LatestValuePipe(void);
+void Test_SendMsg_LatestValueUnsubscribe(void);
+void Test_SendMsg_Coalesce(void);
+void Test_SendMsg_PriorityLane(void);
+void Test_SendMsg_LosslessWait(void);
+void Test_SendMsg_LosslessTimeOut(void);
+void Test_SendMsg_LosslessSignal(void);
+void Test_SendMsg_Latency(void);
+void Test_SendMsg_IoVec(void);
+void Test_SendMsg_IoVecErrors(void);
+
+void Test_SendMsg_SendErrReports(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send message response to a buffer descriptor allocation failure
@@ -2790,6 +2890,63 @@ void Test_SendMsg_InvalidMsgId_ZeroCopy(void);
 ******************************************************************************/
 void Test_SendMsg_NoSubscribers_ZeroCopy(void);
 
+/*****************************************************************************/
+/**
+** \brief Test sending a batch of messages
+**
+** \par Description
+**        This function tests sending several messages with one call to
+**        CFE_SB_SendMsgBatch.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #SB_ResetUnitTest, #CFE_SB_SendMsgBatch, #CFE_SB_ZeroCopySendBatch
+**
+******************************************************************************/
+void Test_SendMsg_Batch(void);
+
+/*****************************************************************************/
+/**
+** \brief Test batch send error handling
+**
+** \par Description
+**        This function tests the per-message status and the per-batch
+**        events of a batch send containing bad messages.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #SB_ResetUnitTest, #CFE_SB_SendMsgBatch, #CFE_SB_ZeroCopySendBatch
+**
+******************************************************************************/
+void Test_SendMsg_BatchErrors(void);
+
+/*****************************************************************************/
+/**
+** \brief Test sending a batch of messages in zero copy mode
+**
+** \par Description
+**        This function tests CFE_SB_ZeroCopySendBatch, including a batch
+**        with an invalid buffer.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #SB_ResetUnitTest, #CFE_SB_SendMsgBatch, #CFE_SB_ZeroCopySendBatch
+**
+******************************************************************************/
+void Test_SendMsg_ZeroCopySendBatch(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test response to sending a message with the message size larger
@@ -2958,6 +3115,110 @@ void Test_RcvMsg_PipeReadError(void);
 ******************************************************************************/
 void Test_RcvMsg_PendForever(void);
 
+/*****************************************************************************/
+/**
+** \brief Test batch receive response to invalid arguments
+**
+** \par Description
+**        This function tests the response of CFE_SB_RcvMsgBatch to bad
+**        arguments and to an empty pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #SB_ResetUnitTest, #CFE_SB_RcvMsgBatch
+**
+******************************************************************************/
+void Test_RcvMsgBatch_InvalidArgs(void);
+
+/*****************************************************************************/
+/**
+** \brief Test draining a pipe with one batch receive
+**
+** \par Description
+**        This function tests that CFE_SB_RcvMsgBatch returns every waiting
+**        message, accounts for them, and releases them on the next receive.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #SB_ResetUnitTest, #CFE_SB_RcvMsgBatch
+**
+******************************************************************************/
+void Test_RcvMsgBatch_Drain(void);
+
+/*****************************************************************************/
+/**
+** \brief Test blocking receive on a ring pipe
+**
+** \par Description
+**        This function tests that a ring pipe reader waits on the OS queue
+**        only when the ring is empty, and that a send signals the OS queue
+**        only while the reader is waiting.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #SB_ResetUnitTest, #CFE_SB_CreatePipeEx, #CFE_SB_RcvMsg
+**
+******************************************************************************/
+void Test_RcvMsg_RingPend(void);
+
+/*****************************************************************************/
+/**
+** \brief Test receive accounting through the queued destination handle
+**
+** \par Description
+**        This function tests that a received message is accounted to the
+**        destination it was delivered through, both when the handle queued
+**        with it is current and when a destination of the pipe was removed
+**        while the message was on the pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #SB_ResetUnitTest, #CFE_SB_RcvMsg, #CFE_SB_Unsubscribe
+**
+******************************************************************************/
+void Test_RcvMsg_StaleDestHandle(void);
+void Test_RcvMsg_RetainMsg(void);
+void Test_RcvMsg_RetainInvalid(void);
+void Test_RcvMsg_RetainPass(void);
+void Test_RcvMsg_RetainShared(void);
+
+/*****************************************************************************/
+/**
+** \brief Test getting the sender of a received message
+**
+** \par Description
+**        This function tests that the application that sent a message is
+**        returned for the message received from a pipe, and the response to
+**        invalid arguments, a message the pipe does not hold and a caller
+**        that does not own the pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #SB_ResetUnitTest, #CFE_SB_GetMsgSender
+**
+******************************************************************************/
+void Test_RcvMsg_GetMsgSender(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test receiving a message response to an invalid buffer pointer (null)
@@ -3425,5 +3686,9 @@ void Test_SB_Macros(void);
 void Test_SB_CCSDSPriHdr_Macros(void);
 void Test_SB_CCSDSSecHdr_Macros(void);
 void Test_SB_IdxPushPop(void);
+void Test_SB_MsgMap(void);
+void Test_SB_MsgMap_Churn(void);
+void Test_SB_SendMsgPaths_PutErrRefund(void);
+void Test_SB_SendMsgBatch_PutErrRefund(void);
 
 #endif /* _sb_ut_h_ */
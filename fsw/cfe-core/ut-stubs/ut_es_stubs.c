@@ -208,6 +208,32 @@ int32 CFE_ES_GetTaskID(CFE_ES_ResourceID_t *TaskIdPtr)
     return status;
 }
 
+int32 CFE_ES_GetTaskContext(CFE_ES_TaskContext_t *ContextPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_GetTaskContext), ContextPtr);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_ES_GetTaskContext);
+
+    if (status >= 0)
+    {
+        /* Defer to the ID stubs so that their data buffers and return codes apply here too */
+        CFE_ES_GetTaskID(&ContextPtr->TaskId);
+        status = CFE_ES_GetAppID(&ContextPtr->AppId);
+        ContextPtr->AppName = "UT";
+    }
+
+    if (status < 0)
+    {
+        ContextPtr->TaskId = CFE_UT_ES_ID_INVALID;
+        ContextPtr->AppId = CFE_UT_ES_ID_INVALID;
+        ContextPtr->AppName = NULL;
+    }
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_ES_GetAppIDByName stub function
@@ -163,6 +163,47 @@ int32 CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth,
     return status;
 }
 
+int32 CFE_SB_CreatePipeEx(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth,
+                          const char *PipeName, uint8 Opts)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_CreatePipeEx), PipeIdPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_CreatePipeEx), Depth);
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_CreatePipeEx), PipeName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_CreatePipeEx), Opts);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_CreatePipeEx);
+
+    if (status >= 0)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(CFE_SB_CreatePipeEx), (uint8*)PipeIdPtr, sizeof(*PipeIdPtr));
+    }
+
+    return status;
+}
+
+int32 CFE_SB_CreatePipeElastic(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, uint16 MaxDepth,
+                               const char *PipeName, uint8 Opts)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_CreatePipeElastic), PipeIdPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_CreatePipeElastic), Depth);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_CreatePipeElastic), MaxDepth);
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_CreatePipeElastic), PipeName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_CreatePipeElastic), Opts);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_CreatePipeElastic);
+
+    if (status >= 0)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(CFE_SB_CreatePipeElastic), (uint8*)PipeIdPtr, sizeof(*PipeIdPtr));
+    }
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_SB_DeletePipe stub function
@@ -446,6 +487,37 @@ int32 CFE_SB_RcvMsg(CFE_SB_MsgPtr_t *BufPtr,
     return status;
 }
 
+int32 CFE_SB_RcvMsgBatch(CFE_SB_MsgPtr_t *BufPtrArray,
+                         uint32 MaxCount,
+                         uint32 *CountPtr,
+                         CFE_SB_PipeId_t PipeId,
+                         int32 TimeOut)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_RcvMsgBatch), BufPtrArray);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_RcvMsgBatch), MaxCount);
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_RcvMsgBatch), CountPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_RcvMsgBatch), PipeId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_RcvMsgBatch), TimeOut);
+
+    int32 status;
+    uint32 Count = 0;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_RcvMsgBatch);
+
+    if (status >= 0 && BufPtrArray != NULL)
+    {
+        Count = UT_Stub_CopyToLocal(UT_KEY(CFE_SB_RcvMsgBatch), (uint8*)BufPtrArray,
+                                    MaxCount * sizeof(*BufPtrArray)) / sizeof(*BufPtrArray);
+    }
+
+    if (CountPtr != NULL)
+    {
+        *CountPtr = Count;
+    }
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_SB_SendMsg stub function
@@ -690,6 +762,94 @@ int32 CFE_SB_SubscribeLocal(CFE_SB_MsgId_t MsgId,
     return status;
 }
 
+int32 CFE_SB_SubscribeRange(CFE_SB_MsgId_t FirstMsgId,
+                            CFE_SB_MsgId_t LastMsgId,
+                            CFE_SB_PipeId_t PipeId)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeRange), FirstMsgId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeRange), LastMsgId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeRange), PipeId);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_SubscribeRange);
+
+    return status;
+}
+
+int32 CFE_SB_SubscribeMask(CFE_SB_MsgId_t MsgId,
+                           CFE_SB_MsgId_Atom_t Mask,
+                           CFE_SB_PipeId_t PipeId)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeMask), MsgId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeMask), Mask);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeMask), PipeId);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_SubscribeMask);
+
+    return status;
+}
+
+int32 CFE_SB_SubscribeMany(const CFE_SB_MsgId_t *MsgIdList,
+                           uint32 Count,
+                           CFE_SB_PipeId_t PipeId,
+                           CFE_SB_Qos_t Quality,
+                           uint16 MsgLim)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_SubscribeMany), MsgIdList);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeMany), Count);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeMany), PipeId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeMany), Quality);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeMany), MsgLim);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_SubscribeMany);
+
+    return status;
+}
+
+int32 CFE_SB_SetDeliveryPolicy(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
+                               const CFE_SB_DeliveryPolicy_t *PolicyPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetDeliveryPolicy), MsgId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetDeliveryPolicy), PipeId);
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_SetDeliveryPolicy), PolicyPtr);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_SetDeliveryPolicy);
+
+    return status;
+}
+
+int32 CFE_SB_SetCoalescing(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, bool Enable)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetCoalescing), MsgId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetCoalescing), PipeId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetCoalescing), Enable);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_SetCoalescing);
+
+    return status;
+}
+
+int32 CFE_SB_SetBroadcastTopic(CFE_SB_MsgId_t MsgId, uint16 Depth)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetBroadcastTopic), MsgId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetBroadcastTopic), Depth);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_SetBroadcastTopic);
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_SB_TimeStampMsg stub function
@@ -1036,6 +1196,43 @@ int32 CFE_SB_PassMsg(CFE_SB_Msg_t *MsgPtr)
     return status;
 }
 
+int32 CFE_SB_SendMsgBatch(CFE_SB_Msg_t **MsgArray, uint32 Count, int32 *StatusArray)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_SendMsgBatch), MsgArray);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SendMsgBatch), Count);
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_SendMsgBatch), StatusArray);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_SendMsgBatch);
+
+    return status;
+}
+
+int32 CFE_SB_SendMsgV(const CFE_SB_IoVec_t *IoVec, uint32 Count)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_SendMsgV), IoVec);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SendMsgV), Count);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_SendMsgV);
+
+    return status;
+}
+
+int32 CFE_SB_SendMsgTimeout(CFE_SB_Msg_t *MsgPtr, int32 TimeOut)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_SendMsgTimeout), MsgPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SendMsgTimeout), TimeOut);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_SendMsgTimeout);
+
+    return status;
+}
+
 int32 CFE_SB_SetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 Opts)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetPipeOpts), PipeId);
@@ -1069,6 +1266,19 @@ int32 CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
     return status;
 }
 
+int32 CFE_SB_UnsubscribeMany(const CFE_SB_MsgId_t *MsgIdList, uint32 Count, CFE_SB_PipeId_t PipeId)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_UnsubscribeMany), MsgIdList);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_UnsubscribeMany), Count);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_UnsubscribeMany), PipeId);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_UnsubscribeMany);
+
+    return status;
+}
+
 CFE_SB_Msg_t* CFE_SB_ZeroCopyGetPtr(uint16 MsgSize, CFE_SB_ZeroCopyHandle_t *BufferHandle)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_ZeroCopyGetPtr), MsgSize);
@@ -1111,6 +1321,50 @@ int32 CFE_SB_ZeroCopyReleasePtr(CFE_SB_Msg_t *Ptr2Release, CFE_SB_ZeroCopyHandle
     return status;
 }
 
+int32 CFE_SB_RetainMsg(CFE_SB_Msg_t *MsgPtr, CFE_SB_PipeId_t PipeId, CFE_SB_ZeroCopyHandle_t *BufferHandle)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_RetainMsg), MsgPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_RetainMsg), PipeId);
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_RetainMsg), BufferHandle);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_RetainMsg);
+
+    return status;
+}
+
+int32 CFE_SB_ReleaseRetained(CFE_SB_Msg_t *MsgPtr, CFE_SB_ZeroCopyHandle_t BufferHandle)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_ReleaseRetained), MsgPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_ReleaseRetained), BufferHandle);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_ReleaseRetained);
+
+    return status;
+}
+
+int32 CFE_SB_GetMsgSender(const CFE_SB_Msg_t *MsgPtr, CFE_SB_PipeId_t PipeId,
+                          CFE_ES_ResourceID_t *SenderIdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_GetMsgSender), MsgPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_GetMsgSender), PipeId);
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_GetMsgSender), SenderIdPtr);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_GetMsgSender);
+
+    if (status >= 0)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(CFE_SB_GetMsgSender), (uint8*)SenderIdPtr, sizeof(*SenderIdPtr));
+    }
+
+    return status;
+}
+
 int32 CFE_SB_ZeroCopySend(CFE_SB_Msg_t *MsgPtr, CFE_SB_ZeroCopyHandle_t BufferHandle)
 {
     UT_Stub_RegisterContext(UT_KEY(CFE_SB_ZeroCopySend), MsgPtr);
@@ -1123,3 +1377,18 @@ int32 CFE_SB_ZeroCopySend(CFE_SB_Msg_t *MsgPtr, CFE_SB_ZeroCopyHandle_t BufferHa
     return status;
 }
 
+int32 CFE_SB_ZeroCopySendBatch(CFE_SB_Msg_t **MsgArray, CFE_SB_ZeroCopyHandle_t *HandleArray,
+                               uint32 Count, int32 *StatusArray)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_ZeroCopySendBatch), MsgArray);
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_ZeroCopySendBatch), HandleArray);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_ZeroCopySendBatch), Count);
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_ZeroCopySendBatch), StatusArray);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_ZeroCopySendBatch);
+
+    return status;
+}
+
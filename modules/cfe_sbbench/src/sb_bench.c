@@ -0,0 +1,181 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: sb_bench.c
+**
+** Purpose:
+**   Initialization routine and parameter sweep of the Software Bus
+**   throughput and latency benchmark.
+**
+**   Each point of the sweep is reported as a UT assert result and as one
+**   line of a CSV file (SB_BENCH_OUTPUT_FILE) for post processing.
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sb_bench.h"
+
+/*
+ * Sweep dimensions.  Points where there are more consumers than pipes,
+ * or more pipes than the platform allows destinations per message,
+ * are skipped.
+ */
+static const uint16 SB_Bench_MsgSizes[]  = { 32, 256, 1024, SB_BENCH_MAX_MSG_SIZE };
+static const uint16 SB_Bench_Fanouts[]   = { 1, 4, 16, SB_BENCH_MAX_FANOUT };
+static const uint16 SB_Bench_Producers[] = { 1, 4 };
+static const uint16 SB_Bench_Consumers[] = { 1, 4 };
+static const uint16 SB_Bench_Depths[]    = { 4, 64 };
+
+#define SB_BENCH_DIM(x)   (sizeof(x) / sizeof((x)[0]))
+
+static osal_id_t SB_Bench_Fd;
+static uint32    SB_Bench_RunCount;
+
+/*
+ * Initialization function
+ * Register the benchmark with CFE Assert
+ */
+int32 CFE_SB_Bench_Init(int32 LibId)
+{
+    UtTest_Add(SB_Bench_Sweep, SB_Bench_Setup, SB_Bench_Teardown, "SB Bench");
+    return CFE_SUCCESS;
+}
+
+/*
+ * Write one line to the results file, if it is open
+ */
+static void SB_Bench_WriteLine(const char *Line)
+{
+    if (OS_ObjectIdDefined(SB_Bench_Fd))
+    {
+        OS_write(SB_Bench_Fd, Line, strlen(Line));
+    }
+}
+
+void SB_Bench_Setup(void)
+{
+    int32 Status;
+
+    SB_Bench_RunCount = 0;
+
+    Status = OS_OpenCreate(&SB_Bench_Fd, SB_BENCH_OUTPUT_FILE,
+                           OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+    if (Status < OS_SUCCESS)
+    {
+        SB_Bench_Fd = OS_OBJECT_ID_UNDEFINED;
+    }
+    UtAssert_True(Status >= OS_SUCCESS, "Open %s, Status=%ld", SB_BENCH_OUTPUT_FILE, (long)Status);
+
+    SB_Bench_WriteLine("run,msg_size,fanout,producers,consumers,pipe_depth,mode,"
+                       "sent,send_errors,received,elapsed_usec,msgs_per_sec,"
+                       "lat_p50_usec,lat_p99_usec,lat_p999_usec,lat_max_usec,send_ns_per_msg\n");
+}
+
+void SB_Bench_Teardown(void)
+{
+    if (OS_ObjectIdDefined(SB_Bench_Fd))
+    {
+        OS_close(SB_Bench_Fd);
+        SB_Bench_Fd = OS_OBJECT_ID_UNDEFINED;
+    }
+}
+
+/*
+ * Run one point of the sweep and report it
+ */
+static void SB_Bench_Point(const SB_Bench_Config_t *Config)
+{
+    SB_Bench_Result_t Result;
+    char              Line[256];
+    int32             Status;
+
+    ++SB_Bench_RunCount;
+
+    Status = SB_Bench_Run(Config, &Result);
+
+    UtAssert_True(Status == CFE_SUCCESS && Result.Received > 0,
+                  "size=%u fanout=%u prod=%u cons=%u depth=%u %s: %lu msgs/s, p50=%lu p99=%lu p999=%lu usec",
+                  (unsigned int)Config->MsgSize, (unsigned int)Config->Fanout,
+                  (unsigned int)Config->Producers, (unsigned int)Config->Consumers,
+                  (unsigned int)Config->PipeDepth, Config->ZeroCopy ? "zerocopy" : "copy",
+                  (unsigned long)Result.MsgsPerSec, (unsigned long)Result.LatencyP50,
+                  (unsigned long)Result.LatencyP99, (unsigned long)Result.LatencyP999);
+
+    snprintf(Line, sizeof(Line), "%lu,%u,%u,%u,%u,%u,%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n",
+             (unsigned long)SB_Bench_RunCount,
+             (unsigned int)Config->MsgSize, (unsigned int)Config->Fanout,
+             (unsigned int)Config->Producers, (unsigned int)Config->Consumers,
+             (unsigned int)Config->PipeDepth, Config->ZeroCopy ? "zerocopy" : "copy",
+             (unsigned long)Result.Sent, (unsigned long)Result.SendErrors,
+             (unsigned long)Result.Received, (unsigned long)Result.ElapsedUsec,
+             (unsigned long)Result.MsgsPerSec, (unsigned long)Result.LatencyP50,
+             (unsigned long)Result.LatencyP99, (unsigned long)Result.LatencyP999,
+             (unsigned long)Result.LatencyMax, (unsigned long)Result.SendNsPerMsg);
+    SB_Bench_WriteLine(Line);
+}
+
+void SB_Bench_Sweep(void)
+{
+    SB_Bench_Config_t Config;
+    uint32            s, f, p, c, d, z;
+
+    for (s = 0; s < SB_BENCH_DIM(SB_Bench_MsgSizes); ++s)
+    {
+        for (f = 0; f < SB_BENCH_DIM(SB_Bench_Fanouts); ++f)
+        {
+            if (SB_Bench_Fanouts[f] > CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
+            {
+                continue;
+            }
+
+            for (p = 0; p < SB_BENCH_DIM(SB_Bench_Producers); ++p)
+            {
+                for (c = 0; c < SB_BENCH_DIM(SB_Bench_Consumers); ++c)
+                {
+                    if (SB_Bench_Consumers[c] > SB_Bench_Fanouts[f])
+                    {
+                        continue;
+                    }
+
+                    for (d = 0; d < SB_BENCH_DIM(SB_Bench_Depths); ++d)
+                    {
+                        for (z = 0; z < 2; ++z)
+                        {
+                            Config.MsgSize   = SB_Bench_MsgSizes[s];
+                            Config.Fanout    = SB_Bench_Fanouts[f];
+                            Config.Producers = SB_Bench_Producers[p];
+                            Config.Consumers = SB_Bench_Consumers[c];
+                            Config.PipeDepth = SB_Bench_Depths[d];
+                            Config.ZeroCopy  = (z != 0);
+
+                            SB_Bench_Point(&Config);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
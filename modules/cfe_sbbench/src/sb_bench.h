@@ -0,0 +1,147 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: sb_bench.h
+**
+** Purpose:
+**   Definitions for the Software Bus throughput and latency benchmark
+**
+*************************************************************************/
+
+#ifndef SB_BENCH_H
+#define SB_BENCH_H
+
+/*
+ * Includes
+ */
+
+#include <cfe.h>
+#include <cfe_platform_cfg.h>
+
+#include "uttest.h"
+#include "utassert.h"
+
+/*
+ * Message ID used by the benchmark traffic.  It must not be used
+ * by any other application on the target running the benchmark.
+ */
+#ifndef SB_BENCH_MID
+#define SB_BENCH_MID                0x08FF
+#endif
+
+/*
+ * File the results are written to, one line per configuration
+ */
+#ifndef SB_BENCH_OUTPUT_FILE
+#define SB_BENCH_OUTPUT_FILE        "/ram/cfe_sb_bench.csv"
+#endif
+
+/*
+ * Number of messages sent by each producer in one configuration
+ */
+#ifndef SB_BENCH_MSGS_PER_PRODUCER
+#define SB_BENCH_MSGS_PER_PRODUCER  1000
+#endif
+
+/*
+ * Limits of the sweep, sizing the static run state
+ */
+#define SB_BENCH_MAX_FANOUT         32
+#define SB_BENCH_MAX_PRODUCERS      8
+#define SB_BENCH_MAX_CONSUMERS      SB_BENCH_MAX_FANOUT
+#define SB_BENCH_MAX_MSG_SIZE       4096
+#define SB_BENCH_MAX_SAMPLES        16384
+
+/*
+ * Child task parameters.  Producers run at a lower priority than
+ * consumers so a consumer is never starved by a busy producer.
+ */
+#define SB_BENCH_STACK_SIZE         8192
+#define SB_BENCH_PRODUCER_PRIORITY  110
+#define SB_BENCH_CONSUMER_PRIORITY  105
+
+/*
+ * Timeouts, in milliseconds
+ */
+#define SB_BENCH_RCV_TIMEOUT        100
+#define SB_BENCH_RUN_TIMEOUT        60000
+#define SB_BENCH_POLL_DELAY         10
+
+/*
+ * One point of the sweep
+ */
+typedef struct
+{
+    uint16 MsgSize;
+    uint16 Fanout;      /**< Number of pipes subscribed to the benchmark message */
+    uint16 Producers;
+    uint16 Consumers;   /**< Consumer tasks, each reading Fanout/Consumers pipes */
+    uint16 PipeDepth;
+    bool   ZeroCopy;
+} SB_Bench_Config_t;
+
+/*
+ * Results of one point of the sweep.  Latencies are in microseconds,
+ * measured from just before the send call to the receive in the consumer.
+ */
+typedef struct
+{
+    uint32 Sent;
+    uint32 SendErrors;
+    uint32 Received;        /**< Total over all pipes, at most Sent * Fanout */
+    uint32 ElapsedUsec;
+    uint32 MsgsPerSec;      /**< Received messages per second */
+    uint32 LatencyP50;
+    uint32 LatencyP99;
+    uint32 LatencyP999;
+    uint32 LatencyMax;
+    uint32 SendNsPerMsg;    /**< Time spent in the send call per sent message */
+} SB_Bench_Result_t;
+
+/*
+ * Payload of the benchmark traffic; the message is padded to the
+ * configured size beyond this.
+ */
+typedef struct
+{
+    uint32 SendTime;
+    uint32 Sequence;
+} SB_Bench_Payload_t;
+
+typedef struct
+{
+    CFE_SB_TlmHdr_t    Hdr;
+    SB_Bench_Payload_t Payload;
+} SB_Bench_Msg_t;
+
+/*
+ * Functions
+ */
+
+int32  CFE_SB_Bench_Init(int32 LibId);
+
+void   SB_Bench_Setup(void);
+void   SB_Bench_Teardown(void);
+void   SB_Bench_Sweep(void);
+
+int32  SB_Bench_Run(const SB_Bench_Config_t *Config, SB_Bench_Result_t *Result);
+uint32 SB_Bench_Now(void);
+
+#endif /* SB_BENCH_H */
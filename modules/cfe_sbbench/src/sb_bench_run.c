@@ -0,0 +1,526 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: sb_bench_run.c
+**
+** Purpose:
+**   Execution of one benchmark configuration: producer and consumer
+**   child tasks, pipe setup and computation of the results.
+**
+**   All tasks of a run belong to the test runner application, so the
+**   pipes created here may be read from any of them.  The child tasks
+**   are started one at a time; each one claims the next slot of its
+**   kind before the following task is created, and only ever writes to
+**   its own slot afterwards, so no locking is needed between tasks.
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sb_bench.h"
+
+typedef struct
+{
+    uint32        Sent;
+    uint32        SendErrors;
+    uint32        SendUsec;
+    uint32        FirstSendTime;
+    volatile bool Done;
+} SB_Bench_Producer_t;
+
+typedef struct
+{
+    uint32        Received;
+    uint32        NumSamples;
+    uint32        LastRcvTime;
+    volatile bool Done;
+} SB_Bench_Consumer_t;
+
+typedef struct
+{
+    SB_Bench_Config_t   Config;
+    CFE_SB_MsgId_t      MsgId;
+    CFE_SB_PipeId_t     Pipes[SB_BENCH_MAX_FANOUT];
+    uint32              SamplesPerConsumer;
+
+    volatile uint32     Started;
+    volatile bool       Go;
+    volatile bool       AllSent;
+
+    SB_Bench_Producer_t Producer[SB_BENCH_MAX_PRODUCERS];
+    SB_Bench_Consumer_t Consumer[SB_BENCH_MAX_CONSUMERS];
+    CFE_ES_ResourceID_t TaskId[SB_BENCH_MAX_PRODUCERS + SB_BENCH_MAX_CONSUMERS];
+
+    uint32              Samples[SB_BENCH_MAX_SAMPLES];
+    uint32              Sorted[SB_BENCH_MAX_SAMPLES];
+
+    union
+    {
+        SB_Bench_Msg_t  Msg;
+        uint8           Bytes[SB_BENCH_MAX_MSG_SIZE];
+    } TxBuf[SB_BENCH_MAX_PRODUCERS];
+} SB_Bench_State_t;
+
+static SB_Bench_State_t SB_Bench;
+
+/*
+ * Time base of the benchmark, the PSP local time in microseconds.
+ * Only differences of two values are meaningful.
+ */
+uint32 SB_Bench_Now(void)
+{
+    OS_time_t Now;
+
+    CFE_PSP_GetTime(&Now);
+
+    return ((uint32)Now.seconds * 1000000) + (uint32)Now.microsecs;
+}
+
+/*
+ * Producer child task: sends SB_BENCH_MSGS_PER_PRODUCER messages,
+ * stamping each one with the time just before the send call.
+ */
+static void SB_Bench_ProducerMain(void)
+{
+    SB_Bench_Producer_t     *ProdPtr;
+    CFE_SB_Msg_t            *MsgPtr;
+    CFE_SB_ZeroCopyHandle_t  Handle;
+    SB_Bench_Msg_t          *TxPtr;
+    uint32                   Slot;
+    uint32                   i;
+    uint32                   Start;
+    int32                    Status;
+
+    CFE_ES_RegisterChildTask();
+
+    Slot    = SB_Bench.Started;
+    ProdPtr = &SB_Bench.Producer[Slot];
+    TxPtr   = &SB_Bench.TxBuf[Slot].Msg;
+
+    CFE_SB_InitMsg(TxPtr, SB_Bench.MsgId, SB_Bench.Config.MsgSize, true);
+
+    SB_Bench.Started = Slot + 1;
+
+    while (!SB_Bench.Go)
+    {
+        OS_TaskDelay(1);
+    }
+
+    for (i = 0; i < SB_BENCH_MSGS_PER_PRODUCER; ++i)
+    {
+        Start = SB_Bench_Now();
+        if (i == 0)
+        {
+            ProdPtr->FirstSendTime = Start;
+        }
+
+        if (SB_Bench.Config.ZeroCopy)
+        {
+            MsgPtr = CFE_SB_ZeroCopyGetPtr(SB_Bench.Config.MsgSize, &Handle);
+            if (MsgPtr == NULL)
+            {
+                Status = CFE_SB_BUF_ALOC_ERR;
+            }
+            else
+            {
+                CFE_SB_InitMsg(MsgPtr, SB_Bench.MsgId, SB_Bench.Config.MsgSize, false);
+                ((SB_Bench_Msg_t *)MsgPtr)->Payload.Sequence = i;
+                ((SB_Bench_Msg_t *)MsgPtr)->Payload.SendTime = Start;
+                Status = CFE_SB_ZeroCopySend(MsgPtr, Handle);
+                if (Status != CFE_SUCCESS)
+                {
+                    CFE_SB_ZeroCopyReleasePtr(MsgPtr, Handle);
+                }
+            }
+        }
+        else
+        {
+            TxPtr->Payload.Sequence = i;
+            TxPtr->Payload.SendTime = Start;
+            Status = CFE_SB_SendMsg((CFE_SB_Msg_t *)TxPtr);
+        }
+
+        ProdPtr->SendUsec += SB_Bench_Now() - Start;
+
+        if (Status == CFE_SUCCESS)
+        {
+            ++ProdPtr->Sent;
+        }
+        else
+        {
+            ++ProdPtr->SendErrors;
+        }
+    }
+
+    ProdPtr->Done = true;
+
+    CFE_ES_ExitChildTask();
+}
+
+/*
+ * Account for one message received by a consumer
+ */
+static void SB_Bench_Consume(SB_Bench_Consumer_t *ConsPtr, uint32 *SamplePtr, CFE_SB_MsgPtr_t MsgPtr)
+{
+    uint32 Now = SB_Bench_Now();
+
+    SamplePtr[ConsPtr->NumSamples % SB_Bench.SamplesPerConsumer] =
+        Now - ((SB_Bench_Msg_t *)MsgPtr)->Payload.SendTime;
+    ++ConsPtr->NumSamples;
+    ++ConsPtr->Received;
+    ConsPtr->LastRcvTime = Now;
+}
+
+/*
+ * Consumer child task: reads the pipes Slot, Slot + Consumers, ... until
+ * each one has delivered every message sent, or has run dry after all
+ * producers finished (messages dropped on a full pipe).  The pipes are
+ * polled in turn, so a message on one pipe is not held up by a wait on
+ * another.  Only when a whole sweep finds every pipe empty does the task
+ * block, on the first pipe still expecting messages; every pipe gets a
+ * copy of each message, so that wait ends with the next send.
+ */
+static void SB_Bench_ConsumerMain(void)
+{
+    SB_Bench_Consumer_t *ConsPtr;
+    CFE_SB_MsgPtr_t      MsgPtr;
+    uint32              *SamplePtr;
+    uint32               PipeCount[SB_BENCH_MAX_FANOUT];
+    bool                 Drained[SB_BENCH_MAX_FANOUT];
+    uint32               Expected;
+    uint32               Remaining;
+    uint32               Waiting;
+    uint32               Slot;
+    uint32               i;
+    bool                 AllSent;
+    int32                Status;
+
+    CFE_ES_RegisterChildTask();
+
+    Slot      = SB_Bench.Started - SB_Bench.Config.Producers;
+    ConsPtr   = &SB_Bench.Consumer[Slot];
+    SamplePtr = &SB_Bench.Samples[Slot * SB_Bench.SamplesPerConsumer];
+    Expected  = SB_Bench.Config.Producers * SB_BENCH_MSGS_PER_PRODUCER;
+
+    Remaining = 0;
+    for (i = Slot; i < SB_Bench.Config.Fanout; i += SB_Bench.Config.Consumers)
+    {
+        PipeCount[i] = 0;
+        Drained[i]   = false;
+        ++Remaining;
+    }
+
+    SB_Bench.Started = SB_Bench.Started + 1;
+
+    while (Remaining > 0)
+    {
+        /* sampled before the sweep: anything sent before the flag was set is already queued */
+        AllSent = SB_Bench.AllSent;
+        Waiting = SB_Bench.Config.Fanout;
+
+        for (i = Slot; i < SB_Bench.Config.Fanout; i += SB_Bench.Config.Consumers)
+        {
+            if (Drained[i])
+            {
+                continue;
+            }
+
+            Status = CFE_SB_RcvMsg(&MsgPtr, SB_Bench.Pipes[i], CFE_SB_POLL);
+            while (Status == CFE_SUCCESS)
+            {
+                SB_Bench_Consume(ConsPtr, SamplePtr, MsgPtr);
+                ++PipeCount[i];
+                Status = CFE_SB_RcvMsg(&MsgPtr, SB_Bench.Pipes[i], CFE_SB_POLL);
+            }
+
+            if (PipeCount[i] >= Expected || AllSent)
+            {
+                Drained[i] = true;
+                --Remaining;
+            }
+            else if (Waiting == SB_Bench.Config.Fanout)
+            {
+                Waiting = i;
+            }
+        }
+
+        /* nothing left on any pipe: block until the producers send again */
+        if (Waiting < SB_Bench.Config.Fanout)
+        {
+            Status = CFE_SB_RcvMsg(&MsgPtr, SB_Bench.Pipes[Waiting], SB_BENCH_RCV_TIMEOUT);
+            if (Status == CFE_SUCCESS)
+            {
+                SB_Bench_Consume(ConsPtr, SamplePtr, MsgPtr);
+                ++PipeCount[Waiting];
+            }
+        }
+    }
+
+    ConsPtr->Done = true;
+
+    CFE_ES_ExitChildTask();
+}
+
+/*
+ * Start one child task and wait until it claimed its slot
+ */
+static int32 SB_Bench_StartTask(uint32 Index, const char *Kind,
+                                CFE_ES_ChildTaskMainFuncPtr_t FunctionPtr, uint32 Priority)
+{
+    char   TaskName[OS_MAX_API_NAME];
+    uint32 Waited;
+    int32  Status;
+
+    snprintf(TaskName, sizeof(TaskName), "SBB%s%lu", Kind, (unsigned long)Index);
+
+    Status = CFE_ES_CreateChildTask(&SB_Bench.TaskId[Index], TaskName, FunctionPtr,
+                                    NULL, SB_BENCH_STACK_SIZE, Priority, 0);
+
+    for (Waited = 0; Status == CFE_SUCCESS && SB_Bench.Started <= Index; Waited += SB_BENCH_POLL_DELAY)
+    {
+        if (Waited >= SB_BENCH_RUN_TIMEOUT)
+        {
+            Status = CFE_SB_TIME_OUT;
+        }
+        else
+        {
+            OS_TaskDelay(SB_BENCH_POLL_DELAY);
+        }
+    }
+
+    return Status;
+}
+
+/*
+ * Sort helper for the latency percentiles
+ */
+static int SB_Bench_Compare(const void *a, const void *b)
+{
+    uint32 A = *(const uint32 *)a;
+    uint32 B = *(const uint32 *)b;
+
+    return (A > B) - (A < B);
+}
+
+/*
+ * Fill in the latency percentiles from the samples of all consumers
+ */
+static void SB_Bench_Percentiles(SB_Bench_Result_t *Result)
+{
+    uint32 Count = 0;
+    uint32 Kept;
+    uint32 c;
+
+    for (c = 0; c < SB_Bench.Config.Consumers; ++c)
+    {
+        Kept = SB_Bench.Consumer[c].NumSamples;
+        if (Kept > SB_Bench.SamplesPerConsumer)
+        {
+            Kept = SB_Bench.SamplesPerConsumer;
+        }
+
+        memcpy(&SB_Bench.Sorted[Count], &SB_Bench.Samples[c * SB_Bench.SamplesPerConsumer],
+               Kept * sizeof(uint32));
+        Count += Kept;
+    }
+
+    if (Count == 0)
+    {
+        return;
+    }
+
+    qsort(SB_Bench.Sorted, Count, sizeof(uint32), SB_Bench_Compare);
+
+    Result->LatencyP50  = SB_Bench.Sorted[(Count * 500) / 1000];
+    Result->LatencyP99  = SB_Bench.Sorted[(Count * 990) / 1000];
+    Result->LatencyP999 = SB_Bench.Sorted[(Count * 999) / 1000];
+    Result->LatencyMax  = SB_Bench.Sorted[Count - 1];
+}
+
+/*
+ * Execute one configuration of the benchmark
+ */
+int32 SB_Bench_Run(const SB_Bench_Config_t *Config, SB_Bench_Result_t *Result)
+{
+    char   PipeName[OS_MAX_API_NAME];
+    uint32 NumPipes;
+    uint32 NumTasks;
+    uint32 StartTime;
+    uint32 SendUsec;
+    uint32 Waited;
+    uint32 i;
+    bool   Done;
+    int32  Status;
+
+    memset(Result, 0, sizeof(*Result));
+
+    if (Config->Fanout == 0 || Config->Fanout > SB_BENCH_MAX_FANOUT ||
+        Config->Producers == 0 || Config->Producers > SB_BENCH_MAX_PRODUCERS ||
+        Config->Consumers == 0 || Config->Consumers > Config->Fanout ||
+        Config->MsgSize < sizeof(SB_Bench_Msg_t) || Config->MsgSize > SB_BENCH_MAX_MSG_SIZE)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    memset(SB_Bench.Producer, 0, sizeof(SB_Bench.Producer));
+    memset(SB_Bench.Consumer, 0, sizeof(SB_Bench.Consumer));
+    SB_Bench.Config             = *Config;
+    SB_Bench.MsgId              = CFE_SB_ValueToMsgId(SB_BENCH_MID);
+    SB_Bench.SamplesPerConsumer = SB_BENCH_MAX_SAMPLES / Config->Consumers;
+    SB_Bench.Started            = 0;
+    SB_Bench.Go                 = false;
+    SB_Bench.AllSent            = false;
+
+    /*
+     * Pipes and subscriptions
+     */
+    Status   = CFE_SUCCESS;
+    NumPipes = 0;
+    while (NumPipes < Config->Fanout && Status == CFE_SUCCESS)
+    {
+        snprintf(PipeName, sizeof(PipeName), "SBB_PIPE%lu", (unsigned long)NumPipes);
+        Status = CFE_SB_CreatePipe(&SB_Bench.Pipes[NumPipes], Config->PipeDepth, PipeName);
+        if (Status == CFE_SUCCESS)
+        {
+            ++NumPipes;
+
+            /* the default limit of 4 messages would drop far below the pipe depth */
+            Status = CFE_SB_SubscribeEx(SB_Bench.MsgId, SB_Bench.Pipes[NumPipes - 1], CFE_SB_Default_Qos,
+                                        Config->PipeDepth);
+        }
+    }
+
+    /*
+     * Producers first, so the consumers can derive their slot from the
+     * number of tasks started
+     */
+    NumTasks = 0;
+    while (NumTasks < Config->Producers + Config->Consumers && Status == CFE_SUCCESS)
+    {
+        if (NumTasks < Config->Producers)
+        {
+            Status = SB_Bench_StartTask(NumTasks, "P", SB_Bench_ProducerMain, SB_BENCH_PRODUCER_PRIORITY);
+        }
+        else
+        {
+            Status = SB_Bench_StartTask(NumTasks, "C", SB_Bench_ConsumerMain, SB_BENCH_CONSUMER_PRIORITY);
+        }
+
+        /* A task that was created but never claimed its slot still has to be removed */
+        if (Status == CFE_SUCCESS || Status == CFE_SB_TIME_OUT)
+        {
+            ++NumTasks;
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        SB_Bench.Go = true;
+
+        Done = false;
+        for (Waited = 0; !Done && Waited < SB_BENCH_RUN_TIMEOUT; Waited += SB_BENCH_POLL_DELAY)
+        {
+            OS_TaskDelay(SB_BENCH_POLL_DELAY);
+
+            Done = true;
+            for (i = 0; i < Config->Producers; ++i)
+            {
+                Done = Done && SB_Bench.Producer[i].Done;
+            }
+
+            SB_Bench.AllSent = Done;
+
+            for (i = 0; i < Config->Consumers; ++i)
+            {
+                Done = Done && SB_Bench.Consumer[i].Done;
+            }
+        }
+
+        if (!Done)
+        {
+            Status = CFE_SB_TIME_OUT;
+        }
+
+        StartTime = SB_Bench.Producer[0].FirstSendTime;
+        SendUsec  = 0;
+        for (i = 0; i < Config->Producers; ++i)
+        {
+            if ((int32)(SB_Bench.Producer[i].FirstSendTime - StartTime) < 0)
+            {
+                StartTime = SB_Bench.Producer[i].FirstSendTime;
+            }
+
+            Result->Sent       += SB_Bench.Producer[i].Sent;
+            Result->SendErrors += SB_Bench.Producer[i].SendErrors;
+            SendUsec           += SB_Bench.Producer[i].SendUsec;
+        }
+
+        for (i = 0; i < Config->Consumers; ++i)
+        {
+            Result->Received += SB_Bench.Consumer[i].Received;
+            if (SB_Bench.Consumer[i].Received > 0 &&
+                SB_Bench.Consumer[i].LastRcvTime - StartTime > Result->ElapsedUsec)
+            {
+                Result->ElapsedUsec = SB_Bench.Consumer[i].LastRcvTime - StartTime;
+            }
+        }
+
+        if (Result->ElapsedUsec > 0)
+        {
+            Result->MsgsPerSec = (uint32)(((uint64)Result->Received * 1000000) / Result->ElapsedUsec);
+        }
+
+        if (Result->Sent + Result->SendErrors > 0)
+        {
+            Result->SendNsPerMsg = (uint32)(((uint64)SendUsec * 1000) / (Result->Sent + Result->SendErrors));
+        }
+
+        SB_Bench_Percentiles(Result);
+    }
+
+    /*
+     * Tasks that did not finish are removed, along with the pipes.  Tasks
+     * that did finish have already exited.
+     */
+    for (i = 0; i < NumTasks; ++i)
+    {
+        if ((i < Config->Producers && !SB_Bench.Producer[i].Done) ||
+            (i >= Config->Producers && !SB_Bench.Consumer[i - Config->Producers].Done))
+        {
+            CFE_ES_DeleteChildTask(SB_Bench.TaskId[i]);
+        }
+    }
+
+    for (i = 0; i < NumPipes; ++i)
+    {
+        CFE_SB_DeletePipe(SB_Bench.Pipes[i]);
+    }
+
+    /* Let the exiting tasks go before their names are reused */
+    OS_TaskDelay(SB_BENCH_POLL_DELAY);
+
+    return Status;
+}
@@ -0,0 +1,211 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: sb_bridge.h
+**
+** Purpose:
+**   Definitions for the Software Bus shared memory bridge, which connects
+**   the software buses of several cFE instances running on one host.
+**
+**   All instances map one shared memory segment.  Each instance owns one
+**   region of it, holding
+**     - the set of MsgIds subscribed with global scope on the instance
+**     - a ring of the messages published on the instance that any other
+**       instance subscribes to
+**   The ring has a single writer, the bridge of the owning instance, and
+**   is read by the bridges of all the other instances.  A reader that
+**   falls more than a ring behind loses the overwritten messages.
+**
+**   A bridged message is copied twice by the bridges: from the SB buffer
+**   it was received in into the ring, and from the ring straight into the
+**   zero copy buffer passed on to the other bus.  Neither copy can go, as
+**   every instance has its own SB memory pool in its own address space,
+**   and a ring slot is overwritten while subscribers may still hold the
+**   message.  A sender that wants no copy into SB in the first place uses
+**   CFE_SB_ZeroCopySend.
+**
+*************************************************************************/
+
+#ifndef SB_BRIDGE_H
+#define SB_BRIDGE_H
+
+/*
+ * Includes
+ */
+
+#include <cfe.h>
+#include <cfe_platform_cfg.h>
+#include <cfe_msgids.h>
+#include <cfe_sb_msg.h>
+
+/*
+ * Name of the shared memory segment.  Every instance that is to be
+ * connected must use the same name and the same configuration below.
+ */
+#ifndef SB_BRIDGE_SHM_NAME
+#define SB_BRIDGE_SHM_NAME          "/cfe_sb_bridge"
+#endif
+
+/*
+ * Number of instances the segment has room for
+ */
+#ifndef SB_BRIDGE_MAX_INSTANCES
+#define SB_BRIDGE_MAX_INSTANCES     4
+#endif
+
+/*
+ * Number of messages in the ring of each instance, a power of two
+ */
+#ifndef SB_BRIDGE_RING_SLOTS
+#define SB_BRIDGE_RING_SLOTS        64
+#endif
+
+/*
+ * Largest message carried; larger ones are counted and dropped
+ */
+#ifndef SB_BRIDGE_SLOT_SIZE
+#define SB_BRIDGE_SLOT_SIZE         CFE_MISSION_SB_MAX_SB_MSG_SIZE
+#endif
+
+/*
+ * Main loop timing.  Messages from other instances are picked up at least
+ * every poll period, in milliseconds; the global subscriptions of this
+ * instance are refreshed every resync period, in seconds, which is how
+ * unsubscribes are noticed as SB only reports new subscriptions.
+ */
+#define SB_BRIDGE_POLL_MSEC         1
+#define SB_BRIDGE_RESYNC_SEC        1
+
+/*
+ * How long an instance waits for another one to finish initializing the
+ * segment, in milliseconds
+ */
+#define SB_BRIDGE_ATTACH_WAIT_MSEC  100
+
+#define SB_BRIDGE_PIPE_DEPTH        64
+#define SB_BRIDGE_SUB_PIPE_DEPTH    32
+
+/*
+ * The subscription maps hold one bit per message ID up to the highest
+ * valid one, in the segment and on the stack.  That is 8 KiB per map for
+ * 16 bit message IDs; the wider IDs the hashed message map allows would
+ * make the segment unreasonably large.
+ */
+#if CFE_PLATFORM_SB_HIGHEST_VALID_MSGID > 0xFFFF
+#error "The SB bridge needs CFE_PLATFORM_SB_HIGHEST_VALID_MSGID to be at most 0xFFFF"
+#endif
+
+#define SB_BRIDGE_SUBMAP_WORDS      ((CFE_PLATFORM_SB_HIGHEST_VALID_MSGID / 32) + 1)
+
+#define SB_BRIDGE_MAGIC             0x53424252  /* "SBBR" */
+
+/*
+ * Event IDs
+ */
+#define SB_BRIDGE_INIT_INF_EID      1
+#define SB_BRIDGE_SHM_ERR_EID       2
+#define SB_BRIDGE_NO_SLOT_ERR_EID   3
+#define SB_BRIDGE_PIPE_ERR_EID      4
+#define SB_BRIDGE_SUB_ERR_EID       5
+#define SB_BRIDGE_TOO_BIG_ERR_EID   6
+#define SB_BRIDGE_LOST_INF_EID      7
+
+/*
+ * Full memory barrier, the rings are shared with other processes
+ */
+#define SB_BRIDGE_BARRIER()         __sync_synchronize()
+
+/*
+ * One message of a ring.  Seq is odd while the writer fills the slot and
+ * (2 * n + 2) once it holds the n'th message written to the ring.
+ */
+typedef struct
+{
+    volatile uint32 Seq;
+    uint32          Size;
+    uint8           Data[SB_BRIDGE_SLOT_SIZE];
+} SB_Bridge_Slot_t;
+
+/*
+ * The region of the segment owned by one instance
+ */
+typedef struct
+{
+    volatile uint32  Owner;     /**< Processor ID of the owning instance plus one, 0 if free */
+    volatile uint32  SubGen;    /**< Incremented on every change of SubMap */
+    volatile uint32  SubMap[SB_BRIDGE_SUBMAP_WORDS];
+    volatile uint32  Head;      /**< Number of messages written to the ring */
+    SB_Bridge_Slot_t Slot[SB_BRIDGE_RING_SLOTS];
+} SB_Bridge_Instance_t;
+
+typedef struct
+{
+    volatile uint32      Magic;     /**< Set once the segment is initialized */
+    volatile uint32      Size;      /**< Claimed by the instance initializing the segment */
+    SB_Bridge_Instance_t Instance[SB_BRIDGE_MAX_INSTANCES];
+} SB_Bridge_Shm_t;
+
+/*
+ * Local state of the bridge app
+ */
+typedef struct
+{
+    CFE_ES_ResourceID_t   AppId;    /**< Sender of what the bridge injects, see SB_Bridge_IsEcho */
+
+    SB_Bridge_Shm_t      *Shm;
+    SB_Bridge_Instance_t *Self;
+    uint32                SelfIdx;
+
+    CFE_SB_PipeId_t       DataPipe;
+    CFE_SB_PipeId_t       SubPipe;
+
+    /* the global subscriptions of this instance, being collected */
+    uint32                Staging[SB_BRIDGE_SUBMAP_WORDS];
+
+    /* what the bridge subscribes to locally, on behalf of the others */
+    uint32                Subscribed[SB_BRIDGE_SUBMAP_WORDS];
+    uint32                LastSubGen[SB_BRIDGE_MAX_INSTANCES];
+    uint32                LastOwner[SB_BRIDGE_MAX_INSTANCES];
+
+    /* read position in the ring of each other instance */
+    uint32                Next[SB_BRIDGE_MAX_INSTANCES];
+
+    uint32                Forwarded;
+    uint32                Received;
+    uint32                Lost;
+    uint32                TooBig;
+} SB_Bridge_Global_t;
+
+extern SB_Bridge_Global_t SB_Bridge;
+
+/*
+ * Functions
+ */
+
+void   SB_Bridge_AppMain(void);
+
+int32  SB_Bridge_ShmAttach(void);
+void   SB_Bridge_ShmDetach(void);
+void   SB_Bridge_RingWrite(const CFE_SB_Msg_t *MsgPtr, uint32 Size);
+void   SB_Bridge_RingReadAll(void);
+void   SB_Bridge_PublishSubs(const uint32 *SubMap);
+void   SB_Bridge_SyncRemoteSubs(void);
+
+#endif /* SB_BRIDGE_H */
@@ -0,0 +1,261 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: sb_bridge_main.c
+**
+** Purpose:
+**   Main loop of the Software Bus shared memory bridge.
+**
+**   The global subscriptions of this instance are learned through the SB
+**   subscription reports (the interface SBN uses), so the bridge must not
+**   be run together with SBN on the same instance.
+**
+**   Each connected instance loads the bridge from its startup script:
+**
+**     CFE_APP, /cf/cfe_sbbridge.so, SB_Bridge_AppMain, SB_BRIDGE, 60, 16384, 0x0, 0;
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include <string.h>
+
+#include "sb_bridge.h"
+
+SB_Bridge_Global_t SB_Bridge;
+
+/*
+ * Send a command to the SB subscription reporting interface
+ */
+static void SB_Bridge_SendSubRptCmd(uint16 CmdCode)
+{
+    CFE_SB_CmdHdr_t Cmd;
+
+    CFE_SB_InitMsg(&Cmd, CFE_SB_ValueToMsgId(CFE_SB_SUB_RPT_CTRL_MID), sizeof(Cmd), true);
+    CFE_SB_SetCmdCode((CFE_SB_Msg_t *)&Cmd, CmdCode);
+    CFE_SB_SendMsg((CFE_SB_Msg_t *)&Cmd);
+}
+
+/*
+ * Set the bit of a MsgId in a subscription map
+ */
+static void SB_Bridge_SetSub(uint32 *SubMap, CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgId_Atom_t Value = CFE_SB_MsgIdToValue(MsgId);
+
+    if (CFE_SB_IsValidMsgId(MsgId) && (Value <= CFE_PLATFORM_SB_HIGHEST_VALID_MSGID))
+    {
+        SubMap[Value / 32] |= (1U << (Value % 32));
+    }
+}
+
+/*
+ * Handle a subscription report of this instance.  Every report adds to the
+ * published map right away, a list (from CFE_SB_SubscribeMany or a part of
+ * the complete list) as well as a single one; the complete list requested
+ * every resync period replaces it, see SB_Bridge_Resync.
+ */
+static void SB_Bridge_ProcessSubRpt(CFE_SB_Msg_t *MsgPtr)
+{
+    CFE_SB_SingleSubscriptionTlm_t *OnePtr;
+    CFE_SB_AllSubscriptionsTlm_t   *AllPtr;
+    uint32                          SubMap[SB_BRIDGE_SUBMAP_WORDS];
+    uint32                          i;
+
+    if (CFE_SB_MsgId_Equal(CFE_SB_GetMsgId(MsgPtr), CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID)))
+    {
+        OnePtr = (CFE_SB_SingleSubscriptionTlm_t *)MsgPtr;
+        if (OnePtr->Payload.SubType == CFE_SB_SUBSCRIPTION)
+        {
+            memcpy(SubMap, (const void *)SB_Bridge.Self->SubMap, sizeof(SubMap));
+            SB_Bridge_SetSub(SubMap, OnePtr->Payload.MsgId);
+            SB_Bridge_SetSub(SB_Bridge.Staging, OnePtr->Payload.MsgId);
+            SB_Bridge_PublishSubs(SubMap);
+        }
+    }
+    else
+    {
+        AllPtr = (CFE_SB_AllSubscriptionsTlm_t *)MsgPtr;
+        memcpy(SubMap, (const void *)SB_Bridge.Self->SubMap, sizeof(SubMap));
+        for (i = 0; (i < AllPtr->Payload.Entries) && (i < CFE_SB_SUB_ENTRIES_PER_PKT); ++i)
+        {
+            SB_Bridge_SetSub(SubMap, AllPtr->Payload.Entry[i].MsgId);
+            SB_Bridge_SetSub(SB_Bridge.Staging, AllPtr->Payload.Entry[i].MsgId);
+        }
+        SB_Bridge_PublishSubs(SubMap);
+    }
+}
+
+/*
+ * Publish the subscriptions collected since the last resync and ask SB
+ * for the complete list again.  Nothing comes back when there are no
+ * global subscriptions, so the list cannot be published on its last
+ * segment; it is published one resync period later instead.
+ */
+static void SB_Bridge_Resync(bool First)
+{
+    if (!First)
+    {
+        SB_Bridge_PublishSubs(SB_Bridge.Staging);
+    }
+
+    memset(SB_Bridge.Staging, 0, sizeof(SB_Bridge.Staging));
+    SB_Bridge_SendSubRptCmd(CFE_SB_SEND_PREV_SUBS_CC);
+}
+
+/*
+ * Check whether a message read from the data pipe was passed on by the
+ * bridge itself.  Those come back when another instance subscribes to
+ * them as well, and must not be forwarded again.  SB records the sending
+ * app with every buffer, so the bridge knows its own traffic by that.
+ */
+static bool SB_Bridge_IsEcho(const CFE_SB_Msg_t *MsgPtr)
+{
+    CFE_ES_ResourceID_t SenderId;
+
+    return (CFE_SB_GetMsgSender(MsgPtr, SB_Bridge.DataPipe, &SenderId) == CFE_SUCCESS) &&
+           CFE_ES_ResourceID_Equal(SenderId, SB_Bridge.AppId);
+}
+
+static int32 SB_Bridge_Init(void)
+{
+    int32 Status;
+
+    memset(&SB_Bridge, 0, sizeof(SB_Bridge));
+
+    Status = CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("SB Bridge: Error registering for events, RC=0x%08lx\n", (unsigned long)Status);
+        return Status;
+    }
+
+    CFE_ES_GetAppID(&SB_Bridge.AppId);
+
+    Status = CFE_SB_CreatePipe(&SB_Bridge.DataPipe, SB_BRIDGE_PIPE_DEPTH, "SB_BRIDGE_DATA");
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_SB_CreatePipe(&SB_Bridge.SubPipe, SB_BRIDGE_SUB_PIPE_DEPTH, "SB_BRIDGE_SUBS");
+    }
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_SB_SubscribeLocal(CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID), SB_Bridge.SubPipe,
+                                       SB_BRIDGE_SUB_PIPE_DEPTH);
+    }
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_SB_SubscribeLocal(CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID), SB_Bridge.SubPipe,
+                                       SB_BRIDGE_SUB_PIPE_DEPTH);
+    }
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Cannot set up the bridge pipes, RC=0x%08lx", (unsigned long)Status);
+        return Status;
+    }
+
+    Status = SB_Bridge_ShmAttach();
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    SB_Bridge_SendSubRptCmd(CFE_SB_ENABLE_SUB_REPORTING_CC);
+    SB_Bridge_Resync(true);
+
+    CFE_EVS_SendEvent(SB_BRIDGE_INIT_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "SB Bridge attached to %s as instance %lu", SB_BRIDGE_SHM_NAME,
+                      (unsigned long)SB_Bridge.SelfIdx);
+
+    return CFE_SUCCESS;
+}
+
+/*
+ * Entry point for this application
+ */
+void SB_Bridge_AppMain(void)
+{
+    CFE_SB_Msg_t *MsgPtr;
+    uint32        RunStatus = CFE_ES_RunStatus_APP_RUN;
+    uint32        LastResync;
+    int32         Status;
+
+    Status = CFE_ES_RegisterApp();
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("SB Bridge: Error in CFE_ES_RegisterApp(): %08lx\n", (unsigned long)Status);
+        return;
+    }
+
+    if (SB_Bridge_Init() != CFE_SUCCESS)
+    {
+        RunStatus = CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    LastResync = CFE_TIME_GetMET().Seconds;
+
+    while (CFE_ES_RunLoop(&RunStatus))
+    {
+        /* messages of this instance that other instances subscribe to */
+        Status = CFE_SB_RcvMsg(&MsgPtr, SB_Bridge.DataPipe, SB_BRIDGE_POLL_MSEC);
+        while (Status == CFE_SUCCESS)
+        {
+            if (!SB_Bridge_IsEcho(MsgPtr))
+            {
+                SB_Bridge_RingWrite(MsgPtr, CFE_SB_GetTotalMsgLength(MsgPtr));
+            }
+            Status = CFE_SB_RcvMsg(&MsgPtr, SB_Bridge.DataPipe, CFE_SB_POLL);
+        }
+
+        if ((Status != CFE_SB_TIME_OUT) && (Status != CFE_SB_NO_MESSAGE))
+        {
+            CFE_EVS_SendEvent(SB_BRIDGE_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Data pipe read error, RC=0x%08lx", (unsigned long)Status);
+            RunStatus = CFE_ES_RunStatus_APP_ERROR;
+        }
+
+        /* subscription changes, here and on the other instances */
+        while (CFE_SB_RcvMsg(&MsgPtr, SB_Bridge.SubPipe, CFE_SB_POLL) == CFE_SUCCESS)
+        {
+            SB_Bridge_ProcessSubRpt(MsgPtr);
+        }
+
+        SB_Bridge_SyncRemoteSubs();
+
+        /* messages of the other instances */
+        SB_Bridge_RingReadAll();
+
+        if ((CFE_TIME_GetMET().Seconds - LastResync) >= SB_BRIDGE_RESYNC_SEC)
+        {
+            SB_Bridge_Resync(false);
+            LastResync = CFE_TIME_GetMET().Seconds;
+        }
+    }
+
+    if (SB_Bridge.Shm != NULL)
+    {
+        SB_Bridge_SendSubRptCmd(CFE_SB_DISABLE_SUB_REPORTING_CC);
+        SB_Bridge_ShmDetach();
+    }
+
+    CFE_ES_ExitApp(RunStatus);
+}
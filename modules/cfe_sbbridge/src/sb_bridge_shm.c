@@ -0,0 +1,447 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: sb_bridge_shm.c
+**
+** Purpose:
+**   Shared memory segment, message rings and subscription maps of the
+**   Software Bus shared memory bridge.
+**
+**   The segment is a POSIX shared memory object, so this module is only
+**   usable on POSIX hosts.
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "cfe_psp.h"
+
+#include "sb_bridge.h"
+
+/*
+ * Map the segment, creating it if this is the first instance, and claim
+ * the region of this instance.  A restarted instance gets its old region
+ * back, as regions are claimed by processor ID.
+ */
+int32 SB_Bridge_ShmAttach(void)
+{
+    int         fd;
+    void       *Addr;
+    struct stat Stat;
+    uint32      Owner;
+    uint32      i;
+
+    fd = shm_open(SB_BRIDGE_SHM_NAME, O_RDWR | O_CREAT, 0660);
+    if (fd < 0)
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_SHM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Cannot open shared memory %s", SB_BRIDGE_SHM_NAME);
+        return OS_ERROR;
+    }
+
+    if (fstat(fd, &Stat) < 0)
+    {
+        close(fd);
+        CFE_EVS_SendEvent(SB_BRIDGE_SHM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Cannot get the size of shared memory %s", SB_BRIDGE_SHM_NAME);
+        return OS_ERROR;
+    }
+
+    /*
+    ** Only a new object is sized; it is zero filled, which is a valid empty
+    ** segment.  An existing one is left alone, so a differently configured
+    ** instance can not cut it short under the others.
+    */
+    if (Stat.st_size == 0)
+    {
+        if (ftruncate(fd, sizeof(SB_Bridge_Shm_t)) < 0)
+        {
+            close(fd);
+            CFE_EVS_SendEvent(SB_BRIDGE_SHM_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Cannot size shared memory %s to %lu bytes", SB_BRIDGE_SHM_NAME,
+                              (unsigned long)sizeof(SB_Bridge_Shm_t));
+            return OS_ERROR;
+        }
+    }
+    else if ((size_t)Stat.st_size != sizeof(SB_Bridge_Shm_t))
+    {
+        close(fd);
+        CFE_EVS_SendEvent(SB_BRIDGE_SHM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Shared memory %s was created with another configuration", SB_BRIDGE_SHM_NAME);
+        return OS_ERROR;
+    }
+
+    Addr = mmap(NULL, sizeof(SB_Bridge_Shm_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (Addr == MAP_FAILED)
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_SHM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Cannot map shared memory %s", SB_BRIDGE_SHM_NAME);
+        return OS_ERROR;
+    }
+
+    SB_Bridge.Shm = Addr;
+
+    /*
+    ** The first instance claims the segment through its size and publishes
+    ** the magic last, so a segment with the magic set is complete.  The
+    ** others wait for the magic and check they agree on the layout.
+    */
+    if (__sync_bool_compare_and_swap(&SB_Bridge.Shm->Size, 0, sizeof(SB_Bridge_Shm_t)))
+    {
+        SB_BRIDGE_BARRIER();
+        SB_Bridge.Shm->Magic = SB_BRIDGE_MAGIC;
+    }
+    else
+    {
+        for (i = 0; (SB_Bridge.Shm->Magic == 0) && (i < SB_BRIDGE_ATTACH_WAIT_MSEC); ++i)
+        {
+            OS_TaskDelay(1);
+        }
+        SB_BRIDGE_BARRIER();
+    }
+
+    if ((SB_Bridge.Shm->Magic != SB_BRIDGE_MAGIC) || (SB_Bridge.Shm->Size != sizeof(SB_Bridge_Shm_t)))
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_SHM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Shared memory %s was created with another configuration", SB_BRIDGE_SHM_NAME);
+        SB_Bridge_ShmDetach();
+        return OS_ERROR;
+    }
+
+    Owner = CFE_PSP_GetProcessorId() + 1;
+
+    for (i = 0; i < SB_BRIDGE_MAX_INSTANCES; ++i)
+    {
+        if (SB_Bridge.Shm->Instance[i].Owner == Owner)
+        {
+            break;
+        }
+    }
+
+    if (i == SB_BRIDGE_MAX_INSTANCES)
+    {
+        for (i = 0; i < SB_BRIDGE_MAX_INSTANCES; ++i)
+        {
+            if (__sync_bool_compare_and_swap(&SB_Bridge.Shm->Instance[i].Owner, 0, Owner))
+            {
+                break;
+            }
+        }
+    }
+
+    if (i == SB_BRIDGE_MAX_INSTANCES)
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_NO_SLOT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "All %d instance regions of %s are in use", SB_BRIDGE_MAX_INSTANCES,
+                          SB_BRIDGE_SHM_NAME);
+        SB_Bridge_ShmDetach();
+        return OS_ERROR;
+    }
+
+    SB_Bridge.SelfIdx = i;
+    SB_Bridge.Self    = &SB_Bridge.Shm->Instance[i];
+
+    /* nothing this instance subscribes to until the first report comes in */
+    memset((void *)SB_Bridge.Self->SubMap, 0, sizeof(SB_Bridge.Self->SubMap));
+    SB_BRIDGE_BARRIER();
+    SB_Bridge.Self->SubGen++;
+
+    /* start reading the other rings at their current end */
+    for (i = 0; i < SB_BRIDGE_MAX_INSTANCES; ++i)
+    {
+        SB_Bridge.Next[i] = SB_Bridge.Shm->Instance[i].Head;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*
+ * Unmap the segment.  The region stays claimed, so a restart of this
+ * instance finds it again; the segment itself is left for the others.
+ */
+void SB_Bridge_ShmDetach(void)
+{
+    if (SB_Bridge.Shm != NULL)
+    {
+        if (SB_Bridge.Self != NULL)
+        {
+            memset((void *)SB_Bridge.Self->SubMap, 0, sizeof(SB_Bridge.Self->SubMap));
+            SB_BRIDGE_BARRIER();
+            SB_Bridge.Self->SubGen++;
+        }
+
+        munmap(SB_Bridge.Shm, sizeof(SB_Bridge_Shm_t));
+        SB_Bridge.Shm  = NULL;
+        SB_Bridge.Self = NULL;
+    }
+}
+
+/*
+ * Append a message to the ring of this instance
+ */
+void SB_Bridge_RingWrite(const CFE_SB_Msg_t *MsgPtr, uint32 Size)
+{
+    SB_Bridge_Slot_t *SlotPtr;
+    uint32            n;
+
+    if (Size > SB_BRIDGE_SLOT_SIZE)
+    {
+        if (SB_Bridge.TooBig++ == 0)
+        {
+            CFE_EVS_SendEvent(SB_BRIDGE_TOO_BIG_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Msg 0x%x of %lu bytes is too big to bridge, max %lu",
+                              (unsigned int)CFE_SB_MsgIdToValue(CFE_SB_GetMsgId((CFE_SB_Msg_t *)MsgPtr)),
+                              (unsigned long)Size, (unsigned long)SB_BRIDGE_SLOT_SIZE);
+        }
+        return;
+    }
+
+    n       = SB_Bridge.Self->Head;
+    SlotPtr = &SB_Bridge.Self->Slot[n % SB_BRIDGE_RING_SLOTS];
+
+    /* readers discard the slot while its sequence is odd or not the one they expect */
+    SlotPtr->Seq = (2 * n) + 1;
+    SB_BRIDGE_BARRIER();
+
+    memcpy(SlotPtr->Data, MsgPtr, Size);
+    SlotPtr->Size = Size;
+    SB_BRIDGE_BARRIER();
+
+    SlotPtr->Seq = (2 * n) + 2;
+    SB_BRIDGE_BARRIER();
+
+    SB_Bridge.Self->Head = n + 1;
+
+    ++SB_Bridge.Forwarded;
+}
+
+/*
+ * Pass one message of another instance on to the local bus.  The slot is
+ * copied into an SB buffer and only passed on if the writer did not start
+ * to overwrite it meanwhile.
+ */
+static void SB_Bridge_RingReadSlot(SB_Bridge_Slot_t *SlotPtr, uint32 Seq)
+{
+    CFE_SB_Msg_t           *BufPtr;
+    CFE_SB_ZeroCopyHandle_t BufferHandle;
+    uint32                  Size;
+
+    Size = SlotPtr->Size;
+    if ((Size < sizeof(CFE_SB_Msg_t)) || (Size > SB_BRIDGE_SLOT_SIZE))
+    {
+        ++SB_Bridge.Lost;
+        return;
+    }
+
+    BufPtr = CFE_SB_ZeroCopyGetPtr(Size, &BufferHandle);
+    if (BufPtr == NULL)
+    {
+        ++SB_Bridge.Lost;
+        return;
+    }
+
+    memcpy(BufPtr, SlotPtr->Data, Size);
+    SB_BRIDGE_BARRIER();
+
+    if (SlotPtr->Seq != Seq)
+    {
+        CFE_SB_ZeroCopyReleasePtr(BufPtr, BufferHandle);
+        ++SB_Bridge.Lost;
+        return;
+    }
+
+    /*
+    ** Passed, so the sequence count of the sending instance is kept.  SB
+    ** records the bridge as the sender, which is how the data pipe tells
+    ** the message apart if it comes back, see SB_Bridge_IsEcho.
+    */
+    if (CFE_SB_ZeroCopyPass(BufPtr, BufferHandle) == CFE_SUCCESS)
+    {
+        ++SB_Bridge.Received;
+    }
+}
+
+/*
+ * Pass on everything written to the rings of the other instances since the
+ * last call
+ */
+void SB_Bridge_RingReadAll(void)
+{
+    SB_Bridge_Instance_t *InstPtr;
+    SB_Bridge_Slot_t     *SlotPtr;
+    uint32                LostBefore = SB_Bridge.Lost;
+    uint32                Head;
+    uint32                Seq;
+    uint32                i;
+
+    for (i = 0; i < SB_BRIDGE_MAX_INSTANCES; ++i)
+    {
+        InstPtr = &SB_Bridge.Shm->Instance[i];
+        if ((i == SB_Bridge.SelfIdx) || (InstPtr->Owner == 0))
+        {
+            continue;
+        }
+
+        Head = InstPtr->Head;
+        SB_BRIDGE_BARRIER();
+
+        /* skip what was overwritten while this reader was away */
+        if ((Head - SB_Bridge.Next[i]) > SB_BRIDGE_RING_SLOTS)
+        {
+            SB_Bridge.Lost += (Head - SB_Bridge.Next[i]) - SB_BRIDGE_RING_SLOTS;
+            SB_Bridge.Next[i] = Head - SB_BRIDGE_RING_SLOTS;
+        }
+
+        while (SB_Bridge.Next[i] != Head)
+        {
+            SlotPtr = &InstPtr->Slot[SB_Bridge.Next[i] % SB_BRIDGE_RING_SLOTS];
+            Seq     = (2 * SB_Bridge.Next[i]) + 2;
+
+            if (SlotPtr->Seq == Seq)
+            {
+                SB_BRIDGE_BARRIER();
+                SB_Bridge_RingReadSlot(SlotPtr, Seq);
+            }
+            else
+            {
+                ++SB_Bridge.Lost;
+            }
+
+            ++SB_Bridge.Next[i];
+        }
+    }
+
+    if ((LostBefore == 0) && (SB_Bridge.Lost != 0))
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_LOST_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Messages from other instances lost, reader fell behind");
+    }
+}
+
+/*
+ * Publish the global subscriptions of this instance
+ */
+void SB_Bridge_PublishSubs(const uint32 *SubMap)
+{
+    if (memcmp((const void *)SB_Bridge.Self->SubMap, SubMap, sizeof(SB_Bridge.Self->SubMap)) != 0)
+    {
+        memcpy((void *)SB_Bridge.Self->SubMap, SubMap, sizeof(SB_Bridge.Self->SubMap));
+        SB_BRIDGE_BARRIER();
+        SB_Bridge.Self->SubGen++;
+    }
+}
+
+/*
+ * Subscribe the data pipe, locally, to everything any other instance
+ * subscribes to globally, and drop what none of them wants anymore.
+ * The subscriptions are local so they are not reported back to the
+ * other instances.
+ */
+void SB_Bridge_SyncRemoteSubs(void)
+{
+    SB_Bridge_Instance_t *InstPtr;
+    uint32                Wanted[SB_BRIDGE_SUBMAP_WORDS];
+    uint32                Changed = 0;
+    uint32                Diff;
+    uint32                Value;
+    uint32                i;
+    uint32                w;
+    int32                 Status;
+
+    for (i = 0; i < SB_BRIDGE_MAX_INSTANCES; ++i)
+    {
+        InstPtr = &SB_Bridge.Shm->Instance[i];
+        if ((InstPtr->SubGen != SB_Bridge.LastSubGen[i]) || (InstPtr->Owner != SB_Bridge.LastOwner[i]))
+        {
+            SB_Bridge.LastSubGen[i] = InstPtr->SubGen;
+            SB_Bridge.LastOwner[i]  = InstPtr->Owner;
+            ++Changed;
+        }
+    }
+
+    if (Changed == 0)
+    {
+        return;
+    }
+
+    SB_BRIDGE_BARRIER();
+
+    memset(Wanted, 0, sizeof(Wanted));
+    for (i = 0; i < SB_BRIDGE_MAX_INSTANCES; ++i)
+    {
+        InstPtr = &SB_Bridge.Shm->Instance[i];
+        if ((i != SB_Bridge.SelfIdx) && (InstPtr->Owner != 0))
+        {
+            for (w = 0; w < SB_BRIDGE_SUBMAP_WORDS; ++w)
+            {
+                Wanted[w] |= InstPtr->SubMap[w];
+            }
+        }
+    }
+
+    for (w = 0; w < SB_BRIDGE_SUBMAP_WORDS; ++w)
+    {
+        Diff = Wanted[w] ^ SB_Bridge.Subscribed[w];
+
+        for (i = 0; Diff != 0; ++i, Diff >>= 1)
+        {
+            if ((Diff & 1) == 0)
+            {
+                continue;
+            }
+
+            Value = (w * 32) + i;
+            if (Value > CFE_PLATFORM_SB_HIGHEST_VALID_MSGID)
+            {
+                break;
+            }
+
+            if (Wanted[w] & (1U << i))
+            {
+                Status = CFE_SB_SubscribeLocal(CFE_SB_ValueToMsgId(Value), SB_Bridge.DataPipe,
+                                               CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT);
+            }
+            else
+            {
+                Status = CFE_SB_UnsubscribeLocal(CFE_SB_ValueToMsgId(Value), SB_Bridge.DataPipe);
+            }
+
+            if (Status == CFE_SUCCESS)
+            {
+                SB_Bridge.Subscribed[w] ^= (1U << i);
+            }
+            else
+            {
+                CFE_EVS_SendEvent(SB_BRIDGE_SUB_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Cannot update subscription to Msg 0x%x, RC=0x%08lx", (unsigned int)Value,
+                                  (unsigned long)Status);
+            }
+        }
+    }
+}